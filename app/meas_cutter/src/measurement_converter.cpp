@@ -225,7 +225,7 @@ bool MeasurementConverter::convert()
 
     try
     {
-      _importer.openChannel(channel_name);
+      _importer.openChannel(channel_name, _calculated_start_timestamp, _calculated_end_timestamp);
       auto channel_info = _importer.getChannelInfoforCurrentChannel();
       auto timestamps = _importer.getTimestamps();
       auto timestamp_begin_iter = timestamps.lower_bound(_calculated_start_timestamp);
@@ -62,7 +62,7 @@ bool MeasurementImporter::hasChannel(const std::string& channel_name) const
   return _reader->HasChannel(channel_name);
 }
 
-void MeasurementImporter::openChannel(const std::string& channel_name)
+void MeasurementImporter::openChannel(const std::string& channel_name, eCALMeasCutterUtils::Timestamp start_timestamp, eCALMeasCutterUtils::Timestamp end_timestamp)
 {
   _current_opened_channel_data._timestamps.clear();
   _current_opened_channel_data._timestamp_entry_info_map.clear();
@@ -80,8 +80,12 @@ void MeasurementImporter::openChannel(const std::string& channel_name)
   _current_opened_channel_data._channel_info.description = channel_information.descriptor;
   _current_opened_channel_data._channel_info.name = channel_name;
 
+  // With a time index, only the entries of the requested time range are read
   eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-  _reader->GetEntriesInfo(channel_name, entry_info_set);
+  if (_reader->HasTimeIndex(channel_name))
+    _reader->GetEntriesInfoRange(channel_name, start_timestamp, end_timestamp, entry_info_set);
+  else
+    _reader->GetEntriesInfo(channel_name, entry_info_set);
 
   for (const auto& entry_info : entry_info_set)
   {
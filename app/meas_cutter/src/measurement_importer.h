@@ -43,7 +43,7 @@ public:
   void                                                                                    setPath(const std::string& path);
   eCALMeasCutterUtils::ChannelNameSet                                                     getChannelNames() const;
   bool                                                                                    hasChannel(const std::string& channel_name) const;
-  void                                                                                    openChannel(const std::string& channel_name);
+  void                                                                                    openChannel(const std::string& channel_name, eCALMeasCutterUtils::Timestamp start_timestamp, eCALMeasCutterUtils::Timestamp end_timestamp);
   eCALMeasCutterUtils::ChannelInfo                                                        getChannelInfoforCurrentChannel() const;
   eCALMeasCutterUtils::TimestampSet                                                       getTimestamps() const;
   void                                                                                    getData(eCALMeasCutterUtils::Timestamp timestamp, eCALMeasCutterUtils::MetaData& meta_data, std::string& data);
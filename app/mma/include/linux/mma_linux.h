@@ -31,7 +31,7 @@
 
 #include "../include/mma_impl.h"
 #include "../include/linux/ressource.h"
-#include "../include/linux/pipe_refresher.h"
+#include "../include/linux/proc_refresher.h"
 #include <ecal/app/pb/mma/mma.pb.h>
 
 #pragma once
@@ -169,10 +169,10 @@ class MMALinux : public MMAImpl
   bool SetDiskIOInformation(ResourceLinux::DiskStatsList& disk_stats_info);
   std::string GetArmvcgencmd();
   
-  std::unique_ptr<PipeRefresher> cpu_pipe_;
-  std::unique_ptr<PipeRefresher> network_pipe_;
-  std::unique_ptr<PipeRefresher> disk_pipe_;
-  std::unique_ptr<PipeRefresher> process_pipe_;
+  std::unique_ptr<ProcRefresher> cpu_pipe_;
+  std::unique_ptr<ProcRefresher> network_pipe_;
+  std::unique_ptr<ProcRefresher> disk_pipe_;
+  std::unique_ptr<ProcRefresher> process_pipe_;
 };
 
 #endif  // __unix__
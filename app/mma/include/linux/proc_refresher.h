@@ -0,0 +1,134 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#ifdef __unix__
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <sys/types.h>
+
+/**
+ * @brief A single /proc file
+ *
+ * The file descriptor is kept open, every Read re-reads the file from offset 0
+ * with pread, so sampling does not need any open / close (or shell) calls.
+ * If the descriptor is not kept open (keep_open == false, or because the
+ * process ran out of file descriptors) the file is opened and closed for
+ * every read instead.
+ */
+class ProcFile
+{
+ public:
+  explicit ProcFile(const std::string& path, bool keep_open = true);
+  ~ProcFile();
+
+  ProcFile(const ProcFile&) = delete;
+  ProcFile& operator=(const ProcFile&) = delete;
+  ProcFile(ProcFile&& other) noexcept;
+  ProcFile& operator=(ProcFile&& other) noexcept;
+
+  // appends the file content to content, returns false if the file cannot be read (anymore)
+  bool AppendTo(std::string& content) const;
+
+  // true if the file descriptor is kept open
+  bool IsOpen() const { return fd_ >= 0; }
+
+ private:
+  static bool ReadAll(int fd, std::string& content);
+
+  std::string path_;
+  int fd_;
+};
+
+/**
+ * @brief Table of the /proc/<pid>/stat files of all running processes
+ *
+ * The stat files of known processes stay open between two reads, only the
+ * files of new processes are opened and the files of processes that are gone
+ * are closed. The result contains one stat line per process.
+ *
+ * At most max_open_files descriptors are kept open, so a machine with many
+ * processes cannot exhaust the file descriptors of the agent. The stat files
+ * of all further processes are opened and closed for every read.
+ */
+class ProcStatTable
+{
+ public:
+  explicit ProcStatTable(size_t max_open_files = DefaultMaxOpenFiles());
+
+  bool Read(std::string& content);
+
+  // number of stat files, that are currently kept open
+  size_t OpenFileCount() const { return open_files_; }
+
+  // a quarter of the soft RLIMIT_NOFILE, the rest is left to the rest of the process
+  static size_t DefaultMaxOpenFiles();
+
+ private:
+  struct StatFile
+  {
+    ProcFile file;
+    uint64_t generation;
+  };
+
+  ProcFile OpenStatFile(const char* pid);
+  void     CloseStatFile(const StatFile& stat_file);
+
+  std::unordered_map<pid_t, StatFile> stat_files_;
+  uint64_t generation_ = 0;
+  size_t   max_open_files_;
+  size_t   open_files_ = 0;
+};
+
+class ProcRefresher
+{
+ public:
+  typedef std::function<bool(std::string&)> ReadFunction;
+
+  // periodically reads the given /proc file
+  explicit ProcRefresher(const std::string& path, uint32_t frequency = 1);
+  // periodically calls read_function, name is handed over to the callback
+  ProcRefresher(const std::string& name, ReadFunction read_function, uint32_t frequency = 1);
+  ~ProcRefresher();
+
+  typedef std::function<void(const std::string&, const std::string&)> MethodCallback;
+  void AddCallback(MethodCallback callback);
+  void RemoveCallback();
+
+ private:
+  MethodCallback callback_;
+  std::string name_;
+  ReadFunction read_function_;
+
+  std::atomic<bool> can_send_;
+  uint32_t frequency_;
+
+  std::thread thread_;
+
+  void FunctionCallback();
+};
+#endif
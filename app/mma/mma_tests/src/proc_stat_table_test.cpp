@@ -0,0 +1,148 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <linux/proc_refresher.h>
+
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+  // number of file descriptors of the test process
+  size_t CountOpenFiles()
+  {
+    size_t count = 0;
+    DIR* fd_dir = opendir("/proc/self/fd");
+    if (fd_dir == nullptr) return 0;
+    while (readdir(fd_dir) != nullptr) count++;
+    closedir(fd_dir);
+    return count;
+  }
+
+  bool ContainsProcess(const std::string& content, pid_t pid)
+  {
+    const std::string line_start = std::to_string(pid) + " (";
+    return (content.compare(0, line_start.size(), line_start) == 0)
+        || (content.find("\n" + line_start) != std::string::npos);
+  }
+
+  // child processes, that live until they are stopped
+  class Children
+  {
+  public:
+    explicit Children(size_t count)
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+          pause();
+          _exit(0);
+        }
+        if (pid > 0) pids_.push_back(pid);
+      }
+    }
+
+    ~Children() { Stop(); }
+
+    void Stop()
+    {
+      for (const pid_t pid : pids_)
+      {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+      }
+      stopped_ = pids_;
+      pids_.clear();
+    }
+
+    const std::vector<pid_t>& Running() const { return pids_; }
+    const std::vector<pid_t>& Stopped() const { return stopped_; }
+
+  private:
+    std::vector<pid_t> pids_;
+    std::vector<pid_t> stopped_;
+  };
+}
+
+TEST(ProcStatTable, DefaultBudgetBelowLimit)
+{
+  struct rlimit limit {};
+  ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+  EXPECT_LT(ProcStatTable::DefaultMaxOpenFiles(), limit.rlim_cur);
+}
+
+TEST(ProcStatTable, ReadsAllProcessesBeyondBudget)
+{
+  const size_t max_open_files = 2;
+  Children children(8);
+  ASSERT_EQ(children.Running().size(), 8u);
+
+  ProcStatTable stat_table(max_open_files);
+  const size_t open_files_before = CountOpenFiles();
+
+  std::string content;
+  ASSERT_TRUE(stat_table.Read(content));
+  EXPECT_EQ(stat_table.OpenFileCount(), max_open_files);
+  EXPECT_EQ(CountOpenFiles(), open_files_before + max_open_files);
+
+  // the processes beyond the budget are read with open / read / close
+  EXPECT_TRUE(ContainsProcess(content, getpid()));
+  for (const pid_t pid : children.Running())
+    EXPECT_TRUE(ContainsProcess(content, pid)) << "pid " << pid;
+
+  // the budget holds for further reads as well
+  ASSERT_TRUE(stat_table.Read(content));
+  EXPECT_EQ(stat_table.OpenFileCount(), max_open_files);
+  EXPECT_EQ(CountOpenFiles(), open_files_before + max_open_files);
+
+  // the files of processes that are gone are closed and free the budget again
+  children.Stop();
+  ASSERT_TRUE(stat_table.Read(content));
+  for (const pid_t pid : children.Stopped())
+    EXPECT_FALSE(ContainsProcess(content, pid)) << "pid " << pid;
+  EXPECT_LE(stat_table.OpenFileCount(), max_open_files);
+  EXPECT_EQ(CountOpenFiles(), open_files_before + stat_table.OpenFileCount());
+}
+
+TEST(ProcStatTable, ZeroBudget)
+{
+  Children children(2);
+  ProcStatTable stat_table(0);
+  const size_t open_files_before = CountOpenFiles();
+
+  std::string content;
+  ASSERT_TRUE(stat_table.Read(content));
+  EXPECT_EQ(stat_table.OpenFileCount(), 0u);
+  EXPECT_EQ(CountOpenFiles(), open_files_before);
+
+  EXPECT_TRUE(ContainsProcess(content, getpid()));
+  for (const pid_t pid : children.Running())
+    EXPECT_TRUE(ContainsProcess(content, pid)) << "pid " << pid;
+}
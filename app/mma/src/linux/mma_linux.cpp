@@ -18,7 +18,7 @@
 */
 
 #include "ecal/app/pb/mma/mma.pb.h"
-#include "linux/pipe_refresher.h"
+#include "linux/proc_refresher.h"
 #include "linux/ressource.h"
 #include <cstddef>
 #include <cstdint>
@@ -49,19 +49,20 @@
 #define B_IN_KB 1024.0
 #define B_IN_MB 1048576.0
 
-#define MMA_CPU_CMD "cat /proc/uptime"
-#define MMA_NET_CMD "cat /proc/net/dev"
-#define MMA_DISK_CMD "cat /proc/diskstats"
-#define MMA_PS_CMD "cat /proc/[0-9]*/stat 2>/dev/null"
+#define MMA_CPU_FILE "/proc/uptime"
+#define MMA_NET_FILE "/proc/net/dev"
+#define MMA_DISK_FILE "/proc/diskstats"
+#define MMA_PS_FILES "/proc/[0-9]*/stat"
 
 MMALinux::MMALinux():
   nr_of_cpu_cores_(GetCpuCores()),
   page_size_(sysconf(_SC_PAGE_SIZE)),
   ticks_per_second_(sysconf(_SC_CLK_TCK)),
-  cpu_pipe_(std::make_unique<PipeRefresher>(MMA_CPU_CMD,500)),
-  network_pipe_(std::make_unique<PipeRefresher>(MMA_NET_CMD,500)),
-  disk_pipe_(std::make_unique<PipeRefresher>(MMA_DISK_CMD,500)),
-  process_pipe_(std::make_unique<PipeRefresher>(MMA_PS_CMD,500))
+  cpu_pipe_(std::make_unique<ProcRefresher>(MMA_CPU_FILE,500)),
+  network_pipe_(std::make_unique<ProcRefresher>(MMA_NET_FILE,500)),
+  disk_pipe_(std::make_unique<ProcRefresher>(MMA_DISK_FILE,500)),
+  process_pipe_(std::make_unique<ProcRefresher>(MMA_PS_FILES,
+    [table = std::make_shared<ProcStatTable>()](std::string& content) { return table->Read(content); }, 500))
 {
   cpu_pipe_->AddCallback(std::bind(&MMALinux::OnDataReceived, this, std::placeholders::_1, std::placeholders::_2));
   network_pipe_->AddCallback(std::bind(&MMALinux::OnDataReceived, this, std::placeholders::_1, std::placeholders::_2));
@@ -79,22 +80,22 @@ MMALinux::~MMALinux()
 void MMALinux::OnDataReceived(const std::string& pipe_result, const std::string& command)
 {
   const std::lock_guard<std::mutex> guard(mutex_);
-  if (command == MMA_CPU_CMD)
+  if (command == MMA_CPU_FILE)
   {
     cpu_pipe_result_ = pipe_result;
     cpu_pipe_count_++;
   }
-  else if (command == MMA_NET_CMD)
+  else if (command == MMA_NET_FILE)
   {
     network_pipe_result_ = pipe_result;
     network_pipe_count_++;
   }
-  else if (command == MMA_DISK_CMD)
+  else if (command == MMA_DISK_FILE)
   {
     disk_pipe_result_ = pipe_result;
     disk_pipe_count_++;
   }
-  else if (command == MMA_PS_CMD)
+  else if (command == MMA_PS_FILES)
   {
     process_pipe_result_ = pipe_result;
     process_pipe_count_++;
@@ -447,8 +448,7 @@ bool MMALinux::FormatListData(std::vector<std::string>& the_list)
     {
       if (root_dev_.empty())
       {
-        std::string result;
-        OpenPipe("cat /proc/cmdline", result);
+        std::string result = FileToString("/proc/cmdline");
         std::size_t found = result.find("root=");
         result = result.substr(found + 5);
         found = result.find(' ');
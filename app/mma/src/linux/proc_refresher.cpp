@@ -0,0 +1,288 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#ifdef __unix__
+
+#include <algorithm>
+#include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "../include/linux/proc_refresher.h"
+
+namespace
+{
+  const size_t read_chunk_size = 4096;
+
+  bool ParsePid(const char* name, pid_t& pid)
+  {
+    pid_t value = 0;
+    if (*name == '\0') return false;
+    for (; *name != '\0'; ++name)
+    {
+      if ((*name < '0') || (*name > '9')) return false;
+      value = value * 10 + (*name - '0');
+    }
+    pid = value;
+    return true;
+  }
+
+  std::string StatPath(const char* pid)
+  {
+    return "/proc/" + std::string(pid) + "/stat";
+  }
+}
+
+////////////////////////////////////////
+// ProcFile
+////////////////////////////////////////
+ProcFile::ProcFile(const std::string& path, bool keep_open /*= true*/)
+  : path_(path)
+  , fd_(keep_open ? open(path.c_str(), O_RDONLY | O_CLOEXEC) : -1)
+{
+}
+
+ProcFile::~ProcFile()
+{
+  if (fd_ >= 0)
+  {
+    close(fd_);
+  }
+}
+
+ProcFile::ProcFile(ProcFile&& other) noexcept
+  : path_(std::move(other.path_))
+  , fd_(other.fd_)
+{
+  other.fd_ = -1;
+}
+
+ProcFile& ProcFile::operator=(ProcFile&& other) noexcept
+{
+  if (this != &other)
+  {
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+    path_ = std::move(other.path_);
+    fd_ = other.fd_;
+    other.fd_ = -1;
+  }
+  return *this;
+}
+
+bool ProcFile::AppendTo(std::string& content) const
+{
+  if (fd_ >= 0)
+  {
+    return ReadAll(fd_, content);
+  }
+
+  // no descriptor available, fall back to a one-shot read
+  const int fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    return false;
+  }
+  const bool success = ReadAll(fd, content);
+  close(fd);
+  return success;
+}
+
+bool ProcFile::ReadAll(int fd, std::string& content)
+{
+  // /proc files are regenerated on every read from offset 0,
+  // so the content is read directly into the (reused) string memory
+  const size_t start = content.size();
+  size_t offset = 0;
+  for (;;)
+  {
+    content.resize(start + offset + read_chunk_size);
+    const ssize_t bytes = pread(fd, &content[start + offset], read_chunk_size, static_cast<off_t>(offset));
+    if (bytes < 0)
+    {
+      if (errno == EINTR) continue;
+      content.resize(start);
+      return false;
+    }
+    if (bytes == 0) break;
+    offset += static_cast<size_t>(bytes);
+  }
+  content.resize(start + offset);
+  return offset > 0;
+}
+
+////////////////////////////////////////
+// ProcStatTable
+////////////////////////////////////////
+ProcStatTable::ProcStatTable(size_t max_open_files /*= DefaultMaxOpenFiles()*/)
+  : max_open_files_(max_open_files)
+{
+}
+
+size_t ProcStatTable::DefaultMaxOpenFiles()
+{
+  struct rlimit limit {};
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+  {
+    return 0;
+  }
+  // RLIM_INFINITY is the largest rlim_t value, so it is capped as well
+  const rlim_t max_open_files = std::min<rlim_t>(limit.rlim_cur / 4, 4096);
+  return static_cast<size_t>(max_open_files);
+}
+
+ProcFile ProcStatTable::OpenStatFile(const char* pid)
+{
+  ProcFile file(StatPath(pid), open_files_ < max_open_files_);
+  if (file.IsOpen())
+    open_files_++;
+  return file;
+}
+
+void ProcStatTable::CloseStatFile(const StatFile& stat_file)
+{
+  if (stat_file.file.IsOpen())
+    open_files_--;
+}
+
+bool ProcStatTable::Read(std::string& content)
+{
+  content.clear();
+
+  DIR* proc_dir = opendir("/proc");
+  if (proc_dir == nullptr)
+  {
+    return false;
+  }
+
+  generation_++;
+  struct dirent* entry = nullptr;
+  while ((entry = readdir(proc_dir)) != nullptr)
+  {
+    pid_t pid = 0;
+    if (!ParsePid(entry->d_name, pid)) continue;
+
+    bool appended = false;
+    auto iter = stat_files_.find(pid);
+    if (iter != stat_files_.end())
+    {
+      appended = iter->second.file.AppendTo(content);
+      // the process is gone, but its pid has been reused by a new process in the meantime
+      if (!appended)
+      {
+        CloseStatFile(iter->second);
+        iter->second.file = OpenStatFile(entry->d_name);
+      }
+    }
+    else
+    {
+      // new process
+      iter = stat_files_.emplace(pid, StatFile{ OpenStatFile(entry->d_name), 0 }).first;
+    }
+
+    if (appended || iter->second.file.AppendTo(content))
+      iter->second.generation = generation_;
+  }
+  closedir(proc_dir);
+
+  // close the stat files of all processes that are gone
+  for (auto iter = stat_files_.begin(); iter != stat_files_.end();)
+  {
+    if (iter->second.generation != generation_)
+    {
+      CloseStatFile(iter->second);
+      iter = stat_files_.erase(iter);
+    }
+    else
+      ++iter;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////
+// ProcRefresher
+////////////////////////////////////////
+ProcRefresher::ProcRefresher(const std::string& path, uint32_t frequency /*= 1*/)
+  : ProcRefresher(path,
+                  [file = std::make_shared<ProcFile>(path)](std::string& content)
+                  {
+                    content.clear();
+                    return file->AppendTo(content);
+                  },
+                  frequency)
+{
+}
+
+ProcRefresher::ProcRefresher(const std::string& name, ReadFunction read_function, uint32_t frequency /*= 1*/)
+  : name_(name)
+  , read_function_(std::move(read_function))
+  , frequency_(frequency)
+{
+  can_send_ = true;
+  thread_ = std::thread(&ProcRefresher::FunctionCallback, this);
+}
+
+ProcRefresher::~ProcRefresher()
+{
+  can_send_ = false;
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+}
+
+void ProcRefresher::AddCallback(MethodCallback callback)
+{
+  callback_ = callback;
+}
+
+void ProcRefresher::RemoveCallback()
+{
+  callback_ = nullptr;
+}
+
+void ProcRefresher::FunctionCallback()
+{
+  // the buffer is reused, so the steady state sampling does not allocate
+  std::string result;
+  while (can_send_)
+  {
+    if (callback_ != nullptr)
+    {
+      if (!read_function_(result))
+        result.clear();
+      callback_(result, name_);
+    }
+    for (auto i=0;((i<10)&&(can_send_));++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(frequency_/10));
+    }
+  }
+}
+#endif
@@ -0,0 +1,498 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "frame_index.h"
+
+#include <ecal_utils/filesystem.h>
+#include <ecal_utils/mapped_file.h>
+#include <ecal_utils/str_convert.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <utility>
+
+namespace
+{
+  ////////////////////////////////////////////////////////////////////////////////
+  //// File layout                                                            ////
+  ////////////////////////////////////////////////////////////////////////////////
+  //
+  // IndexHeader
+  // long long   entry_ids      [frame_count]
+  // long long   timestamps     [frame_count]
+  // uint32_t    channel_indices[frame_count]
+  // channel table: for each channel a uint32_t length followed by the name
+  //
+  // All values are stored in native byte order. An index written on a machine
+  // with a different byte order fails the magic / version check and is
+  // re-created.
+
+  const char     index_magic[8]   = { 'E', 'C', 'A', 'L', 'P', 'I', 'D', 'X' };
+  const uint32_t index_version    = 1;
+
+  // Time range read at once when building the index from a time indexed measurement
+  const long long time_range_window_us = 60LL * 1000 * 1000;
+
+  struct IndexHeader
+  {
+    char     magic[8];
+    uint32_t version;
+    uint32_t use_receive_timestamp;
+    uint64_t frame_count;
+    uint64_t channel_count;
+    uint64_t fingerprint;
+    uint64_t channel_table_size;
+  };
+  static_assert(sizeof(IndexHeader) == 48, "IndexHeader must not contain padding");
+
+  size_t ArraysSize(uint64_t frame_count)
+  {
+    return static_cast<size_t>(frame_count) * (sizeof(long long) + sizeof(long long) + sizeof(uint32_t));
+  }
+
+  void Fnv1a(uint64_t& hash, const void* data, size_t size)
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  void HashHdf5Files(uint64_t& hash, const std::string& dir, const std::string& relative_dir)
+  {
+    // DirContent returns a sorted map, so the hash does not depend on the file system order
+    for (const auto& entry : EcalUtils::Filesystem::DirContent(dir))
+    {
+      const std::string relative_path = relative_dir + "/" + entry.first;
+      if (entry.second.GetType() == EcalUtils::Filesystem::Type::Dir)
+      {
+        HashHdf5Files(hash, dir + "/" + entry.first, relative_path);
+      }
+      else if ((entry.first.size() > 5) && (entry.first.compare(entry.first.size() - 5, 5, ".hdf5") == 0))
+      {
+        // a file rewritten with the same size still changes its modification time
+        const int64_t file_size         = entry.second.FileSize();
+        const int64_t modification_time = entry.second.ModificationTimeNs();
+        Fnv1a(hash, relative_path.data(), relative_path.size() + 1);
+        Fnv1a(hash, &file_size, sizeof(file_size));
+        Fnv1a(hash, &modification_time, sizeof(modification_time));
+      }
+    }
+  }
+
+  // Creates a buffer with the header and the channel table filled in
+  std::vector<char> CreateBuffer(const std::vector<std::string>& channel_names, uint64_t frame_count, bool use_receive_timestamp, uint64_t fingerprint)
+  {
+    size_t channel_table_size = 0;
+    for (const auto& channel_name : channel_names)
+      channel_table_size += sizeof(uint32_t) + channel_name.size();
+
+    std::vector<char> buffer(sizeof(IndexHeader) + ArraysSize(frame_count) + channel_table_size);
+
+    IndexHeader header{};
+    std::memcpy(header.magic, index_magic, sizeof(index_magic));
+    header.version               = index_version;
+    header.use_receive_timestamp = (use_receive_timestamp ? 1 : 0);
+    header.frame_count           = frame_count;
+    header.channel_count         = channel_names.size();
+    header.fingerprint           = fingerprint;
+    header.channel_table_size    = channel_table_size;
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    char* channel_table = buffer.data() + sizeof(IndexHeader) + ArraysSize(frame_count);
+    for (const auto& channel_name : channel_names)
+    {
+      const auto name_size = static_cast<uint32_t>(channel_name.size());
+      std::memcpy(channel_table, &name_size, sizeof(name_size));
+      channel_table += sizeof(name_size);
+      std::memcpy(channel_table, channel_name.data(), channel_name.size());
+      channel_table += channel_name.size();
+    }
+
+    return buffer;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//// FrameIndex                                                             ////
+////////////////////////////////////////////////////////////////////////////////
+
+FrameIndex::FrameIndex()
+  : frame_count_    (0)
+  , entry_ids_      (nullptr)
+  , timestamps_     (nullptr)
+  , channel_indices_(nullptr)
+{}
+
+FrameIndex::~FrameIndex() = default;
+
+void FrameIndex::Load(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::string& meas_dir, bool use_receive_timestamp)
+{
+  Clear();
+
+  const auto     channel_names = hdf5_meas.GetChannelNames();
+  const bool     persist       = !meas_dir.empty() && EcalUtils::Filesystem::IsDir(meas_dir);
+  const uint64_t fingerprint   = (persist ? Fingerprint(meas_dir, channel_names) : 0);
+
+  if (persist)
+  {
+    const std::string index_path = IndexFilePath(meas_dir, use_receive_timestamp);
+    if (MapFile(index_path, use_receive_timestamp, fingerprint))
+      return;
+
+    if (!Build(hdf5_meas, use_receive_timestamp, fingerprint))
+      return;
+
+    // Persisting the index is only an optimization for the next time the
+    // measurement is opened, so it is fine if the directory is not writable.
+    WriteFile(index_path);
+  }
+  else
+  {
+    Build(hdf5_meas, use_receive_timestamp, fingerprint);
+  }
+}
+
+size_t FrameIndex::LowerBound(long long timestamp_us) const
+{
+  return static_cast<size_t>(std::lower_bound(timestamps_, timestamps_ + frame_count_, timestamp_us) - timestamps_);
+}
+
+bool FrameIndex::Build(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, bool use_receive_timestamp, uint64_t fingerprint)
+{
+  const auto channel_name_set = hdf5_meas.GetChannelNames();
+  const std::vector<std::string> channel_names(channel_name_set.begin(), channel_name_set.end());
+
+  // The time index of the measurement is sorted by receive timestamps
+  bool time_indexed = use_receive_timestamp && !channel_names.empty();
+  for (size_t channel_index = 0; time_indexed && (channel_index < channel_names.size()); ++channel_index)
+    time_indexed = hdf5_meas.HasTimeIndex(channel_names[channel_index]);
+
+  if (time_indexed)
+    return BuildFromTimeRanges(hdf5_meas, channel_names, fingerprint);
+  else
+    return BuildFromChannels(hdf5_meas, channel_names, use_receive_timestamp, fingerprint);
+}
+
+bool FrameIndex::BuildFromChannels(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::vector<std::string>& channel_names, bool use_receive_timestamp, uint64_t fingerprint)
+{
+  struct ChannelEntry
+  {
+    long long timestamp;
+    long long id;
+  };
+
+  // Collect a compact, sorted entry list per channel. The entry sets are
+  // already sorted by their receive timestamp, the send timestamps are
+  // usually almost sorted, so sorting them is cheap.
+  std::vector<std::vector<ChannelEntry>> channel_entries(channel_names.size());
+  uint64_t frame_count = 0;
+  for (size_t channel_index = 0; channel_index < channel_names.size(); ++channel_index)
+  {
+    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
+    if (!hdf5_meas.GetEntriesInfo(channel_names[channel_index], entry_info_set))
+      continue;
+
+    auto& entries = channel_entries[channel_index];
+    entries.reserve(entry_info_set.size());
+    for (const auto& entry_info : entry_info_set)
+    {
+      entries.push_back({ use_receive_timestamp ? entry_info.RcvTimestamp : entry_info.SndTimestamp, entry_info.ID });
+    }
+
+    if (!use_receive_timestamp)
+    {
+      std::stable_sort(entries.begin(), entries.end(), [](const ChannelEntry& e1, const ChannelEntry& e2) { return e1.timestamp < e2.timestamp; });
+    }
+
+    frame_count += entries.size();
+  }
+
+  std::vector<char> buffer = CreateBuffer(channel_names, frame_count, use_receive_timestamp, fingerprint);
+
+  auto* entry_ids       = reinterpret_cast<long long*>(buffer.data() + sizeof(IndexHeader));
+  auto* timestamps      = entry_ids + frame_count;
+  auto* channel_indices = reinterpret_cast<uint32_t*>(timestamps + frame_count);
+
+  // K-way merge of the sorted channel lists. On equal timestamps, the channel
+  // with the lower index comes first, so the result is deterministic.
+  using Cursor = std::pair<long long, uint32_t>; // timestamp, channel index
+  std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> heap;
+  std::vector<size_t> positions(channel_names.size(), 0);
+
+  for (uint32_t channel_index = 0; channel_index < channel_entries.size(); ++channel_index)
+  {
+    if (!channel_entries[channel_index].empty())
+      heap.emplace(channel_entries[channel_index].front().timestamp, channel_index);
+  }
+
+  size_t frame = 0;
+  while (!heap.empty())
+  {
+    const uint32_t channel_index = heap.top().second;
+    heap.pop();
+
+    const auto& entries  = channel_entries[channel_index];
+    size_t&     position = positions[channel_index];
+
+    entry_ids      [frame] = entries[position].id;
+    timestamps     [frame] = entries[position].timestamp;
+    channel_indices[frame] = channel_index;
+    ++frame;
+
+    if (++position < entries.size())
+    {
+      heap.emplace(entries[position].timestamp, channel_index);
+    }
+    else
+    {
+      // Release the memory of a channel as soon as it has been merged
+      std::vector<ChannelEntry>().swap(channel_entries[channel_index]);
+    }
+  }
+
+  owned_buffer_ = std::move(buffer);
+  return SetBuffer(owned_buffer_.data(), owned_buffer_.size());
+}
+
+bool FrameIndex::BuildFromTimeRanges(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::vector<std::string>& channel_names, uint64_t fingerprint)
+{
+  struct Frame
+  {
+    long long timestamp;
+    long long id;
+    uint32_t  channel_index;
+  };
+
+  // Same order as the merge of the channel lists: On equal timestamps, the
+  // channel with the lower index comes first.
+  const auto frame_less = [](const Frame& f1, const Frame& f2) { return std::tie(f1.timestamp, f1.channel_index) < std::tie(f2.timestamp, f2.channel_index); };
+
+  std::vector<Frame>     frames;
+  std::vector<long long> channel_begin(channel_names.size());
+  std::vector<long long> channel_end  (channel_names.size());
+  long long              begin = std::numeric_limits<long long>::max();
+  long long              end   = std::numeric_limits<long long>::min();
+
+  for (uint32_t channel_index = 0; channel_index < channel_names.size(); ++channel_index)
+  {
+    channel_begin[channel_index] = hdf5_meas.GetMinTimestamp(channel_names[channel_index]);
+    channel_end  [channel_index] = hdf5_meas.GetMaxTimestamp(channel_names[channel_index]);
+
+    // A channel without entries reports 0. A channel with its last entry at 0
+    // holds at most that single entry, so it can be read right away.
+    if (channel_end[channel_index] == 0)
+    {
+      eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
+      hdf5_meas.GetEntriesInfo(channel_names[channel_index], entry_info_set);
+      for (const auto& entry_info : entry_info_set)
+        frames.push_back({ entry_info.RcvTimestamp, entry_info.ID, channel_index });
+      continue;
+    }
+
+    begin = std::min(begin, channel_begin[channel_index]);
+    end   = std::max(end,   channel_end  [channel_index]);
+  }
+
+  // Read the entries window by window. Thanks to the time index, only the
+  // entries of the current window are loaded from the measurement, instead
+  // of the complete entry list of every channel.
+  size_t window_start = 0;
+  for (long long window_begin = begin; window_begin <= end; window_begin += time_range_window_us)
+  {
+    const long long window_end = window_begin + time_range_window_us - 1;
+
+    for (uint32_t channel_index = 0; channel_index < channel_names.size(); ++channel_index)
+    {
+      if ((channel_end[channel_index] == 0)
+        || (channel_begin[channel_index] > window_end)
+        || (channel_end[channel_index] < window_begin))
+      {
+        continue;
+      }
+
+      eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
+      hdf5_meas.GetEntriesInfoRange(channel_names[channel_index], window_begin, window_end, entry_info_set);
+      for (const auto& entry_info : entry_info_set)
+        frames.push_back({ entry_info.RcvTimestamp, entry_info.ID, channel_index });
+    }
+
+    std::sort(frames.begin() + static_cast<std::ptrdiff_t>(window_start), frames.end(), frame_less);
+    window_start = frames.size();
+
+    if (window_end >= end)
+      break;
+  }
+  std::sort(frames.begin() + static_cast<std::ptrdiff_t>(window_start), frames.end(), frame_less);
+
+  const uint64_t    frame_count = frames.size();
+  std::vector<char> buffer      = CreateBuffer(channel_names, frame_count, true, fingerprint);
+
+  auto* entry_ids       = reinterpret_cast<long long*>(buffer.data() + sizeof(IndexHeader));
+  auto* timestamps      = entry_ids + frame_count;
+  auto* channel_indices = reinterpret_cast<uint32_t*>(timestamps + frame_count);
+
+  for (size_t frame = 0; frame < frames.size(); ++frame)
+  {
+    entry_ids      [frame] = frames[frame].id;
+    timestamps     [frame] = frames[frame].timestamp;
+    channel_indices[frame] = frames[frame].channel_index;
+  }
+
+  owned_buffer_ = std::move(buffer);
+  return SetBuffer(owned_buffer_.data(), owned_buffer_.size());
+}
+
+bool FrameIndex::MapFile(const std::string& path, bool use_receive_timestamp, uint64_t fingerprint)
+{
+  if (!EcalUtils::Filesystem::IsFile(path))
+    return false;
+
+  std::unique_ptr<EcalUtils::MappedFile> mapped_file(new EcalUtils::MappedFile(path));
+  if ((mapped_file->Data() == nullptr) || (mapped_file->Size() < sizeof(IndexHeader)))
+    return false;
+
+  IndexHeader header;
+  std::memcpy(&header, mapped_file->Data(), sizeof(header));
+  if ((header.use_receive_timestamp != (use_receive_timestamp ? 1U : 0U))
+    || (header.fingerprint != fingerprint))
+  {
+    return false;
+  }
+
+  if (!SetBuffer(mapped_file->Data(), mapped_file->Size()))
+  {
+    Clear();
+    return false;
+  }
+
+  mapped_file_ = std::move(mapped_file);
+  return true;
+}
+
+bool FrameIndex::WriteFile(const std::string& path) const
+{
+  if (owned_buffer_.empty())
+    return false;
+
+  // Write to a temporary file first, so a crash or a concurrent player never
+  // sees a half written index
+  const std::string tmp_path = path + ".tmp";
+  {
+#ifdef _WIN32
+    std::ofstream index_file(EcalUtils::StrConvert::Utf8ToWide(tmp_path), std::ios::binary | std::ios::trunc);
+#else
+    std::ofstream index_file(tmp_path, std::ios::binary | std::ios::trunc);
+#endif // _WIN32
+    if (!index_file.is_open())
+      return false;
+
+    index_file.write(owned_buffer_.data(), static_cast<std::streamsize>(owned_buffer_.size()));
+    if (!index_file.good())
+    {
+      index_file.close();
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+  }
+
+#ifdef _WIN32
+  // On Windows, rename does not replace existing files
+  std::remove(path.c_str());
+#endif // _WIN32
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+  {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool FrameIndex::SetBuffer(const char* buffer, size_t buffer_size)
+{
+  IndexHeader header;
+  std::memcpy(&header, buffer, sizeof(header));
+
+  if ((std::memcmp(header.magic, index_magic, sizeof(index_magic)) != 0)
+    || (header.version != index_version)
+    || (buffer_size != sizeof(IndexHeader) + ArraysSize(header.frame_count) + header.channel_table_size))
+  {
+    return false;
+  }
+
+  const char* arrays = buffer + sizeof(IndexHeader);
+  entry_ids_       = reinterpret_cast<const long long*>(arrays);
+  timestamps_      = entry_ids_ + header.frame_count;
+  channel_indices_ = reinterpret_cast<const uint32_t*>(timestamps_ + header.frame_count);
+  frame_count_     = static_cast<size_t>(header.frame_count);
+
+  channel_names_.clear();
+  channel_names_.reserve(static_cast<size_t>(header.channel_count));
+  const char* channel_table     = reinterpret_cast<const char*>(channel_indices_ + header.frame_count);
+  const char* channel_table_end = channel_table + header.channel_table_size;
+  for (uint64_t i = 0; i < header.channel_count; ++i)
+  {
+    uint32_t name_size = 0;
+    if (channel_table_end - channel_table < static_cast<std::ptrdiff_t>(sizeof(name_size)))
+      return false;
+    std::memcpy(&name_size, channel_table, sizeof(name_size));
+    channel_table += sizeof(name_size);
+
+    if (channel_table_end - channel_table < static_cast<std::ptrdiff_t>(name_size))
+      return false;
+    channel_names_.emplace_back(channel_table, name_size);
+    channel_table += name_size;
+  }
+  return true;
+}
+
+void FrameIndex::Clear()
+{
+  frame_count_     = 0;
+  entry_ids_       = nullptr;
+  timestamps_      = nullptr;
+  channel_indices_ = nullptr;
+  channel_names_.clear();
+  owned_buffer_.clear();
+  mapped_file_.reset();
+}
+
+uint64_t FrameIndex::Fingerprint(const std::string& meas_dir, const std::set<std::string>& channel_names)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  HashHdf5Files(hash, meas_dir, "");
+  for (const auto& channel_name : channel_names)
+  {
+    Fnv1a(hash, channel_name.data(), channel_name.size() + 1);
+  }
+  return hash;
+}
+
+std::string FrameIndex::IndexFilePath(const std::string& meas_dir, bool use_receive_timestamp)
+{
+  return meas_dir + (use_receive_timestamp ? "/.ecal_play_index_rcv" : "/.ecal_play_index_snd");
+}
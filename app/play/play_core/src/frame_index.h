@@ -0,0 +1,101 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ecalhdf5/eh5_meas.h>
+
+namespace EcalUtils
+{
+  class MappedFile;
+}
+
+/**
+ * @brief Time-sorted table of all frames of a measurement
+ *
+ * The table is stored as struct of arrays (entry ID, timestamp and channel
+ * index per frame), the channel names are only stored once. All arrays live
+ * in a single contiguous buffer that has the same layout as the sidecar index
+ * file, so an index that has been persisted next to the measurement can be
+ * memory-mapped and used directly, without parsing or sorting anything.
+ */
+class FrameIndex
+{
+public:
+  FrameIndex();
+  ~FrameIndex();
+
+  // Copy
+  FrameIndex(const FrameIndex&)            = delete;
+  FrameIndex& operator=(const FrameIndex&) = delete;
+
+  // Move
+  FrameIndex(FrameIndex&&)                 = delete;
+  FrameIndex& operator=(FrameIndex&&)      = delete;
+
+  /**
+   * @brief Loads the index of the given measurement
+   *
+   * If meas_dir contains a valid index for the same set of HDF5 files,
+   * channels and timestamp type, that index is mapped into memory.
+   * Otherwise the index is created by merging the per-channel entry lists of
+   * the measurement and (if possible) persisted to meas_dir. If the
+   * measurement has a time index and receive timestamps are used, the entries
+   * are read in time windows instead of loading all of them at once.
+   */
+  void Load(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::string& meas_dir, bool use_receive_timestamp);
+
+  size_t    Size()                        const { return frame_count_; }
+  long long GetEntryId(size_t index)      const { return entry_ids_[index]; }
+  long long GetTimestampUs(size_t index)  const { return timestamps_[index]; }
+  uint32_t  GetChannelIndex(size_t index) const { return channel_indices_[index]; }
+
+  const std::vector<std::string>& GetChannelNames() const { return channel_names_; }
+
+  /** @brief Returns the first index with a timestamp >= the given timestamp (or Size()) */
+  size_t LowerBound(long long timestamp_us) const;
+
+private:
+  bool Build              (const eCAL::eh5::v2::HDF5Meas& hdf5_meas, bool use_receive_timestamp, uint64_t fingerprint);
+  bool BuildFromChannels  (const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::vector<std::string>& channel_names, bool use_receive_timestamp, uint64_t fingerprint);
+  bool BuildFromTimeRanges(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::vector<std::string>& channel_names, uint64_t fingerprint);
+  bool MapFile            (const std::string& path, bool use_receive_timestamp, uint64_t fingerprint);
+  bool WriteFile          (const std::string& path) const;
+  bool SetBuffer          (const char* buffer, size_t buffer_size);
+  void Clear();
+
+  static uint64_t    Fingerprint(const std::string& meas_dir, const std::set<std::string>& channel_names);
+  static std::string IndexFilePath(const std::string& meas_dir, bool use_receive_timestamp);
+
+private:
+  std::vector<char>                      owned_buffer_;      /**< Buffer of a freshly built index */
+  std::unique_ptr<EcalUtils::MappedFile> mapped_file_;       /**< Mapping of a persisted index */
+
+  size_t                                 frame_count_;
+  const long long*                       entry_ids_;
+  const long long*                       timestamps_;
+  const uint32_t*                        channel_indices_;
+  std::vector<std::string>               channel_names_;
+};
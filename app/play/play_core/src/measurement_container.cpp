@@ -23,9 +23,51 @@
 #include <ecalhdf5/eh5_meas.h>
 
 #include <algorithm>
+#include <functional>
 #include <math.h>
 #include <stdlib.h>
 
+namespace
+{
+  // Time range read at once from a time indexed measurement
+  const long long time_range_window_us = 60LL * 1000 * 1000;
+
+  // Calls the function for all entries of the channel, sorted by their receive
+  // timestamp. With a time index, the entries are read window by window
+  // instead of loading all of them at once.
+  bool ForEachEntryInfo(const eCAL::eh5::v2::HDF5Meas& hdf5_meas, const std::string& channel_name, const std::function<void(const eCAL::experimental::measurement::base::EntryInfo&)>& function)
+  {
+    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
+
+    const bool      time_indexed = hdf5_meas.HasTimeIndex(channel_name);
+    const long long end          = (time_indexed ? hdf5_meas.GetMaxTimestamp(channel_name) : 0);
+
+    // A channel with its last entry at 0 holds at most that single entry
+    if (!time_indexed || (end == 0))
+    {
+      if (!hdf5_meas.GetEntriesInfo(channel_name, entry_info_set))
+        return false;
+
+      for (const auto& entry_info : entry_info_set)
+        function(entry_info);
+      return true;
+    }
+
+    for (long long window_begin = hdf5_meas.GetMinTimestamp(channel_name); window_begin <= end; window_begin += time_range_window_us)
+    {
+      const long long window_end = window_begin + time_range_window_us - 1;
+
+      hdf5_meas.GetEntriesInfoRange(channel_name, window_begin, window_end, entry_info_set);
+      for (const auto& entry_info : entry_info_set)
+        function(entry_info);
+
+      if (window_end >= end)
+        break;
+    }
+    return true;
+  }
+}
+
 MeasurementContainer::MeasurementContainer(std::shared_ptr<eCAL::eh5::v2::HDF5Meas> hdf5_meas, const std::string& meas_dir, bool use_receive_timestamp)
   : hdf5_meas_             (hdf5_meas)
   , meas_dir_              (meas_dir)
@@ -43,66 +85,51 @@ MeasurementContainer::~MeasurementContainer()
 
 void MeasurementContainer::CreateFrameTable()
 {
-  auto channel_names = hdf5_meas_->GetChannelNames();
-  for (auto& channel_name : channel_names)
-  {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
-    {
-      for (auto& entry_info : entry_info_set)
-      {
-        MeasurementFrame frame_entry;
-
-        frame_entry.id_                = entry_info.ID;
-        frame_entry.channel_name_      = channel_name;
-        frame_entry.receive_timestamp_ = eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(entry_info.RcvTimestamp));
-        frame_entry.send_timestamp_    = eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(entry_info.SndTimestamp));
-        frame_entry.send_id_           = entry_info.SndID;
-        frame_entry.publisher_info_    = nullptr;
-
-        frame_table_.push_back(frame_entry);
-      }
-    }
-  }
-
-  if (use_receive_timestamp_)
-  {
-    std::sort(frame_table_.begin(), frame_table_.end(), [](const MeasurementFrame& e1, const MeasurementFrame& e2) {return e1.receive_timestamp_ < e2.receive_timestamp_; });
-  }
-  else
-  {
-    std::sort(frame_table_.begin(), frame_table_.end(), [](const MeasurementFrame& e1, const MeasurementFrame& e2) {return e1.send_timestamp_ < e2.send_timestamp_; });
-  }
+  // Maps a persisted index or merges the per-channel entry lists
+  frame_table_.Load(*hdf5_meas_, meas_dir_, use_receive_timestamp_);
+  channel_publishers_.assign(frame_table_.GetChannelNames().size(), nullptr);
 }
 
 void MeasurementContainer::CalculateEstimatedSizeForChannels()
 {
   total_estimated_channel_size_map_.clear();
-  auto channel_names = hdf5_meas_->GetChannelNames();
-  for (auto& channel_name : channel_names)
+
+  // The frame table already knows the frames of every channel, so the entry
+  // lists of the channels don't have to be loaded from the measurement again.
+  const auto& channel_names = frame_table_.GetChannelNames();
+  std::vector<size_t> frame_counts(channel_names.size(), 0);
+  for (size_t frame = 0; frame < frame_table_.Size(); ++frame)
   {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
-    {
-      auto size = entry_info_set.size();
-      size_t calculatedStep = size / 5;
-      size_t step = (calculatedStep > 0) ? calculatedStep : 1;
-      size_t sum = 0;
-      uint8_t additions = 0;
+    ++frame_counts[frame_table_.GetChannelIndex(frame)];
+  }
 
-      for (size_t i = 0; i < size; i += step)
-      {
-        size_t entry_size = 0;
-        auto id = (*std::next(entry_info_set.begin(), i)).ID;
-        hdf5_meas_->GetEntryDataSize(id, entry_size);
-        ++additions;
-        sum += entry_size;
-      }
+  // Average the size of up to 5 evenly distributed frames of each channel
+  std::vector<size_t> frames_seen(channel_names.size(), 0);
+  std::vector<size_t> sums       (channel_names.size(), 0);
+  std::vector<size_t> additions  (channel_names.size(), 0);
+  for (size_t frame = 0; frame < frame_table_.Size(); ++frame)
+  {
+    const uint32_t channel_index   = frame_table_.GetChannelIndex(frame);
+    const size_t   calculated_step = frame_counts[channel_index] / 5;
+    const size_t   step            = (calculated_step > 0) ? calculated_step : 1;
 
-      size_t average = (additions == 0) ? 0 : (sum / additions);
-      total_estimated_channel_size_map_[channel_name] = (average * size);
+    if ((frames_seen[channel_index]++ % step) == 0)
+    {
+      size_t entry_size = 0;
+      hdf5_meas_->GetEntryDataSize(frame_table_.GetEntryId(frame), entry_size);
+      ++additions[channel_index];
+      sums[channel_index] += entry_size;
     }
   }
+
+  for (size_t channel_index = 0; channel_index < channel_names.size(); ++channel_index)
+  {
+    if (frame_counts[channel_index] == 0)
+      continue;
+
+    const size_t average = sums[channel_index] / additions[channel_index];
+    total_estimated_channel_size_map_[channel_names[channel_index]] = (average * frame_counts[channel_index]);
+  }
 }
 
 void MeasurementContainer::CreatePublishers()
@@ -134,13 +161,14 @@ void MeasurementContainer::CreatePublishers(const std::map<std::string, std::str
     publisher_map_.emplace(channel_mapping.first, PublisherInfo(channel_mapping.second, data_type_info));
   }
 
-  // Assign publishers to entries
-  for (auto& entry : frame_table_)
+  // Assign publishers to channels
+  const auto& channel_names = frame_table_.GetChannelNames();
+  for (size_t channel_index = 0; channel_index < channel_names.size(); ++channel_index)
   {
-    auto publisher_it = publisher_map_.find(entry.channel_name_);
+    auto publisher_it = publisher_map_.find(channel_names[channel_index]);
     if (publisher_it != publisher_map_.end())
     {
-      entry.publisher_info_ = &(publisher_it->second);
+      channel_publishers_[channel_index] = &(publisher_it->second);
     }
   }
 
@@ -152,11 +180,8 @@ void MeasurementContainer::DeInitializePublishers()
   // Clear the publisher map
   publisher_map_.clear();
 
-  // Remove pointers to publishers from all frames
-  for (auto& entry : frame_table_)
-  {
-    entry.publisher_info_ = nullptr;
-  }
+  // Remove pointers to publishers from all channels
+  std::fill(channel_publishers_.begin(), channel_publishers_.end(), nullptr);
 
   publishers_initialized_ = false;
 }
@@ -181,23 +206,14 @@ bool MeasurementContainer::PublishFrame(long long index)
   if (!publishers_initialized_ || (index < 0) || index >= GetFrameCount())
     return false;
 
-  if (frame_table_[index].publisher_info_)
+  PublisherInfo* publisher_info = GetPublisherInfo(index);
+  if (publisher_info)
   {
-    if (hdf5_meas_->GetEntryDataAsString(frame_table_[index].id_, send_buffer_))
+    if (hdf5_meas_->GetEntryDataAsString(frame_table_.GetEntryId(static_cast<size_t>(index)), send_buffer_))
     {
-      long long timestamp_usecs = -1;
-      if (use_receive_timestamp_)
-      {
-        timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].receive_timestamp_.time_since_epoch()).count();
-      }
-      else
-      {
-        timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].send_timestamp_.time_since_epoch()).count();
-      }
-      // this is not supported by the eCAL v6 API
-      //frame_table_[index].publisher_info_->publisher_.SetID(frame_table_[index].send_id_);
-      frame_table_[index].publisher_info_->publisher_.Send(send_buffer_, timestamp_usecs);
-      frame_table_[index].publisher_info_->message_counter_++;
+      const long long timestamp_usecs = frame_table_.GetTimestampUs(static_cast<size_t>(index));
+      publisher_info->publisher_.Send(send_buffer_, timestamp_usecs);
+      publisher_info->message_counter_++;
       return true;
     }
   }
@@ -206,13 +222,19 @@ bool MeasurementContainer::PublishFrame(long long index)
 }
 
 
+MeasurementContainer::PublisherInfo* MeasurementContainer::GetPublisherInfo(long long index) const
+{
+  const uint32_t channel_index = frame_table_.GetChannelIndex(static_cast<size_t>(index));
+  return (channel_index < channel_publishers_.size() ? channel_publishers_[channel_index] : nullptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Getters                                                                ////
 ////////////////////////////////////////////////////////////////////////////////
 
 long long MeasurementContainer::GetFrameCount() const
 {
-  return (long long)frame_table_.size();
+  return (long long)frame_table_.Size();
 }
 
 bool MeasurementContainer::IsUsingReceiveTimestamp() const
@@ -229,14 +251,7 @@ eCAL::Time::ecal_clock::time_point MeasurementContainer::GetTimestamp(long long
 {
   if ((index >= 0) && (index < GetFrameCount()))
   {
-    if (use_receive_timestamp_)
-    {
-      return frame_table_[index].receive_timestamp_;
-    }
-    else
-    {
-      return frame_table_[index].send_timestamp_;
-    }
+    return eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(frame_table_.GetTimestampUs(static_cast<size_t>(index))));
   }
   else
   {
@@ -248,12 +263,12 @@ std::string MeasurementContainer::GetChannelName(long long index) const
 {
   if ((index >= 0) && (index < GetFrameCount()))
   {
-    return frame_table_[index].channel_name_;
-  }
-  else
-  {
-    return "";
+    const uint32_t channel_index = frame_table_.GetChannelIndex(static_cast<size_t>(index));
+    if (channel_index < frame_table_.GetChannelNames().size())
+      return frame_table_.GetChannelNames()[channel_index];
   }
+
+  return "";
 }
 
 std::chrono::nanoseconds MeasurementContainer::GetMeasurementLength() const
@@ -334,7 +349,7 @@ long long MeasurementContainer::GetNextEnabledFrameIndex(long long current_index
   // Search from current_index to the end
   for (long long i = std::max(current_index, limit_interval.first) + 1; i <= std::min(limit_interval.second, GetFrameCount() - 1); i++)
   {
-    if (frame_table_[i].publisher_info_)
+    if (GetPublisherInfo(i))
     {
       return i;
     }
@@ -345,7 +360,7 @@ long long MeasurementContainer::GetNextEnabledFrameIndex(long long current_index
   {
     for (long long i = std::max(0LL, limit_interval.first); i <= std::min(std::min(current_index, limit_interval.second), GetFrameCount() - 1); i++)
     {
-      if (frame_table_[i].publisher_info_)
+      if (GetPublisherInfo(i))
       {
         return i;
       }
@@ -358,10 +373,17 @@ long long MeasurementContainer::GetNextEnabledFrameIndex(long long current_index
 
 long long MeasurementContainer::GetNextOccurenceOfChannel(long long current_index, const std::string& source_channel_name, bool repeat_from_beginning, std::pair<long long, long long> limit_interval) const
 {
+  // Compare channel indices instead of channel names
+  const auto& channel_names = frame_table_.GetChannelNames();
+  const auto  channel_it    = std::lower_bound(channel_names.begin(), channel_names.end(), source_channel_name);
+  if ((channel_it == channel_names.end()) || (*channel_it != source_channel_name))
+    return -1;
+  const auto source_channel_index = static_cast<uint32_t>(channel_it - channel_names.begin());
+
   // Search from current_index to the end
   for (long long i = std::max(current_index, limit_interval.first) + 1; i <= std::min(limit_interval.second, GetFrameCount() - 1); i++)
   {
-    if (frame_table_[i].channel_name_ == source_channel_name)
+    if (frame_table_.GetChannelIndex(static_cast<size_t>(i)) == source_channel_index)
     {
       return i;
     }
@@ -372,7 +394,7 @@ long long MeasurementContainer::GetNextOccurenceOfChannel(long long current_inde
   {
     for (long long i = std::max(0LL, limit_interval.first); i <= std::min(std::min(current_index, limit_interval.second), GetFrameCount() - 1); i++)
     {
-      if (frame_table_[i].channel_name_ == source_channel_name)
+      if (frame_table_.GetChannelIndex(static_cast<size_t>(i)) == source_channel_index)
       {
         return i;
       }
@@ -398,7 +420,7 @@ std::chrono::nanoseconds MeasurementContainer::GetTimeBetweenFrames(long long fi
 
 long long MeasurementContainer::GetNearestIndex(eCAL::Time::ecal_clock::time_point timestamp) const
 {
-  if (frame_table_.size() < 1)
+  if (frame_table_.Size() < 1)
   {
     return -1;
   }
@@ -408,21 +430,24 @@ long long MeasurementContainer::GetNearestIndex(eCAL::Time::ecal_clock::time_poi
     return 0;
   }
 
-  for (int i = 0; i < GetFrameCount() - 1; i++)
+  // The frame table is sorted, so we can use a binary search for the first frame at or after the timestamp
+  const long long timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(timestamp.time_since_epoch()).count();
+  const long long upper           = static_cast<long long>(frame_table_.LowerBound(timestamp_usecs));
+
+  if (upper >= GetFrameCount())
   {
-    if ((GetTimestamp(i) <= timestamp) && (timestamp <= GetTimestamp(i + 1)))
-    {
-      if ((timestamp - GetTimestamp(i)) <= (GetTimestamp(i + 1) - timestamp))
-      {
-        return i;
-      }
-      else
-      {
-        return i + 1;
-      }
-    }
+    return GetFrameCount() - 1;
+  }
+
+  const long long lower = upper - 1;
+  if ((timestamp - GetTimestamp(lower)) <= (GetTimestamp(upper) - timestamp))
+  {
+    return lower;
+  }
+  else
+  {
+    return upper;
   }
-  return GetFrameCount() - 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -436,45 +461,50 @@ std::map<std::string, ContinuityReport> MeasurementContainer::CreateContinuityRe
   auto channel_names = hdf5_meas_->GetChannelNames();
   for (auto& channel_name : channel_names)
   {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
+    // The entries are checked one after another, so with a time index only a
+    // part of the entries of the channel needs to be loaded at once.
+    bool      has_entries          = false;
+    bool      single_source        = true;
+    long long first_snd_clock      = 0;
+    long long last_snd_clock       = 0;
+    long long existing_frame_count = 0;
+
+    const bool success = ForEachEntryInfo(*hdf5_meas_, channel_name
+                            , [&](const eCAL::experimental::measurement::base::EntryInfo& entry_info)
+                              {
+                                if (!has_entries)
+                                {
+                                  has_entries     = true;
+                                  first_snd_clock = entry_info.SndClock;
+                                }
+                                else if (entry_info.SndClock <= last_snd_clock)
+                                {
+                                  single_source = false;
+                                }
+                                last_snd_clock = entry_info.SndClock;
+                                ++existing_frame_count;
+                              });
+
+    if (!success)
+      continue;
+
+    if (has_entries)
     {
+      long long expected_frame_count = last_snd_clock - first_snd_clock + 1;
 
-      if (!entry_info_set.empty())
+      if (single_source)
       {
-        bool single_source = true;
-        for (auto entry_it = entry_info_set.begin(); entry_it != entry_info_set.end(); entry_it++)
-        {
-          auto this_it = entry_it;
-          auto next_it = std::next(entry_it, 1);
-          
-          if (!(next_it == entry_info_set.end()))
-          {
-            if (next_it->SndClock <= this_it->SndClock)
-            {
-              single_source = false;
-              break;
-            }
-          }
-        }
-
-        long long expected_frame_count = entry_info_set.rbegin()->SndClock - entry_info_set.begin()->SndClock + 1;
-        long long existing_frame_count = entry_info_set.size();
-
-        if (single_source)
-        {
-          continuity_report.emplace(channel_name, ContinuityReport(expected_frame_count, existing_frame_count));
-        }
-        else
-        {
-          continuity_report.emplace(channel_name, ContinuityReport(-1LL, existing_frame_count));
-        }
+        continuity_report.emplace(channel_name, ContinuityReport(expected_frame_count, existing_frame_count));
       }
       else
       {
-        continuity_report.emplace(channel_name, ContinuityReport(0LL, 0LL));
+        continuity_report.emplace(channel_name, ContinuityReport(-1LL, existing_frame_count));
       }
     }
+    else
+    {
+      continuity_report.emplace(channel_name, ContinuityReport(0LL, 0LL));
+    }
   }
 
   return continuity_report;
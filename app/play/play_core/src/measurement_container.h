@@ -22,12 +22,14 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <ecal/ecal.h>
 #include <ecal/pubsub/publisher.h>
 #include <ecalhdf5/eh5_meas.h>
 
 #include "continuity_report.h"
+#include "frame_index.h"
 
 class MeasurementContainer
 {
@@ -100,21 +102,14 @@ private:
     {}
   };
 
-  struct MeasurementFrame
-  {
-    long long                          id_;
-    eCAL::Time::ecal_clock::time_point receive_timestamp_;
-    eCAL::Time::ecal_clock::time_point send_timestamp_;
-    std::string                        channel_name_;
-    long long                          send_id_;
-    PublisherInfo*                     publisher_info_;
-  };
+  PublisherInfo* GetPublisherInfo(long long index) const;
 
   std::shared_ptr<eCAL::eh5::v2::HDF5Meas>              hdf5_meas_;
   std::string                                           meas_dir_;
   bool                                                  use_receive_timestamp_;
 
-  std::vector<MeasurementFrame>           frame_table_;
+  FrameIndex                              frame_table_;
+  std::vector<PublisherInfo*>             channel_publishers_;
   std::map<std::string, size_t>           total_estimated_channel_size_map_;
   std::map<std::string, PublisherInfo>    publisher_map_;
   bool                                    publishers_initialized_;
@@ -0,0 +1,212 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ecal_utils/filesystem.h>
+#include <ecalhdf5/eh5_meas.h>
+
+#include <frame_index.h>
+
+namespace
+{
+  struct TestEntry
+  {
+    std::string channel;
+    long long   snd_timestamp;
+    long long   rcv_timestamp;
+  };
+
+  const std::string output_dir = "frame_index_test";
+
+  // Returns an empty measurement directory (removing the leftovers of a previous test run)
+  std::string CleanMeasDir(const std::string& name)
+  {
+    const std::string meas_dir = output_dir + "/" + name;
+    EcalUtils::Filesystem::DeleteDir(meas_dir);
+    return meas_dir;
+  }
+
+  void CreateMeasurement(const std::string& meas_dir, const std::string& base_name, const std::vector<TestEntry>& entries)
+  {
+    eCAL::eh5::v2::HDF5Meas hdf5_writer;
+    EXPECT_TRUE(hdf5_writer.Open(meas_dir, eCAL::eh5::v2::eAccessType::CREATE));
+    hdf5_writer.SetFileBaseName(base_name);
+
+    long long clock = 0;
+    for (const auto& entry : entries)
+    {
+      const std::string data = entry.channel + " data";
+      EXPECT_TRUE(hdf5_writer.AddEntryToFile(data.data(), data.size(), entry.snd_timestamp, entry.rcv_timestamp, entry.channel, 0, clock++));
+    }
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  std::vector<long long> Timestamps(const FrameIndex& frame_index)
+  {
+    std::vector<long long> timestamps;
+    for (size_t i = 0; i < frame_index.Size(); ++i)
+      timestamps.push_back(frame_index.GetTimestampUs(i));
+    return timestamps;
+  }
+
+  std::vector<std::string> Channels(const FrameIndex& frame_index)
+  {
+    std::vector<std::string> channels;
+    for (size_t i = 0; i < frame_index.Size(); ++i)
+      channels.push_back(frame_index.GetChannelNames()[frame_index.GetChannelIndex(i)]);
+    return channels;
+  }
+}
+
+TEST(FrameIndex, BuildsTimeSortedIndex)
+{
+  const std::string meas_dir = CleanMeasDir("build");
+  CreateMeasurement(meas_dir, "build", { { "a", 30, 1 }, { "b", 20, 2 }, { "a", 10, 3 } });
+
+  eCAL::eh5::v2::HDF5Meas hdf5_meas;
+  ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+
+  FrameIndex rcv_index;
+  rcv_index.Load(hdf5_meas, meas_dir, true);
+  EXPECT_EQ(Timestamps(rcv_index), std::vector<long long>({ 1, 2, 3 }));
+  EXPECT_EQ(Channels(rcv_index),   std::vector<std::string>({ "a", "b", "a" }));
+  EXPECT_EQ(rcv_index.LowerBound(2), 1);
+  EXPECT_EQ(rcv_index.LowerBound(4), 3);
+
+  FrameIndex snd_index;
+  snd_index.Load(hdf5_meas, meas_dir, false);
+  EXPECT_EQ(Timestamps(snd_index), std::vector<long long>({ 10, 20, 30 }));
+  EXPECT_EQ(Channels(snd_index),   std::vector<std::string>({ "a", "b", "a" }));
+
+  // Both indexes have been persisted next to the measurement
+  EXPECT_TRUE(EcalUtils::Filesystem::IsFile(meas_dir + "/.ecal_play_index_rcv"));
+  EXPECT_TRUE(EcalUtils::Filesystem::IsFile(meas_dir + "/.ecal_play_index_snd"));
+}
+
+TEST(FrameIndex, LoadsPersistedIndex)
+{
+  const std::string meas_dir   = CleanMeasDir("load");
+  CreateMeasurement(meas_dir, "load", { { "a", 10, 10 }, { "b", 20, 20 } });
+  const std::string index_path = meas_dir + "/.ecal_play_index_rcv";
+
+  eCAL::eh5::v2::HDF5Meas hdf5_meas;
+  ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+  {
+    FrameIndex frame_index;
+    frame_index.Load(hdf5_meas, meas_dir, true);
+    ASSERT_EQ(frame_index.Size(), 2);
+  }
+
+  // Patch the first entry ID of the persisted index (it directly follows the
+  // 48 byte header). Only an index that is loaded from the file can see it.
+  const long long patched_entry_id = 4711;
+  {
+    std::fstream index_file(index_path, std::ios::in | std::ios::out | std::ios::binary);
+    ASSERT_TRUE(index_file.is_open());
+    index_file.seekp(48);
+    index_file.write(reinterpret_cast<const char*>(&patched_entry_id), sizeof(patched_entry_id));
+  }
+
+  FrameIndex frame_index;
+  frame_index.Load(hdf5_meas, meas_dir, true);
+  ASSERT_EQ(frame_index.Size(), 2);
+  EXPECT_EQ(frame_index.GetEntryId(0), patched_entry_id);
+  EXPECT_EQ(Timestamps(frame_index), std::vector<long long>({ 10, 20 }));
+}
+
+TEST(FrameIndex, RebuildsIndexOfChangedMeasurement)
+{
+  const std::string meas_dir = CleanMeasDir("change");
+  CreateMeasurement(meas_dir, "change", { { "a", 10, 10 }, { "b", 20, 20 } });
+  {
+    eCAL::eh5::v2::HDF5Meas hdf5_meas;
+    ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+    FrameIndex frame_index;
+    frame_index.Load(hdf5_meas, meas_dir, true);
+    EXPECT_EQ(Channels(frame_index), std::vector<std::string>({ "a", "b" }));
+  }
+
+  // Rewrite the measurement with the same file name and the same amount of
+  // data, so only the modification time tells that it has changed
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  CreateMeasurement(meas_dir, "change", { { "a", 20, 20 }, { "b", 10, 10 } });
+  {
+    eCAL::eh5::v2::HDF5Meas hdf5_meas;
+    ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+    FrameIndex frame_index;
+    frame_index.Load(hdf5_meas, meas_dir, true);
+    EXPECT_EQ(Channels(frame_index), std::vector<std::string>({ "b", "a" }));
+  }
+
+  // A new file in the measurement changes the index as well
+  CreateMeasurement(meas_dir, "change_2", { { "c", 5, 5 } });
+  {
+    eCAL::eh5::v2::HDF5Meas hdf5_meas;
+    ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+    FrameIndex frame_index;
+    frame_index.Load(hdf5_meas, meas_dir, true);
+    EXPECT_EQ(Channels(frame_index), std::vector<std::string>({ "c", "b", "a" }));
+  }
+}
+
+TEST(FrameIndex, WithoutMeasurementDirectory)
+{
+  const std::string meas_dir = CleanMeasDir("no_dir");
+  CreateMeasurement(meas_dir, "no_dir", { { "a", 10, 10 } });
+
+  eCAL::eh5::v2::HDF5Meas hdf5_meas;
+  ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+
+  FrameIndex frame_index;
+  frame_index.Load(hdf5_meas, "", true);
+  EXPECT_EQ(Timestamps(frame_index), std::vector<long long>({ 10 }));
+  EXPECT_FALSE(EcalUtils::Filesystem::IsFile(meas_dir + "/.ecal_play_index_rcv"));
+}
+
+TEST(FrameIndex, BuildsIndexFromTimeRanges)
+{
+  // Frames spread over several minutes with a long gap, so the time indexed
+  // measurement is read in several time windows
+  const long long minute_us = 60LL * 1000 * 1000;
+  const std::string meas_dir = CleanMeasDir("time_ranges");
+  CreateMeasurement(meas_dir, "time_ranges", { { "b", 0, 0 }
+                                             , { "a", 1, minute_us - 1 }
+                                             , { "c", 2, minute_us - 1 }
+                                             , { "a", 3, minute_us }
+                                             , { "c", 4, 10 * minute_us + 5 }
+                                             , { "a", 5, 10 * minute_us + 4 } });
+
+  eCAL::eh5::v2::HDF5Meas hdf5_meas;
+  ASSERT_TRUE(hdf5_meas.Open(meas_dir));
+  ASSERT_TRUE(hdf5_meas.HasTimeIndex("a"));
+
+  FrameIndex frame_index;
+  frame_index.Load(hdf5_meas, meas_dir, true);
+  EXPECT_EQ(Timestamps(frame_index), std::vector<long long>({ 0, minute_us - 1, minute_us - 1, minute_us, 10 * minute_us + 4, 10 * minute_us + 5 }));
+  EXPECT_EQ(Channels(frame_index),   std::vector<std::string>({ "b", "a", "c", "a", "a", "c" }));
+}
@@ -25,6 +25,8 @@
 
 #include <clocale>
 #include <locale>
+#include <map>
+#include <sstream>
 
 #include <ecal_utils/ecal_utils.h>
 
@@ -636,6 +638,76 @@ bool EcalRecService::strToBool(const std::string& str)
     }
   }
 
+  //////////////////////////////////////
+  // writer_thread_count              //
+  //////////////////////////////////////
+  {
+    auto it = config.items().find("writer_thread_count");
+    if (it != config.items().end())
+    {
+      const std::string writer_thread_count_string = it->second;
+      int writer_thread_count = 1;
+      try
+      {
+        writer_thread_count = std::stoi(writer_thread_count_string);
+      }
+      catch (const std::exception& e)
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error parsing value \"" + writer_thread_count_string + "\": " + e.what());
+        return job_config;
+      }
+
+      if (writer_thread_count < 1)
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error setting writer thread count to " + writer_thread_count_string + ": Value must be at least 1");
+        return job_config;
+      }
+
+      job_config.SetWriterThreadCount(writer_thread_count);
+    }
+    else
+    {
+      job_config.SetWriterThreadCount(1);
+    }
+  }
+
+  //////////////////////////////////////
+  // topic_compression                //
+  //////////////////////////////////////
+  {
+    std::map<std::string, eCAL::rec::Compression> topic_compression;
+
+    auto it = config.items().find("topic_compression");
+    if (it != config.items().end())
+    {
+      // One "<compression> <topic_name>" pair per line
+      std::stringstream topic_compression_stream(it->second);
+      std::string line;
+      while (std::getline(topic_compression_stream, line))
+      {
+        if (line.empty())
+          continue;
+
+        const size_t separator_pos = line.find(' ');
+        eCAL::rec::Compression compression = eCAL::rec::Compression::None;
+        if ((separator_pos == std::string::npos)
+          || (separator_pos + 1 >= line.size())
+          || !eCAL::rec::CompressionFromString(line.substr(0, separator_pos), compression))
+        {
+          response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+          response->set_error("Error parsing topic compression \"" + line + "\"");
+          return job_config;
+        }
+
+        topic_compression[line.substr(separator_pos + 1)] = compression;
+      }
+    }
+
+    job_config.SetTopicCompression(topic_compression);
+  }
+
   //////////////////////////////////////
   // description                      //
   //////////////////////////////////////
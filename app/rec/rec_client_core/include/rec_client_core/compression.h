@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#pragma once
+
+#include <string>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Compression of the payload of a recorded topic
+     *
+     * Deflate is compressed by the writer thread of the recording job (if eCAL
+     * HDF5 has been built with zlib). Lz4 is compressed by the HDF5 filter
+     * under the global lock of the thread safe HDF5 library, so it does not
+     * scale with several jobs or writer threads.
+     */
+    enum class Compression
+    {
+      None,
+      Deflate,
+      Lz4
+    };
+
+    inline std::string CompressionToString(Compression compression)
+    {
+      switch (compression)
+      {
+      case Compression::Deflate: return "deflate";
+      case Compression::Lz4:     return "lz4";
+      default:                   return "none";
+      }
+    }
+
+    inline bool CompressionFromString(const std::string& compression_string, Compression& compression)
+    {
+      if      (compression_string == "none")    compression = Compression::None;
+      else if (compression_string == "deflate") compression = Compression::Deflate;
+      else if (compression_string == "lz4")     compression = Compression::Lz4;
+      else                                      return false;
+      return true;
+    }
+  }
+}
@@ -21,6 +21,9 @@
 
 #include <string>
 #include <chrono>
+#include <map>
+
+#include <rec_client_core/compression.h>
 
 namespace eCAL
 {
@@ -55,6 +58,12 @@ namespace eCAL
       void SetOneFilePerTopicEnabled(bool enabled);
       bool GetOneFilePerTopicEnabled() const;
 
+      void SetWriterThreadCount(int writer_thread_count);
+      int GetWriterThreadCount() const;
+
+      void SetTopicCompression(const std::map<std::string, Compression>& topic_compression);
+      std::map<std::string, Compression> GetTopicCompression() const;
+
       void SetDescription(const std::string& description);
       std::string GetDescription() const;
 
@@ -76,6 +85,8 @@ namespace eCAL
       std::string  meas_name_;
       int64_t      max_file_size_mb_;
       bool         one_file_per_topic_;
+      int          writer_thread_count_;
+      std::map<std::string, Compression> topic_compression_;
       std::string  description_;
     };
   }
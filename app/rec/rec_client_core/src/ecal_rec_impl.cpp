@@ -728,7 +728,7 @@ namespace eCAL
 
       std::shared_ptr<Frame> frame = std::make_shared<Frame>(&data_, topic_id_.topic_name, ecal_receive_time, system_receive_time);
 
-      // Add to the pre-buffer (it is thread-safe by using a mutex internally)
+      // Add to the pre-buffer (it is thread-safe by using a lock-free queue internally)
       pre_buffer_.push_back(frame);
 
       {
@@ -740,16 +740,12 @@ namespace eCAL
         }
       }
 
-      {
-        // Add to the subscriber statistics
-        const std::lock_guard<decltype(subscriber_throughput_mutex_)> subscriber_statistics_lock(subscriber_throughput_mutex_);
-        subscriber_throughput_statistics_.AddFrame(data_.buffer_size);
-      }
+      // Add to the subscriber statistics (sharded per thread, aggregated when requested)
+      subscriber_throughput_statistics_.AddFrame(data_.buffer_size);
     }
 
     Throughput EcalRecImpl::GetSubscriberThroughput() const
     {
-      const std::lock_guard<decltype(subscriber_throughput_mutex_)> subscriber_statistics_lock(subscriber_throughput_mutex_);
       return subscriber_throughput_statistics_.GetThroughput();
     }
     //////////////////////////////////////
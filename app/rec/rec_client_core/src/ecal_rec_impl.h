@@ -180,8 +180,7 @@ namespace eCAL
 
     // Subscriber throughput statistics
     private:
-      mutable ThroughputStatistics          subscriber_throughput_statistics_;// todo don't make mutable
-      mutable std::mutex                    subscriber_throughput_mutex_;
+      mutable ShardedThroughputStatistics   subscriber_throughput_statistics_;// todo don't make mutable
     };
   }
 }
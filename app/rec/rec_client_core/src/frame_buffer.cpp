@@ -37,13 +37,13 @@ namespace eCAL
 
     bool FrameBuffer::is_enabled() const
     {
-      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
       return is_enabled_;
     }
 
     void FrameBuffer::set_enabled(bool enabled)
     {
-      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      collect_incoming_frames_no_lock();
 
       // Clear just in case something has happend while the frame-buffer was disabled
       if (!is_enabled_)
@@ -57,29 +57,30 @@ namespace eCAL
 
     std::chrono::steady_clock::duration FrameBuffer::get_max_buffer_length() const
     {
-      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
       return max_buffer_length_;
     }
 
     void FrameBuffer::set_max_buffer_length(std::chrono::steady_clock::duration new_length)
     {
-      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
       max_buffer_length_ = new_length;
       remove_old_frames_no_lock();
     }
 
     void FrameBuffer::push_back(const std::shared_ptr<Frame>& frame)
     {
-      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      // Lock-free, this is called from the subscriber callbacks of all topics
       if (is_enabled_)
       {
-        frame_buffer_deque_.push_back(frame);
+        incoming_frames_.push(frame);
       }
     }
 
     std::pair<int64_t, std::chrono::steady_clock::duration> FrameBuffer::length() const
     {
-      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      collect_incoming_frames_no_lock();
 
       if (!is_enabled_)
         return {0, std::chrono::steady_clock::duration(0)};
@@ -99,12 +100,23 @@ namespace eCAL
 
     void FrameBuffer::remove_old_frames()
     {
-      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
       remove_old_frames_no_lock();
     }
 
+    void FrameBuffer::collect_incoming_frames_no_lock() const
+    {
+      std::shared_ptr<Frame> frame;
+      while (incoming_frames_.pop(frame))
+      {
+        frame_buffer_deque_.push_back(std::move(frame));
+      }
+    }
+
     void FrameBuffer::remove_old_frames_no_lock()
     {
+      collect_incoming_frames_no_lock();
+
       auto now = std::chrono::steady_clock::now();
       
       if (frame_buffer_deque_.empty())
@@ -130,13 +142,15 @@ namespace eCAL
 
     void FrameBuffer::clear()
     {
-      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      collect_incoming_frames_no_lock();
       frame_buffer_deque_.clear();
     }
 
     std::deque<std::shared_ptr<Frame>> FrameBuffer::get_as_deque() const
     {
-      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      std::lock_guard<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      collect_incoming_frames_no_lock();
       if (!is_enabled_)
         return std::deque<std::shared_ptr<Frame>>();
       else
@@ -17,12 +17,13 @@
  * ========================= eCAL LICENSE =================================
 */
 
+#include <atomic>
 #include <deque>
-#include <shared_mutex>
+#include <mutex>
 #include <memory>
-#include <condition_variable>
 
 #include "frame.h"
+#include "mpsc_queue.h"
 
 namespace eCAL
 {
@@ -62,19 +63,25 @@ namespace eCAL
       std::deque<std::shared_ptr<Frame>> get_as_deque() const;
 
     private:
+      void collect_incoming_frames_no_lock() const;
       void remove_old_frames_no_lock();
 
     private:
 
-      // Mutex protecting this entire class
-      mutable std::shared_timed_mutex     frame_buffer_mutex_;
+      // Mutex protecting this entire class (except for the incoming frames)
+      mutable std::mutex                  frame_buffer_mutex_;
 
       // Settings
-      bool                                is_enabled_;
+      std::atomic<bool>                   is_enabled_;
       std::chrono::steady_clock::duration max_buffer_length_;
 
+      // Frames pushed by the subscriber callbacks. They are moved to the
+      // frame buffer deque by whoever accesses the frame buffer next, so
+      // pushing a frame never has to wait for the mutex.
+      mutable MpscQueue<std::shared_ptr<Frame>> incoming_frames_;
+
       // Actual frame buffer
-      std::deque<std::shared_ptr<Frame>>  frame_buffer_deque_;
+      mutable std::deque<std::shared_ptr<Frame>> frame_buffer_deque_;
 
     };
   }
@@ -28,6 +28,7 @@
 #include "ThreadingUtils/InterruptibleThread.h"
 
 #include "frame.h"
+#include "rec_client_core/compression.h"
 #include "rec_client_core/ecal_rec_logger.h"
 #include "rec_client_core/job_config.h"
 #include "rec_client_core/topic_info.h"
@@ -40,8 +41,25 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 
+namespace
+{
+  eCAL::eh5::eCompression ToEh5Compression(eCAL::rec::Compression compression)
+  {
+    switch (compression)
+    {
+    case eCAL::rec::Compression::Deflate:
+      return eCAL::eh5::eCompression::DEFLATE;
+    case eCAL::rec::Compression::Lz4:
+      return eCAL::eh5::eCompression::LZ4;
+    default:
+      return eCAL::eh5::eCompression::NONE;
+    }
+  }
+}
+
 namespace eCAL
 {
   namespace rec
@@ -51,22 +69,30 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////
 
-    Hdf5WriterThread::Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer)
+    Hdf5WriterThread::Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer, size_t writer_index, size_t writer_count)
       : InterruptibleThread          ()
       , job_config_                  (job_config)
-      , frame_buffer_                (initial_frame_buffer)
+      , writer_index_                (writer_index)
+      , writer_count_                (writer_count)
       , total_size_bytes_            (0)
+      , total_frames_count_          (0)
       , written_size_bytes_          (0)
       , written_frames_count_        (0)
+      , last_added_frame_timestamp_  (0)
+      , writer_waiting_              (false)
       , new_topic_info_map_          (initial_topic_info_map)
       , new_topic_info_map_available_(true)
       , flushing_                    (false)
+      , adding_frames_count_         (0)
       , throughput_statistics_       (2)
     {
-      // Initialize total size in bytes
-      for (const auto& frame : frame_buffer_)
+      // Initialize the frame queue with the pre-buffered frames
+      for (const auto& frame : initial_frame_buffer)
       {
         total_size_bytes_ += frame->data_.size();
+        total_frames_count_++;
+        last_added_frame_timestamp_ = frame->system_receive_time_.time_since_epoch().count();
+        frame_queue_.push(frame);
       }
 
       hdf5_writer_ = std::make_unique<eCAL::eh5::v2::HDF5Meas>();
@@ -78,6 +104,10 @@ namespace eCAL
       // where the vtable is not created yet or it's destructed.
       Hdf5WriterThread::Interrupt();
       Join();
+
+      // The frame queue must not be destroyed while a frame is being pushed
+      while (adding_frames_count_ != 0)
+        std::this_thread::yield();
     }
 
 
@@ -97,18 +127,32 @@ namespace eCAL
 
     bool Hdf5WriterThread::AddFrame(const std::shared_ptr<Frame>& frame)
     {
-      std::lock_guard<decltype(input_mutex_)> input_lock(input_mutex_);
-      if (!flushing_)
+      // This is called from the subscriber callbacks of all topics, so we
+      // don't lock the input mutex unless the writer thread has to be woken up.
+      // Instead, the frame is announced before flushing_ is checked: Either we
+      // see that Flush() has been called, or the writer thread sees the
+      // announced frame and does not finish flushing before it is in the queue.
+      adding_frames_count_++;
+      const bool accepted = !flushing_;
+      if (accepted)
       {
-        frame_buffer_.push_back(frame);
         total_size_bytes_ += frame->data_.size();
-        input_cv_.notify_one();
-        return true;
+        total_frames_count_++;
+        last_added_frame_timestamp_ = frame->system_receive_time_.time_since_epoch().count();
+        frame_queue_.push(frame);
       }
-      else
+      adding_frames_count_--;
+
+      // Pairs with the fence in Run(): Either the writer thread sees the new
+      // frame (or the finished call) before going to sleep, or we see that it
+      // is waiting.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (writer_waiting_)
       {
-        return false;
+        std::lock_guard<decltype(input_mutex_)> input_lock(input_mutex_);
+        input_cv_.notify_one();
       }
+      return accepted;
     }
 
     void Hdf5WriterThread::SetTopicInfo(std::map<std::string, TopicInfo> topic_info_map)
@@ -129,9 +173,10 @@ namespace eCAL
       if (IsRunning())
       {
         // This log output is inside the IsRunning if condition, as a buffer writer thread would receive the flushing command before it has even been started
-        if (frame_buffer_.size() > 0)
+        const uint64_t unflushed_frames = total_frames_count_ - written_frames_count_;
+        if (unflushed_frames > 0)
         {
-          EcalRecLogger::Instance()->info("Flushing " + std::to_string(frame_buffer_.size()) + " frames...");  
+          EcalRecLogger::Instance()->info("Flushing " + std::to_string(unflushed_frames) + " frames...");  
         }
       }
 
@@ -144,7 +189,8 @@ namespace eCAL
       EcalRecLogger::Instance()->debug("Hdf5WriterThread::Run(): Starting Thread");
 #endif // NDEBUG
 
-      EcalRecLogger::Instance()->info("Measurement directory: " + job_config_.GetCompleteMeasurementPath());
+      if (writer_index_ == 0)
+        EcalRecLogger::Instance()->info("Measurement directory: " + job_config_.GetCompleteMeasurementPath());
 
       // Initialization
       if (!OpenHdf5Writer()) return;
@@ -163,8 +209,11 @@ namespace eCAL
           // Lock the input mutex
           std::unique_lock<decltype(input_mutex_)> input_lock(input_mutex_);
 
-          // Wait until something is set to an input variable (frame_buffer_, topic info)
-          input_cv_.wait(input_lock, [this]() { return IsInterrupted() || IsFlushing() || !frame_buffer_.empty() || !new_topic_info_map_available_; });
+          // Wait until something is set to an input variable (frame_queue_, topic info)
+          writer_waiting_ = true;
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          input_cv_.wait(input_lock, [this]() { return IsInterrupted() || IsFlushingFinished() || !frame_queue_.empty() || new_topic_info_map_available_; });
+          writer_waiting_ = false;
 
           if (IsInterrupted())
             break;
@@ -177,11 +226,9 @@ namespace eCAL
 
             new_topic_info_map_available_ = false;
           }
-          else if (!frame_buffer_.empty())
+          else if (frame_queue_.pop(frame))
           {
-            // take one frame from the framebuffer
-            frame = frame_buffer_.front();
-            frame_buffer_.pop_front();
+            // took one frame from the frame queue
             if (written_frames_count_ == 0)
             {
               first_written_frame_timestamp_ = frame->system_receive_time_;
@@ -231,7 +278,7 @@ namespace eCAL
         }
         else
         {
-          if (flushing_)
+          if (IsFlushingFinished())
           {
             // If there was no frame left and we were only supposed to flush existing frames, we terminate.
 #ifndef NDEBUG
@@ -265,24 +312,36 @@ namespace eCAL
       return flushing_;
     }
 
+    bool Hdf5WriterThread::IsFlushingFinished() const
+    {
+      // A frame that is being added after the flushing_ check must still be written
+      return flushing_ && (adding_frames_count_ == 0) && frame_queue_.empty();
+    }
+
     RecHdf5JobStatus Hdf5WriterThread::GetStatus() const
     {
       {
         std::lock_guard<decltype(input_mutex_)> input_lock(input_mutex_);
 
-        if (frame_buffer_.size() > 0)
+        const uint64_t written_frames_count = written_frames_count_;
+        const uint64_t total_frames_count   = total_frames_count_;
+        const uint64_t written_size_bytes   = written_size_bytes_;
+        const uint64_t total_size_bytes     = total_size_bytes_;
+
+        if (total_frames_count > written_frames_count)
         {
-          last_status_.total_length_        = frame_buffer_.back()->system_receive_time_ - first_written_frame_timestamp_;
+          const std::chrono::steady_clock::time_point last_added_frame_timestamp(std::chrono::steady_clock::duration(last_added_frame_timestamp_.load()));
+          last_status_.total_length_        = last_added_frame_timestamp - first_written_frame_timestamp_;
         }
         else
         {
           last_status_.total_length_        = last_written_frame_timestamp_ - first_written_frame_timestamp_;
         }
 
-        last_status_.total_size_bytes_      = total_size_bytes_;
-        last_status_.unflushed_frame_count_ = frame_buffer_.size();
-        last_status_.unflushed_size_bytes_  = total_size_bytes_ - written_size_bytes_;
-        last_status_.total_frame_count_     = written_frames_count_ + frame_buffer_.size();
+        last_status_.total_size_bytes_      = total_size_bytes;
+        last_status_.unflushed_frame_count_ = static_cast<int64_t>(total_frames_count - written_frames_count);
+        last_status_.unflushed_size_bytes_  = total_size_bytes - written_size_bytes;
+        last_status_.total_frame_count_     = static_cast<int64_t>(total_frames_count);
       }
 
       {
@@ -301,8 +360,13 @@ namespace eCAL
       std::string host_name = eCAL::Process::GetHostName();
       std::string hdf5_dir  = EcalUtils::Filesystem::ToNativeSeperators(job_config_.GetCompleteMeasurementPath() + "/" + host_name);
 
+      // Multiple writers share the directory, the HDF5 reader merges all files
+      std::string base_name = host_name;
+      if (writer_count_ > 1)
+        base_name += "_writer" + std::to_string(writer_index_);
+
 #ifndef NDEBUG
-      EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): hdf5_dir: \"" + hdf5_dir + "\", base_name: \"" + host_name + "\"");
+      EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): hdf5_dir: \"" + hdf5_dir + "\", base_name: \"" + base_name + "\"");
 #endif // NDEBUG
       std::unique_lock<decltype(hdf5_writer_mutex_)> hdf5_writer_lock(hdf5_writer_mutex_);
 
@@ -312,9 +376,15 @@ namespace eCAL
         EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): Successfully opened HDF5-Writer with path \"" + hdf5_dir + "\"");
 #endif // NDEBUG
 
-        hdf5_writer_->SetFileBaseName(host_name);
+        hdf5_writer_->SetFileBaseName(base_name);
         hdf5_writer_->SetMaxSizePerFile(job_config_.GetMaxFileSize());
         hdf5_writer_->SetOneFilePerChannelEnabled(job_config_.GetOneFilePerTopicEnabled());
+
+        // The HDF5 compression filters run in this writer thread when adding the entries
+        for (const auto& topic_compression : job_config_.GetTopicCompression())
+        {
+          hdf5_writer_->SetChannelCompression(topic_compression.first, ToEh5Compression(topic_compression.second));
+        }
       }
       else
       {
@@ -34,6 +34,7 @@
 
 #include "ecalhdf5/eh5_meas_api_v2.h"
 #include "frame.h"
+#include "mpsc_queue.h"
 #include "throughput_statistics.h"
 
 #include "rec_client_core/job_config.h"
@@ -50,7 +51,11 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////
     public:
-      Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map = {}, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer = {});
+      /**
+       * @param writer_index  Index of this writer, if the topics of the job are sharded across multiple writers
+       * @param writer_count  Number of writers of the job. With multiple writers, the index is appended to the HDF5 file base name.
+       */
+      Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map = {}, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer = {}, size_t writer_index = 0, size_t writer_count = 1);
 
       ~Hdf5WriterThread();
 
@@ -86,18 +91,26 @@ namespace eCAL
       bool        OpenHdf5Writer() const;
       bool        CloseHdf5Writer();
 
+      bool        IsFlushingFinished() const; // Must only be called by the writer thread, as it reads the frame queue
+
     ///////////////////////////////
     // Member Variables
     ///////////////////////////////
     private:
       JobConfig job_config_;
+      size_t    writer_index_;
+      size_t    writer_count_;
+
+      MpscQueue<std::shared_ptr<Frame>>     frame_queue_;                       /**< Frames added by the subscriber callbacks. Lock-free for adding, only the writer thread takes frames. */
+      std::atomic<uint64_t>                 total_size_bytes_;
+      std::atomic<uint64_t>                 total_frames_count_;
+      std::atomic<uint64_t>                 written_size_bytes_;
+      std::atomic<uint64_t>                 written_frames_count_;
+      std::atomic<std::chrono::steady_clock::rep> last_added_frame_timestamp_;  /**< system receive time of the newest added frame */
+      std::atomic<bool>                     writer_waiting_;                    /**< The writer thread is (about to be) waiting for input_cv_. Adding a frame only needs to notify it in that case. */
 
       mutable std::mutex                    input_mutex_;                       /**< Mutex protecting every input variables (notably the variables below). */
       mutable std::condition_variable       input_cv_;                          /**< condition variable for notifying the internal worker thread that new input data is available */
-      std::deque<std::shared_ptr<Frame>>    frame_buffer_;
-      uint64_t                              total_size_bytes_;
-      uint64_t                              written_size_bytes_;
-      size_t                                written_frames_count_;
       std::chrono::steady_clock::time_point first_written_frame_timestamp_;
       std::chrono::steady_clock::time_point last_written_frame_timestamp_;
       std::map<std::string, TopicInfo>      new_topic_info_map_;                /**< The new topic info map that shall be set to the HDF5 writer */
@@ -108,7 +121,8 @@ namespace eCAL
       mutable std::mutex                                    hdf5_writer_mutex_;
       std::unique_ptr<eCAL::eh5::v2::HDF5Meas>              hdf5_writer_;
 
-      std::atomic<bool> flushing_;
+      std::atomic<bool>     flushing_;
+      std::atomic<uint32_t> adding_frames_count_;                               /**< Number of AddFrame() calls that passed the flushing_ check, but have not pushed their frame, yet */
 
       mutable std::mutex           throughput_statistics_mutex_;
       mutable ThroughputStatistics throughput_statistics_;
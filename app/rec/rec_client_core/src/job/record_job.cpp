@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <functional>
 #include <sstream>
 #include <string>
 
@@ -59,12 +60,12 @@ namespace eCAL
 
     RecordJob::~RecordJob()
     {
-      if (hdf5_writer_thread_)
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
       {
-        hdf5_writer_thread_->Interrupt();
-        hdf5_writer_thread_->Join();
-        hdf5_writer_thread_ = nullptr;
+        hdf5_writer_thread->Interrupt();
+        hdf5_writer_thread->Join();
       }
+      hdf5_writer_threads_.clear();
 #ifdef ECAL_HAS_CURL
       if (ftp_upload_thread_)
       {
@@ -77,11 +78,11 @@ namespace eCAL
 
     void RecordJob::Interrupt()
     {
-      if (hdf5_writer_thread_)
-        hdf5_writer_thread_->Interrupt();
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+        hdf5_writer_thread->Interrupt();
 #ifdef ECAL_HAS_CURL
       if (ftp_upload_thread_)
-        hdf5_writer_thread_->Interrupt();
+        ftp_upload_thread_->Interrupt();
 #endif // ECAL_HAS_CURL
     }
 
@@ -292,8 +293,9 @@ namespace eCAL
         return false;
       }
 
-      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, initial_topic_info_map, initial_frame_buffer);
-      hdf5_writer_thread_->Start();
+      CreateHdf5WriterThreads_NoLock(initial_topic_info_map, initial_frame_buffer);
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+        hdf5_writer_thread->Start();
 
       main_recorder_state_ = JobState::Recording;
 
@@ -304,12 +306,13 @@ namespace eCAL
     {
       std::unique_lock<std::shared_timed_mutex> lock(job_mutex_);
 
-      if ((main_recorder_state_ != JobState::Recording) || !hdf5_writer_thread_)
+      if ((main_recorder_state_ != JobState::Recording) || hdf5_writer_threads_.empty())
       {
         return false;
       }
 
-      hdf5_writer_thread_->Flush();
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+        hdf5_writer_thread->Flush();
 
       main_recorder_state_ = JobState::Flushing;
 
@@ -326,9 +329,12 @@ namespace eCAL
         return false;
       }
 
-      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, topic_info_map, frame_buffer);
-      hdf5_writer_thread_->Flush();
-      hdf5_writer_thread_->Start();
+      CreateHdf5WriterThreads_NoLock(topic_info_map, frame_buffer);
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+      {
+        hdf5_writer_thread->Flush();
+        hdf5_writer_thread->Start();
+      }
 
       main_recorder_state_ = JobState::Flushing;
 
@@ -338,19 +344,31 @@ namespace eCAL
     bool RecordJob::AddFrame(const std::shared_ptr<Frame>& frame)
     {
       std::shared_lock<std::shared_timed_mutex> lock(job_mutex_);
-      if ((main_recorder_state_ != JobState::Recording) || !hdf5_writer_thread_)
+      if ((main_recorder_state_ != JobState::Recording) || hdf5_writer_threads_.empty())
         return false;
 
-      return hdf5_writer_thread_->AddFrame(frame);
+      return hdf5_writer_threads_[GetHdf5WriterIndex_NoLock(frame->topic_name_)]->AddFrame(frame);
     }
 
     void RecordJob::SetTopicInfo(const std::map<std::string, TopicInfo>& topic_info_map)
     {
       std::shared_lock<std::shared_timed_mutex> lock(job_mutex_);
-      if ((main_recorder_state_ != JobState::Recording) || !hdf5_writer_thread_)
+      if ((main_recorder_state_ != JobState::Recording) || hdf5_writer_threads_.empty())
+        return;
+
+      if (hdf5_writer_threads_.size() == 1)
+      {
+        hdf5_writer_threads_.front()->SetTopicInfo(topic_info_map);
         return;
+      }
+
+      // Each writer only gets the topics it is writing
+      std::vector<std::map<std::string, TopicInfo>> sharded_topic_info_maps(hdf5_writer_threads_.size());
+      for (const auto& topic_info : topic_info_map)
+        sharded_topic_info_maps[GetHdf5WriterIndex_NoLock(topic_info.first)].insert(topic_info);
 
-      hdf5_writer_thread_->SetTopicInfo(topic_info_map);
+      for (size_t i = 0; i < hdf5_writer_threads_.size(); i++)
+        hdf5_writer_threads_[i]->SetTopicInfo(std::move(sharded_topic_info_maps[i]));
     }
 
     eCAL::rec::Error RecordJob::Upload(const UploadConfig& upload_config)
@@ -565,9 +583,23 @@ namespace eCAL
         std::shared_lock<std::shared_timed_mutex> lock(job_mutex_);
         job_status.state_ = main_recorder_state_;
 
-        if (hdf5_writer_thread_)
+        if (!hdf5_writer_threads_.empty())
         {
-          job_status.rec_hdf5_status_ = hdf5_writer_thread_->GetStatus();
+          // Combine the status of all writers to the status of one logical measurement
+          for (const auto& hdf5_writer_thread : hdf5_writer_threads_)
+          {
+            const RecHdf5JobStatus writer_status = hdf5_writer_thread->GetStatus();
+            job_status.rec_hdf5_status_.total_length_                     = std::max(job_status.rec_hdf5_status_.total_length_, writer_status.total_length_);
+            job_status.rec_hdf5_status_.total_frame_count_               += writer_status.total_frame_count_;
+            job_status.rec_hdf5_status_.total_size_bytes_                += writer_status.total_size_bytes_;
+            job_status.rec_hdf5_status_.unflushed_frame_count_           += writer_status.unflushed_frame_count_;
+            job_status.rec_hdf5_status_.unflushed_size_bytes_            += writer_status.unflushed_size_bytes_;
+            job_status.rec_hdf5_status_.write_throughput_.bytes_per_second_  += writer_status.write_throughput_.bytes_per_second_;
+            job_status.rec_hdf5_status_.write_throughput_.frames_per_second_ += writer_status.write_throughput_.frames_per_second_;
+            if (!writer_status.info_.first && job_status.rec_hdf5_status_.info_.first)
+              job_status.rec_hdf5_status_.info_ = writer_status.info_;
+          }
+
           if (job_status.rec_hdf5_status_.info_.first)
           {
             job_status.rec_hdf5_status_.info_ = info_;
@@ -624,8 +656,12 @@ namespace eCAL
       if (main_recorder_state_ == JobState::Flushing)
       {
         // Flushing -> FinishedFlushing, if recorder finished flushing.
-        if (hdf5_writer_thread_
-          && (!hdf5_writer_thread_->IsRunning() || !hdf5_writer_thread_->IsFlushing()))
+        const bool all_writers_finished = std::all_of(hdf5_writer_threads_.begin(), hdf5_writer_threads_.end()
+                                                      , [](const std::unique_ptr<Hdf5WriterThread>& hdf5_writer_thread)
+                                                        {
+                                                          return !hdf5_writer_thread->IsRunning() || !hdf5_writer_thread->IsFlushing();
+                                                        });
+        if (!hdf5_writer_threads_.empty() && all_writers_finished)
         {
           main_recorder_state_ = JobState::FinishedFlushing;
         }
@@ -648,5 +684,45 @@ namespace eCAL
       std::unique_lock<std::shared_timed_mutex> lock(job_mutex_);
       UpdateJobState_NoLock();
     }
+
+    void RecordJob::CreateHdf5WriterThreads_NoLock(const std::map<std::string, TopicInfo>& topic_info_map, const std::deque<std::shared_ptr<Frame>>& frame_buffer)
+    {
+      const size_t writer_count = static_cast<size_t>(std::max(1, job_config_.GetWriterThreadCount()));
+
+      hdf5_writer_threads_.clear();
+      hdf5_writer_threads_.reserve(writer_count);
+
+      if (writer_count == 1)
+      {
+        hdf5_writer_threads_.push_back(std::make_unique<Hdf5WriterThread>(job_config_, topic_info_map, frame_buffer));
+        return;
+      }
+
+      // Shard the topics across the writers. All frames of a topic are written
+      // by the same writer, so each topic stays in one file set.
+      std::vector<std::map<std::string, TopicInfo>>        sharded_topic_info_maps(writer_count);
+      std::vector<std::deque<std::shared_ptr<Frame>>>      sharded_frame_buffers  (writer_count);
+
+      for (const auto& topic_info : topic_info_map)
+        sharded_topic_info_maps[GetHdf5WriterIndex(topic_info.first, writer_count)].insert(topic_info);
+      for (const auto& frame : frame_buffer)
+        sharded_frame_buffers[GetHdf5WriterIndex(frame->topic_name_, writer_count)].push_back(frame);
+
+      for (size_t i = 0; i < writer_count; i++)
+        hdf5_writer_threads_.emplace_back(std::make_unique<Hdf5WriterThread>(job_config_, sharded_topic_info_maps[i], sharded_frame_buffers[i], i, writer_count));
+    }
+
+    size_t RecordJob::GetHdf5WriterIndex_NoLock(const std::string& topic_name) const
+    {
+      return GetHdf5WriterIndex(topic_name, hdf5_writer_threads_.size());
+    }
+
+    size_t RecordJob::GetHdf5WriterIndex(const std::string& topic_name, size_t writer_count)
+    {
+      if (writer_count <= 1)
+        return 0;
+
+      return std::hash<std::string>()(topic_name) % writer_count;
+    }
   }
 }
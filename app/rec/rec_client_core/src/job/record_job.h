@@ -26,6 +26,7 @@
 #include <shared_mutex>
 #include <deque>
 #include <string>
+#include <vector>
 
 #include <rec_client_core/state.h>
 #include <rec_client_core/job_config.h>
@@ -100,6 +101,11 @@ namespace eCAL
       void UpdateJobState_NoLock() const;
       void UpdateJobState() const;
 
+      void   CreateHdf5WriterThreads_NoLock(const std::map<std::string, TopicInfo>& topic_info_map, const std::deque<std::shared_ptr<Frame>>& frame_buffer);
+      size_t GetHdf5WriterIndex_NoLock(const std::string& topic_name) const;
+
+      static size_t GetHdf5WriterIndex(const std::string& topic_name, size_t writer_count);
+
     ///////////////////////////////////////////////
     // Member Variables
     ///////////////////////////////////////////////
@@ -107,7 +113,7 @@ namespace eCAL
       mutable std::shared_timed_mutex          job_mutex_;
 
       const JobConfig                          job_config_;
-      std::unique_ptr<Hdf5WriterThread>        hdf5_writer_thread_;
+      std::vector<std::unique_ptr<Hdf5WriterThread>> hdf5_writer_threads_;  /**< One writer thread per topic shard, each writing its own files into the measurement directory */
 
 #ifdef ECAL_HAS_CURL
       std::unique_ptr<FtpUploadThread>         ftp_upload_thread_;
@@ -34,6 +34,7 @@ namespace eCAL
       : job_id_(0)
       , max_file_size_mb_(1000)
       , one_file_per_topic_(false)
+      , writer_thread_count_(1)
     {}
 
     JobConfig::~JobConfig()
@@ -75,6 +76,12 @@ namespace eCAL
     void            JobConfig::SetOneFilePerTopicEnabled(bool enabled)                     { one_file_per_topic_ = enabled; }
     bool            JobConfig::GetOneFilePerTopicEnabled() const                           { return one_file_per_topic_; }
 
+    void            JobConfig::SetWriterThreadCount     (int writer_thread_count)          { writer_thread_count_ = writer_thread_count; }
+    int             JobConfig::GetWriterThreadCount     () const                           { return writer_thread_count_; }
+
+    void                               JobConfig::SetTopicCompression(const std::map<std::string, Compression>& topic_compression) { topic_compression_ = topic_compression; }
+    std::map<std::string, Compression> JobConfig::GetTopicCompression() const                                                      { return topic_compression_; }
+
     void            JobConfig::SetDescription           (const std::string& description)   { description_ = description; }
     std::string     JobConfig::GetDescription           () const                           { return description_; }
 
@@ -0,0 +1,111 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Unbounded multi-producer / single-consumer queue
+     *
+     * Pushing is lock-free (a single atomic exchange), so any number of
+     * subscriber callback threads can add elements without blocking each
+     * other. Popping must only be done by one thread at a time (e.g. by
+     * protecting it with the mutex of the consuming object).
+     *
+     * A pop may miss an element whose push has not been completed, yet. It
+     * will be returned by one of the next pops. Pushing links the new node
+     * to its predecessor only after publishing it as the head, so the queue
+     * must not be destroyed while a push is in progress: The destructor only
+     * releases the linked nodes, the pushing thread would write to a deleted
+     * node and the new node would leak.
+     */
+    template <typename T>
+    class MpscQueue
+    {
+    public:
+      MpscQueue()
+        : head_(new Node())
+        , tail_(head_.load(std::memory_order_relaxed))
+      {}
+
+      ~MpscQueue()
+      {
+        T value;
+        while (pop(value)) {}
+        delete tail_;
+      }
+
+      // Copy
+      MpscQueue(const MpscQueue&)            = delete;
+      MpscQueue& operator=(const MpscQueue&) = delete;
+
+      // Move
+      MpscQueue(MpscQueue&&)                 = delete;
+      MpscQueue& operator=(MpscQueue&&)      = delete;
+
+      // May be called by any thread
+      void push(T value)
+      {
+        Node* node = new Node(std::move(value));
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+      }
+
+      // Must only be called by the consumer
+      bool pop(T& value)
+      {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+          return false;
+
+        // The popped node becomes the new (empty) stub node
+        value = std::move(next->value);
+        tail_ = next;
+        delete tail;
+        return true;
+      }
+
+      // Must only be called by the consumer
+      bool empty() const
+      {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+      }
+
+    private:
+      struct Node
+      {
+        Node() = default;
+        explicit Node(T&& value_) : value(std::move(value_)) {}
+
+        std::atomic<Node*> next { nullptr };
+        T                  value;
+      };
+
+      alignas(64) std::atomic<Node*> head_;   /**< Last pushed node, producers append here */
+      alignas(64) Node*              tail_;   /**< Stub node in front of the oldest element, owned by the consumer */
+    };
+  }
+}
@@ -19,9 +19,13 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <rec_client_core/state.h>
@@ -134,5 +138,66 @@ namespace eCAL
         }
       }
     };
+
+    /**
+     * @brief Thread-safe throughput statistics for many concurrent writers
+     *
+     * Every thread adds its frames to one of several independent shards
+     * (selected by its thread id), so threads rarely compete for the same
+     * mutex. The shards are only aggregated when the throughput is requested.
+     */
+    class ShardedThroughputStatistics {
+
+    public:
+      explicit ShardedThroughputStatistics(size_t bins_per_second)
+        : shards_(MakeShards(bins_per_second))
+      {}
+
+      void AddFrame(uint64_t bytes)
+      {
+        static thread_local const size_t shard_index = std::hash<std::thread::id>()(std::this_thread::get_id()) % shard_count;
+
+        Shard& shard = shards_[shard_index];
+        const std::lock_guard<std::mutex> shard_lock(shard.mutex);
+        shard.statistics.AddFrame(bytes);
+      }
+
+      Throughput GetThroughput()
+      {
+        Throughput throughput{ 0, 0 };
+        for (auto& shard : shards_)
+        {
+          const std::lock_guard<std::mutex> shard_lock(shard.mutex);
+          const Throughput shard_throughput = shard.statistics.GetThroughput();
+          throughput.bytes_per_second_  += shard_throughput.bytes_per_second_;
+          throughput.frames_per_second_ += shard_throughput.frames_per_second_;
+        }
+        return throughput;
+      }
+
+    private:
+      static constexpr size_t shard_count = 16;
+
+      struct alignas(64) Shard
+      {
+        explicit Shard(size_t bins_per_second) : statistics(bins_per_second) {}
+
+        std::mutex           mutex;
+        ThroughputStatistics statistics;
+      };
+
+      static std::array<Shard, shard_count> MakeShards(size_t bins_per_second)
+      {
+        return MakeShards(bins_per_second, std::make_index_sequence<shard_count>());
+      }
+
+      template <size_t... Indices>
+      static std::array<Shard, shard_count> MakeShards(size_t bins_per_second, std::index_sequence<Indices...> /*indices*/)
+      {
+        return {{ (static_cast<void>(Indices), Shard(bins_per_second))... }};
+      }
+
+      std::array<Shard, shard_count> shards_;
+    };
   }
-}
\ No newline at end of file
+}
@@ -28,6 +28,7 @@
 #include <memory>
 #include <list>
 
+#include <rec_client_core/compression.h>
 #include <rec_client_core/topic_info.h>
 #include <rec_client_core/record_mode.h>
 #include <rec_client_core/state.h>
@@ -123,12 +124,16 @@ namespace eCAL
       void SetMeasName              (std::string  meas_name);
       void SetMaxFileSizeMib        (unsigned int max_file_size_mib);
       void SetOneFilePerTopicEnabled(bool enabled);
+      void SetWriterThreadCount     (int writer_thread_count);
+      void SetTopicCompression      (const std::map<std::string, eCAL::rec::Compression>& topic_compression);
       void SetDescription           (std::string  description);
 
       std::string  GetMeasRootDir   () const;
       std::string  GetMeasName      () const;
       int64_t      GetMaxFileSizeMib() const;
       bool         GetOneFilePerTopicEnabled() const;
+      int          GetWriterThreadCount() const;
+      std::map<std::string, eCAL::rec::Compression> GetTopicCompression() const;
       std::string  GetDescription   () const;
 
     ////////////////////////////////////
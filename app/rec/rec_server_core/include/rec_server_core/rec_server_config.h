@@ -24,6 +24,7 @@
 #include <set>
 #include <chrono>
 
+#include <rec_client_core/compression.h>
 #include <rec_client_core/record_mode.h>
 
 namespace eCAL
@@ -70,6 +71,8 @@ namespace eCAL
         , meas_name_                ("")
         , max_file_size_            (1000)
         , one_file_per_topic_       (false)
+        , writer_thread_count_      (1)
+        , topic_compression_        ()
         , description_              ("")
         , enabled_clients_config_   ()
         , pre_buffer_enabled_       (false)
@@ -84,6 +87,8 @@ namespace eCAL
       std::string                         meas_name_;
       int64_t                             max_file_size_;
       bool                                one_file_per_topic_;
+      int                                 writer_thread_count_;
+      std::map<std::string, eCAL::rec::Compression> topic_compression_;
       std::string                         description_;
       std::map<std::string, ClientConfig> enabled_clients_config_;
       bool                                pre_buffer_enabled_;
@@ -71,6 +71,25 @@ namespace eCAL
             one_file_per_topic_element->SetText(rec_server.GetOneFilePerTopicEnabled() ? "true" : "false");
             main_config_element->InsertEndChild(one_file_per_topic_element);
           }
+          {
+            // writer thread count
+            auto writer_thread_count_element = document.NewElement(ELEMENT_NAME_WRITER_THREAD_COUNT);
+            writer_thread_count_element->SetText(std::to_string(rec_server.GetWriterThreadCount()).c_str());
+            main_config_element->InsertEndChild(writer_thread_count_element);
+          }
+          {
+            // topic compression
+            auto topic_compression_element = document.NewElement(ELEMENT_NAME_TOPIC_COMPRESSION);
+            main_config_element->InsertEndChild(topic_compression_element);
+
+            for (const auto& topic_compression : rec_server.GetTopicCompression())
+            {
+              auto topic_compression_entry = document.NewElement(ELEMENT_NAME_TOPIC_COMPRESSION_ENTRY);
+              topic_compression_entry->SetAttribute(ATTRIBUTE_NAME_TOPIC_COMPRESSION_CODEC, eCAL::rec::CompressionToString(topic_compression.second).c_str());
+              topic_compression_entry->SetText(topic_compression.first.c_str());
+              topic_compression_element->InsertEndChild(topic_compression_entry);
+            }
+          }
           {
             // description
             auto description_element = document.NewElement(ELEMENT_NAME_DESCRIPTION);
@@ -322,6 +341,48 @@ namespace eCAL
             eCAL::rec::EcalRecLogger::Instance()->warn("One-file-per-topic element is missing");
           }
         }
+
+        // writer_thread_count (optional, older configs don't have it)
+        {
+          auto writer_thread_count_element = main_config_element->FirstChildElement(ELEMENT_NAME_WRITER_THREAD_COUNT);
+          if ((writer_thread_count_element != nullptr)
+            && (writer_thread_count_element->GetText() != nullptr))
+          {
+            std::string writer_thread_count_string = writer_thread_count_element->GetText();
+            try
+            {
+              config_output.writer_thread_count_ = std::max(1, std::stoi(writer_thread_count_string));
+            }
+            catch(std::exception& e)
+            {
+              eCAL::rec::EcalRecLogger::Instance()->warn(std::string("Error reading writer thread count: ") + e.what());
+            }
+          }
+        }
+
+        // topic_compression (optional, older configs don't have it)
+        {
+          auto topic_compression_element = main_config_element->FirstChildElement(ELEMENT_NAME_TOPIC_COMPRESSION);
+          if (topic_compression_element != nullptr)
+          {
+            for (auto topic_compression_entry = topic_compression_element->FirstChildElement(ELEMENT_NAME_TOPIC_COMPRESSION_ENTRY); topic_compression_entry != nullptr; topic_compression_entry = topic_compression_entry->NextSiblingElement(ELEMENT_NAME_TOPIC_COMPRESSION_ENTRY))
+            {
+              const char* codec_char_p = topic_compression_entry->Attribute(ATTRIBUTE_NAME_TOPIC_COMPRESSION_CODEC);
+              if ((codec_char_p == nullptr)
+                || (topic_compression_entry->GetText() == nullptr)
+                || (topic_compression_entry->GetText()[0] == '\0'))
+              {
+                continue;
+              }
+
+              eCAL::rec::Compression compression = eCAL::rec::Compression::None;
+              if (eCAL::rec::CompressionFromString(codec_char_p, compression))
+                config_output.topic_compression_[topic_compression_entry->GetText()] = compression;
+              else
+                eCAL::rec::EcalRecLogger::Instance()->warn(std::string("Invalid compression detected: ") + codec_char_p);
+            }
+          }
+        }
         
         // description
         {
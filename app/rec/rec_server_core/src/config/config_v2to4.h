@@ -39,6 +39,10 @@ namespace eCAL
       constexpr const char* ELEMENT_NAME_MEAS_NAME                                  = "measurementName";
       constexpr const char* ELEMENT_NAME_MAX_FILE_SIZE_MIB                          = "maxFileSizeMib";
       constexpr const char* ELEMENT_NAME_ONE_FILE_PER_TOPIC                         = "oneFilePerTopic";         // Added in v4
+      constexpr const char* ELEMENT_NAME_WRITER_THREAD_COUNT                        = "writerThreadCount";       // Optional, defaults to 1
+      constexpr const char* ELEMENT_NAME_TOPIC_COMPRESSION                          = "topicCompression";        // Optional, defaults to no compression
+      constexpr const char* ELEMENT_NAME_TOPIC_COMPRESSION_ENTRY                    = "topic";
+      constexpr const char* ATTRIBUTE_NAME_TOPIC_COMPRESSION_CODEC                  = "compression";
       constexpr const char* ELEMENT_NAME_DESCRIPTION                                = "description";
       constexpr const char* ELEMENT_NAME_ENABLED_RECORDERS                          = "recorders";
       constexpr const char* ELEMENT_NAME_ENABLED_RECORDER_ENTRY                     = "client";
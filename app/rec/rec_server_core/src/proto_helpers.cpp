@@ -20,6 +20,8 @@
 #include <rec_server_core/proto_helpers.h>
 #include <rec_client_core/proto_helpers.h>
 
+#include <algorithm>
+
 namespace eCAL
 {
   namespace rec_server
@@ -91,6 +93,7 @@ namespace eCAL
         rec_server_config_pb.set_meas_name(rec_server_config.meas_name_);
         rec_server_config_pb.set_max_file_size_mib(rec_server_config.max_file_size_);
         rec_server_config_pb.set_one_file_per_topic(rec_server_config.one_file_per_topic_);
+        rec_server_config_pb.set_writer_thread_count(static_cast<uint32_t>(rec_server_config.writer_thread_count_));
         rec_server_config_pb.set_description(rec_server_config.description_);
 
         rec_server_config_pb.clear_enabled_clients_config();
@@ -109,6 +112,12 @@ namespace eCAL
           rec_server_config_pb.add_listed_topics(topic_name);
         }
 
+        rec_server_config_pb.clear_topic_compression();
+        for (const auto& topic_compression : rec_server_config.topic_compression_)
+        {
+          (*rec_server_config_pb.mutable_topic_compression())[topic_compression.first] = eCAL::rec::CompressionToString(topic_compression.second);
+        }
+
         ToProtobuf(rec_server_config.upload_config_, *rec_server_config_pb.mutable_upload_config());
       }
 
@@ -330,6 +339,7 @@ namespace eCAL
         rec_server_config.meas_name_          = rec_server_config_pb.meas_name();
         rec_server_config.max_file_size_      = rec_server_config_pb.max_file_size_mib();
         rec_server_config.one_file_per_topic_ = rec_server_config_pb.one_file_per_topic();
+        rec_server_config.writer_thread_count_ = std::max(1, static_cast<int>(rec_server_config_pb.writer_thread_count()));
         rec_server_config.description_        = rec_server_config_pb.description();
 
         rec_server_config.enabled_clients_config_.clear();
@@ -349,6 +359,14 @@ namespace eCAL
           rec_server_config.listed_topics_.emplace(topic_name);
         }
 
+        rec_server_config.topic_compression_.clear();
+        for (const auto& topic_compression_pb : rec_server_config_pb.topic_compression())
+        {
+          eCAL::rec::Compression compression = eCAL::rec::Compression::None;
+          if (eCAL::rec::CompressionFromString(topic_compression_pb.second, compression))
+            rec_server_config.topic_compression_[topic_compression_pb.first] = compression;
+        }
+
         FromProtobuf(rec_server_config_pb.upload_config(), rec_server_config.upload_config_);
       }
 
@@ -94,12 +94,16 @@ namespace eCAL
     void RecServer::SetMeasName              (std::string meas_name)           { rec_server_impl_->SetMeasName(meas_name); }
     void RecServer::SetMaxFileSizeMib        (unsigned int max_file_size_mib)  { rec_server_impl_->SetMaxFileSizeMib(max_file_size_mib); }
     void RecServer::SetOneFilePerTopicEnabled(bool enabled)                    { rec_server_impl_->SetOneFilePerTopicEnabled(enabled); }
+    void RecServer::SetWriterThreadCount     (int writer_thread_count)         { rec_server_impl_->SetWriterThreadCount(writer_thread_count); }
+    void RecServer::SetTopicCompression      (const std::map<std::string, eCAL::rec::Compression>& topic_compression) { rec_server_impl_->SetTopicCompression(topic_compression); }
     void RecServer::SetDescription           (std::string description)         { rec_server_impl_->SetDescription(description); }
 
     std::string  RecServer::GetMeasRootDir   () const                   { return rec_server_impl_->GetMeasRootDir(); } 
     std::string  RecServer::GetMeasName      () const                   { return rec_server_impl_->GetMeasName(); }
     int64_t      RecServer::GetMaxFileSizeMib() const                   { return rec_server_impl_->GetMaxFileSizeMib(); }
     bool         RecServer::GetOneFilePerTopicEnabled() const           { return rec_server_impl_->GetOneFilePerTopicEnabled(); }
+    int          RecServer::GetWriterThreadCount() const                { return rec_server_impl_->GetWriterThreadCount(); }
+    std::map<std::string, eCAL::rec::Compression> RecServer::GetTopicCompression() const { return rec_server_impl_->GetTopicCompression(); }
     std::string  RecServer::GetDescription   () const                   { return rec_server_impl_->GetDescription(); }
 
     ////////////////////////////////////
@@ -36,6 +36,8 @@
 #include <rec_client_core/ecal_rec_logger.h>
 #include <rec_client_core/ecal_rec.h>
 
+#include <algorithm>
+
 namespace eCAL
 {
   namespace rec_server
@@ -952,6 +954,16 @@ namespace eCAL
       job_config_.SetOneFilePerTopicEnabled(enabled);
     }
 
+    void RecServerImpl::SetWriterThreadCount(int writer_thread_count)
+    {
+      job_config_.SetWriterThreadCount(std::max(1, writer_thread_count));
+    }
+
+    void RecServerImpl::SetTopicCompression(const std::map<std::string, eCAL::rec::Compression>& topic_compression)
+    {
+      job_config_.SetTopicCompression(topic_compression);
+    }
+
     void RecServerImpl::SetDescription(const std::string& description)
     {
       job_config_.SetDescription(description);
@@ -978,6 +990,16 @@ namespace eCAL
       return job_config_.GetOneFilePerTopicEnabled();
     }
 
+    int RecServerImpl::GetWriterThreadCount() const
+    {
+      return job_config_.GetWriterThreadCount();
+    }
+
+    std::map<std::string, eCAL::rec::Compression> RecServerImpl::GetTopicCompression() const
+    {
+      return job_config_.GetTopicCompression();
+    }
+
     std::string RecServerImpl::GetDescription() const
     {
       return job_config_.GetDescription();
@@ -1862,6 +1884,8 @@ namespace eCAL
       config.meas_name_                 = GetMeasName();
       config.max_file_size_             = GetMaxFileSizeMib();
       config.one_file_per_topic_        = GetOneFilePerTopicEnabled();
+      config.writer_thread_count_       = GetWriterThreadCount();
+      config.topic_compression_         = GetTopicCompression();
       config.description_               = GetDescription();
       config.enabled_clients_config_    = GetEnabledRecClients();
       config.pre_buffer_enabled_        = GetPreBufferingEnabled();
@@ -1924,6 +1948,8 @@ namespace eCAL
       SetMaxFileSizeMib          (config.max_file_size_);
       SetDescription             (config.description_);
       SetOneFilePerTopicEnabled  (config.one_file_per_topic_);
+      SetWriterThreadCount       (config.writer_thread_count_);
+      SetTopicCompression        (config.topic_compression_);
       SetPreBufferingEnabled     (config.pre_buffer_enabled_);
       SetMaxPreBufferLength      (config.pre_buffer_length_);
       SetUploadConfig            (config.upload_config_);
@@ -1947,6 +1973,8 @@ namespace eCAL
       SetMeasName           ("");
       SetMaxFileSizeMib     (100);
       SetOneFilePerTopicEnabled(false);
+      SetWriterThreadCount  (1);
+      SetTopicCompression   ({});
       SetDescription        ("");
       
       loaded_config_path_    = "";
@@ -149,12 +149,16 @@ namespace eCAL
       void SetMeasName              (const std::string& meas_name);
       void SetMaxFileSizeMib        (int64_t max_file_size_mib);
       void SetOneFilePerTopicEnabled(bool enabled);
+      void SetWriterThreadCount     (int writer_thread_count);
+      void SetTopicCompression      (const std::map<std::string, eCAL::rec::Compression>& topic_compression);
       void SetDescription           (const std::string& description);
 
       std::string  GetMeasRootDir           () const;
       std::string  GetMeasName              () const;
       int64_t      GetMaxFileSizeMib        () const;
       bool         GetOneFilePerTopicEnabled() const;
+      int          GetWriterThreadCount     () const;
+      std::map<std::string, eCAL::rec::Compression> GetTopicCompression() const;
       std::string  GetDescription           () const;
 
     ////////////////////////////////////
@@ -603,6 +603,13 @@ namespace eCAL
       (*job_config_pb)["description"]          = job_config.GetDescription();
       (*job_config_pb)["max_file_size_mib"]    = std::to_string(job_config.GetMaxFileSize());
       (*job_config_pb)["one_file_per_topic"]   = job_config.GetOneFilePerTopicEnabled() ? "true" : "false";
+      (*job_config_pb)["writer_thread_count"]  = std::to_string(job_config.GetWriterThreadCount());
+
+      // One "<compression> <topic_name>" pair per line
+      std::string topic_compression_string;
+      for (const auto& topic_compression : job_config.GetTopicCompression())
+        topic_compression_string += eCAL::rec::CompressionToString(topic_compression.second) + " " + topic_compression.first + "\n";
+      (*job_config_pb)["topic_compression"]    = topic_compression_string;
     }
 
     void RemoteRecorder::SetUploadConfig(google::protobuf::Map<std::string, std::string>* upload_config_pb, const eCAL::rec::UploadConfig& upload_config)
@@ -0,0 +1,284 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <ecal/process.h>
+
+#include <ecalhdf5/eh5_meas_api_v3.h>
+#include <ecal_utils/filesystem.h>
+
+#include "frame.h"
+#include "job/hdf5_writer_thread.h"
+#include "job/record_job.h"
+
+#include <rec_client_core/compression.h>
+#include <rec_client_core/job_config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  const std::string meas_root_dir = "rec_client_core_test_meas";
+
+  eCAL::rec::JobConfig CreateJobConfig(const std::string& meas_name)
+  {
+    eCAL::rec::JobConfig job_config;
+    job_config.SetMeasRootDir(meas_root_dir);
+    job_config.SetMeasName(meas_name);
+    return job_config;
+  }
+
+  std::string GetHostDirectory(const eCAL::rec::JobConfig& job_config)
+  {
+    return job_config.GetCompleteMeasurementPath() + "/" + eCAL::Process::GetHostName();
+  }
+
+  std::shared_ptr<eCAL::rec::Frame> CreateFrame(const std::string& topic_name, const std::string& data, long long clock)
+  {
+    auto frame = std::make_shared<eCAL::rec::Frame>();
+    frame->data_.assign(data.begin(), data.end());
+    frame->topic_name_         = topic_name;
+    frame->clock_              = clock;
+    frame->ecal_publish_time_  = eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(1000 + clock));
+    frame->ecal_receive_time_  = eCAL::Time::ecal_clock::time_point(std::chrono::microseconds(2000 + clock));
+    frame->system_receive_time_ = std::chrono::steady_clock::now();
+    return frame;
+  }
+
+  // Writes all frames with a single writer thread and waits until the measurement is closed
+  void Record(const eCAL::rec::JobConfig& job_config, const std::vector<std::shared_ptr<eCAL::rec::Frame>>& frames)
+  {
+    EcalUtils::Filesystem::MkPath(GetHostDirectory(job_config));
+
+    eCAL::rec::Hdf5WriterThread writer_thread(job_config);
+    writer_thread.Start();
+    for (const auto& frame : frames)
+    {
+      EXPECT_TRUE(writer_thread.AddFrame(frame));
+    }
+    writer_thread.Flush();
+    writer_thread.Join();
+  }
+
+  int64_t GetDirectorySize(const std::string& path)
+  {
+    int64_t size = 0;
+    for (const auto& file : EcalUtils::Filesystem::DirContent(path))
+    {
+      if (file.second.GetType() == EcalUtils::Filesystem::Type::RegularFile)
+        size += file.second.FileSize();
+    }
+    return size;
+  }
+
+  // Reads all entries of the channel in the order of their clock
+  std::vector<std::string> ReadChannel(eCAL::eh5::v3::HDF5Meas& reader, const std::string& channel_name)
+  {
+    std::map<long long, std::string> entries_by_clock;
+
+    eCAL::eh5::EntryInfoSet entry_infos;
+    EXPECT_TRUE(reader.GetEntriesInfo(eCAL::eh5::SChannel(channel_name, 0), entry_infos));
+    for (const auto& entry_info : entry_infos)
+    {
+      size_t data_size = 0;
+      EXPECT_TRUE(reader.GetEntryDataSize(entry_info.ID, data_size));
+
+      std::string data(data_size, ' ');
+      EXPECT_TRUE(reader.GetEntryData(entry_info.ID, &data[0]));
+      entries_by_clock[entry_info.SndClock] = data;
+    }
+
+    std::vector<std::string> entries;
+    for (const auto& entry : entries_by_clock)
+      entries.push_back(entry.second);
+    return entries;
+  }
+}
+
+TEST(rec_client_core, Hdf5WriterThreadCompressesTopics)
+{
+  if (!eCAL::eh5::IsCompressionAvailable(eCAL::eh5::eCompression::DEFLATE))
+  {
+    GTEST_SKIP() << "HDF5 has been built without the DEFLATE (zlib) filter";
+  }
+
+  EcalUtils::Filesystem::DeleteDir(meas_root_dir);
+
+  // Well compressible payloads, as they are typical for JSON or grid maps
+  std::vector<std::string>                        payloads;
+  std::vector<std::shared_ptr<eCAL::rec::Frame>> frames;
+  for (int i = 0; i < 20; ++i)
+  {
+    std::string payload;
+    for (int j = 0; j < 2000; ++j)
+      payload += "{\"cell\": " + std::to_string(j % 10) + ", \"free\": true}\n";
+    payload += std::to_string(i);
+
+    payloads.push_back(payload);
+    frames.push_back(CreateFrame("compressed_topic", payload, i));
+  }
+
+  // Record the same frames with and without compression
+  auto compressed_job_config = CreateJobConfig("compressed");
+  compressed_job_config.SetTopicCompression({ { "compressed_topic", eCAL::rec::Compression::Deflate } });
+  Record(compressed_job_config, frames);
+
+  const auto uncompressed_job_config = CreateJobConfig("uncompressed");
+  Record(uncompressed_job_config, frames);
+
+  // The recorder writes the HDF5 files with compressed chunks
+  const int64_t compressed_size   = GetDirectorySize(GetHostDirectory(compressed_job_config));
+  const int64_t uncompressed_size = GetDirectorySize(GetHostDirectory(uncompressed_job_config));
+  EXPECT_GT(compressed_size, 0);
+  EXPECT_LT(compressed_size * 4, uncompressed_size);
+
+  // Reading them is transparent
+  eCAL::eh5::v3::HDF5Meas reader;
+  ASSERT_TRUE(reader.Open(GetHostDirectory(compressed_job_config)));
+  EXPECT_EQ(ReadChannel(reader, "compressed_topic"), payloads);
+}
+
+TEST(rec_client_core, Hdf5WriterThreadFlushWhileAddingFrames)
+{
+  EcalUtils::Filesystem::DeleteDir(meas_root_dir);
+
+  const auto job_config = CreateJobConfig("flush_while_adding");
+  EcalUtils::Filesystem::MkPath(GetHostDirectory(job_config));
+
+  // Frames that are accepted while flushing starts must still be written
+  const int producer_count = 4;
+  std::vector<std::vector<std::string>> accepted_payloads(producer_count);
+  {
+    eCAL::rec::Hdf5WriterThread writer_thread(job_config);
+    writer_thread.Start();
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producer_count; ++producer)
+    {
+      producers.emplace_back([&writer_thread, &accepted_payloads, producer]()
+                             {
+                               const std::string topic_name = "topic_" + std::to_string(producer);
+                               for (long long i = 0; ; ++i)
+                               {
+                                 const std::string payload = topic_name + " frame " + std::to_string(i);
+                                 if (!writer_thread.AddFrame(CreateFrame(topic_name, payload, i)))
+                                   break;
+                                 accepted_payloads[producer].push_back(payload);
+                               }
+                             });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writer_thread.Flush();
+    for (auto& producer : producers)
+      producer.join();
+    writer_thread.Join();
+  }
+
+  eCAL::eh5::v3::HDF5Meas reader;
+  ASSERT_TRUE(reader.Open(GetHostDirectory(job_config)));
+  for (int producer = 0; producer < producer_count; ++producer)
+  {
+    const std::string topic_name = "topic_" + std::to_string(producer);
+    EXPECT_FALSE(accepted_payloads[producer].empty());
+    EXPECT_EQ(ReadChannel(reader, topic_name), accepted_payloads[producer]) << topic_name;
+  }
+}
+
+TEST(rec_client_core, RecordJobWithMultipleWriters)
+{
+  EcalUtils::Filesystem::DeleteDir(meas_root_dir);
+
+  const int topic_count      = 12;
+  const int frames_per_topic = 50;
+
+  auto job_config = CreateJobConfig("multiple_writers");
+  job_config.SetWriterThreadCount(4);
+  EcalUtils::Filesystem::MkPath(GetHostDirectory(job_config));
+
+  // The first frames of each topic come from the pre-buffer, the rest is added while recording
+  std::map<std::string, eCAL::rec::TopicInfo>   topic_info_map;
+  std::deque<std::shared_ptr<eCAL::rec::Frame>> frame_buffer;
+  std::map<std::string, std::vector<std::string>> expected_payloads;
+  for (int topic = 0; topic < topic_count; ++topic)
+  {
+    const std::string topic_name = "topic_" + std::to_string(topic);
+    topic_info_map.emplace(topic_name, eCAL::rec::TopicInfo("type_" + std::to_string(topic), "encoding", "descriptor"));
+
+    for (int i = 0; i < 5; ++i)
+    {
+      const std::string payload = topic_name + " frame " + std::to_string(i);
+      frame_buffer.push_back(CreateFrame(topic_name, payload, i));
+      expected_payloads[topic_name].push_back(payload);
+    }
+  }
+
+  {
+    eCAL::rec::RecordJob record_job(job_config);
+    ASSERT_TRUE(record_job.StartRecording(topic_info_map, frame_buffer));
+
+    for (int i = 5; i < frames_per_topic; ++i)
+    {
+      for (int topic = 0; topic < topic_count; ++topic)
+      {
+        const std::string topic_name = "topic_" + std::to_string(topic);
+        const std::string payload    = topic_name + " frame " + std::to_string(i);
+        EXPECT_TRUE(record_job.AddFrame(CreateFrame(topic_name, payload, i)));
+        expected_payloads[topic_name].push_back(payload);
+      }
+    }
+
+    ASSERT_TRUE(record_job.StopRecording());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while ((record_job.GetMainRecorderState() != eCAL::rec::JobState::FinishedFlushing)
+      && (std::chrono::steady_clock::now() < deadline))
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(record_job.GetMainRecorderState(), eCAL::rec::JobState::FinishedFlushing);
+  }
+
+  // Every topic has been written completely, no matter which writer it belongs to
+  eCAL::eh5::v3::HDF5Meas reader;
+  ASSERT_TRUE(reader.Open(GetHostDirectory(job_config)));
+  for (const auto& topic : expected_payloads)
+  {
+    EXPECT_EQ(ReadChannel(reader, topic.first), topic.second) << topic.first;
+    EXPECT_EQ(reader.GetChannelDataTypeInformation(eCAL::eh5::SChannel(topic.first, 0)).name, topic_info_map.at(topic.first).tinfo_.name);
+  }
+
+  // The writers have written separate files
+  size_t hdf5_file_count = 0;
+  for (const auto& file : EcalUtils::Filesystem::DirContent(GetHostDirectory(job_config)))
+  {
+    if (file.first.find(".hdf5") != std::string::npos)
+      ++hdf5_file_count;
+  }
+  EXPECT_GT(hdf5_file_count, 1);
+}
@@ -0,0 +1,115 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "mpsc_queue.h"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(MpscQueue, PopFromEmptyQueue)
+{
+  eCAL::rec::MpscQueue<int> queue;
+
+  int value = 0;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpscQueue, KeepsOrderOfSingleProducer)
+{
+  eCAL::rec::MpscQueue<int> queue;
+  for (int i = 0; i < 1000; ++i)
+    queue.push(i);
+
+  EXPECT_FALSE(queue.empty());
+  for (int i = 0; i < 1000; ++i)
+  {
+    int value = -1;
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+
+  int value = 0;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpscQueue, ConcurrentProducers)
+{
+  constexpr size_t producer_count       = 8;
+  constexpr size_t elements_per_producer = 20000;
+
+  // Element: producer index, sequence number within the producer
+  eCAL::rec::MpscQueue<std::pair<size_t, size_t>> queue;
+
+  std::vector<std::thread> producers;
+  for (size_t producer = 0; producer < producer_count; ++producer)
+  {
+    producers.emplace_back([&queue, producer]()
+                           {
+                             for (size_t i = 0; i < elements_per_producer; ++i)
+                               queue.push({ producer, i });
+                           });
+  }
+
+  // Pop while the producers are still pushing. Every element must arrive
+  // exactly once and in the order of its producer.
+  std::vector<size_t> next_sequence(producer_count, 0);
+  size_t popped = 0;
+  while (popped < producer_count * elements_per_producer)
+  {
+    std::pair<size_t, size_t> element;
+    if (!queue.pop(element))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    ASSERT_LT(element.first, producer_count);
+    ASSERT_EQ(element.second, next_sequence[element.first]);
+    ++next_sequence[element.first];
+    ++popped;
+  }
+
+  for (auto& producer : producers)
+    producer.join();
+
+  std::pair<size_t, size_t> element;
+  EXPECT_FALSE(queue.pop(element));
+  for (size_t producer = 0; producer < producer_count; ++producer)
+    EXPECT_EQ(next_sequence[producer], elements_per_producer);
+}
+
+TEST(MpscQueue, DestructorReleasesRemainingElements)
+{
+  auto element = std::make_shared<int>(42);
+  {
+    eCAL::rec::MpscQueue<std::shared_ptr<int>> queue;
+    queue.push(element);
+    queue.push(element);
+    EXPECT_EQ(element.use_count(), 3);
+  }
+  EXPECT_EQ(element.use_count(), 1);
+}
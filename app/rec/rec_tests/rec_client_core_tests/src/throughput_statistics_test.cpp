@@ -0,0 +1,105 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "throughput_statistics.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  // With 10 bins per second, frames are counted as soon as their 100 ms bin
+  // is not the active one anymore and for about one second after that.
+  constexpr size_t bins_per_second = 10;
+
+  void WaitForActiveBinToPass()
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+  }
+}
+
+TEST(ShardedThroughputStatistics, EmptyStatistics)
+{
+  eCAL::rec::ShardedThroughputStatistics statistics(bins_per_second);
+
+  const auto throughput = statistics.GetThroughput();
+  EXPECT_EQ(throughput.bytes_per_second_,  0);
+  EXPECT_EQ(throughput.frames_per_second_, 0);
+}
+
+TEST(ShardedThroughputStatistics, SingleThread)
+{
+  eCAL::rec::ShardedThroughputStatistics statistics(bins_per_second);
+
+  for (int i = 0; i < 10; ++i)
+    statistics.AddFrame(100);
+
+  WaitForActiveBinToPass();
+
+  const auto throughput = statistics.GetThroughput();
+  EXPECT_EQ(throughput.bytes_per_second_,  1000);
+  EXPECT_EQ(throughput.frames_per_second_, 10);
+}
+
+TEST(ShardedThroughputStatistics, AggregatesAllShards)
+{
+  constexpr size_t   thread_count      = 32;
+  constexpr size_t   frames_per_thread = 1000;
+  constexpr uint64_t frame_size        = 10;
+
+  eCAL::rec::ShardedThroughputStatistics statistics(bins_per_second);
+
+  // Many threads, so the frames are spread over several shards
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&statistics]()
+                         {
+                           for (size_t i = 0; i < frames_per_thread; ++i)
+                             statistics.AddFrame(frame_size);
+                         });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  WaitForActiveBinToPass();
+
+  const auto throughput = statistics.GetThroughput();
+  EXPECT_EQ(throughput.frames_per_second_, thread_count * frames_per_thread);
+  EXPECT_EQ(throughput.bytes_per_second_,  thread_count * frames_per_thread * frame_size);
+}
+
+TEST(ShardedThroughputStatistics, ForgetsOldFrames)
+{
+  eCAL::rec::ShardedThroughputStatistics statistics(bins_per_second);
+
+  statistics.AddFrame(100);
+  WaitForActiveBinToPass();
+  EXPECT_EQ(statistics.GetThroughput().frames_per_second_, 1);
+
+  // After more than a second, the frame has left the window
+  std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+  EXPECT_EQ(statistics.GetThroughput().frames_per_second_, 0);
+}
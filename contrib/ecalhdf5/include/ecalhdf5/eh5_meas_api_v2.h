@@ -239,6 +239,17 @@ namespace eCAL
       **/
       void SetChannelDataTypeInformation(const std::string& channel_name, const DataTypeInformation& info);
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards. Reading compressed
+       * entries is transparent.
+       *
+       * @param channel_name  channel name
+       * @param compression   compression codec
+      **/
+      void SetChannelCompression(const std::string& channel_name, eCompression compression);
+
       /**
        * @brief Gets minimum timestamp for specified channel
        *
@@ -281,6 +292,19 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const std::string& channel_name, long long begin, long long end, EntryInfoSet& entries) const;
 
+      /**
+       * @brief Checks if all channels with the given name have an on-disk time index
+       *
+       *        With a time index, GetEntriesInfoRange, GetMinTimestamp and
+       *        GetMaxTimestamp only read the requested part of the entries
+       *        instead of loading all of them into memory.
+       *
+       * @param channel_name  channel name
+       *
+       * @return              true if the channel has a time index
+      **/
+      bool HasTimeIndex(const std::string& channel_name) const;
+
       /**
        * @brief Gets data size of a specific entry
        *
@@ -40,6 +40,18 @@ namespace eCAL
     class HDF5MeasImpl;
 
     inline namespace v3{
+
+    /**
+     * @brief Checks whether the given compression can be used for writing
+     *
+     * DEFLATE requires the HDF5 library to be built with zlib, LZ4 requires
+     * the HDF5 LZ4 filter plugin.
+     *
+     * @param compression   compression codec
+     *
+     * @return  true if the HDF5 filter of the codec is available
+    **/
+    bool IsCompressionAvailable(eCompression compression);
       
     /**
      * @brief eCAL HDF5 measurement API
@@ -203,6 +215,17 @@ namespace eCAL
       **/
       void SetChannelDataTypeInformation(const SChannel& channel, const DataTypeInformation& info);
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards. Reading compressed
+       * entries is transparent.
+       *
+       * @param channel       channel name & id
+       * @param compression   compression codec
+      **/
+      void SetChannelCompression(const SChannel& channel, eCompression compression);
+
       /**
         * @brief Gets minimum timestamp for specified channel
         *
@@ -225,6 +248,13 @@ namespace eCAL
        * @brief Gets the header info for all data entries for the given channel
        *        Header = timestamp + entry id
        *
+       *        Entry IDs are opaque handles for GetEntryData* and must not be
+       *        assumed to be contiguous. When a measurement directory is opened
+       *        with a time index in every file (see HasTimeIndex), the IDs hold
+       *        the index of the file in the upper bits (from bit 40 on) and the
+       *        ID within that file in the lower 40 bits. Otherwise the IDs are
+       *        numbered consecutively across all files, as before.
+       *
        * @param [in]  channel       channel (name & id)
        * @param [out] entries       header info for all data entries
        *
@@ -245,6 +275,24 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const SChannel& channel, long long begin, long long end, EntryInfoSet& entries) const;
 
+      /**
+       * @brief Checks if the given channel has an on-disk time index
+       *
+       *        With a time index, GetEntriesInfoRange, GetMinTimestamp and
+       *        GetMaxTimestamp only read the requested part of the entries
+       *        instead of loading all of them into memory.
+       *
+       *        The index is written by the V6 and the V5 file writer, i.e.
+       *        also by the v2 API and therefore by eCAL Rec. Measurements
+       *        written by older versions have no time index and keep loading
+       *        all entries on open.
+       *
+       * @param channel  channel (name & id)
+       *
+       * @return         true if the channel has a time index
+      **/
+      bool HasTimeIndex(const SChannel& channel) const;
+
       /**
        * @brief Gets data size of a specific entry
        *
@@ -275,6 +323,16 @@ namespace eCAL
       **/
       bool GetEntryDataAsString(long long entry_id, std::string& data) const;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry
+      *        Uncompressed entries are not copied, the view points into a memory mapping of the file.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the data, keeps the underlying memory alive
+      * @return                 Data was retrieved successfully
+      **/
+      bool GetEntryDataView(long long entry_id, EntryDataView& view) const;
+
       /**
        * @brief Set measurement file base name (desired name for the actual hdf5 files that will be created)
        *
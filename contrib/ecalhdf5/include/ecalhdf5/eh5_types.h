@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <ecal/measurement/base/types.h>
@@ -42,6 +45,7 @@ namespace eCAL
     const std::string kChnIdEncoding      ("TypeEncoding");
     const std::string kChnIdDescriptor    ("TypeDescriptor");
     const std::string kChnIdData          ("DataTable");
+    const std::string kChnIdTimeIndex     ("TimeIndex");
     const std::string kFileVerAttrTitle   ("Version");
     const std::string kTimestampAttrTitle ("Timestamps");
     const std::string kChnAttrTitle       ("Channels");
@@ -71,7 +75,67 @@ namespace eCAL
         CREATE_V5  //!< Create a legacy V5 hdf5 measurement (For testing purpose only!)
       };
     }
+
+    /**
+     * @brief Compression of the payload of a channel
+     *
+     * Compression is implemented as HDF5 filter, so decompression is
+     * transparent for all readers. LZ4 requires the HDF5 LZ4 filter plugin
+     * (e.g. from the HDF5_PLUGIN_PATH) for writing and reading. If it is not
+     * available when writing, DEFLATE is used instead.
+     *
+     * HDF5 is built thread safe and runs every call under one global lock.
+     * If eCAL HDF5 has been built with zlib, DEFLATE entries are compressed
+     * in the writing thread before they are handed to HDF5, so several
+     * writers compress in parallel. LZ4 entries are compressed by the filter
+     * within HDF5, so the LZ4 compression of all writers of a process is
+     * serialized.
+     */
+    enum class eCompression
+    {
+      NONE,      //!< The payload is stored uncompressed
+      DEFLATE,   //!< Fast deflate / zlib compression
+      LZ4,       //!< LZ4 compression (HDF5 filter plugin 32004)
+    };
   
+    /**
+     * @brief Read-only view on the payload of an entry
+     *
+     * For uncompressed entries, the view points directly into a memory
+     * mapping of the measurement file, so no data is copied. Other entries
+     * (e.g. compressed ones) are read into a buffer owned by the view.
+     *
+     * The view keeps the mapping / buffer alive, so it stays valid even
+     * after the measurement has been closed. The file must not be modified
+     * while a view on it exists.
+     */
+    class EntryDataView
+    {
+    public:
+      EntryDataView()
+        : data_(nullptr)
+        , size_(0)
+      {}
+
+      EntryDataView(std::shared_ptr<const void> owner, const char* data, size_t size)
+        : owner_(std::move(owner))
+        , data_ (data)
+        , size_ (size)
+      {}
+
+      const char* data()  const { return data_; }
+      size_t      size()  const { return size_; }
+      bool        empty() const { return size_ == 0; }
+
+      const char* begin() const { return data_; }
+      const char* end()   const { return data_ + size_; }
+
+    private:
+      std::shared_ptr<const void> owner_;
+      const char*                 data_;
+      size_t                      size_;
+    };
+
     using eCAL::experimental::measurement::base::DataTypeInformation;
     //!< @endcond
   }  // namespace eh5
@@ -189,6 +189,11 @@ void eCAL::eh5::v2::HDF5Meas::SetChannelDataTypeInformation(const std::string& c
   return hdf_meas_impl_->SetChannelDataTypeInformation(createChannel(channel_name), info);
 }
 
+void eCAL::eh5::v2::HDF5Meas::SetChannelCompression(const std::string& channel_name, eCompression compression)
+{
+  return hdf_meas_impl_->SetChannelCompression(createChannel(channel_name), compression);
+}
+
 long long eCAL::eh5::v2::HDF5Meas::GetMinTimestamp(const std::string& channel_name) const
 {
   auto named_channels = GetChannelsWithName(hdf_meas_impl_, channel_name);
@@ -245,6 +250,18 @@ bool eCAL::eh5::v2::HDF5Meas::GetEntriesInfoRange(const std::string& channel_nam
   return ret_value;
 }
 
+bool eCAL::eh5::v2::HDF5Meas::HasTimeIndex(const std::string& channel_name) const
+{
+  auto named_channels = GetChannelsWithName(hdf_meas_impl_, channel_name);
+  if (named_channels.empty()) return false;
+
+  for (const auto& channel : named_channels)
+  {
+    if (!hdf_meas_impl_->HasTimeIndex(channel)) return false;
+  }
+  return true;
+}
+
 bool eCAL::eh5::v2::HDF5Meas::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   return hdf_meas_impl_->GetEntryDataSize(entry_id, size);
@@ -38,6 +38,7 @@
 #include "eh5_meas_file_v6.h"
 
 #include "escape.h"
+#include "hdf5_helper.h"
 
 namespace
 {
@@ -261,6 +262,19 @@ void eCAL::eh5::v3::HDF5Meas::SetChannelDataTypeInformation(const SChannel& chan
   }
 }
 
+bool eCAL::eh5::v3::IsCompressionAvailable(eCompression compression)
+{
+  return IsCompressionFilterAvailable(compression);
+}
+
+void eCAL::eh5::v3::HDF5Meas::SetChannelCompression(const SChannel& channel, eCompression compression)
+{
+  if (hdf_meas_impl_)
+  {
+    hdf_meas_impl_->SetChannelCompression(SEscapedChannel::fromSChannel(channel), compression);
+  }
+}
+
 long long eCAL::eh5::v3::HDF5Meas::GetMinTimestamp(const SChannel& channel) const
 {
   long long ret_val = 0;
@@ -305,6 +319,17 @@ bool eCAL::eh5::v3::HDF5Meas::GetEntriesInfoRange(const SChannel& channel, long
   return ret_val;
 }
 
+bool eCAL::eh5::v3::HDF5Meas::HasTimeIndex(const SChannel& channel) const
+{
+  bool ret_val = false;
+  if (hdf_meas_impl_)
+  {
+    ret_val = hdf_meas_impl_->HasTimeIndex(SEscapedChannel::fromSChannel(channel));
+  }
+
+  return ret_val;
+}
+
 bool eCAL::eh5::v3::HDF5Meas::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   bool ret_val = false;
@@ -336,6 +361,15 @@ bool eCAL::eh5::v3::HDF5Meas::GetEntryDataAsString(long long entry_id, std::stri
   return false;
 }
 
+bool eCAL::eh5::v3::HDF5Meas::GetEntryDataView(long long entry_id, EntryDataView& view) const
+{
+  if (hdf_meas_impl_)
+  {
+    return hdf_meas_impl_->GetEntryDataView(entry_id, view);
+  }
+  return false;
+}
+
 void eCAL::eh5::v3::HDF5Meas::SetFileBaseName(const std::string& base_name)
 {
   if (hdf_meas_impl_)
@@ -31,6 +31,7 @@
 #include <dirent.h>
 #endif //_WIN32
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <list>
@@ -45,14 +46,16 @@
 // TODO: Test the one-file-per-channel setting with gtest
 constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
 eCAL::eh5::HDF5MeasDir::HDF5MeasDir()
-  : access_              (v3::eAccessType::RDONLY) // Temporarily set it to RDONLY, so the leading "Close()" from the Open() function will not operate on the uninitialized variable.
+  : time_indexed_        (false)
+  , access_              (v3::eAccessType::RDONLY) // Temporarily set it to RDONLY, so the leading "Close()" from the Open() function will not operate on the uninitialized variable.
   , one_file_per_channel_(false)
   , max_size_per_file_   (kDefaultMaxFileSizeMB * 1024 * 1024)
   , cb_pre_split_        (nullptr)
 {}
 
 eCAL::eh5::HDF5MeasDir::HDF5MeasDir(const std::string& path, v3::eAccessType access /*= eAccessType::RDONLY*/)
-  : access_              (access)
+  : time_indexed_        (false)
+  , access_              (access)
   , one_file_per_channel_(false)
   , max_size_per_file_   (kDefaultMaxFileSizeMB * 1024 * 1024)
   , cb_pre_split_        (nullptr)
@@ -130,6 +133,7 @@ bool eCAL::eh5::HDF5MeasDir::Close()
     channels_info_.clear();
     entries_by_id_.clear();
     entries_by_chn_.clear();
+    time_indexed_ = false;
 
     return successfully_closed;
   }
@@ -141,7 +145,7 @@ bool eCAL::eh5::HDF5MeasDir::IsOk() const
   {
   case eCAL::eh5::v3::eAccessType::RDONLY:
   //case eCAL::eh5::RDWR:
-    return !file_readers_.empty() && !entries_by_id_.empty();
+    return !file_readers_.empty() && (time_indexed_ || !entries_by_id_.empty());
   case eCAL::eh5::v3::eAccessType::CREATE:
   case eCAL::eh5::v3::eAccessType::CREATE_V5:
     return true;
@@ -225,9 +229,33 @@ void eCAL::eh5::HDF5MeasDir::SetChannelDataTypeInformation(const SEscapedChannel
   channels_info_[channel] = ChannelInfo(info);
 }
 
+void eCAL::eh5::HDF5MeasDir::SetChannelCompression(const SEscapedChannel& channel, eCompression compression)
+{
+  // Don't create a writer (and therefore a file) for channels that may never
+  // receive any data. The compression is handed over when the writer is created.
+  channel_compression_[channel] = compression;
+
+  auto file_writer_it = file_writers_.find(one_file_per_channel_ ? channel.name : "");
+  if (file_writer_it != file_writers_.end())
+    file_writer_it->second->SetChannelCompression(channel, compression);
+}
+
 long long eCAL::eh5::HDF5MeasDir::GetMinTimestamp(const SEscapedChannel& channel) const
 {
   long long min_timestamp = std::numeric_limits<long long>::max();
+
+  if (time_indexed_)
+  {
+    const auto& found = channels_info_.find(channel);
+    if (found != channels_info_.end())
+    {
+      // Files without entries of the channel report 0
+      for (const auto* reader : found->second.files_with_entries)
+        min_timestamp = std::min(min_timestamp, reader->GetMinTimestamp(channel.toSChannel()));
+    }
+    return min_timestamp;
+  }
+
   const auto& channel_entries = entries_by_chn_.find(channel);
 
   if (channel_entries != entries_by_chn_.end())
@@ -244,6 +272,18 @@ long long eCAL::eh5::HDF5MeasDir::GetMinTimestamp(const SEscapedChannel& channel
 long long eCAL::eh5::HDF5MeasDir::GetMaxTimestamp(const SEscapedChannel& channel) const
 {
   long long max_timestamp = std::numeric_limits<long long>::min();
+
+  if (time_indexed_)
+  {
+    const auto& found = channels_info_.find(channel);
+    if (found != channels_info_.end())
+    {
+      for (const auto* reader : found->second.files_with_entries)
+        max_timestamp = std::max(max_timestamp, reader->GetMaxTimestamp(channel.toSChannel()));
+    }
+    return max_timestamp;
+  }
+
   const auto& channel_entries = entries_by_chn_.find(channel);
 
   if (channel_entries != entries_by_chn_.end())
@@ -261,6 +301,9 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfo(const SEscapedChannel& channel, Entr
 {
   entries.clear();
 
+  if (time_indexed_)
+    return GetEntriesInfoRange(channel, 0, 0, entries);
+
   const auto& channel_it = entries_by_chn_.find(channel);
   if (channel_it == entries_by_chn_.end())
   {
@@ -276,14 +319,42 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const SEscapedChannel& channel,
 {
   entries.clear();
 
+  if (time_indexed_)
+  {
+    const auto& found = channels_info_.find(channel);
+    if (found == channels_info_.end())
+    {
+      return false;
+    }
+
+    // Only the matching rows are read from the files. Their IDs are made
+    // unique across files by adding the file index.
+    for (const auto* reader : found->second.files)
+    {
+      EntryInfoSet file_entries;
+      if (begin == 0 && end == 0)
+        reader->GetEntriesInfo(channel.toSChannel(), file_entries);
+      else
+        reader->GetEntriesInfoRange(channel.toSChannel(), begin, (end == 0) ? std::numeric_limits<long long>::max() : end, file_entries);
+
+      const long long file_index = GetFileIndex(reader);
+      for (auto entry : file_entries)
+      {
+        entry.ID = (file_index << kFileIndexShift) | entry.ID;
+        entries.insert(entry);
+      }
+    }
+    return !entries.empty();
+  }
+
   const auto& channel_it = entries_by_chn_.find(channel);
   if (channel_it == entries_by_chn_.end())
   {
     return false;
   }
 
-  if (begin == 0) begin = entries.begin()->RcvTimestamp;
-  if (end == 0) end = entries.rbegin()->RcvTimestamp;
+  if (begin == 0) begin = channel_it->second.begin()->RcvTimestamp;
+  if (end == 0) end = channel_it->second.rbegin()->RcvTimestamp;
 
   const auto& lower = channel_it->second.lower_bound(SEntryInfo(begin, 0, 0));
   const auto& upper = channel_it->second.upper_bound(SEntryInfo(end, 0, 0));
@@ -295,10 +366,10 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const SEscapedChannel& channel,
 bool eCAL::eh5::HDF5MeasDir::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   auto ret_val = false;
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  EntryInfo file_entry;
+  if (GetFileEntry(entry_id, file_entry))
   {
-    ret_val = found->second.reader->GetEntryDataSize(found->second.file_id, size);
+    ret_val = file_entry.reader->GetEntryDataSize(file_entry.file_id, size);
   }
   return ret_val;
 }
@@ -306,10 +377,10 @@ bool eCAL::eh5::HDF5MeasDir::GetEntryDataSize(long long entry_id, size_t& size)
 bool eCAL::eh5::HDF5MeasDir::GetEntryData(long long entry_id, void* data) const
 {
   auto ret_val = false;
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  EntryInfo file_entry;
+  if (GetFileEntry(entry_id, file_entry))
   {
-    ret_val = found->second.reader->GetEntryData(found->second.file_id, data);
+    ret_val = file_entry.reader->GetEntryData(file_entry.file_id, data);
   }
   return ret_val;
 }
@@ -319,16 +390,34 @@ bool eCAL::eh5::HDF5MeasDir::GetEntryDataAsString(long long entry_id, std::strin
   bool result = false;
 
   // Find the entry by ID
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  EntryInfo file_entry;
+  if (GetFileEntry(entry_id, file_entry))
   {
     // Get the entry data as a string
-    result = found->second.reader->GetEntryDataAsString(found->second.file_id, data);
+    result = file_entry.reader->GetEntryDataAsString(file_entry.file_id, data);
+  }
+
+  return result;
+}
+
+bool eCAL::eh5::HDF5MeasDir::GetEntryDataView(long long entry_id, EntryDataView& view) const
+{
+  bool result = false;
+
+  EntryInfo file_entry;
+  if (GetFileEntry(entry_id, file_entry))
+  {
+    result = file_entry.reader->GetEntryDataView(file_entry.file_id, view);
   }
 
   return result;
 }
 
+bool eCAL::eh5::HDF5MeasDir::HasTimeIndex(const SEscapedChannel& channel) const
+{
+  return time_indexed_ && HasChannel(channel);
+}
+
 void eCAL::eh5::HDF5MeasDir::SetFileBaseName(const std::string& base_name)
 {
   base_name_ = base_name;
@@ -446,6 +535,7 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
   auto files = GetHdfFiles(path);
 
   long long id = 0;
+  time_indexed_ = !files.empty();
 
   for (const auto& file_path : files)
   {
@@ -463,6 +553,45 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
         channel_info.info = info;
         channel_info.files.push_back(reader);
 
+        time_indexed_ &= reader->HasTimeIndex(channel);
+      }
+      file_readers_.push_back(reader);
+    }
+    else
+    {
+      reader->Close();
+      delete reader;
+      reader = nullptr;
+    }
+  }
+
+  // With a time index, only remember which files have entries of a channel.
+  // Reading the rows at the minimum timestamp only touches a small part of the
+  // entries table, an empty channel has no such rows.
+  if (time_indexed_)
+  {
+    for (auto& channel_info : channels_info_)
+    {
+      const auto channel = channel_info.first.toSChannel();
+      for (const auto* reader : channel_info.second.files)
+      {
+        const long long min_timestamp = reader->GetMinTimestamp(channel);
+        EntryInfoSet entries;
+        if (reader->GetEntriesInfoRange(channel, min_timestamp, min_timestamp + 1, entries) && !entries.empty())
+          channel_info.second.files_with_entries.push_back(reader);
+      }
+    }
+  }
+  // Without a time index in every file, the entries of all files are loaded
+  // and get new IDs
+  else
+  {
+    for (auto* reader : file_readers_)
+    {
+      for (const auto& channel : reader->GetChannels())
+      {
+        auto escaped_channel = SEscapedChannel::fromSChannel(channel);
+
         EntryInfoSet entries;
         if (reader->GetEntriesInfo(channel, entries))
         {
@@ -475,18 +604,36 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
           }
         }
       }
-      file_readers_.push_back(reader);
-    }
-    else
-    {
-      reader->Close();
-      delete reader;
-      reader = nullptr;
     }
   }
+
   return !file_readers_.empty();
 }
 
+bool eCAL::eh5::HDF5MeasDir::GetFileEntry(long long entry_id, EntryInfo& file_entry) const
+{
+  if (time_indexed_)
+  {
+    const auto file_index = static_cast<size_t>(entry_id >> kFileIndexShift);
+    if (entry_id < 0 || file_index >= file_readers_.size()) return false;
+
+    file_entry = EntryInfo(entry_id & ((1LL << kFileIndexShift) - 1), file_readers_[file_index]);
+    return true;
+  }
+
+  const auto& found = entries_by_id_.find(entry_id);
+  if (found == entries_by_id_.end()) return false;
+
+  file_entry = found->second;
+  return true;
+}
+
+long long eCAL::eh5::HDF5MeasDir::GetFileIndex(const eCAL::eh5::v3::HDF5Meas* reader) const
+{
+  const auto found = std::find(file_readers_.begin(), file_readers_.end(), reader);
+  return static_cast<long long>(std::distance(file_readers_.begin(), found));
+}
+
 ::eCAL::eh5::HDF5MeasDir::FileWriterMap::iterator eCAL::eh5::HDF5MeasDir::GetWriter(const SEscapedChannel& channel)
 {
   const auto& channel_name{ channel.name };
@@ -512,6 +659,8 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
     file_writer_it->second->SetFileBaseName(one_file_per_channel_ ? (base_name_ + "_" + GetEscapedFilename(GetUnescapedString(channel_name))) : (base_name_));
     if (cb_pre_split_)
       file_writer_it->second->ConnectPreSplitCallback(cb_pre_split_);
+    for (const auto& compression : channel_compression_)
+      file_writer_it->second->SetChannelCompression(compression.first, compression.second);
 
     // Open the writer
     file_writer_it->second->Open(output_dir_);
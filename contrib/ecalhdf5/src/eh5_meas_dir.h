@@ -27,6 +27,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <memory>
 
 #include "eh5_meas_impl.h"
@@ -162,6 +163,16 @@ namespace eCAL
       **/
       void SetChannelDataTypeInformation(const SEscapedChannel& channel, const DataTypeInformation& info) override;
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards.
+       *
+       * @param channel       channel name & id
+       * @param compression   compression codec
+      **/
+      void SetChannelCompression(const SEscapedChannel& channel, eCompression compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -204,6 +215,15 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
 
+      /**
+      * @brief Checks if the given channel has a time index
+      *
+      * @param channel  channel
+      *
+      * @return         true if the channel has a time index
+      **/
+      bool HasTimeIndex(const SEscapedChannel& channel) const override;
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -234,6 +254,16 @@ namespace eCAL
       **/
       bool GetEntryDataAsString(long long entry_id, std::string& data) const override;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry
+      *        Uncompressed entries are not copied, the view points into a memory mapping of the file.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the data, keeps the underlying memory alive
+      * @return                 Data was retrieved successfully
+      **/
+      bool GetEntryDataView(long long entry_id, EntryDataView& view) const override;
+
       /**
       * @brief Set measurement file base name
       *
@@ -278,6 +308,7 @@ namespace eCAL
       {
         DataTypeInformation info;
         std::list<const eCAL::eh5::v3::HDF5Meas*> files;
+        std::list<const eCAL::eh5::v3::HDF5Meas*> files_with_entries;  //!< Files that hold entries of the channel, only filled when time_indexed_
 
         ChannelInfo() = default;
         ChannelInfo(const DataTypeInformation& info_)
@@ -298,7 +329,7 @@ namespace eCAL
         {}
       };
 
-      using HDF5Files = std::list<eCAL::eh5::v3::HDF5Meas*>;
+      using HDF5Files = std::vector<eCAL::eh5::v3::HDF5Meas*>;
       using ChannelInfoUMap = std::unordered_map<SEscapedChannel, ChannelInfo>;
       using EntriesByIdUMap = std::unordered_map<long long, EntryInfo>;
       using EntriesByChannelUMap =  std::unordered_map<SEscapedChannel, EntryInfoSet>;
@@ -307,6 +338,14 @@ namespace eCAL
       ChannelInfoUMap        channels_info_;
       EntriesByIdUMap        entries_by_id_;
       EntriesByChannelUMap   entries_by_chn_;
+      bool                   time_indexed_;     //!< If true, all files have a time index and entries are read from the files on demand instead of being held in entries_by_id_ / entries_by_chn_
+
+      // Entry IDs when time_indexed_: file index in the upper, entry ID of the file in the lower 40 bits
+      // (up to 2^40 entries per file and 2^23 files). Without a time index the IDs stay consecutive.
+      static constexpr int   kFileIndexShift = 40;
+
+      bool                   GetFileEntry(long long entry_id, EntryInfo& file_entry) const;
+      long long              GetFileIndex(const eCAL::eh5::v3::HDF5Meas* reader) const;
 
       struct Channel
       {
@@ -344,6 +383,7 @@ namespace eCAL
       FileWriterMap       file_writers_;                                        //!< Map of {ChannelName -> FileWriter}. Grows for each new channel, if one_file_per_channel_ is true. Contains only one "" key otherwise that is used for all channels. 
 
       size_t              max_size_per_file_;                                   //!< Maximum file size after which the File Writer shall split
+      std::unordered_map<SEscapedChannel, eCompression> channel_compression_;   //!< Compression per channel. Handed to each File Writer when it is created.
       CallbackFunction    cb_pre_split_;                                        //!< Callback that is executed before a new hdf5 file is created during splitting. Will be executed by each file writer individually.
 
     protected:
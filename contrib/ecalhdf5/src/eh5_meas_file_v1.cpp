@@ -184,6 +184,11 @@ void eCAL::eh5::HDF5MeasFileV1::SetChannelDataTypeInformation(const SEscapedChan
   ReportUnsupportedAction();
 }
 
+void eCAL::eh5::HDF5MeasFileV1::SetChannelCompression(const SEscapedChannel& /*channel*/, eCompression /*compression*/)
+{
+  ReportUnsupportedAction();
+}
+
 long long eCAL::eh5::HDF5MeasFileV1::GetMinTimestamp(const SEscapedChannel& /*channel_name*/) const
 {
   long long ret_val = 0;
@@ -250,8 +255,8 @@ bool eCAL::eh5::HDF5MeasFileV1::GetEntriesInfoRange(const SEscapedChannel& /*cha
 
   if (!entries_.empty())
   {
-    if (begin == 0) begin = entries.begin()->RcvTimestamp;
-    if (end == 0) end = entries.rbegin()->RcvTimestamp;
+    if (begin == 0) begin = entries_.begin()->RcvTimestamp;
+    if (end == 0) end = entries_.rbegin()->RcvTimestamp;
 
     const auto& lower = entries_.lower_bound(SEntryInfo(begin, 0, 0));
     const auto& upper = entries_.upper_bound(SEntryInfo(end, 0, 0));
@@ -263,6 +268,11 @@ bool eCAL::eh5::HDF5MeasFileV1::GetEntriesInfoRange(const SEscapedChannel& /*cha
   return ret_val;
 }
 
+bool eCAL::eh5::HDF5MeasFileV1::HasTimeIndex(const SEscapedChannel& /*channel*/) const
+{
+  return false;
+}
+
 bool eCAL::eh5::HDF5MeasFileV1::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   if (!this->IsOk()) return false;
@@ -305,6 +315,17 @@ bool eCAL::eh5::HDF5MeasFileV1::GetEntryDataAsString(long long /*entry_id*/, std
    return false; 
 }
 
+bool eCAL::eh5::HDF5MeasFileV1::GetEntryDataView(long long entry_id, EntryDataView& view) const
+{
+  view = EntryDataView();
+
+  auto buffer = std::make_shared<std::string>();
+  if (!GetEntryDataAsString(entry_id, *buffer)) return false;
+
+  view = EntryDataView(buffer, buffer->data(), buffer->size());
+  return true;
+}
+
 void eCAL::eh5::HDF5MeasFileV1::SetFileBaseName(const std::string& /*base_name*/)
 {
   ReportUnsupportedAction();
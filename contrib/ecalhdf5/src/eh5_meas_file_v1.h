@@ -153,6 +153,16 @@ namespace eCAL
       **/
       void SetChannelDataTypeInformation(const SEscapedChannel& channel, const DataTypeInformation& info) override;
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards.
+       *
+       * @param channel       channel name & id
+       * @param compression   compression codec
+      **/
+      void SetChannelCompression(const SEscapedChannel& channel, eCompression compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -195,6 +205,15 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
 
+      /**
+      * @brief Checks if the given channel has a time index
+      *
+      * @param channel  channel
+      *
+      * @return         true if the channel has a time index
+      **/
+      bool HasTimeIndex(const SEscapedChannel& channel) const override;
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -225,6 +244,16 @@ namespace eCAL
       **/
       bool GetEntryDataAsString(long long entry_id, std::string& data) const override;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry
+      *        Uncompressed entries are not copied, the view points into a memory mapping of the file.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the data, keeps the underlying memory alive
+      * @return                 Data was retrieved successfully
+      **/
+      bool GetEntryDataView(long long entry_id, EntryDataView& view) const override;
+
       /**
       * @brief Set measurement file base name
       *
@@ -26,6 +26,7 @@
 #include "datatype_helper.h"
 
 #include "hdf5.h"
+#include <ecal_utils/mapped_file.h>
 #include <ecal_utils/string.h>
 
 #include <iostream>
@@ -70,12 +71,19 @@ bool eCAL::eh5::HDF5MeasFileV2::Open(const std::string& path, v3::eAccessType ac
 
   // call the function via its class becase it's a virtual function that is called directly/indirectly in constructor/destructor,-
   // where the vtable is not created yet or it's destructed.
-  return HDF5MeasFileV2::IsOk();
+  if (!HDF5MeasFileV2::IsOk()) return false;
+
+  // The file is read only, so it can be mapped once for all (concurrent) GetEntryDataView calls
+  mapped_file_ = std::make_shared<const EcalUtils::MappedFile>(path);
+  return true;
 }
 
 
 bool eCAL::eh5::HDF5MeasFileV2::Close()
 {
+  // Views that have been handed out keep their own reference to the mapping
+  mapped_file_.reset();
+
   if (HDF5MeasFileV2::IsOk() && H5Fclose(file_id_) >= 0)
   {
     file_id_ = -1;
@@ -168,6 +176,10 @@ void eCAL::eh5::HDF5MeasFileV2::SetChannelDataTypeInformation(const SEscapedChan
 {
 }
 
+void eCAL::eh5::HDF5MeasFileV2::SetChannelCompression(const SEscapedChannel& /*channel*/, eCompression /*compression*/)
+{
+}
+
 
 long long eCAL::eh5::HDF5MeasFileV2::GetMinTimestamp(const SEscapedChannel& channel) const
 {
@@ -237,8 +249,8 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntriesInfoRange(const SEscapedChannel& chann
 
   if (GetEntriesInfo(channel, all_entries) && !all_entries.empty())
   {
-    if (begin == 0) begin = entries.begin()->RcvTimestamp;
-    if (end == 0) end = entries.rbegin()->RcvTimestamp;
+    if (begin == 0) begin = all_entries.begin()->RcvTimestamp;
+    if (end == 0) end = all_entries.rbegin()->RcvTimestamp;
 
     const auto& lower = all_entries.lower_bound(SEntryInfo(begin, 0, 0));
     const auto& upper = all_entries.upper_bound(SEntryInfo(end, 0, 0));
@@ -250,6 +262,11 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntriesInfoRange(const SEscapedChannel& chann
   return ret_val;
 }
 
+bool eCAL::eh5::HDF5MeasFileV2::HasTimeIndex(const SEscapedChannel& /*channel*/) const
+{
+  return false;
+}
+
 bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   if (!this->IsOk()) return false;
@@ -258,10 +275,14 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataSize(long long entry_id, size_t& siz
 
   if (dataset_id < 0) return false;
 
-  size = static_cast<size_t>(H5Dget_storage_size(dataset_id));
+  const auto data_size = GetDataSetSize(dataset_id);
 
   H5Dclose(dataset_id);
 
+  if (data_size < 0) return false;
+
+  size = static_cast<size_t>(data_size);
+
   return true;
 }
 
@@ -275,7 +296,7 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryData(long long entry_id, void* data) con
 
   if (dataset_id < 0) return false;
 
-  auto size = H5Dget_storage_size(dataset_id);
+  auto size = GetDataSetSize(dataset_id);
 
   herr_t read_status = -1;
   if (size >= 0)
@@ -297,9 +318,14 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataAsString(long long entry_id, std::st
 
   if (dataset_id < 0) return false;
 
-  const auto stored_data_size = static_cast<size_t>(H5Dget_storage_size(dataset_id));
+  const auto stored_data_size = GetDataSetSize(dataset_id);
+  if (stored_data_size < 0)
+  {
+    H5Dclose(dataset_id);
+    return false;
+  }
 
-  data.resize(stored_data_size);
+  data.resize(static_cast<size_t>(stored_data_size));
   void* data_ptr = const_cast<void*>(static_cast<const void*>(data.data()));
 
   const herr_t read_status = H5Dread(dataset_id, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_ptr);
@@ -309,6 +335,40 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataAsString(long long entry_id, std::st
   return (read_status >= 0);
 }
 
+bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataView(long long entry_id, EntryDataView& view) const
+{
+  view = EntryDataView();
+  if (!this->IsOk()) return false;
+
+  const auto dataset_id = H5Dopen(file_id_, std::to_string(entry_id).c_str(), H5P_DEFAULT);
+  if (dataset_id < 0) return false;
+
+  const auto data_size = GetDataSetSize(dataset_id);
+  // Only contiguous (i.e. uncompressed) datasets have an offset in the file
+  const auto data_offset = H5Dget_offset(dataset_id);
+  H5Dclose(dataset_id);
+
+  if (data_size < 0)  return false;
+  if (data_size == 0) return true;
+
+  if (data_offset != HADDR_UNDEF)
+  {
+    if (mapped_file_ && (mapped_file_->Data() != nullptr)
+      && (data_offset + static_cast<haddr_t>(data_size) <= mapped_file_->Size()))
+    {
+      view = EntryDataView(mapped_file_, mapped_file_->Data() + data_offset, static_cast<size_t>(data_size));
+      return true;
+    }
+  }
+
+  // Fallback: copy the data into a buffer owned by the view
+  auto buffer = std::make_shared<std::string>();
+  if (!GetEntryDataAsString(entry_id, *buffer)) return false;
+
+  view = EntryDataView(buffer, buffer->data(), buffer->size());
+  return true;
+}
+
 void eCAL::eh5::HDF5MeasFileV2::SetFileBaseName(const std::string& /*base_name*/)
 {
 
@@ -23,10 +23,17 @@
 
 #pragma once
 
+#include <memory>
+
 #include "hdf5.h"
 #include "eh5_meas_impl.h"
 #include "escape.h"
 
+namespace EcalUtils
+{
+  class MappedFile;
+}
+
 namespace eCAL
 {
   namespace eh5
@@ -153,6 +160,16 @@ namespace eCAL
       **/
       void SetChannelDataTypeInformation(const SEscapedChannel& channel, const DataTypeInformation& info) override;
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards.
+       *
+       * @param channel       channel name & id
+       * @param compression   compression codec
+      **/
+      void SetChannelCompression(const SEscapedChannel& channel, eCompression compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -195,6 +212,15 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
 
+      /**
+      * @brief Checks if the given channel has a time index
+      *
+      * @param channel  channel
+      *
+      * @return         true if the channel has a time index
+      **/
+      bool HasTimeIndex(const SEscapedChannel& channel) const override;
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -225,6 +251,16 @@ namespace eCAL
       **/
       bool GetEntryDataAsString(long long entry_id, std::string& data) const override;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry
+      *        Uncompressed entries are not copied, the view points into a memory mapping of the file.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the data, keeps the underlying memory alive
+      * @return                 Data was retrieved successfully
+      **/
+      bool GetEntryDataView(long long entry_id, EntryDataView& view) const override;
+
       /**
       * @brief Set measurement file base name
       *
@@ -263,6 +299,9 @@ namespace eCAL
 
     protected:
       hid_t file_id_;
+
+    private:
+      std::shared_ptr<const EcalUtils::MappedFile> mapped_file_;   //!< Mapping of the file for GetEntryDataView, created when the file is opened
     };
 
   }  // namespace eh5
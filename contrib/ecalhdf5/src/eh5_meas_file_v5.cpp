@@ -24,6 +24,7 @@
 #include "eh5_meas_file_v5.h"
 
 #include "hdf5.h"
+#include "hdf5_helper.h"
 
 namespace eCAL
 {
@@ -74,5 +75,34 @@ namespace eCAL
 
       return (status >= 0);
     }
+
+    long long HDF5MeasFileV5::GetMinTimestamp(const SEscapedChannel& channel) const
+    {
+      if (!HasTimeIndex(channel)) return HDF5MeasFileV2::GetMinTimestamp(channel);
+
+      return GetSortedEntryInfoMinTimestamp(file_id_, channel.name);
+    }
+
+    long long HDF5MeasFileV5::GetMaxTimestamp(const SEscapedChannel& channel) const
+    {
+      if (!HasTimeIndex(channel)) return HDF5MeasFileV2::GetMaxTimestamp(channel);
+
+      return GetSortedEntryInfoMaxTimestamp(file_id_, channel.name);
+    }
+
+    bool HDF5MeasFileV5::GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const
+    {
+      if (!HasTimeIndex(channel)) return HDF5MeasFileV2::GetEntriesInfoRange(channel, begin, end, entries);
+
+      return GetIndexedEntryInfoRange(file_id_, channel.name, v5::GetTimeIndexUrl(channel.name), begin, end, entries);
+    }
+
+    bool HDF5MeasFileV5::HasTimeIndex(const SEscapedChannel& channel) const
+    {
+      if (!this->IsOk() || !HasChannel(channel)) return false;
+
+      const auto url = v5::GetTimeIndexUrl(channel.name);
+      return H5Lexists(file_id_, url.c_str(), H5P_DEFAULT) > 0;
+    }
   }  //  namespace eh5
 }  //  namespace eCAL
@@ -62,6 +62,14 @@ namespace eCAL
       * @return                    true if succeeds, false if it fails
       **/
       bool GetEntriesInfo(const SEscapedChannel& channel, EntryInfoSet& entries) const override;
+
+      long long GetMinTimestamp(const SEscapedChannel& channel) const override;
+
+      long long GetMaxTimestamp(const SEscapedChannel& channel) const override;
+
+      bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
+
+      bool HasTimeIndex(const SEscapedChannel& channel) const override;
     };
   }  //  namespace eh5
 }  //  namespace eCAL
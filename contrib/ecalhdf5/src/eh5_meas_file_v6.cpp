@@ -113,6 +113,20 @@ namespace eCAL
       return eCAL::eh5::DataTypeInformation{ type_name, type_encoding, type_descriptor };
     }
 
+    long long HDF5MeasFileV6::GetMinTimestamp(const SEscapedChannel& channel) const
+    {
+      if (!HasTimeIndex(channel)) return HDF5MeasFileV2::GetMinTimestamp(channel);
+
+      return GetSortedEntryInfoMinTimestamp(file_id_, v6::GetUrl(channel.name, printHex(channel.id), kChnIdData));
+    }
+
+    long long HDF5MeasFileV6::GetMaxTimestamp(const SEscapedChannel& channel) const
+    {
+      if (!HasTimeIndex(channel)) return HDF5MeasFileV2::GetMaxTimestamp(channel);
+
+      return GetSortedEntryInfoMaxTimestamp(file_id_, v6::GetUrl(channel.name, printHex(channel.id), kChnIdData));
+    }
+
     bool eCAL::eh5::HDF5MeasFileV6::GetEntriesInfo(const SEscapedChannel& channel, EntryInfoSet& entries) const
      {
       if (!this->IsOk()) return false;
@@ -124,5 +138,21 @@ namespace eCAL
 
       return true;
     }
+
+    bool HDF5MeasFileV6::GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const
+    {
+      if (!HasTimeIndex(channel)) return HDF5MeasFileV2::GetEntriesInfoRange(channel, begin, end, entries);
+
+      const auto hex_id = printHex(channel.id);
+      return GetIndexedEntryInfoRange(file_id_, v6::GetUrl(channel.name, hex_id, kChnIdData), v6::GetUrl(channel.name, hex_id, kChnIdTimeIndex), begin, end, entries);
+    }
+
+    bool HDF5MeasFileV6::HasTimeIndex(const SEscapedChannel& channel) const
+    {
+      if (!this->IsOk() || !HasChannel(channel)) return false;
+
+      const auto url = v6::GetUrl(channel.name, printHex(channel.id), kChnIdTimeIndex);
+      return H5Lexists(file_id_, url.c_str(), H5P_DEFAULT) > 0;
+    }
   }  //  namespace eh5
 }  //  namespace eCAL
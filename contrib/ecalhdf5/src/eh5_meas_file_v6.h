@@ -70,7 +70,15 @@ namespace eCAL
 
       DataTypeInformation GetChannelDataTypeInformation(const SEscapedChannel& channel) const override;
 
+      long long GetMinTimestamp(const SEscapedChannel& channel) const override;
+
+      long long GetMaxTimestamp(const SEscapedChannel& channel) const override;
+
       bool GetEntriesInfo(const SEscapedChannel& channel, EntryInfoSet& entries) const override;
+
+      bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
+
+      bool HasTimeIndex(const SEscapedChannel& channel) const override;
     };
   }  //  namespace eh5
 }  //  namespace eCAL
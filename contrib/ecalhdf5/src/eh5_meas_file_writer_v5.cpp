@@ -24,6 +24,7 @@
 #include "eh5_meas_file_writer_v5.h"
 #include "escape.h"
 #include "datatype_helper.h"
+#include "hdf5_helper.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -31,6 +32,7 @@
 #include <dirent.h>
 #endif //_WIN32
 
+#include <algorithm>
 #include <string>
 #include <list>
 #include <iostream>
@@ -39,6 +41,7 @@
 #include <ecal_utils/str_convert.h>
 
 constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
+constexpr long long    kTimeIndexIntervalUs  = 1000 * 1000;
 
 eCAL::eh5::HDF5MeasFileWriterV5::HDF5MeasFileWriterV5()
   : cb_pre_split_      (nullptr)
@@ -74,9 +77,15 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::Close()
 
   std::string channels_with_entries;
 
-  for (const auto& channel : channels_)
+  for (auto& channel : channels_)
+  {
+    // Entries are added in the order they arrive, which may differ slightly
+    // from their timestamps. The time index requires a sorted table.
+    std::stable_sort(channel.second.Entries.begin(), channel.second.Entries.end());
+
     if (CreateEntriesTableOfContentsFor(channel.first, channel.second.Type, channel.second.Description, channel.second.Entries))
       channels_with_entries += channel.first + ",";
+  }
 
   if ((!channels_with_entries.empty())  && (channels_with_entries.back() == ','))
     channels_with_entries.pop_back();
@@ -86,6 +95,8 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::Close()
   for (auto& channel : channels_)
     channel.second.Entries.clear();
 
+  writeback_.Detach();
+
   if (H5Fclose(file_id_) >= 0)
   {
     file_id_ = -1;
@@ -152,6 +163,12 @@ void eCAL::eh5::HDF5MeasFileWriterV5::SetChannelDataTypeInformation(const SEscap
   channels_[channel.name].Description = type_descriptor.second;
 }
 
+void eCAL::eh5::HDF5MeasFileWriterV5::SetChannelCompression(const SEscapedChannel& channel, eCompression compression)
+{
+  // The V5 format has no channel ids, so the compression applies to the channel name
+  channel_compression_[channel.name] = compression;
+}
+
 long long eCAL::eh5::HDF5MeasFileWriterV5::GetMinTimestamp(const SEscapedChannel& /*channel*/) const
 {
   // UNSUPPORTED FUNCTION
@@ -176,6 +193,12 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::GetEntriesInfoRange(const SEscapedChannel&
   return false;
 }
 
+bool eCAL::eh5::HDF5MeasFileWriterV5::HasTimeIndex(const SEscapedChannel& /*channel*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
 bool eCAL::eh5::HDF5MeasFileWriterV5::GetEntryDataSize(long long /*entry_id*/, size_t& /*size*/) const
 {
   // UNSUPPORTED FUNCTION
@@ -194,6 +217,12 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::GetEntryDataAsString(long long /*entry_id*
   return false;
 }
 
+bool eCAL::eh5::HDF5MeasFileWriterV5::GetEntryDataView(long long /*entry_id*/, EntryDataView& /*view*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
 
 void eCAL::eh5::HDF5MeasFileWriterV5::SetFileBaseName(const std::string& base_name)
 {
@@ -219,24 +248,36 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::AddEntryToFile(const SEscapedWriteEntry& e
       return false;
   }
 
+  //  Compress the payload, if configured for this channel. This happens
+  //  before any HDF5 call, so writer threads compress in parallel instead of
+  //  one after the other under the global lock of the thread safe HDF5.
+  const auto compression_it = channel_compression_.find(entry.channel.name);
+  const auto compression    = (compression_it != channel_compression_.end()) ? ResolveCompression(compression_it->second, hsSize) : eCompression::NONE;
+  uint32_t   filter_mask    = 0;
+  const bool precompressed  = CompressChunk(compression, entry.data, entry.size, chunk_buffer_, filter_mask);
+
   //  Create DataSpace with rank 1 and size dimension
   auto dataSpace = H5Screate_simple(1, &hsSize, nullptr);
 
   //  Create creation property for dataSpace
   auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
   H5Pset_obj_track_times(dsProperty, false);
+  SetCompressionFilter(dsProperty, compression, hsSize);
 
   //  Create dataset in dataSpace
   auto dataSet = H5Dcreate(file_id_, std::to_string(entries_counter_).c_str(), H5T_NATIVE_UCHAR, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
 
-  //  Write buffer to dataset
-  herr_t writeStatus = H5Dwrite(dataSet, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, entry.data);
+  //  Write buffer to dataset (codecs without a precompressed chunk are compressed by the HDF5 filter)
+  herr_t writeStatus = precompressed ? (WriteChunk(dataSet, chunk_buffer_, filter_mask) ? 0 : -1)
+                                     : H5Dwrite(dataSet, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, entry.data);
 
   //  Close dataset, data space, and data set property
   H5Dclose(dataSet);
   H5Pclose(dsProperty);
   H5Sclose(dataSpace);
 
+  writeback_.Written(hsSize, file_id_);
+
   channels_[entry.channel.name].Entries.emplace_back(SEntryInfo(entry.rcv_timestamp, static_cast<long long>(entries_counter_), entry.clock, entry.snd_timestamp, entry.sender_id));
 
   entries_counter_++;
@@ -284,7 +325,10 @@ hid_t eCAL::eh5::HDF5MeasFileWriterV5::Create()
   file_id_ = H5Fcreate(filePath.c_str(), H5F_ACC_TRUNC, fileCreateProperty, fileAccessPropery);
 
   if (file_id_ >= 0)
+  {
     SetAttribute(file_id_, kFileVerAttrTitle, "5.0");
+    writeback_.Attach(file_id_);
+  }
   else
     file_split_counter_--;
 
@@ -381,6 +425,9 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::CreateEntriesTableOfContentsFor(const std:
   H5Pclose(dsProperty);
   H5Sclose(dataSpace);
 
+  //  Readers that don't know the index just ignore it
+  CreateTimeIndexInRoot(file_id_, v5::GetTimeIndexUrl(channelName), entries, kTimeIndexIntervalUs);
+
   return true;
 }
 
@@ -29,6 +29,7 @@
 #include <dirent.h>
 #endif //_WIN32
 
+#include <algorithm>
 #include <string>
 #include <list>
 #include <iostream>
@@ -39,6 +40,7 @@
 #include "hdf5_helper.h"
 
 constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
+constexpr long long    kTimeIndexIntervalUs  = 1000 * 1000;
 
 eCAL::eh5::HDF5MeasFileWriterV6::HDF5MeasFileWriterV6()
   : cb_pre_split_      (nullptr)
@@ -74,10 +76,15 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::Close()
 
   std::string channels_with_entries;
 
-  for (const auto& channel_per_name : channels_)
+  for (auto& channel_per_name : channels_)
   {
-    for (const auto& channel_per_id : channel_per_name.second)
+    for (auto& channel_per_id : channel_per_name.second)
     {
+      // Entries are added in the order they arrive, which may differ slightly
+      // from their timestamps. The time index requires a sorted table.
+      auto& entries = channel_per_id.second.Entries;
+      std::stable_sort(entries.begin(), entries.end());
+
       std::ignore = CreateEntriesTableOfContentsFor(channel_per_name.first, channel_per_id.first, channel_per_id.second.Info, channel_per_id.second.Entries);
     }
     channels_with_entries += channel_per_name.first + ",";
@@ -92,6 +99,8 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::Close()
     for (auto& channel_per_id : channel_per_name.second)
       channel_per_id.second.Entries.clear();
 
+  writeback_.Detach();
+
   if (H5Fclose(file_id_) >= 0)
   {
     file_id_ = -1;
@@ -156,6 +165,13 @@ void eCAL::eh5::HDF5MeasFileWriterV6::SetChannelDataTypeInformation(const SEscap
   channels_[channel.name][channel.id].Info = info;
 }
 
+void eCAL::eh5::HDF5MeasFileWriterV6::SetChannelCompression(const SEscapedChannel& channel, eCompression compression)
+{
+  // The compression applies to all channels with that name, as the payload
+  // datasets are not grouped by channel id
+  channel_compression_[channel.name] = compression;
+}
+
 
 long long eCAL::eh5::HDF5MeasFileWriterV6::GetMinTimestamp(const SEscapedChannel& /*channel_name*/) const
 {
@@ -181,6 +197,12 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntriesInfoRange(const SEscapedChannel&
   return false;
 }
 
+bool eCAL::eh5::HDF5MeasFileWriterV6::HasTimeIndex(const SEscapedChannel& /*channel*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
 bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntryDataSize(long long /*entry_id*/, size_t& /*size*/) const
 {
   // UNSUPPORTED FUNCTION
@@ -199,6 +221,12 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntryDataAsString(long long /*entry_id*
   return false;
 }
 
+bool eCAL::eh5::HDF5MeasFileWriterV6::GetEntryDataView(long long /*entry_id*/, EntryDataView& /*view*/) const
+{
+  // UNSUPPORTED FUNCTION
+  return false;
+}
+
 void eCAL::eh5::HDF5MeasFileWriterV6::SetFileBaseName(const std::string& base_name)
 {
   base_name_ = base_name;
@@ -223,24 +251,36 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::AddEntryToFile(const SEscapedWriteEntry& e
       return false;
   }
 
+  //  Compress the payload, if configured for this channel. This happens
+  //  before any HDF5 call, so writer threads compress in parallel instead of
+  //  one after the other under the global lock of the thread safe HDF5.
+  const auto compression_it = channel_compression_.find(entry.channel.name);
+  const auto compression    = (compression_it != channel_compression_.end()) ? ResolveCompression(compression_it->second, hsSize) : eCompression::NONE;
+  uint32_t   filter_mask    = 0;
+  const bool precompressed  = CompressChunk(compression, entry.data, entry.size, chunk_buffer_, filter_mask);
+
   //  Create DataSpace with rank 1 and size dimension
   auto dataSpace = H5Screate_simple(1, &hsSize, nullptr);
 
   //  Create creation property for dataSpace
   auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
   H5Pset_obj_track_times(dsProperty, false);
+  SetCompressionFilter(dsProperty, compression, hsSize);
 
   //  Create dataset in dataSpace
   auto dataSet = H5Dcreate(file_id_, std::to_string(entries_counter_).c_str(), H5T_NATIVE_UCHAR, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
 
-  //  Write buffer to dataset
-  herr_t writeStatus = H5Dwrite(dataSet, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, entry.data);
+  //  Write buffer to dataset (codecs without a precompressed chunk are compressed by the HDF5 filter)
+  herr_t writeStatus = precompressed ? (WriteChunk(dataSet, chunk_buffer_, filter_mask) ? 0 : -1)
+                                     : H5Dwrite(dataSet, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, entry.data);
 
   //  Close dataset, data space, and data set property
   H5Dclose(dataSet);
   H5Pclose(dsProperty);
   H5Sclose(dataSpace);
 
+  writeback_.Written(hsSize, file_id_);
+
   // TODO: check here about id vs channel.id
   channels_[entry.channel.name][entry.channel.id].Entries.emplace_back(SEntryInfo(entry.rcv_timestamp, static_cast<long long>(entries_counter_), entry.clock, entry.snd_timestamp, entry.sender_id));
 
@@ -289,7 +329,10 @@ hid_t eCAL::eh5::HDF5MeasFileWriterV6::Create()
   file_id_ = H5Fcreate(filePath.c_str(), H5F_ACC_TRUNC, fileCreateProperty, fileAccessPropery);
 
   if (file_id_ >= 0)
+  {
     SetAttribute(file_id_, kFileVerAttrTitle, "6.0");
+    writeback_.Attach(file_id_);
+  }
   else
     file_split_counter_--;
 
@@ -335,6 +378,7 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::CreateEntriesTableOfContentsFor(const std:
   CreateStringEntryInRoot(file_id_, v6::GetUrl(channelName, hex_id, kChnIdEncoding),   channelInfo.encoding);
   CreateStringEntryInRoot(file_id_, v6::GetUrl(channelName, hex_id, kChnIdDescriptor), channelInfo.descriptor);
   CreateInformationEntryInRoot(file_id_, v6::GetUrl(channelName, hex_id, kChnIdData), entries);
+  CreateTimeIndexInRoot(file_id_, v6::GetUrl(channelName, hex_id, kChnIdTimeIndex), entries, kTimeIndexIntervalUs);
 
   H5Gclose(group_name_id);
   H5Gclose(group_id_id);
@@ -27,11 +27,13 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "eh5_meas_impl.h"
 
 #include "hdf5.h"
 #include "escape.h"
+#include "page_cache_writeback.h"
 
 namespace eCAL
 {
@@ -160,6 +162,16 @@ namespace eCAL
       **/
       void SetChannelDataTypeInformation(const SEscapedChannel& channel, const eCAL::eh5::DataTypeInformation& info) override;
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards.
+       *
+       * @param channel       channel name & id
+       * @param compression   compression codec
+      **/
+      void SetChannelCompression(const SEscapedChannel& channel, eCompression compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -202,6 +214,15 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
 
+      /**
+      * @brief Checks if the given channel has a time index
+      *
+      * @param channel  channel
+      *
+      * @return         true if the channel has a time index
+      **/
+      bool HasTimeIndex(const SEscapedChannel& channel) const override;
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -232,6 +253,16 @@ namespace eCAL
       **/
       bool GetEntryDataAsString(long long entry_id, std::string& data) const override;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry
+      *        Uncompressed entries are not copied, the view points into a memory mapping of the file.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the data, keeps the underlying memory alive
+      * @return                 Data was retrieved successfully
+      **/
+      bool GetEntryDataView(long long entry_id, EntryDataView& view) const override;
+
       /**
       * @brief Set measurement file base name
       *
@@ -274,16 +305,20 @@ namespace eCAL
         EntryInfoVect       Entries;
       };
 
-      using Channels = std::map<std::string, std::map<std::uint64_t, Channel>>;
+      using Channels           = std::map<std::string, std::map<std::uint64_t, Channel>>;
+      using ChannelCompression = std::map<std::string, eCompression>;
 
       std::string              output_dir_;
       std::string              base_name_;
       Channels                 channels_;
+      ChannelCompression       channel_compression_;
+      std::vector<unsigned char> chunk_buffer_;       // compressed entry, reused for all entries
       CallbackFunction         cb_pre_split_;
       hid_t                    file_id_;
       int                      file_split_counter_;
       unsigned long long       entries_counter_;
       size_t                   max_size_per_file_;
+      PageCacheWriteback       writeback_;
 
       /**
       * @brief Creates the actual file
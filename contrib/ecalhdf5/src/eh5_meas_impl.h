@@ -144,6 +144,16 @@ namespace eCAL
       **/
       virtual void SetChannelDataTypeInformation(const SEscapedChannel& channel, const eCAL::eh5::DataTypeInformation& info) = 0;
 
+      /**
+       * @brief Set the compression of the payload of the given channel
+       *
+       * Only affects entries that are added afterwards.
+       *
+       * @param channel       channel name & id
+       * @param compression   compression codec
+      **/
+      virtual void SetChannelCompression(const SEscapedChannel& channel, eCompression compression) = 0;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -186,6 +196,18 @@ namespace eCAL
       **/
       virtual bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const = 0;
 
+      /**
+      * @brief Checks if the given channel has a time index
+      *
+      * With a time index, GetEntriesInfoRange, GetMinTimestamp and
+      * GetMaxTimestamp only read the part of the entries table they need.
+      *
+      * @param channel  channel
+      *
+      * @return         true if the channel has a time index
+      **/
+      virtual bool HasTimeIndex(const SEscapedChannel& channel) const = 0;
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -216,6 +238,16 @@ namespace eCAL
       **/
       virtual bool GetEntryDataAsString(long long entry_id, std::string& data) const = 0;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry
+      *        Uncompressed entries are not copied, the view points into a memory mapping of the file.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the data, keeps the underlying memory alive
+      * @return                 Data was retrieved successfully
+      **/
+      virtual bool GetEntryDataView(long long entry_id, EntryDataView& view) const = 0;
+
       /**
       * @brief Set measurement file base name
       *
@@ -19,6 +19,14 @@
 
 #include "hdf5_helper.h"
 
+#include <iostream>
+#include <mutex>
+#include <set>
+
+#ifdef ECAL_EH5_HAS_ZLIB
+#include <zlib.h>
+#endif
+
 bool CreateStringEntryInRoot(hid_t root, const std::string& url, const std::string& dataset_content)
 {
   // If the content is empty, we instead create a null entry.
@@ -226,6 +234,160 @@ bool GetEntryInfoVector(hid_t root, const std::string& url, eCAL::eh5::EntryInfo
   return (status >= 0);
 }
 
+hssize_t GetEntryInfoRowCount(hid_t root, const std::string& url)
+{
+  auto dataset_id = H5Dopen(root, url.c_str(), H5P_DEFAULT);
+  if (dataset_id < 0) return -1;
+
+  auto data_space = H5Dget_space(dataset_id);
+  H5Dclose(dataset_id);
+  if (data_space < 0) return -1;
+
+  hsize_t dims[2] = { 0, 0 };
+  const auto rank = H5Sget_simple_extent_dims(data_space, dims, nullptr);
+  H5Sclose(data_space);
+
+  return (rank == 2) ? static_cast<hssize_t>(dims[0]) : -1;
+}
+
+bool GetEntryInfoRows(hid_t root, const std::string& url, hsize_t first_row, hsize_t row_count, eCAL::eh5::EntryInfoSet& entries)
+{
+  if (row_count == 0) return true;
+
+  auto dataset_id = H5Dopen(root, url.c_str(), H5P_DEFAULT);
+  if (dataset_id < 0) return false;
+
+  auto file_space = H5Dget_space(dataset_id);
+  hsize_t offset[2] = { first_row, 0 };
+  hsize_t count[2]  = { row_count, 5 };
+  auto memory_space = H5Screate_simple(2, count, nullptr);
+
+  std::vector<long long> data(static_cast<size_t>(row_count * 5));
+  herr_t status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, offset, nullptr, count, nullptr);
+  if (status >= 0)
+    status = H5Dread(dataset_id, H5T_NATIVE_LLONG, memory_space, file_space, H5P_DEFAULT, data.data());
+
+  H5Sclose(memory_space);
+  H5Sclose(file_space);
+  H5Dclose(dataset_id);
+
+  if (status < 0) return false;
+
+  for (size_t index = 0; index < data.size(); index += 5)
+  {
+    //                                    rec timestamp,  channel id,       send clock,       send time stamp,  send ID
+    entries.emplace(eCAL::eh5::SEntryInfo(data[index],    data[index + 1],  data[index + 2],  data[index + 3],  data[index + 4]));
+  }
+
+  return true;
+}
+
+bool CreateTimeIndexInRoot(hid_t root, const std::string& url, const eCAL::eh5::EntryInfoVect& entries, long long interval_us)
+{
+  std::vector<long long> index;
+  for (size_t row = 0; row < entries.size(); ++row)
+  {
+    if (index.empty() || (entries[row].RcvTimestamp >= index[index.size() - 2] + interval_us))
+    {
+      index.push_back(entries[row].RcvTimestamp);
+      index.push_back(static_cast<long long>(row));
+    }
+  }
+
+  hsize_t dims[2] = { index.size() / 2, 2 };
+  auto dataSpace = H5Screate_simple(2, dims, nullptr);
+  auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_obj_track_times(dsProperty, false);
+  auto dataSet = H5Dcreate(root, url.c_str(), H5T_NATIVE_LLONG, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
+
+  herr_t writeStatus = -1;
+  if (dataSet >= 0)
+  {
+    writeStatus = H5Dwrite(dataSet, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, index.data());
+    H5Dclose(dataSet);
+  }
+
+  H5Pclose(dsProperty);
+  H5Sclose(dataSpace);
+
+  return (writeStatus >= 0);
+}
+
+bool ReadTimeIndex(hid_t root, const std::string& url, std::vector<long long>& index)
+{
+  index.clear();
+
+  const auto rows = GetEntryInfoRowCount(root, url);
+  if (rows < 0) return false;
+  if (rows == 0) return true;
+
+  auto dataset_id = H5Dopen(root, url.c_str(), H5P_DEFAULT);
+  if (dataset_id < 0) return false;
+
+  index.resize(static_cast<size_t>(rows) * 2);
+  herr_t status = H5Dread(dataset_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, index.data());
+  H5Dclose(dataset_id);
+
+  return (status >= 0);
+}
+
+bool GetIndexedEntryInfoRange(hid_t root, const std::string& entries_url, const std::string& index_url, long long begin, long long end, eCAL::eh5::EntryInfoSet& entries)
+{
+  entries.clear();
+  if ((begin != 0) && (end != 0) && (end < begin)) return true;
+
+  const auto rows = GetEntryInfoRowCount(root, entries_url);
+
+  std::vector<long long> index;
+  if ((rows <= 0) || !ReadTimeIndex(root, index_url, index) || index.empty())
+    return false;
+
+  // The index holds (timestamp, row) pairs. Start at the last indexed row
+  // that is not after begin and stop at the first indexed row after end.
+  const size_t index_rows = index.size() / 2;
+  hsize_t first_row = 0;
+  hsize_t last_row  = static_cast<hsize_t>(rows);
+  for (size_t i = 0; i < index_rows; ++i)
+  {
+    if ((begin != 0) && (index[2 * i] <= begin))
+      first_row = static_cast<hsize_t>(index[2 * i + 1]);
+    if ((end != 0) && (index[2 * i] > end))
+    {
+      last_row = static_cast<hsize_t>(index[2 * i + 1]);
+      break;
+    }
+  }
+  if (last_row <= first_row) return true;
+
+  eCAL::eh5::EntryInfoSet candidates;
+  if (!GetEntryInfoRows(root, entries_url, first_row, last_row - first_row, candidates))
+    return false;
+
+  const auto lower = (begin == 0) ? candidates.begin() : candidates.lower_bound(eCAL::eh5::SEntryInfo(begin, 0, 0));
+  const auto upper = (end   == 0) ? candidates.end()   : candidates.upper_bound(eCAL::eh5::SEntryInfo(end, 0, 0));
+  entries.insert(lower, upper);
+
+  return true;
+}
+
+long long GetSortedEntryInfoMinTimestamp(hid_t root, const std::string& entries_url)
+{
+  // The entries table is sorted, so the first row has the lowest timestamp
+  eCAL::eh5::EntryInfoSet entries;
+  GetEntryInfoRows(root, entries_url, 0, 1, entries);
+  return entries.empty() ? 0 : entries.begin()->RcvTimestamp;
+}
+
+long long GetSortedEntryInfoMaxTimestamp(hid_t root, const std::string& entries_url)
+{
+  // The entries table is sorted, so the last row has the highest timestamp
+  eCAL::eh5::EntryInfoSet entries;
+  const auto rows = GetEntryInfoRowCount(root, entries_url);
+  if (rows > 0)
+    GetEntryInfoRows(root, entries_url, static_cast<hsize_t>(rows - 1), 1, entries);
+  return entries.empty() ? 0 : entries.begin()->RcvTimestamp;
+}
+
 bool SetAttribute(hid_t id, const std::string& name, const std::string& value)
 {
   if (id < 0) return false;
@@ -352,4 +514,131 @@ std::vector<std::string> ListSubgroups(hid_t id)
 
   H5Literate(id, H5_INDEX_NAME, H5_ITER_INC, nullptr, iterate_lambda, (void*)&group_vector);
   return group_vector;
-}
\ No newline at end of file
+}
+
+namespace
+{
+  constexpr H5Z_filter_t lz4_filter_id = 32004;
+  constexpr int          deflate_level = 1;
+
+  // Warns once per filter, the filter availability does not change at runtime
+  void WarnFilterUnavailable(const std::string& filter_name, const std::string& consequence)
+  {
+    static std::mutex            warned_mutex;
+    static std::set<std::string> warned_filters;
+
+    const std::lock_guard<std::mutex> lock(warned_mutex);
+    if (warned_filters.insert(filter_name).second)
+      std::cerr << "eCALHDF5: Warning: " << filter_name << " compression filter is not available, " << consequence << "\n";
+  }
+}
+
+bool IsCompressionFilterAvailable(eCAL::eh5::eCompression compression)
+{
+  switch (compression)
+  {
+  case eCAL::eh5::eCompression::NONE:
+    return true;
+  case eCAL::eh5::eCompression::DEFLATE:
+    return (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0);
+  case eCAL::eh5::eCompression::LZ4:
+    return (H5Zfilter_avail(lz4_filter_id) > 0);
+  default:
+    return false;
+  }
+}
+
+eCAL::eh5::eCompression ResolveCompression(eCAL::eh5::eCompression compression, hsize_t size)
+{
+  // Small entries would rather grow by the chunk overhead. HDF5 chunks are
+  // also limited to 4 GiB.
+  constexpr hsize_t min_compressed_size = 512;
+  constexpr hsize_t max_chunk_size      = 0xFFFFFFFFULL;
+  if ((compression == eCAL::eh5::eCompression::NONE) || (size < min_compressed_size) || (size > max_chunk_size))
+    return eCAL::eh5::eCompression::NONE;
+
+  if (compression == eCAL::eh5::eCompression::LZ4)
+  {
+    if (IsCompressionFilterAvailable(eCAL::eh5::eCompression::LZ4))
+      return eCAL::eh5::eCompression::LZ4;
+    WarnFilterUnavailable("LZ4", "falling back to DEFLATE");
+  }
+
+  if (!IsCompressionFilterAvailable(eCAL::eh5::eCompression::DEFLATE))
+  {
+    WarnFilterUnavailable("DEFLATE", "entries are stored uncompressed");
+    return eCAL::eh5::eCompression::NONE;
+  }
+  return eCAL::eh5::eCompression::DEFLATE;
+}
+
+bool SetCompressionFilter(hid_t ds_property, eCAL::eh5::eCompression compression, hsize_t size)
+{
+  if (compression == eCAL::eh5::eCompression::NONE)
+    return false;
+
+  // Filters require a chunked layout. Each entry is its own dataset, so one
+  // chunk spans the entire entry.
+  if (H5Pset_chunk(ds_property, 1, &size) < 0)
+    return false;
+
+  if (compression == eCAL::eh5::eCompression::LZ4)
+  {
+    const unsigned int lz4_block_size = 0; // default block size
+    return (H5Pset_filter(ds_property, lz4_filter_id, H5Z_FLAG_OPTIONAL, 1, &lz4_block_size) >= 0);
+  }
+
+  // Level 1 is by far the fastest one and already catches most of the redundancy
+  return (H5Pset_deflate(ds_property, deflate_level) >= 0);
+}
+
+bool CompressChunk(eCAL::eh5::eCompression compression, const void* data, size_t size, std::vector<unsigned char>& chunk, uint32_t& filter_mask)
+{
+#ifdef ECAL_EH5_HAS_ZLIB
+  if (compression != eCAL::eh5::eCompression::DEFLATE)
+    return false;
+
+  // Same zlib stream as written by the HDF5 deflate filter, so readers
+  // decompress the chunk with the filter of the dataset
+  uLongf compressed_size = compressBound(static_cast<uLong>(size));
+  chunk.resize(compressed_size);
+  const int status = compress2(chunk.data(), &compressed_size, static_cast<const Bytef*>(data), static_cast<uLong>(size), deflate_level);
+
+  if ((status == Z_OK) && (compressed_size < size))
+  {
+    chunk.resize(compressed_size);
+    filter_mask = 0;
+  }
+  else
+  {
+    // Like the optional HDF5 filter, store data that does not shrink as it is
+    // and mark the (only) filter of the pipeline as skipped
+    chunk.assign(static_cast<const unsigned char*>(data), static_cast<const unsigned char*>(data) + size);
+    filter_mask = 1;
+  }
+  return true;
+#else
+  (void)compression;
+  (void)data;
+  (void)size;
+  (void)chunk;
+  (void)filter_mask;
+  return false;
+#endif
+}
+
+bool WriteChunk(hid_t dataset_id, const std::vector<unsigned char>& chunk, uint32_t filter_mask)
+{
+  const hsize_t offset = 0;
+  return (H5Dwrite_chunk(dataset_id, H5P_DEFAULT, filter_mask, &offset, chunk.size(), chunk.data()) >= 0);
+}
+
+hssize_t GetDataSetSize(hid_t dataset_id)
+{
+  const auto data_space = H5Dget_space(dataset_id);
+  if (data_space < 0) return -1;
+
+  const auto size = H5Sget_simple_extent_npoints(data_space);
+  H5Sclose(data_space);
+  return size;
+}
@@ -19,9 +19,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #include <hdf5.h>
 
@@ -39,6 +41,72 @@ bool IsNullEntryInRoot(hid_t root, const std::string& url);
 bool CreateInformationEntryInRoot(hid_t root, const std::string& url, const eCAL::eh5::EntryInfoVect& entries);
 bool GetEntryInfoVector(hid_t root, const std::string& url, eCAL::eh5::EntryInfoSet& entries);
 
+/**
+* @brief Gets the number of rows of an entries table
+*
+* @return  number of rows, or a negative value on error
+**/
+hssize_t GetEntryInfoRowCount(hid_t root, const std::string& url);
+
+/**
+* @brief Reads a range of rows of an entries table, without reading the rest of it
+*
+* @param root       ID of the file
+* @param url        URL of the entries table
+* @param first_row  first row to read
+* @param row_count  number of rows to read
+* @param entries    entries to add the rows to
+*
+* @return  true if succeeds, false if it fails
+**/
+bool GetEntryInfoRows(hid_t root, const std::string& url, hsize_t first_row, hsize_t row_count, eCAL::eh5::EntryInfoSet& entries);
+
+/**
+* @brief Creates the time index for a time sorted entries table
+*
+* The index contains one row (receive timestamp, row in the entries table)
+* for the first entry of every interval. So a time range can be found by
+* reading the small index and only the matching rows of the entries table.
+*
+* @param root         ID of the file
+* @param url          URL of the time index
+* @param entries      entries, sorted by receive timestamp
+* @param interval_us  interval between two index rows in microseconds
+*
+* @return  true if succeeds, false if it fails
+**/
+bool CreateTimeIndexInRoot(hid_t root, const std::string& url, const eCAL::eh5::EntryInfoVect& entries, long long interval_us);
+
+/**
+* @brief Reads a time index as flat (receive timestamp, row) pairs
+**/
+bool ReadTimeIndex(hid_t root, const std::string& url, std::vector<long long>& index);
+
+/**
+* @brief Gets the entries of a time range from a time sorted entries table
+*
+* Only the time index and the rows of the entries table that may lie in the
+* range are read. A begin or end of 0 means an open range.
+*
+* @param root         ID of the file
+* @param entries_url  URL of the entries table
+* @param index_url    URL of the time index of the entries table
+* @param begin        time range begin timestamp
+* @param end          time range end timestamp
+* @param entries      entries in the given range
+*
+* @return  true if succeeds, false if it fails
+**/
+bool GetIndexedEntryInfoRange(hid_t root, const std::string& entries_url, const std::string& index_url, long long begin, long long end, eCAL::eh5::EntryInfoSet& entries);
+
+/**
+* @brief Gets the lowest / highest receive timestamp of a time sorted entries table
+*
+* @return  the timestamp, or 0 if the table is empty
+**/
+long long GetSortedEntryInfoMinTimestamp(hid_t root, const std::string& entries_url);
+long long GetSortedEntryInfoMaxTimestamp(hid_t root, const std::string& entries_url);
+
 /**
 * @brief Set attribute to object(file, entry...)
 *
@@ -66,6 +134,86 @@ hid_t OpenOrCreateGroup(hid_t root, const std::string& name);
 
 std::vector<std::string> ListSubgroups(hid_t id);
 
+/**
+* @brief Checks whether the HDF5 filter needed for the given compression is available
+*
+* @param compression  Requested compression
+*
+* @return  true if entries can be written with the given compression
+**/
+bool IsCompressionFilterAvailable(eCAL::eh5::eCompression compression);
+
+/**
+* @brief Resolves the compression that is applied to an entry
+*
+* Entries smaller than a few hundred bytes are not worth compressing and are
+* left untouched. If the requested filter is not available, a warning is
+* printed once and LZ4 falls back to DEFLATE, DEFLATE to no compression.
+*
+* @param compression  Requested compression
+* @param size         Size of the entry
+*
+* @return  compression to pass to SetCompressionFilter and CompressChunk
+**/
+eCAL::eh5::eCompression ResolveCompression(eCAL::eh5::eCompression compression, hsize_t size);
+
+/**
+* @brief Adds the chunked layout and the filter of a resolved compression to a dataset creation property
+*
+* @param ds_property  Dataset creation property
+* @param compression  Resolved compression (see ResolveCompression)
+* @param size         Size of the (1-dimensional) dataset
+*
+* @return  true if a compression filter has been set
+**/
+bool SetCompressionFilter(hid_t ds_property, eCAL::eh5::eCompression compression, hsize_t size);
+
+/**
+* @brief Compresses an entry without calling into HDF5
+*
+* HDF5 is built thread safe and holds a global lock in every API call, so a
+* filter that compresses the entry within H5Dwrite serializes the compression
+* of all writer threads. A chunk compressed by this function is written with
+* WriteChunk instead, only the I/O then runs under the HDF5 lock.
+*
+* This is implemented for DEFLATE if eCAL HDF5 has been built with zlib
+* (ECAL_EH5_HAS_ZLIB). Otherwise, and for LZ4, false is returned and the entry
+* has to be written with H5Dwrite, so the HDF5 filter compresses it.
+*
+* @param compression  Resolved compression (see ResolveCompression)
+* @param data         Entry data
+* @param size         Size of the entry data
+* @param chunk        Buffer that receives the chunk (its capacity is reused)
+* @param filter_mask  Receives the filter mask of the chunk (the filter is
+*                     marked as skipped if the data did not shrink)
+*
+* @return  true if the chunk is ready for WriteChunk
+**/
+bool CompressChunk(eCAL::eh5::eCompression compression, const void* data, size_t size, std::vector<unsigned char>& chunk, uint32_t& filter_mask);
+
+/**
+* @brief Writes a chunk created by CompressChunk as the only chunk of a dataset
+*
+* @param dataset_id   Dataset created with the filter of the same compression
+* @param chunk        Chunk data
+* @param filter_mask  Filter mask of the chunk
+*
+* @return  true if the chunk has been written
+**/
+bool WriteChunk(hid_t dataset_id, const std::vector<unsigned char>& chunk, uint32_t filter_mask);
+
+/**
+* @brief Gets the size of the (uncompressed) data of a dataset in bytes
+*
+* Unlike H5Dget_storage_size, this also returns the correct size for
+* compressed datasets.
+*
+* @param dataset_id  ID of a 1-dimensional byte dataset
+*
+* @return  size of the data in bytes, or a negative value on error
+**/
+hssize_t GetDataSetSize(hid_t dataset_id);
+
 
 inline std::string printHex(eCAL::experimental::measurement::base::Channel::id_t id)
 {
@@ -79,6 +227,17 @@ inline eCAL::experimental::measurement::base::Channel::id_t parseHexID(std::stri
   return std::stoull(string_id, nullptr, 16);
 }
 
+namespace v5
+{
+  // The V5 format stores the entries table of a channel in a dataset named
+  // like the channel. The "," is escaped in channel names, so the time index
+  // can never clash with a channel or with an entry dataset.
+  inline std::string GetTimeIndexUrl(const std::string& channel_name_)
+  {
+    return channel_name_ + "," + eCAL::eh5::kChnIdTimeIndex;
+  }
+}
+
 namespace v6
 {
   inline std::string GetUrl(const std::string& channel_name_, const std::string& channel_id, const std::string& attribute)
@@ -0,0 +1,98 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "page_cache_writeback.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#endif // __linux__
+
+namespace
+{
+  // Size of a writeback window
+  constexpr std::uint64_t kWritebackWindowSize = 32 * 1024 * 1024;
+}
+
+eCAL::eh5::PageCacheWriteback::PageCacheWriteback()
+  : fd_           (-1)
+  , pending_bytes_(0)
+  , window_begin_ (0)
+  , window_end_   (0)
+{}
+
+void eCAL::eh5::PageCacheWriteback::Attach(hid_t file_id)
+{
+  Detach();
+
+#ifdef __linux__
+  // The VFD handle is only a file descriptor for the sec2 driver
+  const hid_t file_access_property = H5Fget_access_plist(file_id);
+  if (file_access_property < 0) return;
+  const bool is_sec2 = (H5Pget_driver(file_access_property) == H5FD_SEC2);
+  H5Pclose(file_access_property);
+  if (!is_sec2) return;
+
+  void* handle = nullptr;
+  if ((H5Fget_vfd_handle(file_id, H5P_DEFAULT, &handle) >= 0) && (handle != nullptr))
+    fd_ = *static_cast<int*>(handle);
+#else
+  (void)file_id;
+#endif // __linux__
+}
+
+void eCAL::eh5::PageCacheWriteback::Detach()
+{
+  fd_            = -1;
+  pending_bytes_ = 0;
+  window_begin_  = 0;
+  window_end_    = 0;
+}
+
+void eCAL::eh5::PageCacheWriteback::Written(std::uint64_t size, hid_t file_id)
+{
+#ifdef __linux__
+  if (fd_ < 0) return;
+
+  pending_bytes_ += size;
+  if (pending_bytes_ < kWritebackWindowSize) return;
+  pending_bytes_ = 0;
+
+  hsize_t file_size = 0;
+  if ((H5Fget_filesize(file_id, &file_size) < 0) || (file_size <= window_end_)) return;
+
+  // Start the writeback of the new window without waiting for it
+  sync_file_range(fd_, static_cast<off_t>(window_end_), static_cast<off_t>(file_size - window_end_), SYNC_FILE_RANGE_WRITE);
+
+  // Wait for the previous window and drop it from the page cache. HDF5 keeps
+  // its own metadata cache, so this does not cause any reads while writing.
+  if (window_end_ > window_begin_)
+  {
+    const auto offset = static_cast<off_t>(window_begin_);
+    const auto length = static_cast<off_t>(window_end_ - window_begin_);
+    sync_file_range(fd_, offset, length, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+    posix_fadvise(fd_, offset, length, POSIX_FADV_DONTNEED);
+  }
+
+  window_begin_ = window_end_;
+  window_end_   = file_size;
+#else
+  (void)size;
+  (void)file_id;
+#endif // __linux__
+}
@@ -0,0 +1,76 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "hdf5.h"
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    /**
+     * @brief Streams the written part of an HDF5 file out of the page cache
+     *
+     * The sec2 driver of HDF5 writes through the page cache, so recording a
+     * large measurement leaves gigabytes of dirty pages behind. The kernel
+     * then writes them back in bursts that block the writing thread, and the
+     * clean pages evict everything else from the cache.
+     *
+     * This class uses the file in two windows, just like double buffering:
+     * once a window is full, its writeback is started asynchronously. The
+     * window before it is waited for and then dropped from the page cache.
+     * So the amount of dirty data per file stays bounded by two windows and
+     * the writing thread almost never waits for the disk.
+     *
+     * Only Linux is supported, on other platforms all functions do nothing.
+     */
+    class PageCacheWriteback
+    {
+    public:
+      PageCacheWriteback();
+
+      /**
+      * @brief Attaches to a freshly created file (sec2 driver only)
+      **/
+      void Attach(hid_t file_id);
+
+      /**
+      * @brief Detaches from the file, call it before the file is closed
+      **/
+      void Detach();
+
+      /**
+      * @brief Tells that the given amount of bytes has been written to the file
+      *
+      * @param size     number of bytes
+      * @param file_id  file the bytes have been written to
+      **/
+      void Written(std::uint64_t size, hid_t file_id);
+
+    private:
+      int           fd_;
+      std::uint64_t pending_bytes_;
+      std::uint64_t window_begin_;
+      std::uint64_t window_end_;
+    };
+  }
+}
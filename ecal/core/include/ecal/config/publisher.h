@@ -84,6 +84,37 @@
  * 
  * The disadvantage of this setting (memfile_buffer_count > 1) is the higher consumption of resources (memory files, events..)
  *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Inner process transport (INPROC::Configuration::enable)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * If a publisher and a subscriber live in the same process, the payload is handed over to the subscriber directly
+ * without any shared memory file, event or network socket involved. The send call copies the payload once into a
+ * reference counted buffer that is shared by all in-process subscribers, each subscriber executes its callback
+ * on its own receive thread. A slow subscriber therefore does not slow down the publisher, it skips the oldest
+ * samples once it is more than a fixed number of samples behind (see INPROC_READER_QUEUE_CAPACITY).
+ *
+ * The layer is enabled by default and is the first entry of the layer_priority_local list. It is only used for
+ * matching subscribers of the same process.
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Asynchronous send queue (SendQueue::Configuration::enable)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * By default, the CPublisher::Send call writes the payload to all active transport layers on the calling thread,
+ * so a stalled network socket or a slow subscriber (acknowledge timeout) directly delays the caller.
+ *
+ * If the send queue is enabled, the send call only copies the payload into a bounded per publisher queue and
+ * returns. A writer thread of the publisher hands the queued samples to the transport layers. If the queue is full,
+ * the overflow policy decides whether the oldest queued sample is dropped, the new sample is dropped (the send call
+ * returns false) or the send call blocks until the writer thread made room. Samples that are still queued when the
+ * publisher is destroyed are written before the destruction completes.
+ *
+ * The disadvantage of this setting is an additional memory copy and the latency of the thread hand-over.
+ * Zero copy shared memory transport is not possible in this mode.
+ *
 **/
 
 #pragma once
@@ -112,6 +143,10 @@ namespace eCAL
           unsigned int memfile_buffer_count    { 1U };    /*!< Maximum number of used buffers (needs to be greater than 1, default = 1) */
           unsigned int memfile_min_size_bytes  { 4096 };  //!< Default memory file size for new publisher (Default: 4096)
           unsigned int memfile_reserve_percent { 50 };    //!< Dynamic file size reserve before recreating memory file if topic size changes (Default: 50)
+          bool         memfile_huge_pages      { false }; //!< Request transparent huge pages for memory files (Linux only, needs shmem_enabled=advise, Default: false)
+          bool         memfile_prefault        { false }; //!< Pre-fault memory file pages on creation to avoid page faults on the first writes (Linux only, Default: false)
+          bool         memfile_lock            { false }; //!< Lock memory file pages in RAM (mlock, Linux only, Default: false)
+          bool         memfile_numa_local      { false }; //!< Bind memory file pages to the NUMA node of the publishing thread (Linux only, Default: false)
         };
       }
 
@@ -119,7 +154,18 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true };                          //!< enable layer
+          bool         enable            { true };                //!< enable layer
+
+          unsigned int retransmit_window { 0U };                  /*!< Number of sent samples kept to repair losses reported by subscribers
+                                                                       (negative acknowledgements, 0 == no repair, Default: 0).
+                                                                       Subscribers deliver the samples of a reliable sender in order, so one lost
+                                                                       datagram holds back the later samples of all topics sent over the same socket
+                                                                       until it is repaired or skipped (up to 30 ms, at most 256 samples buffered). */
+          unsigned int repair_rate_limit { 10U * 1024U * 1024U }; //!< Maximum rate of repaired samples in bytes per second (0 == unlimited, Default: 10 MB/s)
+
+          unsigned int coalescing_latency_us { 0U };              /*!< Maximum time in microseconds small samples are held back to be sent together
+                                                                       with samples of other topics in one datagram (0 == no coalescing, Default: 0) */
+          unsigned int coalescing_max_size   { 1400U };           //!< Maximum size of a coalesced datagram, larger samples are sent directly (Default: 1400)
         };
       }
 
@@ -127,15 +173,44 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true };                          //!< enable layer
+          bool enable      { true };                     //!< enable layer
+
+          bool multiplexed { false };                    /*!< Send over one connection per subscribing process that is shared by all
+                                                              multiplexed TCP publishers of this process (Default: false) */
+        };
+      }
+
+      namespace INPROC
+      {
+        struct Configuration
+        {
+          bool enable { true };                          //!< enable layer (Default: true)
         };
       }
 
       struct Configuration
       {
-        SHM::Configuration shm;
-        UDP::Configuration udp;
-        TCP::Configuration tcp;
+        SHM::Configuration    shm;
+        UDP::Configuration    udp;
+        TCP::Configuration    tcp;
+        INPROC::Configuration inproc;
+      };
+    }
+
+    namespace SendQueue
+    {
+      enum class eOverflowPolicy
+      {
+        drop_oldest,                                     //!< drop the oldest queued sample to make room for the new one
+        drop_newest,                                     //!< drop the new sample, the send call returns false
+        block                                            //!< block the send call until the queue has room again
+      };
+
+      struct Configuration
+      {
+        bool            enable          { false };                        //!< Send enqueues the payload, a writer thread hands it to the transport layers (Default: false)
+        unsigned int    capacity        { 16U };                          //!< Maximum number of queued samples (Default: 16)
+        eOverflowPolicy overflow_policy { eOverflowPolicy::drop_oldest }; //!< Behavior of the send call if the queue is full (Default: drop_oldest)
       };
     }
 
@@ -144,8 +219,10 @@ namespace eCAL
       Layer::Configuration layer;                        //!< Layer configuration
 
       using LayerPriorityVector = std::vector<TransportLayer::eType>;
-      LayerPriorityVector  layer_priority_local    { TransportLayer::eType::shm,    TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
+      LayerPriorityVector  layer_priority_local    { TransportLayer::eType::inproc, TransportLayer::eType::shm, TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
       LayerPriorityVector  layer_priority_remote   { TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
+
+      SendQueue::Configuration send_queue;               //!< Asynchronous send queue configuration
     };
   }
 }
@@ -91,6 +91,10 @@ namespace eCAL
     {
       unsigned int           registration_timeout { 10000U }; //!< Timeout for topic registration in ms (internal) (Default: 10000)
       unsigned int           registration_refresh { 1000U };  //!< Topic registration refresh cylce (has to be smaller then registration timeout!) (Default: 1000)                                   
+      unsigned int           descriptor_refresh   { 10U };    /*!< Datatype descriptors are sent in full only every n-th registration refresh cycle,
+                                                                 in between they are referenced by their hash (0 = always send full descriptors) (Default: 10) */
+      bool                   interest_filter      { false };  /*!< Only deserialize and apply registration samples of publishers, subscribers and services matching local
+                                                                 entities; the registration API then only reports these (ignored if monitoring is initialized) (Default: false) */
 
       bool                   loopback             { true };   //!< enable to receive udp messages on the same local machine (Default: true)
       std::string            shm_transport_domain { "" };     /*!< Common shm transport domain that enables interprocess mechanisms across
@@ -58,11 +58,20 @@ namespace eCAL
         };
       }
 
+      namespace INPROC
+      {
+        struct Configuration
+        {
+          bool enable { true }; //!< enable layer (Default: true)
+        };
+      }
+
       struct Configuration
       {
-        SHM::Configuration shm;
-        UDP::Configuration udp;
-        TCP::Configuration tcp;
+        SHM::Configuration    shm;
+        UDP::Configuration    udp;
+        TCP::Configuration    tcp;
+        INPROC::Configuration inproc;
       };
     }
 
@@ -71,6 +80,12 @@ namespace eCAL
       Layer::Configuration layer;
 
       bool drop_out_of_order_messages { true }; //!< Enable dropping of payload messages that arrive out of order
+
+      unsigned int history_depth { 0U };        //!< Number of received samples kept for CSubscriber::Take/Peek/ReadBatch (0 == no history, Default: 0)
+
+      double max_frequency { 0.0 };             //!< Maximum data frequency [Hz] this subscriber needs, advertised to the publishers so they can skip
+                                                //!< network (udp, tcp) sends above it. If set, message drop detection only covers samples received via shm and inproc,
+                                                //!< gaps in the udp and tcp sample counters are expected then. (0 == unlimited, Default: 0)
     };
   }
 }
@@ -37,6 +37,7 @@ namespace eCAL
       udp_mc,
       shm,
       tcp,
+      inproc,
     };
 
     namespace UDP
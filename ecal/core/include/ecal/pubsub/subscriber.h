@@ -34,6 +34,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -108,6 +109,42 @@ namespace eCAL
     ECAL_API_EXPORTED_MEMBER
       void RemoveReceiveCallback();
 
+    /**
+     * @brief Take the oldest sample out of the subscriber history.
+     *
+     * The subscriber keeps the last Subscriber::Configuration::history_depth received samples
+     * (0 == no history). The sample memory is swapped with the history, so passing the same
+     * sample object again avoids allocations.
+     *
+     * @param sample_  The taken sample.
+     *
+     * @return  True if a sample was available.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Take(SHistorySample& sample_);
+
+    /**
+     * @brief Copy the oldest sample of the subscriber history without removing it
+     *        (the sample the next Take would return).
+     *
+     * @param sample_  The oldest sample.
+     *
+     * @return  True if a sample was available.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Peek(SHistorySample& sample_) const;
+
+    /**
+     * @brief Take all samples out of the subscriber history (oldest first).
+     *
+     * @param samples_  The taken samples, memory of existing elements is reused. The vector is only
+     *                  grown, never shrunk, so just the first (returned number of) elements are valid.
+     *
+     * @return  Number of taken samples.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      size_t ReadBatch(std::vector<SHistorySample>& samples_);
+
     /**
      * @brief Query the number of connected publishers.
      *
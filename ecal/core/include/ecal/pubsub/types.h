@@ -70,6 +70,17 @@ namespace eCAL
     int64_t     send_clock = 0;         //!< publisher send clock. Each publisher increases the counter by one, every time a message is sent. It can be used to detect message drops.
   };
 
+  /**
+   * @brief eCAL subscriber history sample (see CSubscriber::Take, CSubscriber::Peek and CSubscriber::ReadBatch).
+  **/
+  struct SHistorySample
+  {
+    STopicId    publisher_id;           //!< topic id of the publisher that has sent the sample
+    std::string buffer;                 //!< payload buffer, containing the sent data
+    int64_t     send_timestamp = 0;     //!< publisher send timestamp in µs
+    int64_t     send_clock = 0;         //!< publisher send clock
+  };
+
   /**
   * @brief eCAL publisher event callback type.
   **/
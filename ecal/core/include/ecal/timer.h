@@ -33,6 +33,17 @@ namespace eCAL
   class CTimerImpl;
   using TimerCallbackT = std::function<void ()>;
 
+  /**
+   * @brief Timer backend.
+  **/
+  enum class eTimerBackend
+  {
+    thread,       //!< dedicated thread per timer, follows the eCAL time (plugin) clock (default)
+    timer_wheel,  //!< process wide timer wheel with a shared worker pool, follows the steady system clock
+                  //!< (the pool is shared by all timer_wheel timers of the process, a long running callback
+                  //!<  delays the other timer_wheel timers, but not the eCAL internal tasks)
+  };
+
   /**
    * @brief eCAL timer class.
    *
@@ -55,6 +66,23 @@ namespace eCAL
     **/
     ECAL_API CTimer(int timeout_, const TimerCallbackT& callback_, int delay_ = 0);
 
+    /**
+     * @brief Constructor. 
+     *
+     * @param backend_    The timer backend used by Start().
+    **/
+    ECAL_API explicit CTimer(eTimerBackend backend_);
+
+    /**
+     * @brief Constructor. 
+     *
+     * @param timeout_    Timer callback loop time in ms.
+     * @param callback_   The callback function. 
+     * @param delay_      Timer callback delay for first call in ms.
+     * @param backend_    The timer backend.
+    **/
+    ECAL_API CTimer(int timeout_, const TimerCallbackT& callback_, int delay_, eTimerBackend backend_);
+
     /**
      * @brief Destructor. 
     **/
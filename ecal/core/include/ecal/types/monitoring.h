@@ -61,6 +61,7 @@ namespace eCAL
       udp_mc = 1,
       shm    = 4,
       tcp    = 5,
+      inproc = 42,
     };
 
     struct STransportLayer
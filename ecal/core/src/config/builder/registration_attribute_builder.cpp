@@ -33,6 +33,8 @@ namespace eCAL
     attr.network_enabled      = config_.communication_mode == eCAL::eCommunicationMode::network;
     attr.timeout              = std::chrono::milliseconds(reg_config.registration_timeout);
     attr.refresh              = reg_config.registration_refresh;
+    attr.descriptor_refresh   = reg_config.descriptor_refresh;
+    attr.interest_filter      = reg_config.interest_filter;
     attr.loopback             = reg_config.loopback;
     attr.host_name            = eCAL::Process::GetHostName();
     attr.shm_transport_domain = reg_config.shm_transport_domain;
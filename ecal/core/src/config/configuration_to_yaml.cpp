@@ -47,6 +47,7 @@ namespace YAML
       if (layer_as_string == "shm") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::shm);
       if (layer_as_string == "udp") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::udp_mc);
       if (layer_as_string == "tcp") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::tcp);
+      if (layer_as_string == "inproc") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::inproc);
     }
 
     return layer_priority_vector;
@@ -68,6 +69,9 @@ namespace YAML
         case eCAL::TransportLayer::eType::tcp:
           layer_priority_vector.emplace_back("tcp");
           break;
+        case eCAL::TransportLayer::eType::inproc:
+          layer_priority_vector.emplace_back("inproc");
+          break;
         default:
           break;
       }
@@ -187,6 +191,8 @@ namespace YAML
     Node node;
     node["registration_timeout"] = config_.registration_timeout;
     node["registration_refresh"] = config_.registration_refresh;
+    node["descriptor_refresh"]   = config_.descriptor_refresh;
+    node["interest_filter"]      = config_.interest_filter;
     node["loopback"]             = config_.loopback;
     node["shm_transport_domain"] = config_.shm_transport_domain;
     node["local"]                = config_.local;
@@ -198,6 +204,8 @@ namespace YAML
   {
     AssignValue<unsigned int>(config_.registration_timeout, node_, "registration_timeout");
     AssignValue<unsigned int>(config_.registration_refresh, node_, "registration_refresh");
+    AssignValue<unsigned int>(config_.descriptor_refresh, node_, "descriptor_refresh");
+    AssignValue<bool>(config_.interest_filter, node_, "interest_filter");
     AssignValue<bool>(config_.loopback, node_, "loopback");    
     AssignValue<eCAL::Registration::Local::Configuration>(config_.local, node_, "local");
     AssignValue<eCAL::Registration::Network::Configuration>(config_.network, node_, "network");
@@ -317,6 +325,10 @@ namespace YAML
     node["memfile_buffer_count"]     = config_.memfile_buffer_count;
     node["memfile_min_size_bytes"]   = config_.memfile_min_size_bytes;
     node["memfile_reserve_percent"]  = config_.memfile_reserve_percent;
+    node["memfile_huge_pages"]       = config_.memfile_huge_pages;
+    node["memfile_prefault"]         = config_.memfile_prefault;
+    node["memfile_lock"]             = config_.memfile_lock;
+    node["memfile_numa_local"]       = config_.memfile_numa_local;
     return node;
   }
 
@@ -328,6 +340,10 @@ namespace YAML
     AssignValue<unsigned int>(config_.memfile_buffer_count, node_, "memfile_buffer_count");
     AssignValue<unsigned int>(config_.memfile_min_size_bytes, node_, "memfile_min_size_bytes");
     AssignValue<unsigned int>(config_.memfile_reserve_percent, node_, "memfile_reserve_percent");
+    AssignValue<bool>(config_.memfile_huge_pages, node_, "memfile_huge_pages");
+    AssignValue<bool>(config_.memfile_prefault, node_, "memfile_prefault");
+    AssignValue<bool>(config_.memfile_lock, node_, "memfile_lock");
+    AssignValue<bool>(config_.memfile_numa_local, node_, "memfile_numa_local");
     return true;
   }
   
@@ -335,6 +351,10 @@ namespace YAML
   {
     Node node;
     node["enable"] = config_.enable;
+    node["retransmit_window"] = config_.retransmit_window;
+    node["repair_rate_limit"] = config_.repair_rate_limit;
+    node["coalescing_latency_us"] = config_.coalescing_latency_us;
+    node["coalescing_max_size"] = config_.coalescing_max_size;
 
     return node;
   }
@@ -342,18 +362,37 @@ namespace YAML
   bool convert<eCAL::Publisher::Layer::UDP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.retransmit_window, node_, "retransmit_window");
+    AssignValue<unsigned int>(config_.repair_rate_limit, node_, "repair_rate_limit");
+    AssignValue<unsigned int>(config_.coalescing_latency_us, node_, "coalescing_latency_us");
+    AssignValue<unsigned int>(config_.coalescing_max_size, node_, "coalescing_max_size");
     return true;
   }
   
   Node convert<eCAL::Publisher::Layer::TCP::Configuration>::encode(const eCAL::Publisher::Layer::TCP::Configuration& config_)
   {
     Node node;
-    node["enable"] = config_.enable;
+    node["enable"]      = config_.enable;
+    node["multiplexed"] = config_.multiplexed;
 
     return node;
   }
 
   bool convert<eCAL::Publisher::Layer::TCP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::TCP::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<bool>(config_.multiplexed, node_, "multiplexed");
+    return true;
+  }
+
+  Node convert<eCAL::Publisher::Layer::INPROC::Configuration>::encode(const eCAL::Publisher::Layer::INPROC::Configuration& config_)
+  {
+    Node node;
+    node["enable"] = config_.enable;
+    return node;
+  }
+
+  bool convert<eCAL::Publisher::Layer::INPROC::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::INPROC::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
     return true;
@@ -365,6 +404,7 @@ namespace YAML
     node["shm"] = config_.shm;
     node["udp"] = config_.udp;
     node["tcp"] = config_.tcp;
+    node["inproc"] = config_.inproc;
     return node;
   }
 
@@ -373,6 +413,52 @@ namespace YAML
     AssignValue<eCAL::Publisher::Layer::SHM::Configuration>(config_.shm, node_, "shm");
     AssignValue<eCAL::Publisher::Layer::UDP::Configuration>(config_.udp, node_, "udp");
     AssignValue<eCAL::Publisher::Layer::TCP::Configuration>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::Publisher::Layer::INPROC::Configuration>(config_.inproc, node_, "inproc");
+    return true;
+  }
+
+  Node convert<eCAL::Publisher::SendQueue::Configuration>::encode(const eCAL::Publisher::SendQueue::Configuration& config_)
+  {
+    Node node;
+    node["enable"]   = config_.enable;
+    node["capacity"] = config_.capacity;
+    switch (config_.overflow_policy)
+    {
+    case eCAL::Publisher::SendQueue::eOverflowPolicy::drop_oldest:
+      node["overflow_policy"] = "drop_oldest";
+      break;
+    case eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest:
+      node["overflow_policy"] = "drop_newest";
+      break;
+    case eCAL::Publisher::SendQueue::eOverflowPolicy::block:
+      node["overflow_policy"] = "block";
+      break;
+    default:
+      break;
+    }
+    return node;
+  }
+
+  bool convert<eCAL::Publisher::SendQueue::Configuration>::decode(const Node& node_, eCAL::Publisher::SendQueue::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.capacity, node_, "capacity");
+
+    std::string overflow_policy;
+    AssignValue<std::string>(overflow_policy, node_, "overflow_policy");
+
+    if (overflow_policy == "drop_oldest")
+    {
+      config_.overflow_policy = eCAL::Publisher::SendQueue::eOverflowPolicy::drop_oldest;
+    }
+    else if (overflow_policy == "drop_newest")
+    {
+      config_.overflow_policy = eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest;
+    }
+    else if (overflow_policy == "block")
+    {
+      config_.overflow_policy = eCAL::Publisher::SendQueue::eOverflowPolicy::block;
+    }
     return true;
   }
   
@@ -382,6 +468,7 @@ namespace YAML
     node["layer"]                   = config_.layer;
     node["priority_local"]          = transformLayerEnumToStr(config_.layer_priority_local);
     node["priority_network"]        = transformLayerEnumToStr(config_.layer_priority_remote);
+    node["send_queue"]              = config_.send_queue;
     return node;
   }
 
@@ -395,6 +482,7 @@ namespace YAML
     config_.layer_priority_remote = transformLayerStrToEnum(tmp);
 
     AssignValue<eCAL::Publisher::Layer::Configuration>(config_.layer, node_, "layer");    
+    AssignValue<eCAL::Publisher::SendQueue::Configuration>(config_.send_queue, node_, "send_queue");
     return true;
   }
 
@@ -445,12 +533,26 @@ namespace YAML
     return true;
   }
 
+  Node convert<eCAL::Subscriber::Layer::INPROC::Configuration>::encode(const eCAL::Subscriber::Layer::INPROC::Configuration& config_)
+  {
+    Node node;
+    node["enable"] = config_.enable;
+    return node;
+  }
+
+  bool convert<eCAL::Subscriber::Layer::INPROC::Configuration>::decode(const Node& node_, eCAL::Subscriber::Layer::INPROC::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    return true;
+  }
+
   Node convert<eCAL::Subscriber::Layer::Configuration>::encode(const eCAL::Subscriber::Layer::Configuration& config_)
   {
     Node node;
     node["shm"] = config_.shm;
     node["udp"] = config_.udp;
     node["tcp"] = config_.tcp;
+    node["inproc"] = config_.inproc;
     return node;
   }
 
@@ -459,6 +561,7 @@ namespace YAML
     AssignValue<eCAL::Subscriber::Layer::SHM::Configuration>(config_.shm, node_, "shm");
     AssignValue<eCAL::Subscriber::Layer::UDP::Configuration>(config_.udp, node_, "udp");
     AssignValue<eCAL::Subscriber::Layer::TCP::Configuration>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::Subscriber::Layer::INPROC::Configuration>(config_.inproc, node_, "inproc");
     return true;
   }
 
@@ -467,6 +570,8 @@ namespace YAML
     Node node;
     node["layer"] = config_.layer;
     node["drop_out_of_order_messages"] = config_.drop_out_of_order_messages;
+    node["history_depth"] = config_.history_depth;
+    node["max_frequency"] = config_.max_frequency;
     return node;
   }
 
@@ -474,6 +579,8 @@ namespace YAML
   {
     AssignValue<eCAL::Subscriber::Layer::Configuration>(config_.layer, node_, "layer");
     AssignValue<bool>(config_.drop_out_of_order_messages, node_, "drop_out_of_order_messages");
+    AssignValue<unsigned int>(config_.history_depth, node_, "history_depth");
+    AssignValue<double>(config_.max_frequency, node_, "max_frequency");
     return true;
   }
 
@@ -168,6 +168,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Publisher::Layer::TCP::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Publisher::Layer::INPROC::Configuration>
+  {
+    static Node encode(const eCAL::Publisher::Layer::INPROC::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Publisher::Layer::INPROC::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Publisher::Layer::Configuration>
   {
@@ -176,6 +184,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Publisher::Layer::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Publisher::SendQueue::Configuration>
+  {
+    static Node encode(const eCAL::Publisher::SendQueue::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Publisher::SendQueue::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Publisher::Configuration>
   {
@@ -215,6 +231,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Subscriber::Layer::TCP::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Subscriber::Layer::INPROC::Configuration>
+  {
+    static Node encode(const eCAL::Subscriber::Layer::INPROC::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Subscriber::Layer::INPROC::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Subscriber::Layer::Configuration>
   {
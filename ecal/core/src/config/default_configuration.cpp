@@ -54,6 +54,9 @@ namespace
         case eCAL::TransportLayer::eType::tcp:
           result += "\"tcp\", ";
           break;
+        case eCAL::TransportLayer::eType::inproc:
+          result += "\"inproc\", ";
+          break;
         default:
           break;
       }
@@ -134,6 +137,26 @@ namespace
     }
   }
 
+  std::string quoteString(const eCAL::Publisher::SendQueue::eOverflowPolicy overflow_policy_)
+  {
+    switch (overflow_policy_)
+    {
+      case eCAL::Publisher::SendQueue::eOverflowPolicy::drop_oldest:
+        return "\"drop_oldest\"";
+        break;
+      case eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest:
+        return "\"drop_newest\"";
+        break;
+      case eCAL::Publisher::SendQueue::eOverflowPolicy::block:
+        return "\"block\"";
+        break;
+
+      default:
+        return "";
+        break;
+    }
+  }
+
   std::string quoteString(const eCAL::Types::IpAddressV4& ip_)
   {
     return std::string("\"") + ip_.Get() + std::string("\"");
@@ -173,6 +196,12 @@ namespace eCAL
       ss << R"(registration:)"                                                                                                      << "\n";
       ss << R"(  # Topic registration refresh cylce (has to be smaller then registration timeout! Default: 1000))"                  << "\n";
       ss << R"(  registration_refresh: )"                            << config_.registration.registration_refresh                   << "\n";
+      ss << R"(  # Send full datatype descriptors only every n-th refresh cycle, in between they are)"                             << "\n";
+      ss << R"(  # referenced by their hash (0 = always send full descriptors, Default: 10))"                                      << "\n";
+      ss << R"(  descriptor_refresh: )"                              << config_.registration.descriptor_refresh                     << "\n";
+      ss << R"(  # Only deserialize registration samples of entities matching local publishers, subscribers)"                      << "\n";
+      ss << R"(  # and service clients (ignored if monitoring is initialized, Default: false))"                                   << "\n";
+      ss << R"(  interest_filter: )"                                 << config_.registration.interest_filter                        << "\n";
       ss << R"(  # Timeout for topic registration in ms (internal, Default: 60000))"                                                << "\n";
       ss << R"(  registration_timeout: )"                            << config_.registration.registration_timeout                   << "\n";
       ss << R"(  # Enable to receive registration information on the same local machine)"                                           << "\n";
@@ -267,22 +296,55 @@ namespace eCAL
       ss << R"(      memfile_min_size_bytes: )"                      << config_.publisher.layer.shm.memfile_min_size_bytes          << "\n";
       ss << R"(      # Dynamic file size reserve before recreating memory file if topic size changes)"                              << "\n";
       ss << R"(      memfile_reserve_percent: )"                     << config_.publisher.layer.shm.memfile_reserve_percent         << "\n";
+      ss << R"(      # Request transparent huge pages for memory files (Linux only, needs shmem_enabled=advise))"                   << "\n";
+      ss << R"(      memfile_huge_pages: )"                          << config_.publisher.layer.shm.memfile_huge_pages              << "\n";
+      ss << R"(      # Pre-fault memory file pages on creation to avoid page faults on the first writes (Linux only))"              << "\n";
+      ss << R"(      memfile_prefault: )"                            << config_.publisher.layer.shm.memfile_prefault                << "\n";
+      ss << R"(      # Lock memory file pages in RAM (Linux only))"                                                                 << "\n";
+      ss << R"(      memfile_lock: )"                                << config_.publisher.layer.shm.memfile_lock                    << "\n";
+      ss << R"(      # Bind memory file pages to the NUMA node of the publishing thread (Linux only))"                              << "\n";
+      ss << R"(      memfile_numa_local: )"                          << config_.publisher.layer.shm.memfile_numa_local              << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for UDP publisher)"                                                                         << "\n";
       ss << R"(    udp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.udp.enable                          << "\n";
+      ss << R"(      # Number of sent samples kept to repair losses reported by subscribers (0 == no repair))"                      << "\n";
+      ss << R"(      # A loss holds back the later samples of the sender until it is repaired or skipped (up to 30 ms))"           << "\n";
+      ss << R"(      retransmit_window: )"                           << config_.publisher.layer.udp.retransmit_window               << "\n";
+      ss << R"(      # Maximum rate of repaired samples in bytes per second (0 == unlimited))"                                      << "\n";
+      ss << R"(      repair_rate_limit: )"                           << config_.publisher.layer.udp.repair_rate_limit               << "\n";
+      ss << R"(      # Maximum time in microseconds small samples are held back to be sent in one datagram (0 == no coalescing))"   << "\n";
+      ss << R"(      coalescing_latency_us: )"                       << config_.publisher.layer.udp.coalescing_latency_us           << "\n";
+      ss << R"(      # Maximum size of a coalesced datagram, larger samples are sent directly)"                                     << "\n";
+      ss << R"(      coalescing_max_size: )"                         << config_.publisher.layer.udp.coalescing_max_size             << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for TCP publisher)"                                                                         << "\n";
       ss << R"(    tcp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.shm.enable                          << "\n";
+      ss << R"(      # Share one connection per subscribing process with all multiplexed TCP publishers of this process)"           << "\n";
+      ss << R"(      multiplexed: )"                                 << config_.publisher.layer.tcp.multiplexed                     << "\n";
       ss << R"()"                                                                                                                   << "\n";
-      ss << R"(  # Priority list for layer usage in local mode (Default: SHM > UDP > TCP))"                                         << "\n";
+      ss << R"(    # Base configuration for inner process publisher)"                                                               << "\n";
+      ss << R"(    inproc:)"                                                                                                        << "\n";
+      ss << R"(      # Enable layer)"                                                                                               << "\n";
+      ss << R"(      enable: )"                                      << config_.publisher.layer.inproc.enable                       << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Priority list for layer usage in local mode (Default: INPROC > SHM > UDP > TCP))"                                << "\n";
       ss << R"(  priority_local: )"                                  << quoteString(config_.publisher.layer_priority_local)         << "\n";
       ss << R"(  # Priority list for layer usage in cloud mode (Default: UDP > TCP))"                                               << "\n";
       ss << R"(  priority_network: )"                                << quoteString(config_.publisher.layer_priority_remote)        << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Asynchronous send queue, the send call only enqueues and a writer thread hands the samples to the layers)"      << "\n";
+      ss << R"(  send_queue:)"                                                                                                      << "\n";
+      ss << R"(    # Enable the send queue)"                                                                                        << "\n";
+      ss << R"(    enable: )"                                        << config_.publisher.send_queue.enable                         << "\n";
+      ss << R"(    # Maximum number of queued samples)"                                                                             << "\n";
+      ss << R"(    capacity: )"                                      << config_.publisher.send_queue.capacity                       << "\n";
+      ss << R"(    # Behavior if the queue is full: "drop_oldest", "drop_newest" or "block" (send call waits for room))"           << "\n";
+      ss << R"(    overflow_policy: )"                               << quoteString(config_.publisher.send_queue.overflow_policy)   << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Subscriber specific base configuration)"                                                                           << "\n";
       ss << R"(subscriber:)"                                                                                                        << "\n";
@@ -302,8 +364,17 @@ namespace eCAL
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                        << config_.subscriber.layer.tcp.enable                       << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(    # Base configuration for inner process subscriber)"                                                              << "\n";
+      ss << R"(    inproc:)"                                                                                                        << "\n";
+      ss << R"(      # Enable layer)"                                                                                               << "\n";
+      ss << R"(      enable: )"                                        << config_.subscriber.layer.inproc.enable                    << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"(  # Enable dropping of payload messages that arrive out of order)"                                                   << "\n";
       ss << R"(  drop_out_of_order_messages: )"                        << config_.subscriber.drop_out_of_order_messages             << "\n";
+      ss << R"(  # Number of received samples kept for polling via Take/Peek/ReadBatch (0 == no history))"                           << "\n";
+      ss << R"(  history_depth: )"                                     << config_.subscriber.history_depth                          << "\n";
+      ss << R"(  # Maximum data frequency [Hz] needed, publishers skip network sends above it (0 == unlimited))"                     << "\n";
+      ss << R"(  max_frequency: )"                                     << config_.subscriber.max_frequency                          << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Time configuration)"                                                                                               << "\n";
@@ -72,6 +72,16 @@ constexpr unsigned int PUB_MEMFILE_OPEN_TO                = 200U;
 /* memory file access timeout */
 constexpr unsigned int EXP_MEMFILE_ACCESS_TIMEOUT         = 100U;
 
+/* maximum number of inner process samples queued per subscriber (the oldest sample is dropped if the subscriber falls behind) */
+constexpr unsigned int INPROC_READER_QUEUE_CAPACITY       = 16U;
+
+/* process wide timer wheels (number of slots, tick resolution in us, worker threads of the internal, the user and the publisher send timer wheel) */
+constexpr unsigned int TIMER_WHEEL_SLOT_COUNT             = 512U;
+constexpr unsigned int TIMER_WHEEL_TICK_US                = 1000U;
+constexpr unsigned int TIMER_WHEEL_WORKER_COUNT           = 2U;
+constexpr unsigned int TIMER_WHEEL_USER_WORKER_COUNT      = 2U;
+constexpr unsigned int TIMER_WHEEL_SEND_WORKER_COUNT      = 2U;
+
 
 /**********************************************************************************************/
 /*                                     events                                                 */
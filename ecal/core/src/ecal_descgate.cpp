@@ -129,14 +129,33 @@ namespace eCAL
     return m_client_infos.GetInfo(id_, service_info_);
   }
 
+  bool CDescGate::GetDescriptor(uint64_t descriptor_hash_, std::string& descriptor_) const
+  {
+    const std::lock_guard<std::mutex> lock(m_descriptor_mtx);
+    const auto iter = m_descriptor_map.find(descriptor_hash_);
+    if ((iter == m_descriptor_map.end()) || iter->second.descriptor.empty()) return false;
+
+    descriptor_ = iter->second.descriptor;
+    return true;
+  }
+
+  bool CDescGate::AllProcessesSupportDescriptorHash() const
+  {
+    const std::lock_guard<std::mutex> lock(m_legacy_process_mtx);
+    return m_legacy_processes.empty();
+  }
+
   void CDescGate::ApplySample(const Registration::Sample& sample_, eTLayerType /*layer_*/)
   {
     switch (sample_.cmd_type)
     {
     case bct_none:
     case bct_set_sample:
+      break;
+
     case bct_reg_process:
     case bct_unreg_process:
+      ApplyProcessSample(sample_);
       break;
 
     case bct_reg_service:
@@ -162,18 +181,22 @@ namespace eCAL
       break;
 
     case bct_reg_publisher:
+      RegisterDescriptor(sample_);
       m_publisher_infos.RegisterSample(sample_, MakeNotifyLambda(m_publisher_callback_map, eCAL::Registration::RegistrationEventType::new_entity));
       break;
 
     case bct_unreg_publisher:
+      UnregisterDescriptor(sample_);
       m_publisher_infos.UnregisterSample(sample_, MakeNotifyLambda(m_publisher_callback_map, eCAL::Registration::RegistrationEventType::deleted_entity));
       break;
 
     case bct_reg_subscriber:
+      RegisterDescriptor(sample_);
       m_subscriber_infos.RegisterSample(sample_, MakeNotifyLambda(m_subscriber_callback_map, eCAL::Registration::RegistrationEventType::new_entity));
       break;
 
     case bct_unreg_subscriber:
+      UnregisterDescriptor(sample_);
       m_subscriber_infos.UnregisterSample(sample_, MakeNotifyLambda(m_subscriber_callback_map, eCAL::Registration::RegistrationEventType::deleted_entity));
       break;
 
@@ -189,6 +212,71 @@ namespace eCAL
     return m_callback_token.fetch_add(1, std::memory_order_relaxed) + 1;
   }
 
+  void CDescGate::ApplyProcessSample(const Registration::Sample& sample_)
+  {
+    const auto process_key = std::make_pair(sample_.identifier.host_name, sample_.identifier.process_id);
+
+    const std::lock_guard<std::mutex> lock(m_legacy_process_mtx);
+    if ((sample_.cmd_type == bct_reg_process) && !sample_.process.descriptor_hash_support)
+    {
+      m_legacy_processes.insert(process_key);
+    }
+    else
+    {
+      m_legacy_processes.erase(process_key);
+    }
+  }
+
+  void CDescGate::RegisterDescriptor(const Registration::Sample& sample_)
+  {
+    const uint64_t  descriptor_hash = sample_.topic.datatype_descriptor_hash;
+    const EntityIdT entity_id       = sample_.identifier.entity_id;
+
+    const std::lock_guard<std::mutex> lock(m_descriptor_mtx);
+
+    // the entity may have changed its datatype
+    const auto entity_iter = m_descriptor_entity_map.find(entity_id);
+    if ((entity_iter != m_descriptor_entity_map.end()) && (entity_iter->second != descriptor_hash))
+    {
+      ReleaseDescriptor(entity_iter->second, entity_id);
+      m_descriptor_entity_map.erase(entity_iter);
+    }
+
+    if (descriptor_hash == 0) return;
+
+    auto& entry = m_descriptor_map[descriptor_hash];
+    entry.entities.insert(entity_id);
+    m_descriptor_entity_map[entity_id] = descriptor_hash;
+
+    // descriptors are content addressed, the first one for a hash stays valid
+    const std::string& descriptor = sample_.topic.datatype_information.descriptor;
+    if (entry.descriptor.empty() && !descriptor.empty()) entry.descriptor = descriptor;
+  }
+
+  void CDescGate::UnregisterDescriptor(const Registration::Sample& sample_)
+  {
+    const EntityIdT entity_id = sample_.identifier.entity_id;
+
+    const std::lock_guard<std::mutex> lock(m_descriptor_mtx);
+
+    const auto entity_iter = m_descriptor_entity_map.find(entity_id);
+    if (entity_iter == m_descriptor_entity_map.end()) return;
+
+    ReleaseDescriptor(entity_iter->second, entity_id);
+    m_descriptor_entity_map.erase(entity_iter);
+  }
+
+  void CDescGate::ReleaseDescriptor(uint64_t descriptor_hash_, EntityIdT entity_id_)
+  {
+    // m_descriptor_mtx has to be locked by the caller
+    const auto iter = m_descriptor_map.find(descriptor_hash_);
+    if (iter == m_descriptor_map.end()) return;
+
+    // evict the descriptor together with the last entity referencing it
+    iter->second.entities.erase(entity_id_);
+    if (iter->second.entities.empty()) m_descriptor_map.erase(iter);
+  }
+
   // ---------- CollectedTopicInfo ----------
 
   void CDescGate::CollectedTopicInfo::RegisterSample(const Registration::Sample& sample_,
@@ -200,7 +288,18 @@ namespace eCAL
     if (it != map.end())
     {
       // Update normalized datatype info (v6 should be invariant, but we keep it robust)
-      it->second.datatype_info = sample_.topic.datatype_information;
+      // a sample referencing its descriptor by hash only must not wipe out the known descriptor
+      const bool descriptor_omitted = (sample_.topic.datatype_descriptor_hash != 0) && sample_.topic.datatype_information.descriptor.empty();
+      if (descriptor_omitted)
+      {
+        std::string known_descriptor = std::move(it->second.datatype_info.descriptor);
+        it->second.datatype_info            = sample_.topic.datatype_information;
+        it->second.datatype_info.descriptor = std::move(known_descriptor);
+      }
+      else
+      {
+        it->second.datatype_info = sample_.topic.datatype_information;
+      }
       return;
     }
 
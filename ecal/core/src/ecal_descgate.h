@@ -32,11 +32,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <unordered_map>
 #include <mutex>
 #include <string>
 #include <tuple>
 #include <set>
+#include <utility>
 
 namespace eCAL
 {
@@ -69,6 +71,12 @@ namespace eCAL
     std::set<SServiceId> GetClientIDs() const;
     bool GetClientInfo(const SServiceId& id_, ServiceMethodInformationSetT& service_info_) const;
 
+    // datatype descriptors by hash (registration samples may reference a descriptor by its hash only)
+    bool GetDescriptor(uint64_t descriptor_hash_, std::string& descriptor_) const;
+
+    // false as long as a process is registered that needs the full descriptors (older eCAL versions)
+    bool AllProcessesSupportDescriptorHash() const;
+
     // delete copy/move
     CDescGate(const CDescGate&) = delete;
     CDescGate& operator=(const CDescGate&) = delete;
@@ -133,6 +141,11 @@ namespace eCAL
 
     Registration::CallbackToken CreateToken();
 
+    void ApplyProcessSample(const Registration::Sample& sample_);
+    void RegisterDescriptor(const Registration::Sample& sample_);
+    void UnregisterDescriptor(const Registration::Sample& sample_);
+    void ReleaseDescriptor(uint64_t descriptor_hash_, EntityIdT entity_id_);
+
     // internal quality topic info publisher/subscriber maps
     CollectedTopicInfo                       m_publisher_infos;
     STopicEventCallbackMap                   m_publisher_callback_map;
@@ -144,6 +157,20 @@ namespace eCAL
     CollectedServiceInfo                     m_server_infos;
     CollectedServiceInfo                     m_client_infos;
 
+    // content addressed datatype descriptor cache, an entry is kept as long as a topic references it
+    struct SDescriptorEntry
+    {
+      std::string         descriptor;
+      std::set<EntityIdT> entities;
+    };
+    mutable std::mutex                             m_descriptor_mtx;
+    std::unordered_map<uint64_t, SDescriptorEntry> m_descriptor_map;
+    std::unordered_map<EntityIdT, uint64_t>        m_descriptor_entity_map;
+
+    // processes (host name, process id) that do not resolve descriptors referenced by their hash
+    mutable std::mutex                             m_legacy_process_mtx;
+    std::set<std::pair<std::string, int32_t>>      m_legacy_processes;
+
     std::atomic<Registration::CallbackToken> m_callback_token{ 0 };
   };
 }
@@ -153,6 +153,7 @@ namespace eCAL
       registration_provider_context.pubgate      = pubgate_instance;
       registration_provider_context.servicegate  = servicegate_instance;
       registration_provider_context.clientgate   = clientgate_instance;
+      registration_provider_context.descgate     = descgate_instance;
       registration_provider_instance = std::make_shared<CRegistrationProvider>(registration_provider_context);
       new_initialization = true;
     }
@@ -165,6 +166,7 @@ namespace eCAL
       SRegistrationReceiverContext registration_receiver_context;
       registration_receiver_context.attributes    = registration_attr;
       registration_receiver_context.memfile_map   = memfile_map_instance;
+      registration_receiver_context.descgate      = descgate_instance;
       registration_receiver_instance = std::make_shared<CRegistrationReceiver>(registration_receiver_context);
       new_initialization = true;
     }
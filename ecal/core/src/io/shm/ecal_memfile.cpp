@@ -26,13 +26,15 @@
 #include "ecal_memfile.h"
 #include "ecal_memfile_info.h"
 #include "ecal_memfile_db.h"
+#include "ecal_memfile_os.h"
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
-#include <random>
+#include <thread>
 
 #define SIZEOF_PARTIAL_STRUCT(_STRUCT_NAME_, _FIELD_NAME_) (reinterpret_cast<std::size_t>(&(reinterpret_cast<_STRUCT_NAME_*>(0)->_FIELD_NAME_)) + sizeof(_STRUCT_NAME_::_FIELD_NAME_)) //NOLINT
 
@@ -47,6 +49,7 @@ namespace eCAL
     m_auto_sanitizing(false),
     m_payload_initialized(false),
     m_access_state(access_state::closed),
+    m_shared_read(false),
     m_memfile_map(std::move(memfile_map_))
   {
   }
@@ -56,7 +59,7 @@ namespace eCAL
     Destroy(false);
   }
 
-  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_)
+  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_, const SMemFileOptions& options_)
   {
     assert((create_ && len_ > 0) || (!create_ && len_ == 0));
     assert((auto_sanitizing_ && create_) || !auto_sanitizing_);
@@ -83,8 +86,10 @@ namespace eCAL
 
       // reset header and info
       m_header       = SInternalHeader();
+      if (create_) m_header.shared_read_access = 1;
 
       m_memfile_info = std::make_shared<SMemFileInfo>();
+      if (create_) m_memfile_info->options = options_;
 
       // create memory file
       if (!m_memfile_map->AddFile(name_, create_, create_ ? len_ + m_header.int_hdr_size : SIZEOF_PARTIAL_STRUCT(SInternalHeader, int_hdr_size), m_memfile_info))
@@ -121,10 +126,14 @@ namespace eCAL
 
           // reset header if memfile does not exist or rather is not initialized as well as if lock state is inconsistent
           if (!m_memfile_info->exists || header->int_hdr_size == 0 || (m_auto_sanitizing && m_memfile_mutex.WasRecovered()))
+          {
             *header = m_header;
+          }
           else
           {
             // read compatible header part if magic number already exists
+            // (an older header does not support shared read access)
+            m_header.shared_read_access = 0;
             memcpy(&m_header, header, std::min(sizeof(SInternalHeader), static_cast<std::size_t>(header->int_hdr_size)));
           }
         }
@@ -166,6 +175,9 @@ namespace eCAL
     // return state
     bool ret_state = true;
 
+    // do not keep the writer waiting for us
+    if (m_shared_read) ReleaseSharedRead();
+
     if (!remove_)
       m_memfile_mutex.DropOwnership();
 
@@ -189,14 +201,42 @@ namespace eCAL
     return(ret_state);
   }
 
+  bool CMemoryFile::Grow(const size_t len_, int timeout_)
+  {
+    if (!m_created)                     return(false);
+    if (len_ <= MaxDataSize())          return(true);
+
+    // no reader must access the memory file while it is remapped
+    if (!GetWriteAccess(timeout_)) return(false);
+
+    const bool grown = m_memfile_map->GrowFile(len_ + m_header.int_hdr_size, m_memfile_info);
+    if (grown)
+    {
+      // update header, readers map the file again on their next access
+      m_header.max_data_size = (unsigned long)len_;
+      reinterpret_cast<SInternalHeader*>(m_memfile_info->mem_address)->max_data_size = m_header.max_data_size;
+    }
+
+    ReleaseWriteAccess();
+    return(grown);
+  }
+
   bool CMemoryFile::GetReadAccess(int timeout_)
   {
-    // currently we do not differ between read and write access
     if (GetAccess(timeout_))
     {
       // mark as opened for read access
       m_access_state = access_state::read_access;
 
+      // register as shared reader and let other readers in,
+      // the writer waits until all shared readers are gone.
+      // if that's not possible (older writer, no file lock support on this system)
+      // we keep the mutex and read exclusively.
+      if (AcquireSharedRead())
+      {
+        m_memfile_mutex.Unlock();
+      }
+
       return(true);
     }
 
@@ -211,8 +251,17 @@ namespace eCAL
     // reset states
     m_access_state = access_state::closed;
 
-    // release read mutex
-    m_memfile_mutex.Unlock();
+    if (m_shared_read)
+    {
+      // release shared read access
+      ReleaseSharedRead();
+    }
+    else
+    {
+      // release read mutex
+      m_memfile_mutex.Unlock();
+    }
+    m_access_mutex.unlock();
 
     return(true);
   }
@@ -253,9 +302,26 @@ namespace eCAL
 
   bool CMemoryFile::GetWriteAccess(int timeout_)
   {
-    // currently we do not differ between read and write access
+    const auto start_time = std::chrono::steady_clock::now();
     if (GetAccess(timeout_))
     {
+      // new readers are blocked by the mutex now, wait for the active shared readers to finish
+      int remaining_timeout = timeout_;
+      if (timeout_ > 0)
+      {
+        const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+        remaining_timeout = std::max(0, timeout_ - static_cast<int>(elapsed_ms));
+      }
+      if (!WaitForSharedReaders(remaining_timeout))
+      {
+#ifndef NDEBUG
+        printf("Shared readers did not release memory file in time: %s.\n\n", m_name.c_str());
+#endif
+        m_memfile_mutex.Unlock();
+        m_access_mutex.unlock();
+        return(false);
+      }
+
       // mark as opened for write access
       m_access_state = access_state::write_access;
 
@@ -275,6 +341,7 @@ namespace eCAL
 
     // unlock mutex
     m_memfile_mutex.Unlock();
+    m_access_mutex.unlock();
 
     return(true);
   }
@@ -364,12 +431,21 @@ namespace eCAL
     auto memfile_info = m_memfile_info;
     if (!memfile_info || (memfile_info->mem_address == nullptr)) return(false);
 
+    // serialize the usage of this object by multiple threads,
+    // shared readers do not keep the named mutex locked
+    bool object_locked(false);
+    if      (timeout_ < 0)  { m_access_mutex.lock(); object_locked = true; }
+    else if (timeout_ == 0) object_locked = m_access_mutex.try_lock();
+    else                    object_locked = m_access_mutex.try_lock_for(std::chrono::milliseconds(timeout_));
+    if (!object_locked) return(false);
+
     // lock mutex
     if(!m_memfile_mutex.Lock(timeout_))
     {
 #ifndef NDEBUG
       printf("Could not lock memory file mutex: %s.\n\n", m_name.c_str());
 #endif
+      m_access_mutex.unlock();
       return(false);
     }
 
@@ -395,10 +471,68 @@ namespace eCAL
       {
         // unlock mutex
         m_memfile_mutex.Unlock();
+        m_access_mutex.unlock();
         return(false);
       }
     }
 
     return(true);
   }
+
+  bool CMemoryFile::AcquireSharedRead()
+  {
+    if (m_header.shared_read_access == 0) return(false);
+    auto memfile_info = m_memfile_info;
+    if (!memfile_info)                    return(false);
+
+    // the first shared reader of this process locks the file,
+    // the lock is released automatically if the process terminates
+    const std::lock_guard<std::mutex> lock(memfile_info->shared_readers_mtx);
+    if ((memfile_info->shared_readers == 0) && !memfile::os::LockFileShared(*memfile_info)) return(false);
+    memfile_info->shared_readers++;
+
+    m_shared_read = true;
+    return(true);
+  }
+
+  void CMemoryFile::ReleaseSharedRead()
+  {
+    auto memfile_info = m_memfile_info;
+    if (memfile_info)
+    {
+      const std::lock_guard<std::mutex> lock(memfile_info->shared_readers_mtx);
+      memfile_info->shared_readers--;
+      if (memfile_info->shared_readers == 0) memfile::os::UnlockFileShared(*memfile_info);
+    }
+    m_shared_read = false;
+  }
+
+  bool CMemoryFile::WaitForSharedReaders(int timeout_)
+  {
+    auto memfile_info = m_memfile_info;
+    if (!memfile_info) return(true);
+
+    // shared readers of this process are counted, other processes hold a shared lock on the file
+    const auto readers_active = [&memfile_info]()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(memfile_info->shared_readers_mtx);
+          if (memfile_info->shared_readers > 0) return(true);
+        }
+        return(memfile::os::IsFileLockedShared(*memfile_info));
+      };
+
+    const auto start_time = std::chrono::steady_clock::now();
+    for (int spin = 0; readers_active(); ++spin)
+    {
+      const auto elapsed = std::chrono::steady_clock::now() - start_time;
+      if ((timeout_ >= 0) && (elapsed >= std::chrono::milliseconds(timeout_))) return(false);
+
+      // readers usually only copy the payload, so spin a little before sleeping
+      if (spin < 100) std::this_thread::yield();
+      else            std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return(true);
+  }
 }
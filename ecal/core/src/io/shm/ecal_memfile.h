@@ -27,6 +27,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <string>
 
 #include <ecal/pubsub/payload_writer.h>
@@ -60,10 +61,11 @@ namespace eCAL
      * @param name_    Unique file name. 
      * @param create_  Add file to system if not exists.
      * @param len_     Number of bytes to allocate (only if create_ == true). 
+     * @param options_ Memory allocation options (only if create_ == true).
      *
      * @return  true if it succeeds, false if it fails. 
     **/
-    bool Create(const char* name_, bool create_, size_t len_ = 0, bool auto_sanitizing_ = false);
+    bool Create(const char* name_, bool create_, size_t len_ = 0, bool auto_sanitizing_ = false, const SMemFileOptions& options_ = SMemFileOptions());
 
     /**
      * @brief Delete the associated memory file from system. 
@@ -74,9 +76,24 @@ namespace eCAL
     **/
     bool Destroy(bool remove_);
 
+    /**
+     * @brief Grow the memory file in place (keeping its name).
+     *
+     * Readers notice the new size on their next access and map the file again.
+     *
+     * @param len_      New number of bytes to allocate.
+     * @param timeout_  The timeout in ms for write access.
+     *
+     * @return  true if it succeeds, false if the file could not be grown (e.g. not supported by the os).
+    **/
+    bool Grow(size_t len_, int timeout_);
+
     /**
      * @brief Get memory file read access. 
      *
+     * Several readers can access the memory file at the same time, if the
+     * writer supports it. Otherwise the access is exclusive.
+     *
      * @param timeout_  The timeout in ms for access via mutex.
      *
      * @return  true if file exists and could be opened with read access. 
@@ -114,7 +131,9 @@ namespace eCAL
     /**
      * @brief Get memory file write access.
      *
-     * @param timeout_  The timeout in ms for access via mutex.
+     * Blocks new readers and waits for the active shared readers to finish.
+     *
+     * @param timeout_  The timeout in ms for access via mutex (including the wait for shared readers).
      *
      * @return  true if file exists and could be opened with read/write access.
     **/
@@ -181,6 +200,7 @@ namespace eCAL
     bool IsOpened()          const {return(m_access_state != access_state::closed);};
     bool HasReadAccess()     const {return(m_access_state == access_state::read_access);};
     bool HasWriteAccess()    const {return(m_access_state == access_state::write_access);};
+    bool HasSharedReadAccess() const {return(HasReadAccess() && m_shared_read);};
 
     
     // @deprecate_eCAL6
@@ -202,15 +222,22 @@ namespace eCAL
       std::uint64_t               cur_data_size = 0;
       std::uint64_t               max_data_size = 0;
 #endif
+      // The writer waits for shared readers (0 = writer only supports exclusive read access).
+      std::uint8_t                shared_read_access = 0;
+      std::array<std::uint8_t, 7> _reserved_1        = {};
       // New fields should only declare well defined data types and be aligned to 8 bytes
       // std::uint8_t                 _new_field  = 0;
-      // std::array<std::uint8_t, 7>  _reserved_1 = {};
+      // std::array<std::uint8_t, 7>  _reserved_2 = {};
     };
 #pragma pack(pop)
 
   protected:
     bool GetAccess(int timeout_);
 
+    bool AcquireSharedRead();
+    void ReleaseSharedRead();
+    bool WaitForSharedReaders(int timeout_);
+
     enum class access_state
     {
       closed,
@@ -221,10 +248,12 @@ namespace eCAL
     bool                          m_auto_sanitizing;
     bool                          m_payload_initialized;
     access_state                  m_access_state;
+    bool                          m_shared_read;
     std::string                   m_name;
     SInternalHeader               m_header;
     std::shared_ptr<SMemFileInfo> m_memfile_info;
     CNamedMutex                   m_memfile_mutex;
+    std::timed_mutex              m_access_mutex;         // serializes concurrent usage of this object, as shared readers don't keep m_memfile_mutex locked
 
   private:
     CMemoryFile(const CMemoryFile&);                 // prevent copy-construction
@@ -164,4 +164,13 @@ namespace eCAL
 
     return(true);
   }
+
+  bool CMemFileMap::GrowFile(const size_t len_, std::shared_ptr<SMemFileInfo>& mem_file_info_)
+  {
+    // lock memory map access
+    const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
+
+    // grow file in place (if supported by the os)
+    return(memfile::os::GrowFile(len_, *mem_file_info_));
+  }
 }
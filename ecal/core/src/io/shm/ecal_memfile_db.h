@@ -44,6 +44,7 @@ namespace eCAL
     bool AddFile(const std::string& name_, bool create_, size_t len_, std::shared_ptr<SMemFileInfo>& memfile_info_);
     bool RemoveFile(const std::string& name_, bool remove_);
     bool CheckFileSize(size_t len_, std::shared_ptr<SMemFileInfo>& memfile_info_);
+    bool GrowFile(size_t len_, std::shared_ptr<SMemFileInfo>& memfile_info_);
 
   protected:
     using MemFileMapT = std::unordered_map<std::string, std::shared_ptr<SMemFileInfo>>;
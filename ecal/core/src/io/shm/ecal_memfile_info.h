@@ -25,6 +25,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <ecal/os.h>
@@ -47,6 +48,15 @@ typedef int  MapRegionT;
 
 namespace eCAL
 {
+  // memory allocation options, applied by the creator of a memory file (linux only)
+  struct SMemFileOptions
+  {
+    bool huge_pages = false;   // advise the kernel to back the file with transparent huge pages
+    bool prefault   = false;   // populate all pages when mapping the file
+    bool lock       = false;   // lock the pages in RAM
+    bool numa_local = false;   // prefer the NUMA node of the mapping thread for new pages
+  };
+
   struct SMemFileInfo
   {
     int          refcnt      = 0;
@@ -57,5 +67,12 @@ namespace eCAL
     std::string  name;
     size_t       size        = 0;
     bool         exists      = false;
+    bool         writable    = false;   // mapped with write access (creator only)
+    SMemFileOptions options;
+
+    // shared read access of this process, all memory file objects of the process share the file handle
+    // and therefore its lock (the lock is taken by the first and released by the last shared reader)
+    std::mutex   shared_readers_mtx;
+    int          shared_readers = 0;
   };
 }
@@ -42,6 +42,12 @@ namespace eCAL
       bool UnMapFile(SMemFileInfo& mem_file_info_);
 
       bool CheckFileSize(const size_t len_, const bool create_, SMemFileInfo& mem_file_info_);
+      bool GrowFile(const size_t len_, SMemFileInfo& mem_file_info_);
+
+      // shared read lock bound to the file handle, released by the os when the process terminates
+      bool LockFileShared(SMemFileInfo& mem_file_info_);
+      bool UnlockFileShared(SMemFileInfo& mem_file_info_);
+      bool IsFileLockedShared(SMemFileInfo& mem_file_info_);
     }
   }
 }
@@ -29,6 +29,7 @@
 #include "ecal/log_level.h"
 
 #include <chrono>
+#include <functional>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -210,8 +211,8 @@ namespace eCAL
             // -------------------------------------------------------------------------
             // That means we call the user callback (ApplySample) from within the opened memory file.
             // So we do not waste time by copying the payload in an intermediate buffer
-            // but the file keeps opened and blocked until the callback returns.
-            // Other subscriber can not access the content this time !
+            // but the file keeps opened and blocked for the publisher until the callback returns.
+            // Other subscribers can still read the content at the same time (shared read access, not on windows).
             // -------------------------------------------------------------------------
             if (zero_copy_allowed)
             {
@@ -325,7 +326,6 @@ namespace eCAL
   ////////////////////////////////////////
   CMemFileThreadPool::CMemFileThreadPool(std::shared_ptr<CMemFileMap> memfile_map_)
     : m_created(false)
-    , m_do_cleanup(false)
     , m_memfile_map(std::move(memfile_map_))
   {
   }
@@ -339,9 +339,9 @@ namespace eCAL
   {
     if(m_created) return;
 
-    // start cleanup thread
-    m_do_cleanup = true;
-    m_cleanup_thread = std::thread(&CMemFileThreadPool::CleanupPoolThread, this);
+    // start cyclic cleanup (1 second period)
+    m_cleanup_timer = std::make_unique<CCallbackTimer>(std::bind(&CMemFileThreadPool::CleanupPool, this));
+    m_cleanup_timer->start(std::chrono::milliseconds(1000));
 
     m_created = true;
   }
@@ -350,13 +350,8 @@ namespace eCAL
   {
     if(!m_created) return;
 
-    // stop cleanup thread
-    {
-      const std::lock_guard<std::mutex> lock(m_do_cleanup_mtx);
-      m_do_cleanup = false;
-      m_do_cleanup_cv.notify_one();
-    }
-    if (m_cleanup_thread.joinable()) m_cleanup_thread.join();
+    // stop cyclic cleanup
+    m_cleanup_timer.reset();
 
     // lock pool
     const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
@@ -413,25 +408,6 @@ namespace eCAL
     }
   }
 
-  void CMemFileThreadPool::CleanupPoolThread()
-  {
-    for (;;)
-    {
-      {
-        // cycling with 1 second timeout
-        std::unique_lock<std::mutex> lock(m_do_cleanup_mtx);
-        m_do_cleanup_cv.wait_for(lock, std::chrono::milliseconds(1000), [&]() -> bool {return !m_do_cleanup; });
-        if (!m_do_cleanup)
-        {
-          // cleanup thread stopped
-          return;
-        }
-      }
-      // do your job
-      CleanupPool();
-    }
-  }
-
   void CMemFileThreadPool::CleanupPool()
   {
     // lock pool
@@ -31,6 +31,7 @@
 #include "ecal_event.h"
 #include "ecal_memfile.h"
 #include "ecal_memfile_header.h"
+#include "util/ecal_callback_timer.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -101,17 +102,13 @@ namespace eCAL
     bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
 
   protected:
-    void CleanupPoolThread();
     void CleanupPool();
 
     std::atomic<bool>                                         m_created;
     std::mutex                                                m_observer_pool_sync;
     std::map<std::string, std::shared_ptr<CMemFileObserver>>  m_observer_pool;
 
-    std::atomic<bool>                                         m_do_cleanup;
-    std::condition_variable                                   m_do_cleanup_cv;
-    std::mutex                                                m_do_cleanup_mtx;
-    std::thread                                               m_cleanup_thread;
+    std::unique_ptr<CCallbackTimer>                           m_cleanup_timer;
     
     std::shared_ptr<CMemFileMap>                              m_memfile_map;
   };
@@ -129,17 +129,28 @@ namespace eCAL
   {
     if (!m_created) return false;
 
-    // we recreate a memory file if the file size is too small
+    // we grow (or recreate) a memory file if the file size is too small
     const bool file_to_small = m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_);
     if (file_to_small)
     {
-#ifndef NDEBUG
-      Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
-#endif
       // estimate size of memory file
       const size_t memfile_size = sizeof(SMemFileHeader) + size_ + static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
 
-      // recreate the file
+      // try to grow the file in place first, the file name does not change
+      // and connected subscribers map the larger file on their next access,
+      // so there is no need to register again
+      if (m_memfile.Grow(memfile_size, static_cast<int>(m_attr.timeout_open_ms)))
+      {
+#ifndef NDEBUG
+        Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - GROW");
+#endif
+        return false;
+      }
+
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
+#endif
+      // recreate the file (growing is not supported on this platform or the file is blocked)
       if (!Recreate(memfile_size)) return false;
 
       // return true to trigger registration and immediately inform listening subscribers
@@ -265,7 +276,7 @@ namespace eCAL
     if (memfile_size < m_attr.min_size) memfile_size = m_attr.min_size;
 
     // create the memory file
-    if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size))
+    if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size, false, m_attr.options))
     {
       Logging::Log(Logging::log_level_error, std::string("CSyncMemoryFile::Create FAILED : ") + m_memfile_name);
       return false;
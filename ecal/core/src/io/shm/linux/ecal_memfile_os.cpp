@@ -31,8 +31,70 @@
 #include <string>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <vector>
+
+namespace
+{
+  void BindToLocalNumaNode(const eCAL::SMemFileInfo& mem_file_info_)
+  {
+#if defined(SYS_mbind) && defined(SYS_getcpu)
+    unsigned int cpu(0);
+    unsigned int node(0);
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return;
+
+    // prefer the node of the current cpu, fall back to other nodes if it is exhausted
+    const int           mpol_preferred = 1;
+    const unsigned long bits           = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> node_mask(node / bits + 1, 0);
+    node_mask[node / bits] |= 1UL << (node % bits);
+    if (::syscall(SYS_mbind, mem_file_info_.mem_address, mem_file_info_.size, mpol_preferred, node_mask.data(), node_mask.size() * bits + 1, 0) != 0)
+    {
+      std::cerr << "mbind failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+    }
+#else
+    (void)mem_file_info_;
+#endif
+  }
+
+  void ApplyOptions(const eCAL::SMemFileInfo& mem_file_info_)
+  {
+    const eCAL::SMemFileOptions& options = mem_file_info_.options;
+
+    // the memory policy has to be set before the first page is touched
+    if (options.numa_local) BindToLocalNumaNode(mem_file_info_);
+
+#ifdef MADV_HUGEPAGE
+    if (options.huge_pages && (::madvise(mem_file_info_.mem_address, mem_file_info_.size, MADV_HUGEPAGE) != 0))
+    {
+      std::cerr << "madvise(MADV_HUGEPAGE) failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+    }
+#endif
+
+    if (options.lock)
+    {
+      // mlock populates the pages as well
+      if (::mlock(mem_file_info_.mem_address, mem_file_info_.size) == 0) return;
+      std::cerr << "mlock failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+    }
+
+    if (options.prefault)
+    {
+#ifdef MADV_POPULATE_WRITE
+      if (mem_file_info_.writable && (::madvise(mem_file_info_.mem_address, mem_file_info_.size, MADV_POPULATE_WRITE) == 0)) return;
+#endif
+      // older kernels, touch every page (reading a page of a shared memory file allocates it)
+      const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+      const volatile char* mem = static_cast<const volatile char*>(mem_file_info_.mem_address);
+      for (size_t pos = 0; pos < mem_file_info_.size; pos += page_size)
+      {
+        (void)mem[pos];
+      }
+    }
+  }
+}
 
 namespace eCAL
 {
@@ -72,8 +134,10 @@ namespace eCAL
           mem_file_info_.memfile = 0;
           mem_file_info_.name = "";
           mem_file_info_.exists = false;
+          mem_file_info_.writable = false;
           return(false);
         }
+        mem_file_info_.writable = create_;
 
         mem_file_info_.size = 0;
 
@@ -115,7 +179,7 @@ namespace eCAL
 
           // get address
           int         prot = PROT_READ;
-          if (create_) prot |= PROT_WRITE;
+          if (create_ || mem_file_info_.writable) prot |= PROT_WRITE;
 
           mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, MAP_SHARED, mem_file_info_.memfile, 0);
           if (mem_file_info_.mem_address == MAP_FAILED)
@@ -124,6 +188,8 @@ namespace eCAL
             std::cerr << "mmap failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
             return(false);
           }
+
+          ApplyOptions(mem_file_info_);
         }
 
         return(true);
@@ -183,6 +249,80 @@ namespace eCAL
 
         return(true);
       }
+
+      bool GrowFile(const size_t len_, SMemFileInfo& mem_file_info_)
+      {
+        if (mem_file_info_.memfile == 0) return(false);
+        if (!mem_file_info_.writable)    return(false);
+        if (len_ <= mem_file_info_.size) return(true);
+
+        // grow the file, the existing content is preserved
+        if (::ftruncate(mem_file_info_.memfile, len_) != 0)
+        {
+          std::cerr << "ftruncate failed (memfile::os::GrowFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+          return(false);
+        }
+
+        // and map the memory file again
+        UnMapFile(mem_file_info_);
+        mem_file_info_.size = len_;
+        return(MapFile(false, mem_file_info_));
+      }
+
+      // open file description locks belong to the file handle (not to the process id), so they work
+      // across pid namespaces and are released by the kernel when the last handle is closed
+      bool LockFileShared(SMemFileInfo& mem_file_info_)
+      {
+#ifdef F_OFD_SETLK
+        if (mem_file_info_.memfile == 0) return(false);
+
+        struct flock lock {};
+        lock.l_type   = F_RDLCK;
+        lock.l_whence = SEEK_SET;
+        lock.l_start  = 0;
+        lock.l_len    = 1;
+        return(::fcntl(mem_file_info_.memfile, F_OFD_SETLK, &lock) == 0);
+#else
+        (void)mem_file_info_;
+        return(false);
+#endif
+      }
+
+      bool UnlockFileShared(SMemFileInfo& mem_file_info_)
+      {
+#ifdef F_OFD_SETLK
+        if (mem_file_info_.memfile == 0) return(false);
+
+        struct flock lock {};
+        lock.l_type   = F_UNLCK;
+        lock.l_whence = SEEK_SET;
+        lock.l_start  = 0;
+        lock.l_len    = 1;
+        return(::fcntl(mem_file_info_.memfile, F_OFD_SETLK, &lock) == 0);
+#else
+        (void)mem_file_info_;
+        return(false);
+#endif
+      }
+
+      bool IsFileLockedShared(SMemFileInfo& mem_file_info_)
+      {
+#ifdef F_OFD_GETLK
+        if (mem_file_info_.memfile == 0) return(false);
+
+        // locks of our own file handle do not conflict and are not reported
+        struct flock lock {};
+        lock.l_type   = F_WRLCK;
+        lock.l_whence = SEEK_SET;
+        lock.l_start  = 0;
+        lock.l_len    = 1;
+        if (::fcntl(mem_file_info_.memfile, F_OFD_GETLK, &lock) != 0) return(false);
+        return(lock.l_type != F_UNLCK);
+#else
+        (void)mem_file_info_;
+        return(false);
+#endif
+      }
     }
   }
 }
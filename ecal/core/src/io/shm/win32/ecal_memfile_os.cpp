@@ -129,6 +129,29 @@ namespace eCAL
 
         return(mem_file_info_.mem_address != nullptr);
       }
+
+      bool GrowFile(const size_t /*len_*/, SMemFileInfo& /*mem_file_info_*/)
+      {
+        // file mappings cannot grow on windows, the memory file has to be recreated
+        return(false);
+      }
+
+      // pagefile backed file mappings do not offer a lock that is released with the reading process,
+      // so readers keep the exclusive access via the memory file mutex on windows
+      bool LockFileShared(SMemFileInfo& /*mem_file_info_*/)
+      {
+        return(false);
+      }
+
+      bool UnlockFileShared(SMemFileInfo& /*mem_file_info_*/)
+      {
+        return(false);
+      }
+
+      bool IsFileLockedShared(SMemFileInfo& /*mem_file_info_*/)
+      {
+        return(false);
+      }
     }
   }
 }
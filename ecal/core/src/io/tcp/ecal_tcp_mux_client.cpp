@@ -0,0 +1,310 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  TCP multiplexed connection client, receives the samples of all subscribed
+ *         topics of one publishing process over a single connection
+**/
+
+#include "ecal_tcp_mux_client.h"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+  constexpr std::chrono::milliseconds g_reconnection_delay(1000);
+}
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    CMuxClient::CMuxClient(asio::io_context& io_context_, EndpointListT endpoints_, int max_reconnection_attempts_, ReceiveCallbackT receive_callback_) :
+      m_strand(asio::make_strand(io_context_)),
+      m_resolver(m_strand),
+      m_socket(m_strand),
+      m_reconnect_timer(m_strand),
+      m_endpoints(std::move(endpoints_)),
+      m_max_reconnection_attempts(max_reconnection_attempts_),
+      m_receive_callback(std::move(receive_callback_)),
+      m_stopped(false),
+      m_closed(false)
+    {}
+
+    void CMuxClient::Start()
+    {
+      asio::post(m_strand, [me = shared_from_this()] { me->Connect(0); });
+    }
+
+    void CMuxClient::Stop()
+    {
+      m_stopped = true;
+      m_closed  = true;
+      asio::post(m_strand, [me = shared_from_this()]
+        {
+          {
+            const std::lock_guard<std::mutex> lock(me->m_mutex);
+            me->m_connected = false;
+            me->m_writing   = false;
+            me->m_write_queue.clear();
+          }
+          asio::error_code ec;
+          me->m_resolver.cancel();
+          me->m_reconnect_timer.cancel();
+          me->m_socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec); // NOLINT(*-unused-return-value)
+          me->m_socket.close(ec);                                          // NOLINT(*-unused-return-value)
+        });
+    }
+
+    void CMuxClient::Subscribe(EntityIdT topic_id_, const std::string& topic_name_)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_topics.emplace(topic_id_, topic_name_).second) return;
+        if (!m_connected) return;
+      }
+      SendControl(eMuxFrameType::subscribe, topic_id_);
+    }
+
+    void CMuxClient::Unsubscribe(const std::string& topic_name_)
+    {
+      std::vector<EntityIdT> topic_ids;
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto iter = m_topics.begin(); iter != m_topics.end();)
+        {
+          if (iter->second == topic_name_)
+          {
+            topic_ids.push_back(iter->first);
+            iter = m_topics.erase(iter);
+          }
+          else
+          {
+            ++iter;
+          }
+        }
+        if (!m_connected) return;
+      }
+      for (const auto topic_id : topic_ids)
+      {
+        SendControl(eMuxFrameType::unsubscribe, topic_id);
+      }
+    }
+
+    size_t CMuxClient::GetTopicCount()
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      return m_topics.size();
+    }
+
+    // runs on the strand
+    void CMuxClient::Connect(size_t endpoint_index_)
+    {
+      if (m_stopped) return;
+
+      // no endpoint reachable, retry later
+      if (endpoint_index_ >= m_endpoints.size())
+      {
+        ++m_reconnection_attempts;
+        if ((m_max_reconnection_attempts >= 0) && (m_reconnection_attempts > m_max_reconnection_attempts))
+        {
+          m_closed = true;
+          return;
+        }
+
+        m_reconnect_timer.expires_after(g_reconnection_delay);
+        m_reconnect_timer.async_wait([me = shared_from_this()](const asio::error_code& ec)
+          {
+            if (ec) return;
+            me->Connect(0);
+          });
+        return;
+      }
+
+      const auto& endpoint = m_endpoints[endpoint_index_];
+      m_resolver.async_resolve(endpoint.first, std::to_string(endpoint.second),
+        [me = shared_from_this(), endpoint_index_](const asio::error_code& resolve_ec, const asio::ip::tcp::resolver::results_type& results)
+        {
+          if (me->m_stopped) return;
+          if (resolve_ec)
+          {
+            me->Connect(endpoint_index_ + 1);
+            return;
+          }
+
+          asio::async_connect(me->m_socket, results,
+            [me, endpoint_index_](const asio::error_code& connect_ec, const asio::ip::tcp::endpoint& /*endpoint*/)
+            {
+              if (me->m_stopped) return;
+              if (connect_ec)
+              {
+                asio::error_code ec;
+                me->m_socket.close(ec); // NOLINT(*-unused-return-value)
+                me->Connect(endpoint_index_ + 1);
+                return;
+              }
+              me->OnConnected();
+            });
+        });
+    }
+
+    // runs on the strand
+    void CMuxClient::OnConnected()
+    {
+      m_reconnection_attempts = 0;
+
+      asio::error_code ec;
+      m_socket.set_option(asio::ip::tcp::no_delay(true), ec); // NOLINT(*-unused-return-value)
+
+      // tell the publishing process about all publishers we are interested in
+      bool start_write(false);
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_connected = true;
+        for (const auto& topic : m_topics)
+        {
+          auto frame = std::make_shared<std::vector<char>>(g_mux_frame_header_size + g_mux_control_body_size);
+          WriteMuxFrameHeader(frame->data(), eMuxFrameType::subscribe, g_mux_control_body_size);
+          WriteMuxTopicId(frame->data() + g_mux_frame_header_size, topic.first);
+          m_write_queue.push_back(std::move(frame));
+        }
+        if (!m_write_queue.empty() && !m_writing)
+        {
+          m_writing   = true;
+          start_write = true;
+        }
+      }
+      if (start_write) Write();
+
+      ReadHeader();
+    }
+
+    // runs on the strand
+    void CMuxClient::OnConnectionLost()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_connected) return;
+        m_connected = false;
+        m_writing   = false;
+        m_write_queue.clear();
+      }
+
+      asio::error_code ec;
+      m_socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec); // NOLINT(*-unused-return-value)
+      m_socket.close(ec);                                          // NOLINT(*-unused-return-value)
+
+      Connect(m_endpoints.size());
+    }
+
+    void CMuxClient::SendControl(eMuxFrameType type_, EntityIdT topic_id_)
+    {
+      auto frame = std::make_shared<std::vector<char>>(g_mux_frame_header_size + g_mux_control_body_size);
+      WriteMuxFrameHeader(frame->data(), type_, g_mux_control_body_size);
+      WriteMuxTopicId(frame->data() + g_mux_frame_header_size, topic_id_);
+
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_connected) return;
+        m_write_queue.push_back(std::move(frame));
+        if (m_writing) return;
+        m_writing = true;
+      }
+      asio::post(m_strand, [me = shared_from_this()] { me->Write(); });
+    }
+
+    // runs on the strand
+    void CMuxClient::Write()
+    {
+      FrameT frame;
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_write_queue.empty() || !m_connected)
+        {
+          m_writing = false;
+          return;
+        }
+        frame = m_write_queue.front();
+      }
+
+      asio::async_write(m_socket, asio::buffer(*frame),
+        [me = shared_from_this(), frame](const asio::error_code& ec, std::size_t /*bytes_written*/)
+        {
+          if (ec)
+          {
+            if (ec != asio::error::operation_aborted) me->OnConnectionLost();
+            return;
+          }
+          {
+            const std::lock_guard<std::mutex> lock(me->m_mutex);
+            if (!me->m_write_queue.empty() && (me->m_write_queue.front() == frame)) me->m_write_queue.pop_front();
+          }
+          me->Write();
+        });
+    }
+
+    // runs on the strand
+    void CMuxClient::ReadHeader()
+    {
+      asio::async_read(m_socket, asio::buffer(m_read_header),
+        [me = shared_from_this()](const asio::error_code& ec, std::size_t /*bytes_read*/)
+        {
+          if (ec)
+          {
+            if (ec != asio::error::operation_aborted) me->OnConnectionLost();
+            return;
+          }
+
+          eMuxFrameType type(eMuxFrameType::data);
+          uint32_t      body_size(0);
+          if (!ReadMuxFrameHeader(me->m_read_header.data(), type, body_size))
+          {
+            std::cerr << "CMuxClient: Unsupported protocol version, closing connection" << '\n';
+            me->OnConnectionLost();
+            return;
+          }
+          me->ReadBody(type, body_size);
+        });
+    }
+
+    // runs on the strand
+    void CMuxClient::ReadBody(eMuxFrameType type_, uint32_t body_size_)
+    {
+      m_read_body.resize(body_size_);
+      asio::async_read(m_socket, asio::buffer(m_read_body),
+        [me = shared_from_this(), type_](const asio::error_code& ec, std::size_t /*bytes_read*/)
+        {
+          if (ec)
+          {
+            if (ec != asio::error::operation_aborted) me->OnConnectionLost();
+            return;
+          }
+
+          // frames of unknown type are skipped
+          if ((type_ == eMuxFrameType::data) && !me->m_stopped && me->m_receive_callback)
+          {
+            me->m_receive_callback(me->m_read_body.data(), me->m_read_body.size());
+          }
+          me->ReadHeader();
+        });
+    }
+  }
+}
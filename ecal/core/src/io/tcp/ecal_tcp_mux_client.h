@@ -0,0 +1,115 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  TCP multiplexed connection client, receives the samples of all subscribed
+ *         topics of one publishing process over a single connection
+**/
+
+#pragma once
+
+#include <ecal/types.h>
+
+#include <asio.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "io/tcp/ecal_tcp_mux_protocol.h"
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    class CMuxClient : public std::enable_shared_from_this<CMuxClient>
+    {
+    public:
+      using ReceiveCallbackT = std::function<void(const char* buffer_, size_t size_)>;
+      using EndpointListT    = std::vector<std::pair<std::string, uint16_t>>;
+
+      // the endpoints are tried in order, a negative number of reconnection attempts retries forever
+      CMuxClient(asio::io_context& io_context_, EndpointListT endpoints_, int max_reconnection_attempts_, ReceiveCallbackT receive_callback_);
+
+      void Start();
+      void Stop();
+
+      // the client gave up to reconnect or was stopped
+      bool IsClosed() const { return m_closed; }
+
+      // subscribe to the samples of a single publisher (topic id) of the given topic
+      void   Subscribe(EntityIdT topic_id_, const std::string& topic_name_);
+      // unsubscribe from all publishers of the given topic
+      void   Unsubscribe(const std::string& topic_name_);
+      size_t GetTopicCount();
+
+      // prevent copying and moving
+      CMuxClient(const CMuxClient&) = delete;
+      CMuxClient& operator=(const CMuxClient&) = delete;
+      CMuxClient(CMuxClient&&) = delete;
+      CMuxClient& operator=(CMuxClient&&) = delete;
+
+    private:
+      using FrameT = std::shared_ptr<const std::vector<char>>;
+
+      void Connect(size_t endpoint_index_);
+      void OnConnected();
+      void OnConnectionLost();
+
+      void SendControl(eMuxFrameType type_, EntityIdT topic_id_);
+      void Write();
+
+      void ReadHeader();
+      void ReadBody(eMuxFrameType type_, uint32_t body_size_);
+
+      using strand_t = asio::strand<asio::io_context::executor_type>;
+      strand_t                                  m_strand;
+      asio::ip::tcp::resolver                   m_resolver;
+      asio::ip::tcp::socket                     m_socket;
+      asio::steady_timer                        m_reconnect_timer;
+
+      const EndpointListT                       m_endpoints;
+      const int                                 m_max_reconnection_attempts;
+      int                                       m_reconnection_attempts = 0;
+      ReceiveCallbackT                          m_receive_callback;
+
+      std::atomic<bool>                         m_stopped;
+      std::atomic<bool>                         m_closed;
+
+      std::mutex                                m_mutex;
+      bool                                      m_connected = false;
+      bool                                      m_writing   = false;
+      std::map<EntityIdT, std::string>          m_topics;    // subscribed publishers (topic id -> topic name)
+      std::deque<FrameT>                        m_write_queue;
+
+      std::array<char, g_mux_frame_header_size> m_read_header {};
+      std::vector<char>                         m_read_body;
+    };
+  }
+}
@@ -0,0 +1,59 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  io context with a pool of threads for the TCP multiplexed connections
+**/
+
+#include "ecal_tcp_mux_executor.h"
+
+#include <algorithm>
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    CMuxExecutor::CMuxExecutor(size_t thread_count_) :
+      m_work(m_io_context.get_executor())
+    {
+      const size_t thread_count = std::max<size_t>(thread_count_, 1);
+      m_threads.reserve(thread_count);
+      for (size_t i = 0; i < thread_count; ++i)
+      {
+        m_threads.emplace_back([this] { m_io_context.run(); });
+      }
+    }
+
+    CMuxExecutor::~CMuxExecutor()
+    {
+      m_io_context.stop();
+      Shutdown();
+    }
+
+    void CMuxExecutor::Shutdown()
+    {
+      m_work.reset();
+      for (auto& thread : m_threads)
+      {
+        if (thread.joinable()) thread.join();
+      }
+    }
+  }
+}
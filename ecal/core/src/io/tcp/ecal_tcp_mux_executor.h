@@ -0,0 +1,62 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  io context with a pool of threads for the TCP multiplexed connections
+**/
+
+#pragma once
+
+#include <asio.hpp>
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    class CMuxExecutor
+    {
+    public:
+      explicit CMuxExecutor(size_t thread_count_);
+      ~CMuxExecutor();
+
+      asio::io_context& GetIoContext() { return m_io_context; }
+
+      // let the threads finish all pending work and join them
+      void Shutdown();
+
+      // prevent copying and moving
+      CMuxExecutor(const CMuxExecutor&) = delete;
+      CMuxExecutor& operator=(const CMuxExecutor&) = delete;
+      CMuxExecutor(CMuxExecutor&&) = delete;
+      CMuxExecutor& operator=(CMuxExecutor&&) = delete;
+
+    private:
+      using work_guard_t = asio::executor_work_guard<asio::io_context::executor_type>;
+
+      asio::io_context         m_io_context;
+      work_guard_t             m_work;
+      std::vector<std::thread> m_threads;
+    };
+  }
+}
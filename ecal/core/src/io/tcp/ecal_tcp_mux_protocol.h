@@ -0,0 +1,92 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  TCP multiplexed connection protocol (frame header shared by server and client)
+**/
+
+#pragma once
+
+#include "ecal_utils/portable_endian.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    /*
+     * Every frame on a multiplexed connection starts with an 8 byte header
+     *
+     *   [type (1 byte)][protocol version (1 byte)][reserved (2 bytes)][body size (4 bytes, little endian)]
+     *
+     * The subscribing process sends subscribe / unsubscribe frames (body: topic id of the
+     * publisher, 8 bytes, little endian), the publishing process answers with data frames for
+     * the subscribed publishers (body: tcp sample in the format of the classic tcp layer, so the
+     * topic information is part of the sample).
+    **/
+    enum class eMuxFrameType : uint8_t
+    {
+      subscribe   = 1,
+      unsubscribe = 2,
+      data        = 3,
+    };
+
+    constexpr size_t   g_mux_frame_header_size     = 8;
+    constexpr uint8_t  g_mux_protocol_version      = 1;
+    constexpr uint32_t g_mux_control_body_size     = sizeof(uint64_t);
+
+    inline void WriteMuxFrameHeader(char* buffer_, eMuxFrameType type_, uint32_t body_size_)
+    {
+      buffer_[0] = static_cast<char>(type_);
+      buffer_[1] = static_cast<char>(g_mux_protocol_version);
+      buffer_[2] = 0;
+      buffer_[3] = 0;
+      const uint32_t body_size_le = htole32(body_size_);
+      memcpy(buffer_ + 4, &body_size_le, sizeof(body_size_le));
+    }
+
+    inline void WriteMuxTopicId(char* buffer_, uint64_t topic_id_)
+    {
+      const uint64_t topic_id_le = htole64(topic_id_);
+      memcpy(buffer_, &topic_id_le, sizeof(topic_id_le));
+    }
+
+    inline uint64_t ReadMuxTopicId(const char* buffer_)
+    {
+      uint64_t topic_id_le = 0;
+      memcpy(&topic_id_le, buffer_, sizeof(topic_id_le));
+      return le64toh(topic_id_le);
+    }
+
+    inline bool ReadMuxFrameHeader(const char* buffer_, eMuxFrameType& type_, uint32_t& body_size_)
+    {
+      if (static_cast<uint8_t>(buffer_[1]) != g_mux_protocol_version) return false;
+
+      type_ = static_cast<eMuxFrameType>(buffer_[0]);
+      uint32_t body_size_le = 0;
+      memcpy(&body_size_le, buffer_ + 4, sizeof(body_size_le));
+      body_size_ = le32toh(body_size_le);
+      return true;
+    }
+  }
+}
@@ -0,0 +1,362 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  TCP multiplexed connection server, sends the samples of all multiplexed
+ *         tcp writers of this process over one connection per subscribing process
+**/
+
+#include "ecal_tcp_mux_server.h"
+#include "ecal_tcp_mux_protocol.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace
+{
+  // upper bounds of a single socket write, a write contains at most one sample per publisher
+  constexpr size_t g_max_write_frames = 64;
+  constexpr size_t g_max_write_bytes  = 4 * 1024 * 1024;
+}
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    ////////////////
+    // SESSION
+    ////////////////
+    class CMuxServer::CSession : public std::enable_shared_from_this<CMuxServer::CSession>
+    {
+    public:
+      using FrameT         = std::shared_ptr<const std::vector<char>>;
+      using CloseCallbackT = std::function<void(const std::shared_ptr<CSession>&)>;
+
+      CSession(asio::ip::tcp::socket socket_, CloseCallbackT close_callback_) :
+        m_socket(std::move(socket_)),
+        m_close_callback(std::move(close_callback_))
+      {}
+
+      void Start()
+      {
+        asio::error_code ec;
+        m_socket.set_option(asio::ip::tcp::no_delay(true), ec); // NOLINT(*-unused-return-value)
+        ReadHeader();
+      }
+
+      bool IsSubscribed(EntityIdT topic_id_)
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return m_open && (m_topics.find(topic_id_) != m_topics.end());
+      }
+
+      void Send(EntityIdT topic_id_, const FrameT& frame_)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(m_mutex);
+          if (!m_open) return;
+          if (m_topics.find(topic_id_) == m_topics.end()) return;
+
+          // a sample of this publisher is still waiting, the newer one replaces it
+          auto iter = m_pending.find(topic_id_);
+          if (iter != m_pending.end())
+          {
+            iter->second = frame_;
+            return;
+          }
+
+          // otherwise the publisher queues up behind all other publishers with waiting samples
+          m_pending.emplace(topic_id_, frame_);
+          m_ready.push_back(topic_id_);
+
+          if (m_writing) return;
+          m_writing = true;
+        }
+        asio::post(m_socket.get_executor(), [me = shared_from_this()] { me->Write(); });
+      }
+
+      void Close()
+      {
+        asio::post(m_socket.get_executor(), [me = shared_from_this()] { me->Shutdown(); });
+      }
+
+    private:
+      // runs on the session strand only
+      void Write()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(m_mutex);
+          m_in_flight.clear();
+          m_write_buffers.clear();
+
+          // take the waiting samples round robin, one per publisher
+          size_t write_bytes = 0;
+          while (!m_ready.empty() && (m_in_flight.size() < g_max_write_frames) && (write_bytes < g_max_write_bytes))
+          {
+            auto iter = m_pending.find(m_ready.front());
+            m_ready.pop_front();
+
+            write_bytes += iter->second->size();
+            m_write_buffers.emplace_back(iter->second->data(), iter->second->size());
+            m_in_flight.push_back(std::move(iter->second));
+            m_pending.erase(iter);
+          }
+
+          if (m_in_flight.empty() || !m_open)
+          {
+            m_writing = false;
+            return;
+          }
+        }
+
+        asio::async_write(m_socket, m_write_buffers,
+          [me = shared_from_this()](const asio::error_code& ec, std::size_t /*bytes_written*/)
+          {
+            if (ec)
+            {
+              me->Shutdown();
+              return;
+            }
+            me->Write();
+          });
+      }
+
+      void ReadHeader()
+      {
+        asio::async_read(m_socket, asio::buffer(m_read_header),
+          [me = shared_from_this()](const asio::error_code& ec, std::size_t /*bytes_read*/)
+          {
+            if (ec)
+            {
+              me->Shutdown();
+              return;
+            }
+
+            eMuxFrameType type(eMuxFrameType::data);
+            uint32_t      body_size(0);
+            if (!ReadMuxFrameHeader(me->m_read_header.data(), type, body_size)
+              || (type == eMuxFrameType::data)
+              || (body_size != g_mux_control_body_size))
+            {
+              std::cerr << "CMuxServer: Invalid frame received, closing connection" << '\n';
+              me->Shutdown();
+              return;
+            }
+            me->ReadBody(type, body_size);
+          });
+      }
+
+      void ReadBody(eMuxFrameType type_, uint32_t body_size_)
+      {
+        m_read_body.resize(body_size_);
+        asio::async_read(m_socket, asio::buffer(m_read_body),
+          [me = shared_from_this(), type_](const asio::error_code& ec, std::size_t /*bytes_read*/)
+          {
+            if (ec)
+            {
+              me->Shutdown();
+              return;
+            }
+
+            const EntityIdT topic_id = ReadMuxTopicId(me->m_read_body.data());
+            {
+              const std::lock_guard<std::mutex> lock(me->m_mutex);
+              switch (type_)
+              {
+              case eMuxFrameType::subscribe:
+                me->m_topics.insert(topic_id);
+                break;
+              case eMuxFrameType::unsubscribe:
+                me->m_topics.erase(topic_id);
+                me->DropPending(topic_id);
+                break;
+              default:
+                break;
+              }
+            }
+            me->ReadHeader();
+          });
+      }
+
+      // needs m_mutex to be locked
+      void DropPending(EntityIdT topic_id_)
+      {
+        if (m_pending.erase(topic_id_) == 0) return;
+        m_ready.erase(std::remove(m_ready.begin(), m_ready.end(), topic_id_), m_ready.end());
+      }
+
+      void Shutdown()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(m_mutex);
+          if (!m_open) return;
+          m_open = false;
+          m_topics.clear();
+          m_pending.clear();
+          m_ready.clear();
+        }
+
+        asio::error_code ec;
+        m_socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec); // NOLINT(*-unused-return-value)
+        m_socket.close(ec);                                          // NOLINT(*-unused-return-value)
+
+        if (m_close_callback) m_close_callback(shared_from_this());
+      }
+
+      asio::ip::tcp::socket                       m_socket;
+      CloseCallbackT                              m_close_callback;
+
+      std::mutex                                  m_mutex;
+      bool                                        m_open    = true;
+      bool                                        m_writing = false;
+      std::unordered_set<EntityIdT>               m_topics;
+      std::unordered_map<EntityIdT, FrameT>       m_pending;
+      std::deque<EntityIdT>                       m_ready;
+
+      std::vector<FrameT>                         m_in_flight;
+      std::vector<asio::const_buffer>             m_write_buffers;
+
+      std::array<char, g_mux_frame_header_size>   m_read_header {};
+      std::vector<char>                           m_read_body;
+    };
+
+    ////////////////
+    // SERVER
+    ////////////////
+    CMuxServer::CMuxServer(size_t thread_count_, const std::string& address_) :
+      m_executor(thread_count_),
+      m_acceptor(asio::make_strand(m_executor.GetIoContext()))
+    {
+      const asio::ip::tcp::endpoint endpoint(asio::ip::make_address(address_), 0);
+
+      asio::error_code ec;
+      m_acceptor.open(endpoint.protocol(), ec); // NOLINT(*-unused-return-value)
+      if (!ec && endpoint.address().is_v6())
+      {
+        // accept ipv4 connections as well
+        m_acceptor.set_option(asio::ip::v6_only(false), ec); // NOLINT(*-unused-return-value)
+      }
+      if (!ec) m_acceptor.bind(endpoint, ec);                              // NOLINT(*-unused-return-value)
+      if (!ec) m_acceptor.listen(asio::socket_base::max_listen_connections, ec); // NOLINT(*-unused-return-value)
+      if (ec)
+      {
+        std::cerr << "CMuxServer: Unable to open acceptor: " << ec.message() << '\n';
+        return;
+      }
+
+      m_port = m_acceptor.local_endpoint().port();
+      Accept();
+    }
+
+    CMuxServer::~CMuxServer()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_sessions_mutex);
+        for (const auto& session : m_sessions)
+        {
+          session->Close();
+        }
+      }
+      asio::post(m_acceptor.get_executor(), [this]
+        {
+          asio::error_code ec;
+          m_acceptor.close(ec); // NOLINT(*-unused-return-value)
+        });
+
+      // all connections are closed when the threads run out of work
+      m_executor.Shutdown();
+    }
+
+    bool CMuxServer::Send(EntityIdT topic_id_, const char* header_, size_t header_size_, const char* payload_, size_t payload_size_)
+    {
+      if (!IsOpen()) return false;
+
+      const size_t body_size = header_size_ + payload_size_;
+      if (body_size > std::numeric_limits<uint32_t>::max()) return false;
+
+      // collect the connections interested in this publisher
+      std::vector<std::shared_ptr<CSession>> sessions;
+      {
+        const std::lock_guard<std::mutex> lock(m_sessions_mutex);
+        for (const auto& session : m_sessions)
+        {
+          if (session->IsSubscribed(topic_id_)) sessions.push_back(session);
+        }
+      }
+      if (sessions.empty()) return true;
+
+      // create the frame once, all connections share it
+      auto frame = std::make_shared<std::vector<char>>(g_mux_frame_header_size + body_size);
+      WriteMuxFrameHeader(frame->data(), eMuxFrameType::data, static_cast<uint32_t>(body_size));
+      memcpy(frame->data() + g_mux_frame_header_size, header_, header_size_);
+      if (payload_size_ > 0) memcpy(frame->data() + g_mux_frame_header_size + header_size_, payload_, payload_size_);
+
+      const CSession::FrameT shared_frame(std::move(frame));
+      for (const auto& session : sessions)
+      {
+        session->Send(topic_id_, shared_frame);
+      }
+      return true;
+    }
+
+    size_t CMuxServer::GetSessionCount()
+    {
+      const std::lock_guard<std::mutex> lock(m_sessions_mutex);
+      return m_sessions.size();
+    }
+
+    void CMuxServer::Accept()
+    {
+      m_acceptor.async_accept(asio::make_strand(m_executor.GetIoContext()),
+        [this](const asio::error_code& ec, asio::ip::tcp::socket socket)
+        {
+          if (ec)
+          {
+            if (ec == asio::error::operation_aborted) return;
+            std::cerr << "CMuxServer: Error accepting connection: " << ec.message() << '\n';
+            if (!m_acceptor.is_open()) return;
+          }
+          else
+          {
+            auto session = std::make_shared<CSession>(std::move(socket), [this](const std::shared_ptr<CSession>& session_) { RemoveSession(session_); });
+            {
+              const std::lock_guard<std::mutex> lock(m_sessions_mutex);
+              m_sessions.push_back(session);
+            }
+            session->Start();
+          }
+          Accept();
+        });
+    }
+
+    void CMuxServer::RemoveSession(const std::shared_ptr<CSession>& session_)
+    {
+      const std::lock_guard<std::mutex> lock(m_sessions_mutex);
+      m_sessions.erase(std::remove(m_sessions.begin(), m_sessions.end(), session_), m_sessions.end());
+    }
+  }
+}
@@ -0,0 +1,80 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  TCP multiplexed connection server, sends the samples of all multiplexed
+ *         tcp writers of this process over one connection per subscribing process
+**/
+
+#pragma once
+
+#include "io/tcp/ecal_tcp_mux_executor.h"
+
+#include <ecal/types.h>
+
+#include <asio.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    class CMuxServer
+    {
+    public:
+      CMuxServer(size_t thread_count_, const std::string& address_);
+      ~CMuxServer();
+
+      bool     IsOpen() const { return m_port != 0; }
+      uint16_t GetPort() const { return m_port; }
+
+      // send header and payload as one sample of the given publisher to all connections that subscribed to it
+      bool Send(EntityIdT topic_id_, const char* header_, size_t header_size_, const char* payload_, size_t payload_size_);
+
+      // number of open connections (one per subscribing process)
+      size_t GetSessionCount();
+
+      // prevent copying and moving
+      CMuxServer(const CMuxServer&) = delete;
+      CMuxServer& operator=(const CMuxServer&) = delete;
+      CMuxServer(CMuxServer&&) = delete;
+      CMuxServer& operator=(CMuxServer&&) = delete;
+
+    private:
+      class CSession;
+
+      void Accept();
+      void RemoveSession(const std::shared_ptr<CSession>& session_);
+
+      CMuxExecutor                           m_executor;
+      asio::ip::tcp::acceptor                m_acceptor;
+      uint16_t                               m_port = 0;
+
+      std::mutex                             m_sessions_mutex;
+      std::vector<std::shared_ptr<CSession>> m_sessions;
+    };
+  }
+}
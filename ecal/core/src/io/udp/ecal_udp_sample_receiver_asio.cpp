@@ -29,6 +29,8 @@
 #endif
 
 #include <array>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 namespace eCAL
@@ -53,10 +55,16 @@ namespace eCAL
 
       // start receiving
       Receive();
+
+      // repair gaps of reliable senders, the timer is armed by the first reliable sample
+      m_repair_timer = std::make_unique<asio::steady_timer>(*m_io_context);
     }
 
     CSampleReceiverAsio::~CSampleReceiverAsio()
     {
+      // cancel repair timer
+      m_repair_timer->cancel();
+
       // cancel async socket operations
       asio::error_code ec;
       m_socket->cancel(ec);
@@ -218,51 +226,131 @@ namespace eCAL
             return;
           }
 
-          // extract data from the buffer
-          const char* receive_buffer = static_cast<const char*>(buffer->data());
-          bool processed = true;
+          // extract and apply the sample
+          const bool processed = ApplyFrame(static_cast<const char*>(buffer->data()), buffer->size(), m_sender_endpoint);
 
-          // read sample_name size
-          unsigned short sample_name_size = 0;
-          memcpy(&sample_name_size, receive_buffer, 2);
-
-          // check for damaged data
-          if (sample_name_size > buffer->size())
+          // recursively call Receive() to continue listening for data
+          if (processed)
           {
-            std::cerr << "CSampleReceiverAsio: Received damaged data. Wrong sample name size." << '\n';
-            processed = false;
+            this->Receive();
           }
-          else
-          {
-            // read sample_name
-            const std::string sample_name(receive_buffer + sizeof(sample_name_size));
+        });
+    }
 
-            // calculate payload offset
-            auto payload_offset = sizeof(sample_name_size) + sample_name_size;
+    bool CSampleReceiverAsio::ApplyFrame(const char* frame_, size_t frame_size_, const asio::ip::udp::endpoint& sender_endpoint_)
+    {
+      // read sample_name size
+      unsigned short sample_name_size = 0;
+      memcpy(&sample_name_size, frame_, 2);
 
-            // check for damaged data
-            if (payload_offset > buffer->size())
-            {
-              std::cerr << "CSampleReceiverAsio: Received damaged data. Wrong payload buffer offset." << '\n';
-              processed = false;
-            }
-            else if (m_has_sample_callback(sample_name)) // if we are interested in the sample payload
-            {
-              // extract payload and its size
-              const char* payload_buffer = receive_buffer + payload_offset;
-              auto payload_buffer_size = buffer->size() - payload_offset;
+      // check for damaged data
+      if (sample_name_size > frame_size_)
+      {
+        std::cerr << "CSampleReceiverAsio: Received damaged data. Wrong sample name size." << '\n';
+        return false;
+      }
 
-              // apply the sample payload
-              m_apply_sample_callback(payload_buffer, payload_buffer_size);
-            }
-          }
+      // read sample_name
+      const std::string sample_name(frame_ + sizeof(sample_name_size));
 
-          // recursively call Receive() to continue listening for data
-          if (processed)
-          {
-            this->Receive();
-          }
+      // calculate payload offset
+      auto payload_offset = sizeof(sample_name_size) + sample_name_size;
+
+      // check for damaged data
+      if (payload_offset > frame_size_)
+      {
+        std::cerr << "CSampleReceiverAsio: Received damaged data. Wrong payload buffer offset." << '\n';
+        return false;
+      }
+
+      // if we are not interested in the sample payload
+      if (!m_has_sample_callback(sample_name)) return true;
+
+      // samples of a reliable sender carry a sequence number behind the sample name
+      const size_t reliability_header_offset = sizeof(sample_name_size) + sample_name.size() + 1;
+      uint64_t sequence(0);
+      if ((reliability_header_offset < payload_offset)
+        && ReadReliabilityHeader(frame_ + reliability_header_offset, payload_offset - reliability_header_offset, sequence))
+      {
+        // deliver in sequence order and request missing samples
+        m_reliable_streams[sender_endpoint_].Apply(sequence, frame_, frame_size_, std::chrono::steady_clock::now(),
+          [this](const char* frame, size_t frame_size) { DeliverFrame(frame, frame_size); },
+          [this, sender_endpoint_](const std::vector<uint64_t>& sequences) { SendNack(sender_endpoint_, sequences); });
+        if (!m_repair_timer_armed) StartRepairTimer();
+        return true;
+      }
+
+      // apply the sample payload
+      DeliverFrame(frame_, frame_size_);
+      return true;
+    }
+
+    void CSampleReceiverAsio::DeliverFrame(const char* frame_, size_t frame_size_)
+    {
+      // frame has been checked by ApplyFrame already
+      unsigned short sample_name_size = 0;
+      memcpy(&sample_name_size, frame_, 2);
+      const size_t payload_offset = sizeof(sample_name_size) + sample_name_size;
+
+      m_apply_sample_callback(frame_ + payload_offset, frame_size_ - payload_offset);
+    }
+
+    void CSampleReceiverAsio::SendNack(const asio::ip::udp::endpoint& sender_endpoint_, const std::vector<uint64_t>& sequences_)
+    {
+      SerializeNack(sequences_, m_nack_buffer);
+
+      const unsigned short s1 = static_cast<unsigned short>(g_nack_sample_name.size()) + 1 /*'\0'*/;
+      const asio::const_buffer sample_name_size_asio_buffer(&s1, 2);
+      const asio::const_buffer sample_name_asio_buffer(g_nack_sample_name.c_str(), s1);
+      const asio::const_buffer nack_asio_buffer(m_nack_buffer.data(), m_nack_buffer.size());
+
+      const asio::socket_base::message_flags flags(0);
+      asio::error_code ec;
+      m_socket->send_to({ sample_name_size_asio_buffer, sample_name_asio_buffer, nack_asio_buffer }, sender_endpoint_, flags, ec);
+      if (ec)
+      {
+        std::cerr << "CSampleReceiverAsio: Unable to send repair request: " << ec.message() << '\n';
+      }
+    }
+
+    void CSampleReceiverAsio::StartRepairTimer()
+    {
+      m_repair_timer_armed = true;
+      m_repair_timer->expires_after(CReliableReceiveStream::nack_interval);
+      m_repair_timer->async_wait([this](asio::error_code ec)
+        {
+          if (ec == asio::error::operation_aborted) return;
+
+          PollReliableStreams();
+
+          // stay idle until the next reliable sender shows up
+          if (m_reliable_streams.empty())
+            m_repair_timer_armed = false;
+          else
+            StartRepairTimer();
         });
     }
+
+    void CSampleReceiverAsio::PollReliableStreams()
+    {
+      const auto now = std::chrono::steady_clock::now();
+      for (auto iter = m_reliable_streams.begin(); iter != m_reliable_streams.end();)
+      {
+        const asio::ip::udp::endpoint sender_endpoint = iter->first;
+        iter->second.Poll(now,
+          [this](const char* frame, size_t frame_size) { DeliverFrame(frame, frame_size); },
+          [this, sender_endpoint](const std::vector<uint64_t>& sequences) { SendNack(sender_endpoint, sequences); });
+
+        // forget senders that have been silent for a while
+        if (now - iter->second.GetLastActivity() > std::chrono::seconds(10))
+        {
+          iter = m_reliable_streams.erase(iter);
+        }
+        else
+        {
+          ++iter;
+        }
+      }
+    }
   }
 }
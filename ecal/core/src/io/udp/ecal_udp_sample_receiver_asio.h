@@ -24,10 +24,14 @@
 #pragma once
 
 #include "io/udp/ecal_udp_sample_receiver_base.h"
+#include "io/udp/ecal_udp_sample_reliability.h"
 
 #include <ecaludp/socket.h>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <thread>
+#include <vector>
 
 namespace eCAL
 {
@@ -53,6 +57,12 @@ namespace eCAL
       bool JoinMultiCastGroup(const char* ipaddr_);
 
       void Receive();
+      bool ApplyFrame(const char* frame_, size_t frame_size_, const asio::ip::udp::endpoint& sender_endpoint_);
+      void DeliverFrame(const char* frame_, size_t frame_size_);
+
+      void SendNack(const asio::ip::udp::endpoint& sender_endpoint_, const std::vector<uint64_t>& sequences_);
+      void StartRepairTimer();
+      void PollReliableStreams();
 
       std::unique_ptr<asio::io_context>       m_io_context;
       using work_guard_t = asio::executor_work_guard<asio::io_context::executor_type>;
@@ -61,6 +71,12 @@ namespace eCAL
 
       asio::ip::udp::endpoint                 m_sender_endpoint;
       std::thread                             m_io_thread;
+
+      // receive states of reliable senders (only accessed by the io thread)
+      std::map<asio::ip::udp::endpoint, CReliableReceiveStream> m_reliable_streams;
+      std::unique_ptr<asio::steady_timer>     m_repair_timer;
+      bool                                    m_repair_timer_armed = false;   // the timer only runs while there are reliable senders
+      std::vector<char>                       m_nack_buffer;
     };
   }
 }
@@ -0,0 +1,234 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  UDP sample reliability (sequence numbers, retransmit window and negative acknowledgements)
+**/
+
+#include "ecal_udp_sample_reliability.h"
+
+#include <algorithm>
+
+namespace
+{
+  void WriteUInt(char* buffer_, uint64_t value_, size_t size_)
+  {
+    for (size_t i = 0; i < size_; ++i)
+      buffer_[i] = static_cast<char>((value_ >> (8 * i)) & 0xFF);
+  }
+
+  uint64_t ReadUInt(const char* buffer_, size_t size_)
+  {
+    uint64_t value(0);
+    for (size_t i = 0; i < size_; ++i)
+      value |= static_cast<uint64_t>(static_cast<unsigned char>(buffer_[i])) << (8 * i);
+    return value;
+  }
+
+  constexpr std::chrono::milliseconds g_repair_holdoff{ 5 };
+}
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    void WriteReliabilityHeader(char* buffer_, uint64_t sequence_)
+    {
+      buffer_[0] = static_cast<char>(g_reliability_header_version);
+      WriteUInt(buffer_ + 1, sequence_, 8);
+    }
+
+    bool ReadReliabilityHeader(const char* buffer_, size_t buffer_size_, uint64_t& sequence_)
+    {
+      if (buffer_size_ < g_reliability_header_size) return false;
+      if (static_cast<uint8_t>(buffer_[0]) != g_reliability_header_version) return false;
+      sequence_ = ReadUInt(buffer_ + 1, 8);
+      return true;
+    }
+
+    void SerializeNack(const std::vector<uint64_t>& sequences_, std::vector<char>& buffer_)
+    {
+      buffer_.resize(4 + 8 * sequences_.size());
+      WriteUInt(buffer_.data(), sequences_.size(), 4);
+      for (size_t i = 0; i < sequences_.size(); ++i)
+        WriteUInt(buffer_.data() + 4 + 8 * i, sequences_[i], 8);
+    }
+
+    bool DeserializeNack(const char* buffer_, size_t buffer_size_, std::vector<uint64_t>& sequences_)
+    {
+      sequences_.clear();
+      if (buffer_size_ < 4) return false;
+      const size_t count = static_cast<size_t>(ReadUInt(buffer_, 4));
+      if (buffer_size_ < 4 + 8 * count) return false;
+      sequences_.reserve(count);
+      for (size_t i = 0; i < count; ++i)
+        sequences_.push_back(ReadUInt(buffer_ + 4 + 8 * i, 8));
+      return true;
+    }
+
+    ////////////////////////////////////////
+    // CRetransmitWindow
+    ////////////////////////////////////////
+    CRetransmitWindow::CRetransmitWindow(size_t capacity_, size_t repair_bytes_per_second_) :
+      m_slots(std::max<size_t>(capacity_, 1)),
+      m_repair_bytes_per_second(static_cast<double>(repair_bytes_per_second_)),
+      m_repair_tokens(static_cast<double>(repair_bytes_per_second_)),
+      m_last_refill(std::chrono::steady_clock::now())
+    {
+    }
+
+    std::vector<char>& CRetransmitWindow::Store(uint64_t sequence_)
+    {
+      auto& slot = m_slots[sequence_ % m_slots.size()];
+      slot.valid       = true;
+      slot.sequence    = sequence_;
+      slot.last_repair = std::chrono::steady_clock::time_point();
+      return slot.frame;
+    }
+
+    const std::vector<char>* CRetransmitWindow::Repair(uint64_t sequence_, std::chrono::steady_clock::time_point now_)
+    {
+      auto& slot = m_slots[sequence_ % m_slots.size()];
+      if (!slot.valid || (slot.sequence != sequence_)) return nullptr;
+
+      // another receiver requested the same repair just now
+      if (now_ - slot.last_repair < g_repair_holdoff) return nullptr;
+
+      // limit the repair rate (0 == unlimited)
+      if (m_repair_bytes_per_second > 0.0)
+      {
+        const double elapsed_s = std::chrono::duration<double>(now_ - m_last_refill).count();
+        m_last_refill   = now_;
+        m_repair_tokens = std::min(m_repair_tokens + elapsed_s * m_repair_bytes_per_second, m_repair_bytes_per_second);
+        if (m_repair_tokens <= 0.0) return nullptr;
+        m_repair_tokens -= static_cast<double>(slot.frame.size());
+      }
+
+      slot.last_repair = now_;
+      return &slot.frame;
+    }
+
+    ////////////////////////////////////////
+    // CReliableReceiveStream
+    ////////////////////////////////////////
+    constexpr std::chrono::milliseconds CReliableReceiveStream::nack_interval;
+    constexpr unsigned int              CReliableReceiveStream::nack_attempts;
+    constexpr size_t                    CReliableReceiveStream::max_held_back;
+    constexpr uint64_t                  CReliableReceiveStream::max_seq_jump;
+    constexpr size_t                    CReliableReceiveStream::max_nack_size;
+
+    void CReliableReceiveStream::Apply(uint64_t sequence_, const char* frame_, size_t frame_size_, std::chrono::steady_clock::time_point now_, const DeliverFunctionT& deliver_, const NackFunctionT& nack_)
+    {
+      m_last_activity = now_;
+
+      // first sample of this sender, or the sender was restarted
+      if (!m_initialized || (sequence_ + max_seq_jump < m_next_sequence) || (sequence_ > m_next_sequence + max_seq_jump))
+      {
+        m_initialized   = true;
+        m_next_sequence = sequence_;
+        m_nacked_until  = sequence_;
+        m_nack_count    = 0;
+        m_held_back.clear();
+      }
+
+      // no more space to hold back samples, give up the oldest gap
+      if ((sequence_ > m_next_sequence) && (m_held_back.size() >= max_held_back))
+      {
+        SkipGap(deliver_);
+      }
+
+      // duplicate or repaired after its gap was skipped
+      if (sequence_ < m_next_sequence) return;
+
+      if (sequence_ == m_next_sequence)
+      {
+        deliver_(frame_, frame_size_);
+        ++m_next_sequence;
+        DeliverHeldBack(deliver_);
+        return;
+      }
+
+      // sample behind a gap, hold it back
+      if (!m_held_back.emplace(sequence_, std::vector<char>(frame_, frame_ + frame_size_)).second) return;
+
+      // request the sequence numbers that went missing since the last request
+      const uint64_t nack_from = std::max(m_nacked_until, m_next_sequence);
+      if (sequence_ > nack_from)
+      {
+        Nack(nack_from, sequence_, now_, nack_);
+      }
+      m_nacked_until = std::max(m_nacked_until, sequence_ + 1);
+    }
+
+    void CReliableReceiveStream::Poll(std::chrono::steady_clock::time_point now_, const DeliverFunctionT& deliver_, const NackFunctionT& nack_)
+    {
+      if (m_held_back.empty()) return;
+      if (now_ - m_last_nack < nack_interval) return;
+
+      // the oldest gap could not be repaired in time
+      if (m_nack_count >= nack_attempts)
+      {
+        SkipGap(deliver_);
+        if (m_held_back.empty()) return;
+      }
+
+      // request everything that is still missing again
+      Nack(m_next_sequence, m_held_back.rbegin()->first, now_, nack_);
+      ++m_nack_count;
+    }
+
+    void CReliableReceiveStream::Nack(uint64_t from_, uint64_t to_, std::chrono::steady_clock::time_point now_, const NackFunctionT& nack_)
+    {
+      std::vector<uint64_t> sequences;
+      for (uint64_t sequence = from_; (sequence < to_) && (sequences.size() < max_nack_size); ++sequence)
+      {
+        if (m_held_back.find(sequence) == m_held_back.end())
+          sequences.push_back(sequence);
+      }
+      if (sequences.empty()) return;
+
+      nack_(sequences);
+      m_last_nack = now_;
+    }
+
+    void CReliableReceiveStream::DeliverHeldBack(const DeliverFunctionT& deliver_)
+    {
+      while (!m_held_back.empty() && (m_held_back.begin()->first == m_next_sequence))
+      {
+        const auto& frame = m_held_back.begin()->second;
+        deliver_(frame.data(), frame.size());
+        m_held_back.erase(m_held_back.begin());
+        ++m_next_sequence;
+      }
+
+      // every gap is closed, the next one starts with fresh attempts
+      if (m_held_back.empty()) m_nack_count = 0;
+    }
+
+    void CReliableReceiveStream::SkipGap(const DeliverFunctionT& deliver_)
+    {
+      if (m_held_back.empty()) return;
+
+      m_next_sequence = m_held_back.begin()->first;
+      m_nack_count    = 0;
+      DeliverHeldBack(deliver_);
+    }
+  }
+}
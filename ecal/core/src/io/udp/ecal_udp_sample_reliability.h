@@ -0,0 +1,145 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  UDP sample reliability (sequence numbers, retransmit window and negative acknowledgements)
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    // ------------------------------------------------
+    // reliability header
+    //
+    // A reliable sender appends this header behind the
+    // terminating '\0' of the sample name and counts it
+    // into the sample name size, so receivers that do not
+    // know it still find the name and the payload.
+    //
+    // 1 Byte  header version
+    // 8 Bytes sequence number of the sending socket
+    // ------------------------------------------------
+    constexpr size_t  g_reliability_header_size    = 9;
+    constexpr uint8_t g_reliability_header_version = 1;
+
+    void WriteReliabilityHeader(char* buffer_, uint64_t sequence_);
+    bool ReadReliabilityHeader(const char* buffer_, size_t buffer_size_, uint64_t& sequence_);
+
+    // ------------------------------------------------
+    // negative acknowledgement
+    //
+    // Sent by a receiver to the socket a sample came from,
+    // using this sample name and the payload
+    //
+    // 4 Bytes number of missing sequence numbers (n)
+    // n * 8 Bytes missing sequence numbers
+    // ------------------------------------------------
+    const std::string g_nack_sample_name = "__ecal_udp_nack__";
+
+    void SerializeNack(const std::vector<uint64_t>& sequences_, std::vector<char>& buffer_);
+    bool DeserializeNack(const char* buffer_, size_t buffer_size_, std::vector<uint64_t>& sequences_);
+
+    /**
+     * @brief Samples recently sent by a reliable sender, kept to repair losses reported by receivers
+     *
+     * Repairs are limited to a maximum rate (token bucket) and every sample is repaired at most
+     * once per repair holdoff, so many receivers missing the same sample cause only one repair.
+    **/
+    class CRetransmitWindow
+    {
+    public:
+      CRetransmitWindow(size_t capacity_, size_t repair_bytes_per_second_);
+
+      // returns the (recycled) buffer to store the frame of the given sequence number in
+      std::vector<char>& Store(uint64_t sequence_);
+
+      // returns the frame to repair or nullptr if it is out of the window or the repair rate is exceeded
+      const std::vector<char>* Repair(uint64_t sequence_, std::chrono::steady_clock::time_point now_);
+
+    private:
+      struct SSlot
+      {
+        bool                                  valid    = false;
+        uint64_t                              sequence = 0;
+        std::vector<char>                     frame;
+        std::chrono::steady_clock::time_point last_repair;
+      };
+
+      std::vector<SSlot>                    m_slots;
+      double                                m_repair_bytes_per_second;
+      double                                m_repair_tokens;
+      std::chrono::steady_clock::time_point m_last_refill;
+    };
+
+    /**
+     * @brief Receive state of a single reliable sender
+     *
+     * Samples are delivered in sequence order. Samples arriving behind a gap are held back and the
+     * missing sequence numbers are requested with negative acknowledgements. If a gap can not be
+     * repaired in time, it is skipped and the held back samples are delivered.
+     *
+     * A gap therefore delays the later samples (of every topic of the sender) by up to
+     * nack_attempts * nack_interval and buffers up to max_held_back samples, keep the
+     * publisher configuration documentation (udp retransmit_window) in sync with these limits.
+    **/
+    class CReliableReceiveStream
+    {
+    public:
+      using DeliverFunctionT = std::function<void(const char* frame_, size_t frame_size_)>;
+      using NackFunctionT    = std::function<void(const std::vector<uint64_t>& sequences_)>;
+
+      void Apply(uint64_t sequence_, const char* frame_, size_t frame_size_, std::chrono::steady_clock::time_point now_, const DeliverFunctionT& deliver_, const NackFunctionT& nack_);
+      void Poll(std::chrono::steady_clock::time_point now_, const DeliverFunctionT& deliver_, const NackFunctionT& nack_);
+
+      std::chrono::steady_clock::time_point GetLastActivity() const { return m_last_activity; }
+
+      static constexpr std::chrono::milliseconds nack_interval  { 10 };   // resend interval for unanswered nacks
+      static constexpr unsigned int              nack_attempts  { 3 };    // nacks per gap before it is skipped
+      static constexpr size_t                    max_held_back  { 256 };  // samples held back behind a gap
+      static constexpr uint64_t                  max_seq_jump   { 4096 }; // larger jumps restart the stream (sender restarted)
+      static constexpr size_t                    max_nack_size  { 128 };  // sequence numbers per nack
+
+    private:
+      void Nack(uint64_t from_, uint64_t to_, std::chrono::steady_clock::time_point now_, const NackFunctionT& nack_);
+      void DeliverHeldBack(const DeliverFunctionT& deliver_);
+      void SkipGap(const DeliverFunctionT& deliver_);
+
+      bool                                  m_initialized   = false;
+      uint64_t                              m_next_sequence = 0;
+      uint64_t                              m_nacked_until  = 0;
+      std::map<uint64_t, std::vector<char>> m_held_back;
+
+      unsigned int                          m_nack_count    = 0;
+      std::chrono::steady_clock::time_point m_last_nack;
+      std::chrono::steady_clock::time_point m_last_activity;
+    };
+  }
+}
@@ -25,24 +25,98 @@
 #include "io/udp/ecal_udp_configurations.h"
 
 #include <array>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 namespace eCAL
 {
   namespace UDP
   {
+    namespace
+    {
+      // io context that runs the repair request handlers of all reliable senders
+      struct SSharedIoContext
+      {
+        using work_guard_t = asio::executor_work_guard<asio::io_context::executor_type>;
+
+        asio::io_context io_context;
+        work_guard_t     work;
+        std::thread      io_thread;
+
+        SSharedIoContext()
+          : work(io_context.get_executor())
+          , io_thread([this] { io_context.run(); })
+        {}
+
+        ~SSharedIoContext()
+        {
+          work.reset();
+          io_context.stop();
+          io_thread.join();
+        }
+
+        SSharedIoContext(const SSharedIoContext&) = delete;
+        SSharedIoContext& operator=(const SSharedIoContext&) = delete;
+        SSharedIoContext(SSharedIoContext&&) = delete;
+        SSharedIoContext& operator=(SSharedIoContext&&) = delete;
+      };
+    }
+
+    std::shared_ptr<asio::io_context> CSampleSender::GetSharedIoContext()
+    {
+      static std::mutex                      instance_mtx;
+      static std::weak_ptr<SSharedIoContext> instance;
+
+      const std::lock_guard<std::mutex> lock(instance_mtx);
+      auto shared_context = instance.lock();
+      if (!shared_context)
+      {
+        shared_context = std::make_shared<SSharedIoContext>();
+        instance       = shared_context;
+      }
+      // the returned io context keeps the shared context (and its thread) alive
+      return std::shared_ptr<asio::io_context>(shared_context, &shared_context->io_context);
+    }
+
     CSampleSender::CSampleSender(const SSenderAttr& attr_) :
       m_destination_endpoint(asio::ip::make_address(attr_.address), static_cast<unsigned short>(attr_.port))
     {
-      m_io_context = std::make_unique<asio::io_context>();
+      // unreliable senders only send synchronously and do not need a running io context
+      if (attr_.retransmit_window > 0) m_io_context = GetSharedIoContext();
+      else                             m_io_context = std::make_shared<asio::io_context>();
 
       // create the socket and set all socket options
       InitializeSocket(attr_);
+
+      // reliable sender, keep the recent samples and listen for repair requests
+      if (attr_.retransmit_window > 0)
+      {
+        // receivers send their negative acknowledgements to the address we are sending from
+        asio::error_code ec;
+        m_socket->bind(asio::ip::udp::endpoint(m_destination_endpoint.protocol(), 0), ec); // NOLINT(*-unused-return-value)
+        if (ec)
+        {
+          std::cerr << "CSampleSender: Unable to bind socket, sending unreliable: " << ec.message() << '\n';
+        }
+        else
+        {
+          m_retransmit_window  = std::make_unique<CRetransmitWindow>(attr_.retransmit_window, attr_.repair_bytes_per_second);
+          m_test_drop_interval = attr_.test_drop_interval;
+
+          m_nack_receiving = true;
+          ReceiveNacks();
+        }
+      }
     }
 
     CSampleSender::~CSampleSender()
     {
+      // stop listening for repair requests
+      StopReceivingNacks();
+
       // close socket
       asio::error_code ec;
       m_socket->close(ec);
@@ -110,6 +184,11 @@ namespace eCAL
 
     size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
     {
+      if (m_retransmit_window)
+      {
+        return SendReliable(sample_name_, serialized_sample_);
+      }
+
       // ------------------------------------------------
       // emulate old protocol
       // 
@@ -136,5 +215,125 @@ namespace eCAL
       }
       return sent;
     }
+
+    size_t CSampleSender::SendReliable(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
+    {
+      const std::lock_guard<std::mutex> lock(m_send_mutex);
+      const uint64_t sequence = m_sequence++;
+
+      // same frame as above, the reliability header is appended to the sample name
+      const unsigned short s1 = static_cast<unsigned short>(sample_name_.size() + 1 /*'\0'*/ + g_reliability_header_size);
+      const size_t         s2 = serialized_sample_.size();
+
+      // build the frame in the retransmit window, so it can be repaired later on
+      std::vector<char>& frame = m_retransmit_window->Store(sequence);
+      frame.resize(sizeof(s1) + s1 + s2);
+      char* frame_pos = frame.data();
+      memcpy(frame_pos, &s1, sizeof(s1));
+      frame_pos += sizeof(s1);
+      memcpy(frame_pos, sample_name_.c_str(), sample_name_.size() + 1);
+      frame_pos += sample_name_.size() + 1;
+      WriteReliabilityHeader(frame_pos, sequence);
+      frame_pos += g_reliability_header_size;
+      if (s2 > 0) memcpy(frame_pos, serialized_sample_.data(), s2);
+
+      // loss injection for testing, the sample can only be received by repair
+      if ((m_test_drop_interval > 0) && ((sequence + 1) % m_test_drop_interval == 0))
+      {
+        return frame.size();
+      }
+
+      const asio::socket_base::message_flags flags(0);
+      asio::error_code ec;
+      const size_t sent = m_socket->send_to({ asio::const_buffer(frame.data(), frame.size()) }, m_destination_endpoint, flags, ec);
+      if (ec)
+      {
+        std::cout << "CSampleSender::Send failed with: \'" << ec.message() << "\'" << '\n';
+        return 0;
+      }
+      return sent;
+    }
+
+    void CSampleSender::ReceiveNacks()
+    {
+      m_socket->async_receive_from(m_nack_endpoint,
+        [this](const std::shared_ptr<ecaludp::OwningBuffer>& buffer, asio::error_code ec)
+        {
+          // triggered by m_socket->cancel in destructor
+          if ((ec == asio::error::operation_aborted) || m_nack_stop)
+          {
+            SetNacksStopped();
+            return;
+          }
+
+          if (ec)
+          {
+            std::cerr << "CSampleSender: Error receiving repair requests: " << ec.message() << '\n';
+            SetNacksStopped();
+            return;
+          }
+
+          // the nack is framed like every other sample
+          const char* receive_buffer = static_cast<const char*>(buffer->data());
+          unsigned short sample_name_size = 0;
+          std::vector<uint64_t> sequences;
+          if (buffer->size() >= sizeof(sample_name_size))
+          {
+            memcpy(&sample_name_size, receive_buffer, sizeof(sample_name_size));
+          }
+          const size_t payload_offset = sizeof(sample_name_size) + sample_name_size;
+          if ((sample_name_size == g_nack_sample_name.size() + 1)
+            && (payload_offset <= buffer->size())
+            && (g_nack_sample_name.compare(0, std::string::npos, receive_buffer + sizeof(sample_name_size), g_nack_sample_name.size()) == 0)
+            && DeserializeNack(receive_buffer + payload_offset, buffer->size() - payload_offset, sequences))
+          {
+            const auto now = std::chrono::steady_clock::now();
+            const std::lock_guard<std::mutex> lock(m_send_mutex);
+            for (const auto sequence : sequences)
+            {
+              const std::vector<char>* frame = m_retransmit_window->Repair(sequence, now);
+              if (frame == nullptr) continue;
+
+              const asio::socket_base::message_flags flags(0);
+              asio::error_code send_ec;
+              m_socket->send_to({ asio::const_buffer(frame->data(), frame->size()) }, m_destination_endpoint, flags, send_ec);
+            }
+          }
+
+          // continue listening for repair requests
+          this->ReceiveNacks();
+        });
+    }
+
+    void CSampleSender::StopReceivingNacks()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_nack_mutex);
+        if (!m_nack_receiving) return;
+      }
+
+      // the io context is shared, so it can not be stopped, instead the receive operation
+      // is cancelled on the io thread and we wait for the cancellation and for the last handler
+      m_nack_stop = true;
+      asio::post(*m_io_context, [this]
+        {
+          asio::error_code ec;
+          m_socket->cancel(ec);
+
+          const std::lock_guard<std::mutex> lock(m_nack_mutex);
+          m_nack_cancelled = true;
+          m_nack_cv.notify_all();
+        });
+
+      std::unique_lock<std::mutex> lock(m_nack_mutex);
+      m_nack_cv.wait(lock, [this] { return m_nack_cancelled && !m_nack_receiving; });
+    }
+
+    void CSampleSender::SetNacksStopped()
+    {
+      const std::lock_guard<std::mutex> lock(m_nack_mutex);
+      m_nack_receiving = false;
+      m_nack_cv.notify_all();
+    }
   }
 }
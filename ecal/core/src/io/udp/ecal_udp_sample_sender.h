@@ -23,10 +23,16 @@
 
 #pragma once
 
+#include "io/udp/ecal_udp_sample_reliability.h"
 #include "io/udp/ecal_udp_sender_attr.h"
 
 #include <ecaludp/socket.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -42,12 +48,39 @@ namespace eCAL
 
       size_t Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
 
+      // prevent copying and moving
+      CSampleSender(const CSampleSender&) = delete;
+      CSampleSender& operator=(const CSampleSender&) = delete;
+      CSampleSender(CSampleSender&&) = delete;
+      CSampleSender& operator=(CSampleSender&&) = delete;
+
     private:
       void InitializeSocket(const SSenderAttr& attr_);
 
-      std::unique_ptr<asio::io_context>       m_io_context;
+      size_t SendReliable(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
+      void   ReceiveNacks();
+      void   StopReceivingNacks();
+      void   SetNacksStopped();
+
+      // all reliable senders of the process share one io context and its thread
+      static std::shared_ptr<asio::io_context> GetSharedIoContext();
+
+      std::shared_ptr<asio::io_context>       m_io_context;
       std::unique_ptr<ecaludp::Socket>        m_socket;
       asio::ip::udp::endpoint                 m_destination_endpoint;
+
+      // reliability (only used if a retransmit window is configured)
+      asio::ip::udp::endpoint                 m_nack_endpoint;
+      std::atomic<bool>                       m_nack_stop{ false };
+      std::mutex                              m_nack_mutex;
+      std::condition_variable                 m_nack_cv;
+      bool                                    m_nack_receiving     = false;
+      bool                                    m_nack_cancelled     = false;
+
+      std::mutex                              m_send_mutex;
+      std::unique_ptr<CRetransmitWindow>      m_retransmit_window;
+      uint64_t                                m_sequence           = 0;
+      size_t                                  m_test_drop_interval = 0;
     };
   }
 }
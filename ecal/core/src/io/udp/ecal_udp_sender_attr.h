@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace eCAL
@@ -37,6 +38,10 @@ namespace eCAL
       bool        broadcast = false;
       bool        loopback  = true;
       int         sndbuf    = 1024 * 1024;
+
+      size_t      retransmit_window       = 0;                 // samples kept to repair losses reported by receivers (0 == no reliability)
+      size_t      repair_bytes_per_second = 10 * 1024 * 1024;  // maximum repair rate (0 == unlimited)
+      size_t      test_drop_interval      = 0;                 // testing only, the first transmission of every n-th sample is dropped (0 == off)
     };
   }
 }
@@ -155,11 +155,13 @@ namespace eCAL
     bool               topic_tlayer_ecal_udp(false);
     bool               topic_tlayer_ecal_shm(false);
     bool               topic_tlayer_ecal_tcp(false);
+    bool               topic_tlayer_ecal_inproc(false);
     for (const auto& layer : sample_topic.transport_layer)
     {
       topic_tlayer_ecal_udp |= (layer.type == tl_ecal_udp) && layer.active;
       topic_tlayer_ecal_shm |= (layer.type == tl_ecal_shm) && layer.active;
       topic_tlayer_ecal_tcp |= (layer.type == tl_ecal_tcp) && layer.active;
+      topic_tlayer_ecal_inproc |= (layer.type == tl_ecal_inproc) && layer.active;
     }
     const int32_t      connections_local = sample_topic.connections_local;
     const int32_t      connections_external = sample_topic.connections_external;
@@ -243,6 +245,13 @@ namespace eCAL
         transport_layer.active = topic_tlayer_ecal_tcp;
         TopicInfo.transport_layer.push_back(transport_layer);
       }
+      // transport_layer inproc
+      {
+        eCAL::Monitoring::STransportLayer transport_layer;
+        transport_layer.type   = eCAL::Monitoring::eTransportLayerType::inproc;
+        transport_layer.active = topic_tlayer_ecal_inproc;
+        TopicInfo.transport_layer.push_back(transport_layer);
+      }
 
       TopicInfo.topic_size           = static_cast<int>(topic_size);
       TopicInfo.connections_local    = static_cast<int>(connections_local);
@@ -34,6 +34,8 @@ namespace eCAL
     attributes.network_enabled            = config_.communication_mode == eCAL::eCommunicationMode::network;
     attributes.loopback                   = registration_config.loopback;
     attributes.drop_out_of_order_messages = subscriber_config.drop_out_of_order_messages;
+    attributes.history_depth              = subscriber_config.history_depth;
+    attributes.max_frequency              = subscriber_config.max_frequency;
     attributes.registration_timeout_ms    = registration_config.registration_timeout;
     attributes.topic_name                 = topic_name_;
     attributes.host_name                  = Process::GetHostName();
@@ -64,6 +66,8 @@ namespace eCAL
     attributes.tcp.max_reconnection_attempts = transport_layer_config.tcp.max_reconnections;
     
     attributes.shm.enable = subscriber_config.layer.shm.enable;
+
+    attributes.inproc.enable = subscriber_config.layer.inproc.enable;
     
     return attributes;
   }
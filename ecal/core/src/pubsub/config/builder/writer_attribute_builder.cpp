@@ -49,12 +49,20 @@ namespace eCAL
     attributes.shm.memfile_buffer_count    = publisher_config.layer.shm.memfile_buffer_count;
     attributes.shm.memfile_min_size_bytes  = publisher_config.layer.shm.memfile_min_size_bytes;
     attributes.shm.memfile_reserve_percent = publisher_config.layer.shm.memfile_reserve_percent;
+    attributes.shm.memfile_huge_pages      = publisher_config.layer.shm.memfile_huge_pages;
+    attributes.shm.memfile_prefault        = publisher_config.layer.shm.memfile_prefault;
+    attributes.shm.memfile_lock            = publisher_config.layer.shm.memfile_lock;
+    attributes.shm.memfile_numa_local      = publisher_config.layer.shm.memfile_numa_local;
     attributes.shm.zero_copy_mode          = publisher_config.layer.shm.zero_copy_mode;
 
     attributes.udp.enable        = publisher_config.layer.udp.enable;
     attributes.udp.broadcast     = config_.communication_mode == eCAL::eCommunicationMode::local;
     attributes.udp.port          = transport_tlayer_config.udp.port;
     attributes.udp.send_buffer   = transport_tlayer_config.udp.send_buffer;
+    attributes.udp.retransmit_window = publisher_config.layer.udp.retransmit_window;
+    attributes.udp.repair_rate_limit = publisher_config.layer.udp.repair_rate_limit;
+    attributes.udp.coalescing_latency_us = publisher_config.layer.udp.coalescing_latency_us;
+    attributes.udp.coalescing_max_size   = publisher_config.layer.udp.coalescing_max_size;
     
     switch (config_.communication_mode)
     {
@@ -72,7 +80,14 @@ namespace eCAL
     }
     
     attributes.tcp.enable           = publisher_config.layer.tcp.enable;
+    attributes.tcp.multiplexed      = publisher_config.layer.tcp.multiplexed;
     attributes.tcp.thread_pool_size = transport_tlayer_config.tcp.number_executor_writer;
+
+    attributes.inproc.enable        = publisher_config.layer.inproc.enable;
+
+    attributes.send_queue.enable          = publisher_config.send_queue.enable;
+    attributes.send_queue.capacity        = publisher_config.send_queue.capacity;
+    attributes.send_queue.overflow_policy = publisher_config.send_queue.overflow_policy;
     
     return attributes;
   }
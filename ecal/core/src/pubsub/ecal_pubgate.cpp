@@ -92,6 +92,12 @@ namespace eCAL
     return(ret_state);
   }
 
+  bool CPubGate::HasTopic(const std::string& topic_name_)
+  {
+    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_publisher_mutex);
+    return(m_topic_name_publisher_map.find(topic_name_) != m_topic_name_publisher_map.end());
+  }
+
   void CPubGate::ApplySubscriberRegistration(const Registration::Sample& ecal_sample_)
   {
     if(!m_created) return;
@@ -124,6 +130,9 @@ namespace eCAL
         case tl_ecal_tcp:
           layer_states.tcp.read_enabled = true;
           break;
+        case tl_ecal_inproc:
+          layer_states.inproc.read_enabled = true;
+          break;
         default:
           break;
         }
@@ -146,7 +155,7 @@ namespace eCAL
     auto res = m_topic_name_publisher_map.equal_range(topic_name);
     for(TopicNamePublisherMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplySubscriberRegistration(subscription_info, topic_information, layer_states, reader_par);
+      iter->second->ApplySubscriberRegistration(subscription_info, topic_information, layer_states, ecal_topic.max_data_frequency, reader_par);
     }
   }
 
@@ -47,6 +47,8 @@ namespace eCAL
     bool Register(const std::string& topic_name_, const std::shared_ptr<CPublisherImpl>& publisher_);
     bool Unregister(const std::string& topic_name_, const std::shared_ptr<CPublisherImpl>& publisher_);
 
+    bool HasTopic(const std::string& topic_name_);
+
     void ApplySubscriberRegistration(const Registration::Sample& ecal_sample_);
     void ApplySubscriberUnregistration(const Registration::Sample& ecal_sample_);
 
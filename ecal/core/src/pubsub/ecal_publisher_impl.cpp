@@ -38,8 +38,10 @@
 #include "readwrite/ecal_writer_base.h"
 #include "readwrite/ecal_writer_buffer_payload.h"
 #include "readwrite/ecal_transport_layer.h"
+#include "util/descriptor_hash.h"
 #include "util/entity_id_generator.h"
 
+#include "readwrite/config/builder/inproc_attribute_builder.h"
 #include "readwrite/config/builder/shm_attribute_builder.h"
 #include "readwrite/config/builder/tcp_attribute_builder.h"
 #include "readwrite/config/builder/udp_attribute_builder.h"
@@ -49,6 +51,7 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <initializer_list>
 #include <limits>
 #include <mutex>
 #include <sstream>
@@ -98,6 +101,7 @@ namespace
     logLayerState("UDP", states.udp);
     logLayerState("SHM", states.shm);
     logLayerState("TCP", states.tcp);
+    logLayerState("INPROC", states.inproc);
   }
 #endif
 }
@@ -107,8 +111,10 @@ namespace eCAL
   CPublisherImpl::CPublisherImpl(const SDataTypeInformation& topic_info_, const eCAL::eCALWriter::SAttributes& attr_, SPublisherGlobalContext global_context_)
     : m_publisher_id(eCAL::Util::GenerateUniqueEntityId())
     , m_topic_info(topic_info_)
+    , m_topic_descriptor_hash(Util::DescriptorHash(topic_info_.descriptor))
     , m_attributes(attr_)
     , m_frequency_calculator(3.0f)
+    , m_send_limit_timer([this]() { SendPendingSamples(); }, CTimerWheel::ePool::send)
     , m_created(false)
     , m_global_context(std::move(global_context_))
   {
@@ -122,6 +128,13 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // create the send queue (asynchronous send mode)
+    if (m_attributes.send_queue.enable)
+    {
+      m_send_queue = std::make_unique<CPublisherSendQueue>(m_attributes.send_queue.capacity, m_attributes.send_queue.overflow_policy,
+        [this](CPayloadWriter& payload_, long long time_, long long filter_id_) { WriteLayers(payload_, time_, filter_id_); });
+    }
+
     // mark as created
     m_created = true;
   }
@@ -134,6 +147,12 @@ namespace eCAL
 
     if (!m_created) return;
 
+    // write the pending samples of the send queue and stop its writer thread
+    m_send_queue.reset();
+
+    // stop sending the samples held back for rate limited subscribers
+    m_send_limit_timer.stop();
+
     // stop all transport layer
     StopAllLayer();
 
@@ -151,6 +170,17 @@ namespace eCAL
   }
 
   bool CPublisherImpl::Write(CPayloadWriter& payload_, long long time_, long long filter_id_)
+  {
+    // asynchronous send mode, the writer thread of the queue hands the sample to the layers
+    if (m_send_queue)
+    {
+      return m_send_queue->Push(payload_, time_, filter_id_);
+    }
+
+    return WriteLayers(payload_, time_, filter_id_);
+  }
+
+  bool CPublisherImpl::WriteLayers(CPayloadWriter& payload_, long long time_, long long filter_id_)
   {
     // get payload buffer size (one time, to avoid multiple computations)
     const size_t payload_buf_size(payload_.GetSize());
@@ -169,8 +199,27 @@ namespace eCAL
     allow_zero_copy &= !m_writer_tcp;
 #endif
 
-    // create a payload copy for all layer
-    if (!allow_zero_copy)
+    // create a payload copy for all layer (the inproc layer takes its own reference counted copy,
+    // so it does not need this one if it is the only active layer)
+    bool copy_payload(!allow_zero_copy);
+#if ECAL_CORE_SUBSCRIBER
+    if (m_writer_inproc)
+    {
+      bool other_layer(false);
+#if ECAL_CORE_TRANSPORT_SHM
+      other_layer |= (m_writer_shm != nullptr);
+#endif
+#if ECAL_CORE_TRANSPORT_UDP
+      other_layer |= (m_writer_udp != nullptr);
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+      other_layer |= (m_writer_tcp != nullptr);
+#endif
+      copy_payload &= other_layer;
+    }
+#endif
+
+    if (copy_payload)
     {
       m_payload_buffer.resize(payload_buf_size);
       payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size());
@@ -182,6 +231,60 @@ namespace eCAL
     // did we write anything
     bool written(false);
 
+#if ECAL_CORE_TRANSPORT_UDP || ECAL_CORE_TRANSPORT_TCP
+    // network layers skip samples that none of their subscribers needs (rate limited subscribers)
+    const auto send_time = std::chrono::steady_clock::now();
+#endif
+
+    ////////////////////////////////////////////////////////////////////////////
+    // INPROC
+    ////////////////////////////////////////////////////////////////////////////
+#if ECAL_CORE_SUBSCRIBER
+    if (m_writer_inproc)
+    {
+#ifndef NDEBUG
+      eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::INPROC");
+#endif
+
+      // send it
+      bool inproc_sent(false);
+      {
+        // fill writer data
+        struct SWriterAttr wattr;
+        wattr.len = payload_buf_size;
+        wattr.id = m_id;
+        wattr.clock = m_clock;
+        wattr.hash = snd_hash;
+        wattr.time = time_;
+
+        // hand the payload directly to the subscribers of this process
+        if (copy_payload)
+        {
+          // wrap the buffer into a payload object
+          CBufferPayloadWriter payload_buf(m_payload_buffer.data(), m_payload_buffer.size());
+          inproc_sent = m_writer_inproc->Write(payload_buf, wattr);
+        }
+        else
+        {
+          inproc_sent = m_writer_inproc->Write(payload_, wattr);
+        }
+        m_layers.inproc.active = true;
+      }
+      written |= inproc_sent;
+
+#ifndef NDEBUG
+      if (inproc_sent)
+      {
+        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::INPROC - SUCCESS");
+      }
+      else
+      {
+        eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::INPROC - FAILED");
+      }
+#endif
+    }
+#endif // ECAL_CORE_SUBSCRIBER
+
     ////////////////////////////////////////////////////////////////////////////
     // SHM
     ////////////////////////////////////////////////////////////////////////////
@@ -251,21 +354,31 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_UDP
     if (m_writer_udp)
     {
-#ifndef NDEBUG
-      eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp");
+      // fill writer data
+      struct SWriterAttr wattr;
+      wattr.len = payload_buf_size;
+      wattr.id = m_id;
+      wattr.clock = m_clock;
+      wattr.hash = snd_hash;
+      wattr.time = time_;
+      wattr.loopback = m_attributes.loopback;
+
+      // the tcp layer below still needs the payload buffer if a sample is held back
+      bool keep_payload(false);
+#if ECAL_CORE_TRANSPORT_TCP
+      keep_payload = (m_writer_tcp != nullptr);
 #endif
 
-      // send it
-      bool udp_sent(false);
+      // the sample is held back until the next send slot (unless a newer sample replaces it)
+      if (!IsSendDue(m_udp_send_limit, send_time, m_payload_buffer, keep_payload, wattr))
       {
-        // fill writer data
-        struct SWriterAttr wattr;
-        wattr.len = payload_buf_size;
-        wattr.id = m_id;
-        wattr.clock = m_clock;
-        wattr.hash = snd_hash;
-        wattr.time = time_;
-        wattr.loopback = m_attributes.loopback;
+        written = true;
+      }
+      else
+      {
+#ifndef NDEBUG
+        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp");
+#endif
 
         // prepare send
         if (m_writer_udp->PrepareWrite(wattr))
@@ -276,21 +389,21 @@ namespace eCAL
         }
 
         // write to udp multicast layer
-        udp_sent = m_writer_udp->Write(m_payload_buffer.data(), wattr);
+        const bool udp_sent = m_writer_udp->Write(m_payload_buffer.data(), wattr);
         m_layers.udp.active = true;
-      }
-      written |= udp_sent;
+        written |= udp_sent;
 
 #ifndef NDEBUG
-      if (udp_sent)
-      {
-        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp - SUCCESS");
-      }
-      else
-      {
-        eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::udp - FAILED");
-      }
+        if (udp_sent)
+        {
+          eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp - SUCCESS");
+        }
+        else
+        {
+          eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::udp - FAILED");
+        }
 #endif
+      }
     }
 #endif // ECAL_CORE_TRANSPORT_UDP
 
@@ -300,37 +413,41 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
     if (m_writer_tcp)
     {
+      // fill writer data
+      struct SWriterAttr wattr;
+      wattr.len = payload_buf_size;
+      wattr.id = m_id;
+      wattr.clock = m_clock;
+      wattr.hash = snd_hash;
+      wattr.time = time_;
+
+      // the sample is held back until the next send slot (unless a newer sample replaces it)
+      if (!IsSendDue(m_tcp_send_limit, send_time, m_payload_buffer, false, wattr))
+      {
+        written = true;
+      }
+      else
+      {
 #ifndef NDEBUG
-      eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Send::TCP");
+        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Send::TCP");
 #endif
 
-      // send it
-      bool tcp_sent(false);
-      {
-        // fill writer data
-        struct SWriterAttr wattr;
-        wattr.len = payload_buf_size;
-        wattr.id = m_id;
-        wattr.clock = m_clock;
-        wattr.hash = snd_hash;
-        wattr.time = time_;
-
         // write to tcp layer
-        tcp_sent = m_writer_tcp->Write(m_payload_buffer.data(), wattr);
+        const bool tcp_sent = m_writer_tcp->Write(m_payload_buffer.data(), wattr);
         m_layers.tcp.active = true;
-      }
-      written |= tcp_sent;
+        written |= tcp_sent;
 
 #ifndef NDEBUG
-      if (tcp_sent)
-      {
-        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::TCP - SUCCESS");
-      }
-      else
-      {
-        eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::TCP - FAILED");
-      }
+        if (tcp_sent)
+        {
+          eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::TCP - SUCCESS");
+        }
+        else
+        {
+          eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::TCP - FAILED");
+        }
 #endif
+      }
     }
 #endif // ECAL_CORE_TRANSPORT_TCP
 
@@ -340,7 +457,8 @@ namespace eCAL
 
   bool CPublisherImpl::SetDataTypeInformation(const SDataTypeInformation& topic_info_)
   {
-    m_topic_info = topic_info_;
+    m_topic_info            = topic_info_;
+    m_topic_descriptor_hash = Util::DescriptorHash(topic_info_.descriptor);
 
 #ifndef NDEBUG
     eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::SetDataTypeInformation");
@@ -381,7 +499,7 @@ namespace eCAL
     return true;
   }
 
-  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_)
+  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, int32_t sub_max_frequency_, const std::string& reader_par_)
   {
     // collect layer states
     std::vector<eTLayerType> pub_layers;
@@ -404,6 +522,14 @@ namespace eCAL
 
     m_layers.tcp.read_enabled = sub_layer_states_.tcp.read_enabled; // just for debugging/logging
 #endif
+#if ECAL_CORE_SUBSCRIBER
+    // the inner process layer can only connect subscribers of this process
+    const bool same_process = (m_attributes.host_name == subscription_info_.host_name) && (m_attributes.process_id == subscription_info_.process_id);
+    if (m_attributes.inproc.enable && same_process) pub_layers.push_back(tl_ecal_inproc);
+    if (sub_layer_states_.inproc.read_enabled)     sub_layers.push_back(tl_ecal_inproc);
+
+    m_layers.inproc.read_enabled = sub_layer_states_.inproc.read_enabled; // just for debugging/logging
+#endif
 
     // determine if we need to start a transport layer
     const TransportLayer::eType layer2activate = DetermineTransportLayer2Start(pub_layers, sub_layers, m_attributes.host_name == subscription_info_.host_name);
@@ -418,6 +544,9 @@ namespace eCAL
     case TransportLayer::eType::tcp:
       StartTcpLayer();
       break;
+    case TransportLayer::eType::inproc:
+      StartInProcLayer();
+      break;
     default:
       break;
     }
@@ -446,7 +575,7 @@ namespace eCAL
       if (subscription_info_iter == m_connection_map.end())
       {
         // add subscriber to connection map, connection state false
-        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, false };
+        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, false, layer2activate, sub_max_frequency_ };
       }
       else
       {
@@ -461,11 +590,14 @@ namespace eCAL
         }
 
         // update the data type, the layer states and set the state active
-        connection = SConnection{ data_type_info_, sub_layer_states_, true };
+        connection = SConnection{ data_type_info_, sub_layer_states_, true, layer2activate, sub_max_frequency_ };
       }
 
       // update connection count
       m_connection_count = GetConnectionCount();
+
+      // update the network send rates
+      UpdateSendRateLimits();
     }
 
 
@@ -502,6 +634,9 @@ namespace eCAL
 
       // update connection count
       m_connection_count = GetConnectionCount();
+
+      // update the network send rates
+      UpdateSendRateLimits();
     }
 
     // fire disconnect event
@@ -586,6 +721,7 @@ namespace eCAL
       ecal_reg_sample_tdatatype.encoding   = m_topic_info.encoding;
       ecal_reg_sample_tdatatype.name       = m_topic_info.name;
       ecal_reg_sample_tdatatype.descriptor = m_topic_info.descriptor;
+      ecal_reg_sample_topic.datatype_descriptor_hash = m_topic_descriptor_hash;
     }
     ecal_reg_sample_topic.topic_size = static_cast<int32_t>(m_topic_size);
 
@@ -631,6 +767,19 @@ namespace eCAL
     }
 #endif
 
+#if ECAL_CORE_SUBSCRIBER
+    // inproc layer
+    if (m_writer_inproc)
+    {
+      eCAL::Registration::TLayer inproc_tlayer;
+      inproc_tlayer.type = tl_ecal_inproc;
+      inproc_tlayer.version = ecal_transport_layer_version;
+      inproc_tlayer.enabled = m_layers.inproc.write_enabled;
+      inproc_tlayer.active = m_layers.inproc.active;
+      ecal_reg_sample_topic.transport_layer.push_back(inproc_tlayer);
+    }
+#endif
+
     ecal_reg_sample_topic.process_name = m_attributes.process_name;
     ecal_reg_sample_topic.unit_name    = m_attributes.unit_name;
     ecal_reg_sample_topic.data_id      = m_id;
@@ -727,8 +876,12 @@ namespace eCAL
     // log state
     eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartUdpLayer::ACTIVATED");
 
-    // create writer
-    m_writer_udp = std::make_unique<CDataWriterUdpMC>(eCAL::eCALWriter::BuildUDPAttributes(m_publisher_id, m_attributes));
+    // create writer (the send limit timer may access it concurrently)
+    {
+      auto writer_udp = std::make_unique<CDataWriterUdpMC>(eCAL::eCALWriter::BuildUDPAttributes(m_publisher_id, m_attributes));
+      const std::lock_guard<std::mutex> lock(m_udp_send_limit.mutex);
+      m_writer_udp = std::move(writer_udp);
+    }
 
     // register activated layer
     Register();
@@ -779,8 +932,12 @@ namespace eCAL
     // log state
     eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartTcpLayer::ACTIVATED");
 
-    // create writer
-    m_writer_tcp = std::make_unique<CDataWriterTCP>(eCAL::eCALWriter::BuildTCPAttributes(m_publisher_id, m_attributes));
+    // create writer (the send limit timer may access it concurrently)
+    {
+      auto writer_tcp = std::make_unique<CDataWriterTCP>(eCAL::eCALWriter::BuildTCPAttributes(m_publisher_id, m_attributes));
+      const std::lock_guard<std::mutex> lock(m_tcp_send_limit.mutex);
+      m_writer_tcp = std::move(writer_tcp);
+    }
 
     // register activated layer
     Register();
@@ -794,6 +951,32 @@ namespace eCAL
 #endif // ECAL_CORE_TRANSPORT_TCP
   }
 
+  bool CPublisherImpl::StartInProcLayer()
+  {
+#if ECAL_CORE_SUBSCRIBER
+    if (m_layers.inproc.write_enabled) return false;
+
+    // flag enabled
+    m_layers.inproc.write_enabled = true;
+
+    // log state
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartInProcLayer::ACTIVATED");
+
+    // create writer
+    m_writer_inproc = std::make_unique<CDataWriterInProc>(eCAL::eCALWriter::BuildINPROCAttributes(m_publisher_id, m_attributes));
+
+    // register activated layer
+    Register();
+
+#ifndef NDEBUG
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartInProcLayer::WRITER_CREATED");
+#endif
+    return true;
+#else  // ECAL_CORE_SUBSCRIBER
+    return false;
+#endif // ECAL_CORE_SUBSCRIBER
+  }
+
   void CPublisherImpl::StopAllLayer()
   {
 #if ECAL_CORE_TRANSPORT_UDP
@@ -801,7 +984,10 @@ namespace eCAL
     m_layers.udp.write_enabled = false;
 
     // destroy writer
-    m_writer_udp.reset();
+    {
+      const std::lock_guard<std::mutex> lock(m_udp_send_limit.mutex);
+      m_writer_udp.reset();
+    }
 #endif
 
 #if ECAL_CORE_TRANSPORT_SHM
@@ -817,7 +1003,18 @@ namespace eCAL
     m_layers.tcp.write_enabled = false;
 
     // destroy writer
-    m_writer_tcp.reset();
+    {
+      const std::lock_guard<std::mutex> lock(m_tcp_send_limit.mutex);
+      m_writer_tcp.reset();
+    }
+#endif
+
+#if ECAL_CORE_SUBSCRIBER
+    // flag disabled
+    m_layers.inproc.write_enabled = false;
+
+    // destroy writer
+    m_writer_inproc.reset();
 #endif
   }
 
@@ -851,6 +1048,7 @@ namespace eCAL
       {TransportLayer::eType::shm, tl_ecal_shm},
       {TransportLayer::eType::udp_mc, tl_ecal_udp},
       {TransportLayer::eType::tcp, tl_ecal_tcp},
+      {TransportLayer::eType::inproc, tl_ecal_inproc},
     };
 
     for (const TransportLayer::eType layer : layer_priority_vector)
@@ -866,6 +1064,101 @@ namespace eCAL
     return TransportLayer::eType::none;
   }
 
+  void CPublisherImpl::UpdateSendRateLimits()
+  {
+    // a network layer may only skip samples if every subscriber served by it declared a maximum frequency,
+    // it then sends with the highest of these frequencies (connection map mutex needs to be locked)
+    auto min_send_interval_ns = [this](TransportLayer::eType layer_) -> long long
+    {
+      int32_t max_frequency(0);
+      for (const auto& connection : m_connection_map)
+      {
+        if (connection.second.layer != layer_) continue;
+        if (connection.second.max_frequency <= 0) return 0;
+        max_frequency = std::max(max_frequency, connection.second.max_frequency);
+      }
+      if (max_frequency == 0) return 0;
+
+      // mHz -> ns
+      return 1000LL * 1000 * 1000 * 1000 / max_frequency;
+    };
+
+    m_udp_send_limit.min_interval_ns = min_send_interval_ns(TransportLayer::eType::udp_mc);
+    m_tcp_send_limit.min_interval_ns = min_send_interval_ns(TransportLayer::eType::tcp);
+
+    // the held back samples are checked twice per send slot of the fastest limited layer
+    long long timer_period_ns(0);
+    for (const long long interval_ns : { m_udp_send_limit.min_interval_ns.load(), m_tcp_send_limit.min_interval_ns.load() })
+    {
+      if (interval_ns == 0) continue;
+      timer_period_ns = (timer_period_ns == 0) ? interval_ns / 2 : std::min(timer_period_ns, interval_ns / 2);
+    }
+    timer_period_ns = (timer_period_ns == 0) ? 0 : std::max(timer_period_ns, 1LL);
+
+    if (timer_period_ns != m_send_limit_timer_period_ns)
+    {
+      m_send_limit_timer.stop();
+      if (timer_period_ns != 0) m_send_limit_timer.start(std::chrono::nanoseconds(timer_period_ns));
+      m_send_limit_timer_period_ns = timer_period_ns;
+    }
+  }
+
+  bool CPublisherImpl::IsSendDue(SSendRateLimit& limit_, std::chrono::steady_clock::time_point now_, std::vector<char>& payload_, bool keep_payload_, const SWriterAttr& attr_)
+  {
+    const std::chrono::nanoseconds min_interval(limit_.min_interval_ns.load());
+
+    const std::lock_guard<std::mutex> lock(limit_.mutex);
+    if ((min_interval.count() != 0) && (now_ < limit_.next_send))
+    {
+      // keep the newest skipped sample, so the last sample of a burst is not lost
+      // (the buffers are swapped, the payload buffer is refilled by the next write anyway)
+      if (keep_payload_) limit_.pending_payload.assign(payload_.begin(), payload_.end());
+      else               limit_.pending_payload.swap(payload_);
+      limit_.pending_attr = attr_;
+      limit_.pending      = true;
+      return false;
+    }
+
+    // the sample that is sent now replaces the pending one
+    limit_.pending = false;
+    if (min_interval.count() == 0) return true;
+
+    // keep the send rate stable, but do not catch up after a pause
+    limit_.next_send += min_interval;
+    if (limit_.next_send <= now_) limit_.next_send = now_ + min_interval;
+    return true;
+  }
+
+  template <typename WriterT>
+  void CPublisherImpl::SendPendingSample(SSendRateLimit& limit_, std::chrono::steady_clock::time_point now_, const std::unique_ptr<WriterT>& writer_)
+  {
+    const std::chrono::nanoseconds min_interval(limit_.min_interval_ns.load());
+
+    // the writer is not called concurrently, a write that is due waits for this one
+    // (the writer itself is created and destroyed under the same mutex)
+    const std::lock_guard<std::mutex> lock(limit_.mutex);
+    if (!limit_.pending || (now_ < limit_.next_send)) return;
+
+    limit_.pending = false;
+    if (writer_) writer_->Write(limit_.pending_payload.data(), limit_.pending_attr);
+
+    limit_.next_send += min_interval;
+    if (limit_.next_send <= now_) limit_.next_send = now_ + min_interval;
+  }
+
+  void CPublisherImpl::SendPendingSamples()
+  {
+#if ECAL_CORE_TRANSPORT_UDP || ECAL_CORE_TRANSPORT_TCP
+    const auto now = std::chrono::steady_clock::now();
+#endif
+#if ECAL_CORE_TRANSPORT_UDP
+    SendPendingSample(m_udp_send_limit, now, m_writer_udp);
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+    SendPendingSample(m_tcp_send_limit, now, m_writer_tcp);
+#endif
+  }
+
   int32_t CPublisherImpl::GetFrequency()
   {
     const auto frequency_time = std::chrono::steady_clock::now();
@@ -29,9 +29,12 @@
 #include <ecal/config.h>
 #include <ecal/v5/ecal_callback.h>
 
+#include "ecal_publisher_send_queue.h"
 #include "serialization/ecal_serialize_sample_registration.h"
+#include "util/ecal_callback_timer.h"
 #include "util/frequency_calculator.h"
 #include "readwrite/config/attributes/writer_attributes.h"
+#include "readwrite/ecal_writer_data.h"
 
 #if ECAL_CORE_TRANSPORT_UDP
 #include "readwrite/udp/ecal_writer_udp.h"
@@ -45,6 +48,10 @@
 #include "readwrite/tcp/ecal_writer_tcp.h"
 #endif
 
+#if ECAL_CORE_SUBSCRIBER
+#include "readwrite/inproc/ecal_writer_inproc.h"
+#endif
+
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -82,6 +89,7 @@ namespace eCAL
       SLayerState udp;
       SLayerState shm;
       SLayerState tcp;
+      SLayerState inproc;
     };
 
     using SSubscriptionInfo = Registration::SampleIdentifier;
@@ -96,7 +104,7 @@ namespace eCAL
     bool SetEventCallback(const PubEventCallbackT& callback_);
     bool RemoveEventCallback();
 
-    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_);
+    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, int32_t sub_max_frequency_, const std::string& reader_par_);
     void ApplySubscriberUnregistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
     void GetRegistration(Registration::Sample& sample);
@@ -122,6 +130,7 @@ namespace eCAL
     bool StartUdpLayer();
     bool StartShmLayer();
     bool StartTcpLayer();
+    bool StartInProcLayer();
 
     void StopAllLayer();
 
@@ -132,14 +141,31 @@ namespace eCAL
 
     size_t GetConnectionCount();
 
+    bool WriteLayers(CPayloadWriter& payload_, long long time_, long long filter_id_);
     size_t PrepareWrite(long long id_, size_t len_);
 
     TransportLayer::eType DetermineTransportLayer2Start(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_);
+
+    struct SSendRateLimit
+    {
+      std::atomic<long long>                min_interval_ns{ 0 };   // 0 = every sample is sent
+      std::mutex                            mutex;                  // protects the send slot, the pending sample and the layer writer
+      std::chrono::steady_clock::time_point next_send;
+      bool                                  pending = false;        // the newest skipped sample waits for the next send slot
+      std::vector<char>                     pending_payload;
+      SWriterAttr                           pending_attr;
+    };
+    void UpdateSendRateLimits();
+    static bool IsSendDue(SSendRateLimit& limit_, std::chrono::steady_clock::time_point now_, std::vector<char>& payload_, bool keep_payload_, const SWriterAttr& attr_);
+    template <typename WriterT>
+    static void SendPendingSample(SSendRateLimit& limit_, std::chrono::steady_clock::time_point now_, const std::unique_ptr<WriterT>& writer_);
+    void SendPendingSamples();
     
     int32_t GetFrequency();
 
     EntityIdT                              m_publisher_id;
     SDataTypeInformation                   m_topic_info;
+    uint64_t                               m_topic_descriptor_hash = 0;
     size_t                                 m_topic_size = 0;
     eCAL::eCALWriter::SAttributes          m_attributes;
     STopicId                               m_topic_id;
@@ -148,9 +174,11 @@ namespace eCAL
 
     struct SConnection
     {
-      SDataTypeInformation data_type_info;
-      SLayerStates         layer_states;
-      bool                 state = false;
+      SDataTypeInformation  data_type_info;
+      SLayerStates          layer_states;
+      bool                  state = false;
+      TransportLayer::eType layer = TransportLayer::eType::none;  // layer this subscriber is served by
+      int32_t               max_frequency = 0;                     // maximum data frequency the subscriber needs [mHz], 0 = unlimited
     };
     using SSubscriptionMapT = std::map<SSubscriptionInfo, SConnection>;
     mutable std::mutex                     m_connection_map_mutex;
@@ -161,7 +189,7 @@ namespace eCAL
     PubEventCallbackT                      m_event_id_callback;
 
     long long                              m_id = 0;
-    long long                              m_clock = 0;
+    std::atomic<long long>                 m_clock{ 0 };
 
     std::mutex                             m_frequency_calculator_mutex;
     ResettableFrequencyCalculator<std::chrono::steady_clock> m_frequency_calculator;
@@ -175,10 +203,19 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
     std::unique_ptr<CDataWriterTCP>        m_writer_tcp;
 #endif
+#if ECAL_CORE_SUBSCRIBER
+    std::unique_ptr<CDataWriterInProc>     m_writer_inproc;
+#endif
 
     SLayerStates                           m_layers;
+    SSendRateLimit                         m_udp_send_limit;
+    SSendRateLimit                         m_tcp_send_limit;
+    CCallbackTimer                         m_send_limit_timer;               // sends the pending samples of the rate limited layers
+    long long                              m_send_limit_timer_period_ns = 0; // 0 = timer not running (connection map mutex)
     std::atomic<bool>                      m_created;
 
+    std::unique_ptr<CPublisherSendQueue>   m_send_queue;
+
     SPublisherGlobalContext                m_global_context;
   };
 }
@@ -0,0 +1,125 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL publisher send queue (asynchronous send mode)
+**/
+
+#include "ecal_publisher_send_queue.h"
+#include "readwrite/ecal_writer_buffer_payload.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace eCAL
+{
+  CPublisherSendQueue::CPublisherSendQueue(size_t capacity_, Publisher::SendQueue::eOverflowPolicy overflow_policy_, WriteFunctionT write_function_)
+    : m_capacity(std::max<size_t>(capacity_, 1))
+    , m_overflow_policy(overflow_policy_)
+    , m_write_function(std::move(write_function_))
+  {
+    m_thread = std::thread(&CPublisherSendQueue::WriterThread, this);
+  }
+
+  CPublisherSendQueue::~CPublisherSendQueue()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_filled_cv.notify_one();
+    m_drained_cv.notify_all();
+
+    // the writer thread finishes after all pending samples are written
+    if (m_thread.joinable())
+    {
+      m_thread.join();
+    }
+  }
+
+  bool CPublisherSendQueue::Push(CPayloadWriter& payload_, long long time_, long long filter_id_)
+  {
+    // copy the payload outside of the lock, the writer thread can continue meanwhile
+    std::vector<char> buffer = AcquireBuffer();
+    buffer.resize(payload_.GetSize());
+    payload_.WriteFull(buffer.data(), buffer.size());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_stop) return false;
+
+    if (m_queue.size() >= m_capacity)
+    {
+      switch (m_overflow_policy)
+      {
+      case Publisher::SendQueue::eOverflowPolicy::drop_newest:
+        m_free_buffers.push_back(std::move(buffer));
+        return false;
+      case Publisher::SendQueue::eOverflowPolicy::block:
+        m_drained_cv.wait(lock, [this] { return m_stop || (m_queue.size() < m_capacity); });
+        if (m_stop) return false;
+        break;
+      case Publisher::SendQueue::eOverflowPolicy::drop_oldest:
+      default:
+        m_free_buffers.push_back(std::move(m_queue.front().payload));
+        m_queue.pop_front();
+        break;
+      }
+    }
+
+    m_queue.push_back(SQueuedSample{ std::move(buffer), time_, filter_id_ });
+    m_filled_cv.notify_one();
+    return true;
+  }
+
+  std::vector<char> CPublisherSendQueue::AcquireBuffer()
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_free_buffers.empty()) return {};
+
+    std::vector<char> buffer = std::move(m_free_buffers.back());
+    m_free_buffers.pop_back();
+    return buffer;
+  }
+
+  void CPublisherSendQueue::WriterThread()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+      m_filled_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+
+      // stopped and all pending samples written
+      if (m_queue.empty()) break;
+
+      SQueuedSample sample = std::move(m_queue.front());
+      m_queue.pop_front();
+      m_drained_cv.notify_one();
+
+      // hand the sample to the transport layers without holding the lock
+      lock.unlock();
+      {
+        CBufferPayloadWriter payload(sample.payload.data(), sample.payload.size());
+        m_write_function(payload, sample.time, sample.filter_id);
+      }
+      lock.lock();
+
+      m_free_buffers.push_back(std::move(sample.payload));
+    }
+  }
+}
@@ -0,0 +1,90 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL publisher send queue (asynchronous send mode)
+**/
+
+#pragma once
+
+#include <ecal/config/publisher.h>
+#include <ecal/pubsub/payload_writer.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Bounded send queue of a publisher
+   *
+   * Push copies the payload into a (recycled) queue buffer and returns. A writer thread
+   * pops the queued samples and hands them to the write function, so the caller is not
+   * blocked by the transport layers. Pending samples are written on destruction.
+   */
+  class CPublisherSendQueue
+  {
+  public:
+    using WriteFunctionT = std::function<void(CPayloadWriter& payload_, long long time_, long long filter_id_)>;
+
+    CPublisherSendQueue(size_t capacity_, Publisher::SendQueue::eOverflowPolicy overflow_policy_, WriteFunctionT write_function_);
+    ~CPublisherSendQueue();
+
+    CPublisherSendQueue(const CPublisherSendQueue&) = delete;
+    CPublisherSendQueue& operator=(const CPublisherSendQueue&) = delete;
+    CPublisherSendQueue(CPublisherSendQueue&&) = delete;
+    CPublisherSendQueue& operator=(CPublisherSendQueue&&) = delete;
+
+    /**
+     * @brief Enqueue a sample.
+     *
+     * @return False if the sample has been dropped (drop_newest policy with a full queue).
+    **/
+    bool Push(CPayloadWriter& payload_, long long time_, long long filter_id_);
+
+  private:
+    struct SQueuedSample
+    {
+      std::vector<char> payload;
+      long long         time      = 0;
+      long long         filter_id = 0;
+    };
+
+    std::vector<char> AcquireBuffer();
+    void WriterThread();
+
+    const size_t                                m_capacity;
+    const Publisher::SendQueue::eOverflowPolicy m_overflow_policy;
+    WriteFunctionT                              m_write_function;
+
+    std::mutex                                  m_mutex;
+    std::condition_variable                     m_filled_cv;    // signaled on push and stop
+    std::condition_variable                     m_drained_cv;   // signaled on pop and stop
+    std::deque<SQueuedSample>                   m_queue;
+    std::vector<std::vector<char>>              m_free_buffers; // payload buffers of written samples, reused by Push
+    bool                                        m_stop = false;
+
+    std::thread                                 m_thread;
+  };
+}
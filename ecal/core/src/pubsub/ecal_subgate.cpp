@@ -23,6 +23,7 @@
 **/
 
 #include "pubsub/ecal_subgate.h"
+#include "readwrite/ecal_sample_batch.h"
 #include "ecal_globals.h"
 
 #include "ecal/log.h"
@@ -172,6 +173,39 @@ namespace eCAL
       }
     }
     break;
+    case bct_set_sample_batch:
+    {
+      // unpack the coalesced samples and apply them one by one
+      const auto&        batch = ecal_sample.content.payload.vec;
+      Payload::Sample    entry_sample;
+      Payload::TopicInfo entry_topic_info;
+      bool               applied(false);
+      ForEachSampleBatchEntry(batch.data(), batch.size(),
+        [&](const char* entry_data_, size_t entry_size_)
+        {
+          entry_sample.topic_info.topic_name.clear();
+          entry_sample.content.payload.vec.clear();
+          if (!DeserializeFromBuffer(entry_data_, entry_size_, entry_sample)) return;
+          if (entry_sample.cmd_type != bct_set_sample) return;
+
+          // entries without topic information continue the topic of the entry before
+          if (!entry_sample.topic_info.topic_name.empty()) entry_topic_info = entry_sample.topic_info;
+          if (entry_topic_info.topic_name.empty()) return;
+
+          const auto& entry_content = entry_sample.content;
+          applied |= ApplySample(
+            entry_topic_info,
+            entry_content.payload.vec.data(),
+            entry_content.payload.vec.size(),
+            entry_content.id,
+            entry_content.clock,
+            entry_content.time,
+            static_cast<size_t>(entry_content.hash),
+            layer_
+          );
+        });
+      return applied;
+    }
     default:
       break;
     }
@@ -206,6 +240,29 @@ namespace eCAL
     return (applied_size > 0);
   }
 
+  bool CSubGate::ApplyInProcSample(const Payload::TopicInfo& topic_info_, const CDataReaderInProc::PayloadT& payload_, long long id_, long long clock_, long long time_, size_t hash_)
+  {
+    if (!m_created) return false;
+
+    std::vector<std::shared_ptr<CSubscriberImpl>> readers_to_apply;
+    {
+      const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
+      auto res = m_topic_name_subscriber_map.equal_range(topic_info_.topic_name);
+      std::transform(
+        res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
+      );
+    }
+
+    // every reader gets a reference to the same payload buffer
+    bool applied(false);
+    for (const auto& reader : readers_to_apply)
+    {
+      applied |= reader->ApplyInProcSample(CDataReaderInProc::SSample{ topic_info_, payload_, id_, clock_, time_, hash_ });
+    }
+
+    return applied;
+  }
+
   void CSubGate::ApplyPublisherRegistration(const Registration::Sample& ecal_sample_)
   {
     if(!m_created) return;
@@ -237,6 +294,9 @@ namespace eCAL
         case tl_ecal_tcp:
           layer_states.tcp.write_enabled = true;
           break;
+        case tl_ecal_inproc:
+          layer_states.inproc.write_enabled = true;
+          break;
         default:
           break;
         }
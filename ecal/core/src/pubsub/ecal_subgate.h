@@ -51,6 +51,7 @@ namespace eCAL
 
     bool ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_, eTLayerType layer_);
     bool ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    bool ApplyInProcSample(const Payload::TopicInfo& topic_info_, const CDataReaderInProc::PayloadT& payload_, long long id_, long long clock_, long long time_, size_t hash_);
 
     void ApplyPublisherRegistration(const Registration::Sample& ecal_sample_);
     void ApplyPublisherUnregistration(const Registration::Sample& ecal_sample_);
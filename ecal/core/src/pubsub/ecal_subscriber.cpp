@@ -103,6 +103,31 @@ namespace eCAL
     if (subscriber_impl) static_cast<void>(subscriber_impl->RemoveReceiveCallback());
   }
 
+  bool CSubscriber::Take(SHistorySample& sample_)
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (!subscriber_impl) return false;
+    return subscriber_impl->Take(sample_);
+  }
+
+  bool CSubscriber::Peek(SHistorySample& sample_) const
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (!subscriber_impl) return false;
+    return subscriber_impl->Peek(sample_);
+  }
+
+  size_t CSubscriber::ReadBatch(std::vector<SHistorySample>& samples_)
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (!subscriber_impl)
+    {
+      samples_.clear();
+      return 0;
+    }
+    return subscriber_impl->ReadBatch(samples_);
+  }
+
   size_t CSubscriber::GetPublisherCount() const
   {
     auto subscriber_impl = m_subscriber_impl.lock();
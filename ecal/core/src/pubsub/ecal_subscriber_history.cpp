@@ -0,0 +1,98 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL subscriber keep-last-N sample history
+**/
+
+#include "ecal_subscriber_history.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace eCAL
+{
+  CSubscriberHistory::CSubscriberHistory(size_t depth_)
+    : m_ring(std::max<size_t>(depth_, 1))
+  {
+  }
+
+  void CSubscriberHistory::Push(const STopicId& publisher_id_, const char* payload_, size_t size_, long long time_, long long clock_)
+  {
+    // copy the sample into the spare slot without holding the lock
+    m_spare.publisher_id = publisher_id_;
+    m_spare.buffer.assign(payload_, size_);
+    m_spare.send_timestamp = time_;
+    m_spare.send_clock     = clock_;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    size_t slot(0);
+    if (m_count < m_ring.size())
+    {
+      slot = (m_first + m_count) % m_ring.size();
+      m_count++;
+    }
+    else
+    {
+      // overwrite the oldest sample
+      slot = m_first;
+      m_first = (m_first + 1) % m_ring.size();
+    }
+
+    // the replaced slot becomes the next spare
+    std::swap(m_ring[slot], m_spare);
+  }
+
+  bool CSubscriberHistory::Take(SHistorySample& sample_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_count == 0) return false;
+
+    std::swap(sample_, m_ring[m_first]);
+    m_first = (m_first + 1) % m_ring.size();
+    m_count--;
+    return true;
+  }
+
+  bool CSubscriberHistory::Peek(SHistorySample& sample_) const
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_count == 0) return false;
+
+    // copy the sample the next Take would return
+    sample_ = m_ring[m_first];
+    return true;
+  }
+
+  size_t CSubscriberHistory::ReadBatch(std::vector<SHistorySample>& samples_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t count = m_count;
+
+    // oldest sample first, the vector is never shrunk to keep the memory of further elements
+    if (samples_.size() < count) samples_.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      std::swap(samples_[i], m_ring[(m_first + i) % m_ring.size()]);
+    }
+    m_first = 0;
+    m_count = 0;
+    return count;
+  }
+}
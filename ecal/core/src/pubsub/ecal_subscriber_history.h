@@ -0,0 +1,62 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL subscriber keep-last-N sample history
+**/
+
+#pragma once
+
+#include <ecal/pubsub/types.h>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Ring of the last N received samples of a subscriber.
+   *
+   * The payload copy is done outside of the lock into a spare slot that is swapped into
+   * the ring afterwards. Take and ReadBatch swap the slots with the callers samples, so
+   * the lock is only held for O(1) operations and slot memory is recycled in both directions.
+   * If the ring is full, the oldest sample is overwritten.
+   */
+  class CSubscriberHistory
+  {
+  public:
+    explicit CSubscriberHistory(size_t depth_);
+
+    // must not be called concurrently (the subscriber applies one sample at a time)
+    void Push(const STopicId& publisher_id_, const char* payload_, size_t size_, long long time_, long long clock_);
+
+    bool   Take(SHistorySample& sample_);
+    bool   Peek(SHistorySample& sample_) const;
+    size_t ReadBatch(std::vector<SHistorySample>& samples_);
+
+  private:
+    mutable std::mutex          m_mutex;
+    std::vector<SHistorySample> m_ring;
+    size_t                      m_first = 0;    // ring index of the oldest sample
+    size_t                      m_count = 0;    // number of samples in the ring
+
+    SHistorySample              m_spare;        // filled by Push outside of the lock
+  };
+}
@@ -34,9 +34,11 @@
 
 #include "ecal_subscriber_impl.h"
 #include "ecal_global_accessors.h"
+#include "ecal_def.h"
 
 #include "readwrite/ecal_reader_layer.h"
 #include "readwrite/ecal_transport_layer.h"
+#include "util/descriptor_hash.h"
 #include "util/entity_id_generator.h"
 
 #if ECAL_CORE_TRANSPORT_UDP
@@ -56,6 +58,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <iterator>
 #include <limits>
@@ -74,6 +77,7 @@ namespace eCAL
   CSubscriberImpl::CSubscriberImpl(const SDataTypeInformation& topic_info_, const eCAL::eCALReader::SAttributes& attr_, SSubscriberGlobalContext global_context_) :
                  m_subscriber_id(eCAL::Util::GenerateUniqueEntityId()),
                  m_topic_info(topic_info_),
+                 m_topic_descriptor_hash(Util::DescriptorHash(topic_info_.descriptor)),
                  m_topic_size(0),
                  m_receive_time(0),
                  m_clock(0),
@@ -93,6 +97,12 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // create the sample history
+    if (m_attributes.history_depth > 0)
+    {
+      m_history = std::make_unique<CSubscriberHistory>(m_attributes.history_depth);
+    }
+
     // start transport layers
     InitializeLayers();
     StartTransportLayer();
@@ -167,6 +177,28 @@ namespace eCAL
     return(false);
   }
 
+  bool CSubscriberImpl::Take(SHistorySample& sample_)
+  {
+    if (!m_created || !m_history) return(false);
+    return m_history->Take(sample_);
+  }
+
+  bool CSubscriberImpl::Peek(SHistorySample& sample_) const
+  {
+    if (!m_created || !m_history) return(false);
+    return m_history->Peek(sample_);
+  }
+
+  size_t CSubscriberImpl::ReadBatch(std::vector<SHistorySample>& samples_)
+  {
+    if (!m_created || !m_history)
+    {
+      samples_.clear();
+      return(0);
+    }
+    return m_history->ReadBatch(samples_);
+  }
+
   bool CSubscriberImpl::SetReceiveCallback(const ReceiveCallbackT& callback_)
   {
     if (!m_created) return(false);
@@ -254,6 +286,7 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
     m_layers.tcp.write_enabled = pub_layer_states_.tcp.write_enabled;
 #endif
+    m_layers.inproc.write_enabled = pub_layer_states_.inproc.write_enabled;
 
     // add key to connection map, including connection state
     bool is_new_connection = false;
@@ -402,6 +435,7 @@ namespace eCAL
     m_layers.udp.active |= layer_ == tl_ecal_udp;
     m_layers.shm.active |= layer_ == tl_ecal_shm;
     m_layers.tcp.active |= layer_ == tl_ecal_tcp;
+    m_layers.inproc.active |= layer_ == tl_ecal_inproc;
 
 #ifndef NDEBUG
     // log it
@@ -411,7 +445,7 @@ namespace eCAL
     // increase read clock
     m_clock++;
 
-    TriggerMessageDropUdate(publication_info, clock_);
+    TriggerMessageDropUdate(publication_info, clock_, layer_);
     TriggerStatisticsUpdate(time_);
 
     // reset timeout
@@ -420,8 +454,21 @@ namespace eCAL
     // store size
     m_topic_size = size_;
 
-    // execute callback
+    // store the sample in the history
     bool processed = false;
+    if (m_history)
+    {
+      STopicId topic_id;
+      topic_id.topic_name          = topic_info_.topic_name;
+      topic_id.topic_id.host_name  = topic_info_.host_name;
+      topic_id.topic_id.entity_id  = topic_info_.topic_id;
+      topic_id.topic_id.process_id = topic_info_.process_id;
+
+      m_history->Push(topic_id, payload_, size_, time_, clock_);
+      processed = true;
+    }
+
+    // execute callback
     {
       // call user receive callback function
       if(m_receive_callback)
@@ -476,6 +523,14 @@ namespace eCAL
     return(size_);
   }
 
+  bool CSubscriberImpl::ApplyInProcSample(CDataReaderInProc::SSample sample_)
+  {
+    if (!m_created || !m_reader_inproc) return(false);
+
+    // the sample is applied on the receive thread of the inproc reader
+    return m_reader_inproc->Push(std::move(sample_));
+  }
+
   void CSubscriberImpl::Register()
   {
 #if ECAL_CORE_REGISTRATION
@@ -538,6 +593,7 @@ namespace eCAL
       ecal_reg_sample_tdatatype.encoding   = m_topic_info.encoding;
       ecal_reg_sample_tdatatype.name       = m_topic_info.name;
       ecal_reg_sample_tdatatype.descriptor = m_topic_info.descriptor;
+      ecal_reg_sample_topic.datatype_descriptor_hash = m_topic_descriptor_hash;
     }
     ecal_reg_sample_topic.topic_size = static_cast<int32_t>(m_topic_size);
 
@@ -577,6 +633,17 @@ namespace eCAL
     }
 #endif
 
+    // inproc layer
+    if (m_attributes.inproc.enable)
+    {
+      Registration::TLayer inproc_tlayer;
+      inproc_tlayer.type      = tl_ecal_inproc;
+      inproc_tlayer.version   = ecal_transport_layer_version;
+      inproc_tlayer.enabled   = m_layers.inproc.read_enabled;
+      inproc_tlayer.active    = m_layers.inproc.active;
+      ecal_reg_sample_topic.transport_layer.push_back(inproc_tlayer);
+    }
+
     ecal_reg_sample_topic.process_name   = m_attributes.process_name;
     ecal_reg_sample_topic.unit_name      = m_attributes.unit_name;
     ecal_reg_sample_topic.data_clock     = m_clock;
@@ -585,6 +652,12 @@ namespace eCAL
       ecal_reg_sample_topic.data_frequency = GetFrequency();
       ecal_reg_sample_topic.latency_us = m_latency_us_calculator.GetStatistics();
     }
+    // maximum data frequency this subscriber needs [mHz]
+    if (m_attributes.max_frequency > 0.0)
+    {
+      const double max_frequency_in_mhz = std::ceil(m_attributes.max_frequency * 1000);
+      ecal_reg_sample_topic.max_data_frequency = static_cast<int32_t>(std::min(max_frequency_in_mhz, static_cast<double>(std::numeric_limits<int32_t>::max())));
+    }
     ecal_reg_sample_topic.message_drops  = GetMessageDropsAndFireDroppedEvents();
 
     // we do not know the number of connections ..
@@ -643,6 +716,18 @@ namespace eCAL
       if (m_global_context.tcp_layer) m_global_context.tcp_layer->AddSubscription(m_attributes.host_name, m_attributes.topic_name, m_subscriber_id);
     }
 #endif
+
+    if (m_attributes.inproc.enable)
+    {
+      // flag enabled
+      m_layers.inproc.read_enabled = true;
+
+      // inproc samples are pushed by the publishers of this process via the subgate
+      m_reader_inproc = std::make_unique<CDataReaderInProc>(INPROC_READER_QUEUE_CAPACITY, [this](const CDataReaderInProc::SSample& sample_)
+        {
+          ApplySample(sample_.topic_info, sample_.payload->data(), sample_.payload->size(), sample_.id, sample_.clock, sample_.time, sample_.hash, tl_ecal_inproc);
+        });
+    }
   }
   
   void CSubscriberImpl::StopTransportLayer()
@@ -679,6 +764,15 @@ namespace eCAL
       if (m_global_context.tcp_layer) m_global_context.tcp_layer->RemSubscription(m_attributes.host_name, m_attributes.topic_name, m_subscriber_id);
     }
 #endif
+
+    if (m_reader_inproc)
+    {
+      // flag disabled
+      m_layers.inproc.read_enabled = false;
+
+      // stop the receive thread, the reader is kept until destruction as the subgate may still push samples
+      m_reader_inproc->Stop();
+    }
   }
 
   void CSubscriberImpl::FireEvent(const eSubscriberEvent type_, const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_)
@@ -804,10 +898,13 @@ namespace eCAL
     m_latency_us_calculator.Update(static_cast<double>(latency_us));
   }
 
-  void CSubscriberImpl::TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter)
+  void CSubscriberImpl::TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter, eTLayerType layer_)
   {
     const std::lock_guard<std::mutex> lock(m_message_drop_map_mutex);
-    m_message_drop_map.RegisterReceivedMessage(publication_info_, message_counter);
+    // publishers skip network samples on purpose for rate limited subscribers, gaps are no drops then
+    const bool rate_limited_layer = (layer_ == tl_ecal_udp) || (layer_ == tl_ecal_tcp);
+    if ((m_attributes.max_frequency <= 0.0) || !rate_limited_layer)
+      m_message_drop_map.RegisterReceivedMessage(publication_info_, message_counter);
     m_publisher_message_counter_map.SetCounter(publication_info_, message_counter);
   }
 
@@ -825,6 +922,9 @@ namespace eCAL
     case tl_ecal_tcp:
       if (!m_attributes.tcp.enable) return false;
       break;
+    case tl_ecal_inproc:
+      if (!m_attributes.inproc.enable) return false;
+      break;
     default:
       break;
     }
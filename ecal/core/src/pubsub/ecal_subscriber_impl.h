@@ -28,6 +28,7 @@
 #include <ecal/time.h>
 #include <ecal/v5/ecal_callback.h>
 
+#include "ecal_subscriber_history.h"
 #include "serialization/ecal_serialize_sample_payload.h"
 #include "serialization/ecal_serialize_sample_registration.h"
 #include "util/frequency_calculator.h"
@@ -35,6 +36,7 @@
 #include "util/statistics_calculator.h"
 #include "util/counter_cache.h"
 #include "readwrite/config/attributes/reader_attributes.h"
+#include "readwrite/inproc/ecal_reader_inproc.h"
 
 #include <atomic>
 #include <chrono>
@@ -42,11 +44,13 @@
 #include <cstddef>
 #include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -79,6 +83,7 @@ namespace eCAL
       SLayerState udp;
       SLayerState shm;
       SLayerState tcp;
+      SLayerState inproc;
     };
 
     using SPublicationInfo = Registration::SampleIdentifier;
@@ -96,6 +101,10 @@ namespace eCAL
 
     bool Read(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ms_ = 0);
 
+    bool   Take(SHistorySample& sample_);
+    bool   Peek(SHistorySample& sample_) const;
+    size_t ReadBatch(std::vector<SHistorySample>& samples_);
+
     bool SetReceiveCallback(const ReceiveCallbackT& callback_);
     bool RemoveReceiveCallback();
 
@@ -121,6 +130,7 @@ namespace eCAL
 
     void InitializeLayers();
     size_t ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    bool   ApplyInProcSample(CDataReaderInProc::SSample sample_);
 
   protected:
     void Register();
@@ -147,13 +157,14 @@ namespace eCAL
     bool ShouldApplySampleBasedOnId(long long id_) const;
 
     void TriggerStatisticsUpdate(long long send_time_);
-    void TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter);
+    void TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter, eTLayerType layer_);
 
     int32_t GetFrequency();
     int32_t GetMessageDropsAndFireDroppedEvents();
 
     EntityIdT                                 m_subscriber_id;
     SDataTypeInformation                      m_topic_info;
+    uint64_t                                  m_topic_descriptor_hash;
     STopicId                                  m_topic_id;
     std::atomic<size_t>                       m_topic_size;
 
@@ -174,6 +185,8 @@ namespace eCAL
     std::string                               m_read_buf;
     long long                                 m_read_time = 0;
 
+    std::unique_ptr<CSubscriberHistory>       m_history;
+
     std::mutex                                m_receive_callback_mutex;
     ReceiveCallbackT                          m_receive_callback;
     std::atomic<int>                          m_receive_time;
@@ -201,6 +214,8 @@ namespace eCAL
     SLayerStates                              m_layers;
     std::atomic<bool>                         m_created;
 
+    std::unique_ptr<CDataReaderInProc>        m_reader_inproc;
+
     eCAL::eCALReader::SAttributes             m_attributes;
 
     SSubscriberGlobalContext                  m_global_context;
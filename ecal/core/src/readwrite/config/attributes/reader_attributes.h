@@ -48,16 +48,24 @@ namespace eCAL
       bool enable;
     };
 
+    struct SINPROCAttributes
+    {
+      bool enable;
+    };
+
     struct SAttributes
     {
       bool         network_enabled;
       bool         drop_out_of_order_messages;
+      unsigned int history_depth;
+      double       max_frequency;
       bool         loopback;
       unsigned int registration_timeout_ms;
 
-      SUDPAttributes udp;
-      STCPAttributes tcp;
-      SSHMAttributes shm;
+      SUDPAttributes    udp;
+      STCPAttributes    tcp;
+      SSHMAttributes    shm;
+      SINPROCAttributes inproc;
 
       std::string topic_name;
       std::string host_name;
@@ -38,11 +38,18 @@ namespace eCAL
       int         send_buffer;
       std::string group;
       int         ttl;
+
+      unsigned int retransmit_window;
+      unsigned int repair_rate_limit;
+
+      unsigned int coalescing_latency_us;
+      unsigned int coalescing_max_size;
     };
 
     struct STCPAttributes
     {
       bool   enable;
+      bool   multiplexed;
       size_t thread_pool_size;
     };
 
@@ -54,6 +61,22 @@ namespace eCAL
       unsigned int memfile_buffer_count;
       unsigned int memfile_min_size_bytes;
       unsigned int memfile_reserve_percent;
+      bool         memfile_huge_pages;
+      bool         memfile_prefault;
+      bool         memfile_lock;
+      bool         memfile_numa_local;
+    };
+
+    struct SINPROCAttributes
+    {
+      bool enable;
+    };
+
+    struct SSendQueueAttributes
+    {
+      bool                                   enable;
+      unsigned int                           capacity;
+      Publisher::SendQueue::eOverflowPolicy  overflow_policy;
     };
 
 
@@ -77,6 +100,9 @@ namespace eCAL
       SUDPAttributes       udp;
       STCPAttributes       tcp;
       SSHMAttributes       shm;
+      SINPROCAttributes    inproc;
+
+      SSendQueueAttributes send_queue;
     };
   }
 }
\ No newline at end of file
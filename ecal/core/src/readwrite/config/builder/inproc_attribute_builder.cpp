@@ -0,0 +1,38 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "inproc_attribute_builder.h"
+
+namespace eCAL
+{
+  namespace eCALWriter
+  {
+    INPROC::SAttributes BuildINPROCAttributes(const uint64_t& topic_id_, const eCALWriter::SAttributes& attr_)
+    {
+      INPROC::SAttributes attributes;
+
+      attributes.host_name  = attr_.host_name;
+      attributes.process_id = attr_.process_id;
+      attributes.topic_name = attr_.topic_name;
+      attributes.topic_id   = topic_id_;
+
+      return attributes;
+    }
+  }
+}
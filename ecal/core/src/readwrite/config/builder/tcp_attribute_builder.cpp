@@ -42,6 +42,7 @@ namespace eCAL
 
       attributes.topic_name = attr_.topic_name;
       attributes.topic_id   = topic_id_;
+      attributes.multiplexed      = attr_.tcp.multiplexed;
       attributes.thread_pool_size = attr_.tcp.thread_pool_size;
       
       return attributes;
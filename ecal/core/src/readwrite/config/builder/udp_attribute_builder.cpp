@@ -55,6 +55,11 @@ namespace eCAL
       attributes.address     = attr_.udp.group;
       attributes.ttl         = attr_.udp.ttl;
 
+      attributes.retransmit_window = attr_.udp.retransmit_window;
+      attributes.repair_rate_limit = attr_.udp.repair_rate_limit;
+
+      attributes.coalescing_latency_us = attr_.udp.coalescing_latency_us;
+      attributes.coalescing_max_size   = attr_.udp.coalescing_max_size;
 
       return attributes;
     }
@@ -0,0 +1,76 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  batch of serialized payload samples, sent as content of a single sample
+**/
+
+#pragma once
+
+#include "ecal_utils/portable_endian.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eCAL
+{
+  /*
+   * A sample of type bct_set_sample_batch carries a sequence of serialized bct_set_sample samples
+   * as its payload, every entry is prefixed by its size
+   *
+   *   [entry size (4 bytes, little endian)][serialized sample] ...
+   *
+   * An entry without topic information belongs to the same topic as the entry before.
+  **/
+  constexpr const char* g_sample_batch_name              = "__ecal_sample_batch__";
+  constexpr size_t      g_sample_batch_entry_header_size = sizeof(uint32_t);
+
+  inline void AppendSampleBatchEntry(std::vector<char>& batch_, const std::vector<char>& serialized_sample_)
+  {
+    const uint32_t entry_size_le = htole32(static_cast<uint32_t>(serialized_sample_.size()));
+    const size_t   offset        = batch_.size();
+    batch_.resize(offset + g_sample_batch_entry_header_size + serialized_sample_.size());
+    memcpy(batch_.data() + offset, &entry_size_le, g_sample_batch_entry_header_size);
+    if (!serialized_sample_.empty()) memcpy(batch_.data() + offset + g_sample_batch_entry_header_size, serialized_sample_.data(), serialized_sample_.size());
+  }
+
+  // calls entry_callback_(data, size) for every entry, returns false if the batch is truncated
+  template <typename EntryCallback>
+  bool ForEachSampleBatchEntry(const char* batch_, size_t batch_size_, EntryCallback entry_callback_)
+  {
+    size_t offset = 0;
+    while (offset < batch_size_)
+    {
+      if (batch_size_ - offset < g_sample_batch_entry_header_size) return false;
+
+      uint32_t entry_size_le = 0;
+      memcpy(&entry_size_le, batch_ + offset, g_sample_batch_entry_header_size);
+      const size_t entry_size = le32toh(entry_size_le);
+      offset += g_sample_batch_entry_header_size;
+
+      if (batch_size_ - offset < entry_size) return false;
+      entry_callback_(batch_ + offset, entry_size);
+      offset += entry_size;
+    }
+    return true;
+  }
+}
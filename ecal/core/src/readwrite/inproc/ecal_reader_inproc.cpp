@@ -0,0 +1,96 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  inner process data reader
+**/
+
+#include "ecal_reader_inproc.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace eCAL
+{
+  CDataReaderInProc::CDataReaderInProc(size_t capacity_, ApplyFunctionT apply_function_)
+    : m_capacity(std::max<size_t>(capacity_, 1))
+    , m_apply_function(std::move(apply_function_))
+  {
+  }
+
+  CDataReaderInProc::~CDataReaderInProc()
+  {
+    Stop();
+  }
+
+  bool CDataReaderInProc::Push(SSample sample_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stop) return false;
+
+    // most subscribers never receive inproc samples, so the thread is created on demand
+    if (!m_thread.joinable())
+    {
+      m_thread = std::thread(&CDataReaderInProc::ReceiveThread, this);
+    }
+
+    if (m_queue.size() >= m_capacity)
+    {
+      m_queue.pop_front();
+    }
+    m_queue.push_back(std::move(sample_));
+    m_filled_cv.notify_one();
+    return true;
+  }
+
+  void CDataReaderInProc::Stop()
+  {
+    std::thread thread;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+      m_queue.clear();
+      thread.swap(m_thread);
+    }
+    m_filled_cv.notify_one();
+
+    if (thread.joinable())
+    {
+      thread.join();
+    }
+  }
+
+  void CDataReaderInProc::ReceiveThread()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+      m_filled_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+      if (m_stop) break;
+
+      const SSample sample = std::move(m_queue.front());
+      m_queue.pop_front();
+
+      // apply the sample without holding the lock, the publisher can continue meanwhile
+      lock.unlock();
+      m_apply_function(sample);
+      lock.lock();
+    }
+  }
+}
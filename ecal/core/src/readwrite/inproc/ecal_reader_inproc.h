@@ -0,0 +1,100 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  inner process data reader
+**/
+
+#pragma once
+
+#include "serialization/ecal_struct_sample_payload.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Receive queue of a subscriber for samples of publishers in the same process
+   *
+   * The publisher hands over a reference counted payload buffer that is shared by all
+   * in-process subscribers. A receive thread (started with the first sample) pops the
+   * queued samples and hands them to the apply function, so the subscriber callback
+   * does not run within the send call of the publisher. If the queue is full, the
+   * oldest queued sample is dropped.
+   */
+  class CDataReaderInProc
+  {
+  public:
+    using PayloadT = std::shared_ptr<const std::vector<char>>;
+
+    struct SSample
+    {
+      Payload::TopicInfo topic_info;
+      PayloadT           payload;
+      long long          id    = 0;
+      long long          clock = 0;
+      long long          time  = 0;
+      size_t             hash  = 0;
+    };
+
+    using ApplyFunctionT = std::function<void(const SSample& sample_)>;
+
+    CDataReaderInProc(size_t capacity_, ApplyFunctionT apply_function_);
+    ~CDataReaderInProc();
+
+    CDataReaderInProc(const CDataReaderInProc&) = delete;
+    CDataReaderInProc& operator=(const CDataReaderInProc&) = delete;
+    CDataReaderInProc(CDataReaderInProc&&) = delete;
+    CDataReaderInProc& operator=(CDataReaderInProc&&) = delete;
+
+    /**
+     * @brief Enqueue a sample.
+     *
+     * @return False if the reader has been stopped.
+    **/
+    bool Push(SSample sample_);
+
+    /**
+     * @brief Stop the receive thread, pending samples are discarded.
+     *
+     * Waits for a currently running apply function to finish.
+    **/
+    void Stop();
+
+  private:
+    void ReceiveThread();
+
+    const size_t            m_capacity;
+    ApplyFunctionT          m_apply_function;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_filled_cv;    // signaled on push and stop
+    std::deque<SSample>     m_queue;
+    bool                    m_stop = false;
+
+    std::thread             m_thread;
+  };
+}
@@ -0,0 +1,81 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  inner process data writer
+**/
+
+#include "ecal_writer_inproc.h"
+#include "ecal_global_accessors.h"
+
+#include "pubsub/ecal_subgate.h"
+
+#include <atomic>
+
+namespace eCAL
+{
+  CDataWriterInProc::CDataWriterInProc(const eCALWriter::INPROC::SAttributes& attr_) :
+    m_attributes(attr_)
+  {
+    m_topic_info.host_name  = m_attributes.host_name;
+    m_topic_info.process_id = m_attributes.process_id;
+    m_topic_info.topic_name = m_attributes.topic_name;
+    m_topic_info.topic_id   = m_attributes.topic_id;
+  }
+
+  SWriterInfo CDataWriterInProc::GetInfo()
+  {
+    SWriterInfo info_;
+
+    info_.name           = "inproc";
+    info_.description    = "inner process data writer";
+
+    info_.has_mode_local = true;
+    info_.has_mode_cloud = false;
+
+    info_.send_size_max  = -1;
+
+    return info_;
+  }
+
+  bool CDataWriterInProc::Write(CPayloadWriter& payload_, const SWriterAttr& attr_)
+  {
+    const auto subgate = g_subgate();
+    if (!subgate) return false;
+
+    // the payload is copied once and shared by all subscribers of this process,
+    // the buffer of the last sample is reused if no subscriber holds it anymore
+    if (!m_buffer || (m_buffer.use_count() > 1))
+    {
+      m_buffer = std::make_shared<std::vector<char>>();
+    }
+    else
+    {
+      // synchronize with the subscriber threads that released the buffer
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    m_buffer->resize(attr_.len);
+    if (attr_.len > 0) payload_.WriteFull(m_buffer->data(), m_buffer->size());
+
+    // the subscribers apply the sample on their own receive threads,
+    // so the handover cannot fail and even an empty payload counts as sent
+    subgate->ApplyInProcSample(m_topic_info, m_buffer, attr_.id, attr_.clock, attr_.time, attr_.hash);
+    return true;
+  }
+}
@@ -0,0 +1,51 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  inner process data writer
+**/
+
+#pragma once
+
+#include "readwrite/ecal_writer_base.h"
+#include "config/attributes/writer_inproc_attributes.h"
+
+#include "serialization/ecal_struct_sample_payload.h"
+
+#include <memory>
+#include <vector>
+
+namespace eCAL
+{
+  // ecal inner process writer, hands a reference counted payload copy to the subscribers of this process
+  class CDataWriterInProc : public CDataWriterBase<Registration::LayerParInProc>
+  {
+  public:
+    CDataWriterInProc(const eCALWriter::INPROC::SAttributes& attr_);
+
+    SWriterInfo GetInfo() override;
+
+    bool Write(CPayloadWriter& payload_, const SWriterAttr& attr_) override;
+
+  private:
+    eCALWriter::INPROC::SAttributes    m_attributes;
+    Payload::TopicInfo                 m_topic_info;
+    std::shared_ptr<std::vector<char>> m_buffer;      // reused as soon as all subscribers released it
+  };
+}
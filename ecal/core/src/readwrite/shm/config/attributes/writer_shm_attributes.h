@@ -33,6 +33,10 @@ namespace eCAL
         unsigned int memfile_buffer_count;
         unsigned int memfile_min_size_bytes;
         unsigned int memfile_reserve_percent;
+        bool         memfile_huge_pages;
+        bool         memfile_prefault;
+        bool         memfile_lock;
+        bool         memfile_numa_local;
 
         std::string host_name;
         std::string topic_name;
@@ -66,7 +66,8 @@ namespace eCAL
     // adapt write index if needed
     m_write_idx %= m_memory_file_vec.size();
       
-    // check size and reserve new if needed
+    // check size and reserve new if needed (files are grown in place if possible,
+    // only a recreated file needs to be registered again)
     ret_state |= m_memory_file_vec[m_write_idx]->CheckSize(attr_.len);
 
     return ret_state;
@@ -179,6 +180,10 @@ namespace eCAL
     memory_file_attr.reserve         = m_attributes.memfile_reserve_percent;
     memory_file_attr.timeout_open_ms = PUB_MEMFILE_OPEN_TO;
     memory_file_attr.timeout_ack_ms  = m_attributes.acknowledge_timeout_ms;
+    memory_file_attr.options.huge_pages = m_attributes.memfile_huge_pages;
+    memory_file_attr.options.prefault   = m_attributes.memfile_prefault;
+    memory_file_attr.options.lock       = m_attributes.memfile_lock;
+    memory_file_attr.options.numa_local = m_attributes.memfile_numa_local;
 
     // retrieve the memory file size of existing files
     size_t memory_file_size(0);
@@ -34,6 +34,7 @@ namespace eCAL
         std::string topic_name;
         uint64_t    topic_id;
 
+        bool   multiplexed;
         size_t thread_pool_size;
       };
     }
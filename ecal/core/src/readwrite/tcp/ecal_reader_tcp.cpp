@@ -33,6 +33,49 @@
 
 #include "ecal_utils/portable_endian.h"
 
+#include <cstring>
+
+namespace
+{
+  // parse a tcp sample (magic, header size, header, payload) and forward it to the subscriber gate
+  void ApplyTcpSample(const char* buffer_, size_t size_, size_t ecal_magic_, eCAL::Payload::Sample& ecal_header_, eCAL::CSubGate& subgate_)
+  {
+    //                             ECAL        + header size field
+    const size_t header_length = ecal_magic_ + sizeof(uint16_t);
+    if (size_ < header_length) return;
+
+    uint16_t header_size_le = 0;
+    memcpy(&header_size_le, buffer_ + ecal_magic_, sizeof(header_size_le));
+    const uint16_t header_size = le16toh(header_size_le);
+    if (size_ < header_length + header_size) return;
+
+    // extract header
+    const char* header_payload = buffer_ + header_length;
+    // extract data payload
+    const char* data_payload   = header_payload + header_size;
+
+    // parse header
+    if (!eCAL::DeserializeFromBuffer(header_payload, header_size, ecal_header_)) return;
+
+    // use this intermediate variables as optimization
+    const auto& ecal_header_topic_info = ecal_header_.topic_info;
+    const auto& ecal_header_content    = ecal_header_.content;
+
+    const size_t data_size = static_cast<size_t>(ecal_header_content.size);
+    if (data_size > size_ - header_length - header_size) return;
+
+    subgate_.ApplySample(
+      ecal_header_topic_info,
+      data_payload,
+      data_size,
+      ecal_header_content.id,
+      ecal_header_content.clock,
+      ecal_header_content.time,
+      ecal_header_content.hash,
+      eCAL::tl_ecal_tcp);
+  }
+}
+
 namespace eCAL
 {
   ////////////////
@@ -107,35 +150,8 @@ namespace eCAL
 
   void CDataReaderTCP::OnTcpMessage(const tcp_pubsub::CallbackData& data_)
   {
-    //                             ECAL                    + header size field
-    const size_t   header_length = m_attributes.ecal_magic + sizeof(uint16_t);
-    const uint16_t header_size   = le16toh(*reinterpret_cast<uint16_t*>(data_.buffer_->data() + m_attributes.ecal_magic));
-
-    // extract header
-    const char* header_payload = data_.buffer_->data() + header_length;
-    // extract data payload
-    const char* data_payload   = header_payload + header_size;
-
-    // parse header
-    if (DeserializeFromBuffer(header_payload, header_size, m_ecal_header))
-    {
-      if (m_subgate)
-      {
-        // use this intermediate variables as optimization
-        const auto& ecal_header_topic_info = m_ecal_header.topic_info;
-        const auto& ecal_header_content    = m_ecal_header.content;
-
-        m_subgate->ApplySample(
-          ecal_header_topic_info,
-          data_payload,
-          static_cast<size_t>(ecal_header_content.size),
-          ecal_header_content.id,
-          ecal_header_content.clock,
-          ecal_header_content.time,
-          ecal_header_content.hash,
-          tl_ecal_tcp);
-      }
-    }
+    if (!m_subgate) return;
+    ApplyTcpSample(data_.buffer_->data(), data_.buffer_->size(), m_attributes.ecal_magic, m_ecal_header, *m_subgate);
   }
   
   ////////////////
@@ -181,6 +197,22 @@ namespace eCAL
     reader->Destroy();
 
     m_datareadertcp_map.erase(iter);
+
+    // leave the multiplexed connections, close them if no topic is left
+    for (auto mux_iter = m_mux_client_map.begin(); mux_iter != m_mux_client_map.end();)
+    {
+      auto& client = mux_iter->second;
+      client->Unsubscribe(topic_name_);
+      if (client->GetTopicCount() == 0)
+      {
+        client->Stop();
+        mux_iter = m_mux_client_map.erase(mux_iter);
+      }
+      else
+      {
+        ++mux_iter;
+      }
+    }
   }
 
   void CTCPReaderLayer::SetConnectionParameter(SReaderLayerPar& par_)
@@ -190,6 +222,7 @@ namespace eCAL
     //////////////////////////////////
     const auto& remote_hostname = par_.host_name;
     auto        remote_port     = par_.parameter.layer_par_tcp.port;
+    auto        remote_mux_port = par_.parameter.layer_par_tcp.mux_port;
 
     const std::string map_key(par_.topic_name);
 
@@ -197,7 +230,50 @@ namespace eCAL
     const DataReaderTCPMapT::iterator iter = m_datareadertcp_map.find(map_key);
     if (iter == m_datareadertcp_map.end()) return;
 
+    // writer in multiplexed mode, the topic joins the connection to the writers process
+    if (remote_mux_port != 0)
+    {
+      AddMuxConnectionIfNecessary(remote_hostname, static_cast<uint16_t>(remote_mux_port), par_.topic_id, par_.topic_name);
+      return;
+    }
+
     auto& reader = iter->second;
     reader->AddConnectionIfNecessary(remote_hostname, static_cast<uint16_t>(remote_port));
   }
+
+  void CTCPReaderLayer::AddMuxConnectionIfNecessary(const std::string& host_name_, uint16_t port_, EntityIdT topic_id_, const std::string& topic_name_)
+  {
+    const auto map_key = std::make_pair(host_name_, port_);
+
+    auto iter = m_mux_client_map.find(map_key);
+    if ((iter == m_mux_client_map.end()) || iter->second->IsClosed())
+    {
+      if (!m_mux_executor)
+      {
+        m_mux_executor = std::make_unique<TCP::CMuxExecutor>(m_attributes.thread_pool_size);
+      }
+
+      // Add possible hostnames:
+      // 1. hostname:port
+      // 2. hostname.local:port (-> i.e. the mDNS variant)
+      TCP::CMuxClient::EndpointListT endpoints = { { host_name_, port_ } , { host_name_ + ".local", port_ } };
+
+      // the client calls back from one thread at a time, so it can reuse its header
+      const size_t ecal_magic  = eCAL::eCALReader::TCP::BuildTCPReaderAttributes(m_attributes).ecal_magic;
+      auto         ecal_header = std::make_shared<Payload::Sample>();
+      auto         subgate     = m_subgate;
+      auto         callback    = [ecal_magic, ecal_header, subgate](const char* buffer_, size_t size_)
+        {
+          if (subgate) ApplyTcpSample(buffer_, size_, ecal_magic, *ecal_header, *subgate);
+        };
+
+      auto client = std::make_shared<TCP::CMuxClient>(m_mux_executor->GetIoContext(), std::move(endpoints), m_attributes.max_reconnection_attempts, std::move(callback));
+      client->Start();
+
+      if (iter != m_mux_client_map.end()) iter->second = client;
+      else                                iter = m_mux_client_map.emplace(map_key, client).first;
+    }
+
+    iter->second->Subscribe(topic_id_, topic_name_);
+  }
 }
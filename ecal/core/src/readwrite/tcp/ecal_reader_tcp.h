@@ -28,14 +28,21 @@
 #include "config/attributes/data_reader_tcp_attributes.h"
 #include "config/attributes/tcp_reader_layer_attributes.h"
 
+#include "io/tcp/ecal_tcp_mux_client.h"
+#include "io/tcp/ecal_tcp_mux_executor.h"
+
 #include <tcp_pubsub/executor.h>
 #include <tcp_pubsub/subscriber.h>
 
 #include "serialization/ecal_struct_sample_payload.h"
 
 #include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace eCAL
 {
@@ -82,9 +89,16 @@ namespace eCAL
     void SetConnectionParameter(SReaderLayerPar& /*par_*/) override;
 
   private:
+    void AddMuxConnectionIfNecessary(const std::string& host_name_, uint16_t port_, EntityIdT topic_id_, const std::string& topic_name_);
+
     std::atomic<bool> m_initialized;
     std::shared_ptr<tcp_pubsub::Executor>   m_executor;
 
+    // multiplexed connections, one per publishing process, shared by all topics
+    using MuxClientMapT = std::map<std::pair<std::string, uint16_t>, std::shared_ptr<TCP::CMuxClient>>;
+    std::unique_ptr<TCP::CMuxExecutor>      m_mux_executor;
+    MuxClientMapT                           m_mux_client_map;
+
     using DataReaderTCPMapT = std::unordered_map<std::string, std::shared_ptr<CDataReaderTCP>>;
     std::mutex                              m_datareadertcp_sync;
     DataReaderTCPMapT                       m_datareadertcp_map;
@@ -58,9 +58,24 @@ namespace eCAL
   std::mutex                            CDataWriterTCP::g_tcp_writer_executor_mtx;
   std::shared_ptr<tcp_pubsub::Executor> CDataWriterTCP::g_tcp_writer_executor;
 
+  std::mutex                            CDataWriterTCP::g_tcp_writer_mux_server_mtx;
+  std::weak_ptr<TCP::CMuxServer>        CDataWriterTCP::g_tcp_writer_mux_server;
+
   CDataWriterTCP::CDataWriterTCP(const eCAL::eCALWriter::TCP::SAttributes& attr_) :
     m_attributes(attr_)
   {
+    if (m_attributes.multiplexed)
+    {
+      const std::lock_guard<std::mutex> lock(g_tcp_writer_mux_server_mtx);
+      m_mux_server = g_tcp_writer_mux_server.lock();
+      if (!m_mux_server)
+      {
+        m_mux_server = std::make_shared<TCP::CMuxServer>(m_attributes.thread_pool_size, GetPreferredAnyAddress());
+        g_tcp_writer_mux_server = m_mux_server;
+      }
+      return;
+    }
+
     {
       const std::lock_guard<std::mutex> lock(g_tcp_writer_executor_mtx);
       if (!g_tcp_writer_executor)
@@ -91,7 +106,7 @@ namespace eCAL
 
   bool CDataWriterTCP::Write(const void* const buf_, const SWriterAttr& attr_)
   {
-    if (!m_publisher) return false;
+    if (!m_publisher && !m_mux_server) return false;
 
     // create new payload sample (header information only, no payload)
     Payload::Sample proto_header;
@@ -151,6 +166,12 @@ namespace eCAL
     // copy serialized proto header right after sample size field
     memcpy((void*)(m_header_buffer.data() + ecal_magic_size + sizeof(uint16_t)), serialized_proto_header.data(), serialized_proto_header.size());
 
+    // send it over the shared connections
+    if (m_mux_server)
+    {
+      return m_mux_server->Send(m_attributes.topic_id, m_header_buffer.data(), m_header_buffer.size(), static_cast<const char*>(buf_), attr_.len);
+    }
+
     // create tcp send buffer
     std::vector<std::pair<const char* const, const size_t>> send_vec;
     send_vec.reserve(2);
@@ -171,6 +192,7 @@ namespace eCAL
   {
     Registration::LayerParTcp connection_par;
     connection_par.port = m_port;
+    if (m_mux_server) connection_par.mux_port = m_mux_server->GetPort();
     return connection_par;
   }
 }
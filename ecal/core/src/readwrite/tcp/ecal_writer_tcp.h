@@ -27,9 +27,12 @@
 
 #include "readwrite/ecal_writer_base.h"
 
+#include "io/tcp/ecal_tcp_mux_server.h"
+
 #include <tcp_pubsub/executor.h>
 #include <tcp_pubsub/publisher.h>
 
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -58,5 +61,11 @@ namespace eCAL
 
     std::shared_ptr<tcp_pubsub::Publisher>       m_publisher;
     uint16_t                                     m_port = 0;
+
+    // multiplexed mode, all multiplexed writers of this process share one server
+    static std::mutex                            g_tcp_writer_mux_server_mtx;
+    static std::weak_ptr<TCP::CMuxServer>        g_tcp_writer_mux_server;
+
+    std::shared_ptr<TCP::CMuxServer>             m_mux_server;
   };
 }
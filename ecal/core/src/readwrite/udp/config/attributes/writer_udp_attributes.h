@@ -37,6 +37,12 @@ namespace eCAL
         bool        loopback;
         int         send_buffer;
 
+        unsigned int retransmit_window;
+        unsigned int repair_rate_limit;
+
+        unsigned int coalescing_latency_us;
+        unsigned int coalescing_max_size;
+
         std::string host_name;
         std::string topic_name;
         uint64_t    topic_id;
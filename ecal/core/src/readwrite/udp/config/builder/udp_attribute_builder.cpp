@@ -55,6 +55,9 @@ namespace eCAL
         sender_attr.address   = attr_.address;
         sender_attr.ttl       = attr_.ttl;
 
+        sender_attr.retransmit_window       = attr_.retransmit_window;
+        sender_attr.repair_bytes_per_second = attr_.repair_rate_limit;
+
         return sender_attr;
       }
     }
@@ -30,6 +30,7 @@
 
 #include "io/udp/ecal_udp_configurations.h"
 #include "pubsub/ecal_subgate.h"
+#include "readwrite/ecal_sample_batch.h"
 #include "config/builder/udp_attribute_builder.h"
 
 #include <functional>
@@ -102,6 +103,8 @@ namespace eCAL
   
   bool CUDPReaderLayer::HasSample(const std::string& sample_name_)
   {
+    // coalesced samples may contain any topic, the subgate picks the subscribed ones
+    if (sample_name_ == g_sample_batch_name) return true;
     if (m_subgate) return m_subgate->HasSample(sample_name_);
     return false;
   }
@@ -29,13 +29,40 @@
 
 #include "config/builder/udp_attribute_builder.h"
 
+#include <chrono>
 #include <cstddef>
+#include <mutex>
 
 namespace eCAL
 {
+  std::mutex                         CDataWriterUdpMC::g_udp_writer_coalescer_mtx;
+  std::weak_ptr<CUdpSampleCoalescer> CDataWriterUdpMC::g_udp_writer_coalescer;
+
   CDataWriterUdpMC::CDataWriterUdpMC(const eCALWriter::UDP::SAttributes& attr_) :
     m_attributes(attr_)
   {
+    // join the coalescer of the process, if small samples may be held back
+    // the coalescer sends with its own senders, so the writer does not need any
+    if (m_attributes.coalescing_latency_us > 0)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(g_udp_writer_coalescer_mtx);
+        m_coalescer = g_udp_writer_coalescer.lock();
+        if (!m_coalescer)
+        {
+          m_coalescer = std::make_shared<CUdpSampleCoalescer>();
+          g_udp_writer_coalescer = m_coalescer;
+        }
+      }
+
+      m_attributes.loopback = true;
+      m_coalescer_sender_attr_loopback = eCAL::eCALWriter::UDP::ConvertToIOUDPSenderAttributes(m_attributes);
+
+      m_attributes.loopback = false;
+      m_coalescer_sender_attr_no_loopback = eCAL::eCALWriter::UDP::ConvertToIOUDPSenderAttributes(m_attributes);
+      return;
+    }
+
     // create udp/sample sender with activated loop-back
     m_attributes.loopback = true;
     m_sample_sender_loopback = std::make_shared<UDP::CSampleSender>(eCAL::eCALWriter::UDP::ConvertToIOUDPSenderAttributes(m_attributes));
@@ -82,6 +109,28 @@ namespace eCAL
     ecal_sample_content.payload.raw_addr = static_cast<const char*>(buf_);
     ecal_sample_content.payload.raw_size = attr_.len;
 
+    // hand it over to the coalescer
+    if (m_coalescer)
+    {
+      const std::chrono::microseconds max_latency(m_attributes.coalescing_latency_us);
+      bool written(false);
+      if (attr_.loopback)
+      {
+        written = m_coalescer->Write(m_coalescer_sender_attr_loopback, ecal_sample, max_latency, m_attributes.coalescing_max_size);
+      }
+      else
+      {
+        written = m_coalescer->Write(m_coalescer_sender_attr_no_loopback, ecal_sample, max_latency, m_attributes.coalescing_max_size);
+      }
+
+      if (!written)
+      {
+        Logging::Log(Logging::log_level_fatal, "CDataWriterUDP::Send failed to send message !");
+      }
+
+      return(written);
+    }
+
     // send it
     size_t sent = 0;
     if (SerializeToBuffer(ecal_sample, m_sample_buffer))
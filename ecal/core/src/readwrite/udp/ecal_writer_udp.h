@@ -24,10 +24,13 @@
 #pragma once
 
 #include "io/udp/ecal_udp_sample_sender.h"
+#include "io/udp/ecal_udp_sender_attr.h"
 #include "readwrite/ecal_writer_base.h"
 #include "config/attributes/writer_udp_attributes.h"
+#include "ecal_writer_udp_coalescer.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -47,6 +50,14 @@ namespace eCAL
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_loopback;
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_no_loopback;
 
+    // all udp writers of the process share one coalescer
+    static std::mutex                         g_udp_writer_coalescer_mtx;
+    static std::weak_ptr<CUdpSampleCoalescer> g_udp_writer_coalescer;
+
+    std::shared_ptr<CUdpSampleCoalescer> m_coalescer;
+    UDP::SSenderAttr                     m_coalescer_sender_attr_loopback;
+    UDP::SSenderAttr                     m_coalescer_sender_attr_no_loopback;
+
     eCALWriter::UDP::SAttributes        m_attributes;
   };
 }
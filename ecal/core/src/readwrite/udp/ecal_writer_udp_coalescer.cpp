@@ -0,0 +1,261 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  udp sample coalescer, packs small samples of all udp writers with the same
+ *         destination into one datagram
+**/
+
+#include <ecal/log.h>
+
+#include "ecal_writer_udp_coalescer.h"
+#include "readwrite/ecal_sample_batch.h"
+#include "serialization/ecal_serialize_sample_payload.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+namespace
+{
+  // reserve for the batch sample header, the sample name and the reliability header of the datagram
+  constexpr size_t g_batch_overhead = 128;
+}
+
+namespace eCAL
+{
+  bool CUdpSampleCoalescer::SSenderAttrLess::operator()(const UDP::SSenderAttr& lhs_, const UDP::SSenderAttr& rhs_) const
+  {
+    return std::tie(lhs_.address, lhs_.port, lhs_.ttl, lhs_.broadcast, lhs_.loopback, lhs_.sndbuf, lhs_.retransmit_window, lhs_.repair_bytes_per_second, lhs_.test_drop_interval)
+         < std::tie(rhs_.address, rhs_.port, rhs_.ttl, rhs_.broadcast, rhs_.loopback, rhs_.sndbuf, rhs_.retransmit_window, rhs_.repair_bytes_per_second, rhs_.test_drop_interval);
+  }
+
+  CUdpSampleCoalescer::CUdpSampleCoalescer()
+  {
+    m_thread = std::thread(&CUdpSampleCoalescer::Run, this);
+  }
+
+  CUdpSampleCoalescer::~CUdpSampleCoalescer()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_one();
+    m_thread.join();
+  }
+
+  bool CUdpSampleCoalescer::Write(const UDP::SSenderAttr& sender_attr_, Payload::Sample& sample_, std::chrono::microseconds max_latency_, size_t max_size_)
+  {
+    const auto now = std::chrono::steady_clock::now();
+    bool notify(false);
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      auto& destination = m_destinations[sender_attr_];
+      if (!destination.sender) destination.sender = std::make_shared<UDP::CSampleSender>(sender_attr_);
+      auto& batch = destination.batch;
+
+      // the topic information is only needed if the topic changes within the batch
+      bool continue_topic = (batch.entry_count > 0) && (batch.last_topic_id == sample_.topic_info.topic_id);
+      SerializeEntry(sample_, continue_topic);
+
+      auto fits = [&batch, max_size_, this]()
+        {
+          return (g_batch_overhead + batch.entries.size() + g_sample_batch_entry_header_size + m_entry_buffer.size()) <= max_size_;
+        };
+
+      if (!fits())
+      {
+        SOutgoing outgoing;
+        TakeBatch(batch, outgoing);
+        if (continue_topic)
+        {
+          continue_topic = false;
+          SerializeEntry(sample_, continue_topic);
+        }
+
+        // too large for coalescing, send it as it is
+        if (!fits())
+        {
+          outgoing.direct_topic_name = sample_.topic_info.topic_name;
+          outgoing.direct_sample.swap(m_entry_buffer);
+          return Send(lock, destination, outgoing);
+        }
+
+        // queue the sample before sending the previous batch, m_entry_buffer may change while m_mutex is unlocked
+        notify = AppendEntry(batch, sample_, now + max_latency_);
+        Send(lock, destination, outgoing);
+      }
+      else
+      {
+        notify = AppendEntry(batch, sample_, now + max_latency_);
+      }
+    }
+
+    if (notify) m_cv.notify_one();
+    return true;
+  }
+
+  bool CUdpSampleCoalescer::AppendEntry(SBatch& batch_, const Payload::Sample& sample_, std::chrono::steady_clock::time_point deadline_)
+  {
+    bool notify(false);
+    if (batch_.entry_count == 0)
+    {
+      batch_.first_topic_name = sample_.topic_info.topic_name;
+      batch_.deadline         = deadline_;
+      notify                  = true;
+    }
+    else if (deadline_ < batch_.deadline)
+    {
+      batch_.deadline = deadline_;
+      notify          = true;
+    }
+
+    AppendSampleBatchEntry(batch_.entries, m_entry_buffer);
+    batch_.entry_count++;
+    batch_.last_topic_id = sample_.topic_info.topic_id;
+    return notify;
+  }
+
+  void CUdpSampleCoalescer::SerializeEntry(Payload::Sample& sample_, bool continue_topic_)
+  {
+    if (!continue_topic_)
+    {
+      SerializeToBuffer(sample_, m_entry_buffer);
+      return;
+    }
+
+    // serialize without topic information, the receiver takes it from the entry before
+    Payload::TopicInfo topic_info{};
+    std::swap(topic_info, sample_.topic_info);
+    SerializeToBuffer(sample_, m_entry_buffer);
+    std::swap(topic_info, sample_.topic_info);
+  }
+
+  void CUdpSampleCoalescer::TakeBatch(SBatch& batch_, SOutgoing& outgoing_)
+  {
+    std::swap(outgoing_.batch, batch_);
+    batch_ = SBatch();
+  }
+
+  bool CUdpSampleCoalescer::Send(std::unique_lock<std::mutex>& lock_, SDestination& destination_, SOutgoing& outgoing_)
+  {
+    // wait for the datagrams taken before from this destination, without blocking the other writers
+    const uint64_t ticket = destination_.send_tickets_issued++;
+    m_send_cv.wait(lock_, [&destination_, ticket]() { return destination_.send_tickets_served == ticket; });
+    const std::shared_ptr<UDP::CSampleSender> sender = destination_.sender;
+    lock_.unlock();
+
+    bool sent(true);
+    if (outgoing_.batch.entry_count > 0)
+    {
+      sent = SendBatch(*sender, outgoing_.batch);
+    }
+    if (!outgoing_.direct_sample.empty())
+    {
+      sent = sender->Send(outgoing_.direct_topic_name, outgoing_.direct_sample) > 0;
+    }
+
+    lock_.lock();
+    destination_.send_tickets_served++;
+    m_send_cv.notify_all();
+    return sent;
+  }
+
+  bool CUdpSampleCoalescer::SendBatch(UDP::CSampleSender& sender_, const SBatch& batch_)
+  {
+    std::vector<char> datagram;
+    size_t sent(0);
+    if (batch_.entry_count == 1)
+    {
+      // a single sample is sent as it is, so every receiver understands it
+      datagram.assign(batch_.entries.begin() + g_sample_batch_entry_header_size, batch_.entries.end());
+      sent = sender_.Send(batch_.first_topic_name, datagram);
+    }
+    else
+    {
+      Payload::Sample batch_sample{};
+      batch_sample.cmd_type                 = eCmdType::bct_set_sample_batch;
+      batch_sample.content.payload.type     = Payload::pl_raw;
+      batch_sample.content.payload.raw_addr = batch_.entries.data();
+      batch_sample.content.payload.raw_size = batch_.entries.size();
+      if (SerializeToBuffer(batch_sample, datagram))
+      {
+        sent = sender_.Send(g_sample_batch_name, datagram);
+      }
+    }
+
+    if (sent == 0)
+    {
+      Logging::Log(Logging::log_level_error, "CUdpSampleCoalescer::SendBatch failed to send " + std::to_string(batch_.entry_count) + " coalesced messages !");
+    }
+    return sent > 0;
+  }
+
+  void CUdpSampleCoalescer::Run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+      // send all batches that reached their deadline, wait for the next one
+      const auto now = std::chrono::steady_clock::now();
+      auto next_deadline = std::chrono::steady_clock::time_point::max();
+      std::vector<SDestination*> due_destinations;
+      for (auto& destination : m_destinations)
+      {
+        const auto& batch = destination.second.batch;
+        if (batch.entry_count == 0) continue;
+
+        if (batch.deadline <= now) due_destinations.push_back(&destination.second);
+        else                       next_deadline = std::min(next_deadline, batch.deadline);
+      }
+
+      if (!due_destinations.empty())
+      {
+        // m_mutex is unlocked while sending, so the batches are checked again and the deadlines recalculated afterwards
+        for (auto* destination : due_destinations)
+        {
+          if ((destination->batch.entry_count == 0) || (destination->batch.deadline > now)) continue;
+
+          SOutgoing outgoing;
+          TakeBatch(destination->batch, outgoing);
+          Send(lock, *destination, outgoing);
+        }
+        continue;
+      }
+
+      if (next_deadline == std::chrono::steady_clock::time_point::max()) m_cv.wait(lock);
+      else                                                               m_cv.wait_until(lock, next_deadline);
+    }
+
+    // send what is left
+    std::vector<SDestination*> destinations;
+    for (auto& destination : m_destinations)
+    {
+      if (destination.second.batch.entry_count > 0) destinations.push_back(&destination.second);
+    }
+    for (auto* destination : destinations)
+    {
+      SOutgoing outgoing;
+      TakeBatch(destination->batch, outgoing);
+      Send(lock, *destination, outgoing);
+    }
+  }
+}
@@ -0,0 +1,119 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  udp sample coalescer, packs small samples of all udp writers with the same
+ *         destination into one datagram
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_sample_sender.h"
+#include "io/udp/ecal_udp_sender_attr.h"
+#include "serialization/ecal_struct_sample_payload.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CUdpSampleCoalescer
+  {
+  public:
+    CUdpSampleCoalescer();
+    ~CUdpSampleCoalescer();
+
+    /*
+     * Queue the sample for the destination, it is sent together with the following samples as soon as
+     * the datagram is full or max_latency_ expired. Samples that do not fit into max_size_ are sent
+     * directly (after the samples already queued for the destination).
+     * The coalescer sends with its own sender for every distinct sender configuration.
+    **/
+    bool Write(const UDP::SSenderAttr& sender_attr_, Payload::Sample& sample_, std::chrono::microseconds max_latency_, size_t max_size_);
+
+    // prevent copying and moving
+    CUdpSampleCoalescer(const CUdpSampleCoalescer&) = delete;
+    CUdpSampleCoalescer& operator=(const CUdpSampleCoalescer&) = delete;
+    CUdpSampleCoalescer(CUdpSampleCoalescer&&) = delete;
+    CUdpSampleCoalescer& operator=(CUdpSampleCoalescer&&) = delete;
+
+  private:
+    struct SSenderAttrLess
+    {
+      bool operator()(const UDP::SSenderAttr& lhs_, const UDP::SSenderAttr& rhs_) const;
+    };
+
+    struct SBatch
+    {
+      std::vector<char>                     entries;
+      size_t                                entry_count   = 0;
+      std::string                           first_topic_name;
+      uint64_t                              last_topic_id = 0;
+      std::chrono::steady_clock::time_point deadline;
+    };
+
+    // everything taken from a destination to be sent without holding m_mutex
+    struct SOutgoing
+    {
+      SBatch                                batch;
+      std::string                           direct_topic_name;
+      std::vector<char>                     direct_sample;
+    };
+
+    struct SDestination
+    {
+      std::shared_ptr<UDP::CSampleSender>   sender;
+      SBatch                                batch;
+
+      // datagrams of a destination are sent in the order they were taken from the batch
+      uint64_t                              send_tickets_issued = 0;
+      uint64_t                              send_tickets_served = 0;
+    };
+
+    // need m_mutex to be locked
+    void SerializeEntry(Payload::Sample& sample_, bool continue_topic_);
+    bool AppendEntry(SBatch& batch_, const Payload::Sample& sample_, std::chrono::steady_clock::time_point deadline_);
+    static void TakeBatch(SBatch& batch_, SOutgoing& outgoing_);
+
+    // need lock_ to be locked, unlocks it while sending and locks it again before returning
+    bool Send(std::unique_lock<std::mutex>& lock_, SDestination& destination_, SOutgoing& outgoing_);
+    static bool SendBatch(UDP::CSampleSender& sender_, const SBatch& batch_);
+
+    void Run();
+
+    std::mutex                         m_mutex;
+    std::condition_variable            m_cv;
+    std::condition_variable            m_send_cv;
+    bool                               m_stop = false;
+    std::map<UDP::SSenderAttr, SDestination, SSenderAttrLess> m_destinations;
+
+    std::vector<char>                  m_entry_buffer;
+
+    std::thread                        m_thread;
+  };
+}
@@ -57,6 +57,8 @@ namespace eCAL
       bool                      network_enabled;
       bool                      loopback;
       unsigned int              refresh;
+      unsigned int              descriptor_refresh;
+      bool                      interest_filter;
       std::string               host_name;
       std::string               shm_transport_domain;
       int                       process_id;
@@ -50,6 +50,7 @@ eCAL::Registration::Sample eCAL::Registration::GetProcessRegisterSample()
   process_sample_process.process_name         = eCAL::Process::GetProcessName();
   process_sample_process.unit_name            = eCAL::Process::GetUnitName();
   process_sample_process.process_parameter               = eCAL::Process::GetProcessParameter();
+  process_sample_process.descriptor_hash_support         = true;
 
   {
     const std::lock_guard<std::mutex> lock(g_process_state_mutex);
@@ -0,0 +1,64 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "ecal_registration_descriptor_referencer.h"
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    CDescriptorReferencer::CDescriptorReferencer(uint64_t refresh_cycles_)
+      : m_refresh_cycles(refresh_cycles_)
+    {
+    }
+
+    void CDescriptorReferencer::ReferenceSentDescriptors(SampleList& sample_list_)
+    {
+      if (m_refresh_cycles == 0) return;
+
+      m_send_cycle++;
+
+      // descriptors that have not been sent for m_refresh_cycles cycles need to be sent in full again
+      for (auto iter = m_descriptor_send_cycle.begin(); iter != m_descriptor_send_cycle.end();)
+      {
+        if (m_send_cycle - iter->second >= m_refresh_cycles) iter = m_descriptor_send_cycle.erase(iter);
+        else ++iter;
+      }
+
+      for (auto& sample : sample_list_)
+      {
+        if ((sample.cmd_type != bct_reg_publisher) && (sample.cmd_type != bct_reg_subscriber)) continue;
+
+        auto& topic = sample.topic;
+        if (topic.datatype_descriptor_hash == 0) continue;
+
+        // the first sample of a topic with a descriptor carries it in full, all following samples
+        // of that topic (of this and the next cycles) only reference it by its hash
+        const bool first_sample = m_descriptor_send_cycle.emplace(std::make_pair(topic.datatype_descriptor_hash, topic.topic_name), m_send_cycle).second;
+        if (!first_sample) topic.datatype_information.descriptor.clear();
+      }
+    }
+
+    void CDescriptorReferencer::Reset()
+    {
+      m_descriptor_send_cycle.clear();
+    }
+  }
+}
@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief eCAL registration descriptor referencer
+ *
+ * Replaces the datatype descriptors of outgoing topic registration samples by
+ * their hash, once the full descriptor has been sent for that topic.
+ * The full descriptor is sent again every refresh_cycles_ send cycles.
+ *
+**/
+
+#pragma once
+
+#include <serialization/ecal_struct_sample_registration.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    class CDescriptorReferencer
+    {
+    public:
+      explicit CDescriptorReferencer(uint64_t refresh_cycles_);
+
+      // strips the descriptors of all samples that do not need to carry them in this send cycle
+      void ReferenceSentDescriptors(SampleList& sample_list_);
+
+      // forgets all sent descriptors, the next samples carry them in full again
+      void Reset();
+
+    private:
+      uint64_t m_refresh_cycles;
+      uint64_t m_send_cycle = 0;
+
+      // (descriptor hash, topic name) -> send cycle in which the full descriptor has been sent the last time
+      // tracked per topic, because receivers may filter out the samples of topics they are not interested in
+      std::map<std::pair<uint64_t, std::string>, uint64_t> m_descriptor_send_cycle;
+    };
+  }
+}
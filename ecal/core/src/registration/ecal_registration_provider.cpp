@@ -40,6 +40,7 @@
 #include <ecal/log.h>
 #include <ecal_globals.h>
 #include "ecal_def.h"
+#include "ecal_descgate.h"
 
 #include <registration/ecal_process_registration.h>
 #include <registration/udp/ecal_registration_sender_udp.h>
@@ -56,6 +57,7 @@ namespace eCAL
 
   CRegistrationProvider::CRegistrationProvider(SRegistrationProviderContext& context_) 
     : m_context(std::move(context_))
+    , m_descriptor_referencer(m_context.attributes.descriptor_refresh)
   {
   }
 
@@ -85,7 +87,7 @@ namespace eCAL
     }
 
     // start cyclic registration thread
-    m_reg_sample_snd_thread = std::make_shared<CCallbackThread>(std::bind(&CRegistrationProvider::RegisterSendThread, this));
+    m_reg_sample_snd_thread = std::make_shared<CCallbackTimer>(std::bind(&CRegistrationProvider::RegisterSendThread, this));
     m_reg_sample_snd_thread->start(std::chrono::milliseconds(m_context.attributes.refresh));
 
     m_created = true;
@@ -98,12 +100,12 @@ namespace eCAL
     // add unregistration sample to registration loop
     AddSingleSample(Registration::GetProcessUnregisterSample());
 
-    // wake up registration thread the last time
-    m_reg_sample_snd_thread->trigger();
-
-    // stop cyclic registration thread
+    // stop cyclic registration timer
     m_reg_sample_snd_thread->stop();
 
+    // send the collected samples (including the unregistration) the last time
+    RegisterSendThread();
+
     // delete registration sender
     m_reg_sender.reset();
 
@@ -118,7 +120,7 @@ namespace eCAL
     // add registration sample to registration loop
     AddSingleSample(sample_);
 
-    // wake up registration thread
+    // wake up registration timer
     m_reg_sample_snd_thread->trigger();
 
     return(true);
@@ -177,8 +179,24 @@ namespace eCAL
         m_applied_sample_list.clear();
       }
 
+      // reference datatype descriptors that have been sent recently by their hash only
+      ReferenceSentDescriptors(m_send_thread_sample_list);
+
       // send collected registration sample list
       m_reg_sender->SendSampleList(m_send_thread_sample_list);
     }
   }
+
+  void CRegistrationProvider::ReferenceSentDescriptors(Registration::SampleList& sample_list_)
+  {
+    // older processes cannot resolve a hash, they need the full descriptors in every sample
+    if (!m_context.descgate || !m_context.descgate->AllProcessesSupportDescriptorHash())
+    {
+      // and everything is sent in full again once they are gone
+      m_descriptor_referencer.Reset();
+      return;
+    }
+
+    m_descriptor_referencer.ReferenceSentDescriptors(sample_list_);
+  }
 }
@@ -30,16 +30,16 @@
 #pragma once
 
 
+#include "registration/ecal_registration_descriptor_referencer.h"
 #include "registration/ecal_registration_sender.h"
-#include "util/ecal_thread.h"
+#include "util/ecal_callback_timer.h"
 #include "config/attributes/registration_attributes.h"
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 
-#include "util/ecal_thread.h"
-
 namespace eCAL
 {
   class CMemFileMap;
@@ -47,6 +47,7 @@ namespace eCAL
   class CPubGate;
   class CServiceGate;
   class CClientGate;
+  class CDescGate;
 
   struct SRegistrationProviderContext
   {
@@ -56,6 +57,7 @@ namespace eCAL
     std::shared_ptr<eCAL::CPubGate>        pubgate;
     std::shared_ptr<eCAL::CServiceGate>    servicegate;
     std::shared_ptr<eCAL::CClientGate>     clientgate;
+    std::shared_ptr<eCAL::CDescGate>       descgate;
   };
 
   class CRegistrationProvider
@@ -73,11 +75,12 @@ namespace eCAL
   protected:
     void AddSingleSample(const Registration::Sample& sample_);
     void RegisterSendThread();
+    void ReferenceSentDescriptors(Registration::SampleList& sample_list_);
 
     static std::atomic<bool>             m_created;
 
     std::unique_ptr<CRegistrationSender> m_reg_sender;
-    std::shared_ptr<CCallbackThread>     m_reg_sample_snd_thread;
+    std::shared_ptr<CCallbackTimer>      m_reg_sample_snd_thread;
 
     std::mutex                           m_applied_sample_list_mtx;
     Registration::SampleList             m_applied_sample_list;
@@ -85,5 +88,7 @@ namespace eCAL
     Registration::SampleList             m_send_thread_sample_list;
 
     SRegistrationProviderContext         m_context;
+
+    Registration::CDescriptorReferencer  m_descriptor_referencer;
   };
 }
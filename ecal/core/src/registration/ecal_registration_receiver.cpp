@@ -29,7 +29,9 @@
 #include "registration/ecal_registration_receiver.h"
 
 #include "registration/ecal_registration_timeout_provider.h"
-#include "util/ecal_thread.h"
+#include "ecal_descgate.h"
+#include "ecal_global_accessors.h"
+#include "util/ecal_callback_timer.h"
 
 #include "registration/udp/ecal_registration_receiver_udp.h"
 #if ECAL_CORE_REGISTRATION_SHM
@@ -43,6 +45,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "config/builder/udp_shm_attribute_builder.h"
 #include "config/builder/sample_applier_attribute_builder.h"
@@ -92,18 +95,25 @@ namespace eCAL
       {
         m_timeout_provider->ApplySample(sample_);
       });
-    m_timeout_provider_thread = std::make_unique<CCallbackThread>([this]() {m_timeout_provider->CheckForTimeouts(); });
+    m_timeout_provider_thread = std::make_unique<CCallbackTimer>([this]() {m_timeout_provider->CheckForTimeouts(); });
     m_timeout_provider_thread->start(std::chrono::milliseconds(100));
 
+    // optionally skip samples that are not relevant for this process before deserializing them
+    Registration::SampleFilterT sample_filter;
+    if (m_context.attributes.interest_filter)
+    {
+      sample_filter = [](eCmdType cmd_type_, const std::string& name_) { return IsSampleOfInterest(cmd_type_, name_); };
+    }
+
 #if ECAL_CORE_REGISTRATION_SHM
     if (m_context.attributes.transport_mode == Registration::eTransportMode::shm)
     {
-      m_registration_receiver_shm = std::make_unique<CRegistrationReceiverSHM>([this](const Registration::Sample& sample_) {return m_sample_applier.ApplySample(sample_); }, Registration::BuildSHMAttributes(m_context.attributes), m_context.memfile_map);
+      m_registration_receiver_shm = std::make_unique<CRegistrationReceiverSHM>([this](const Registration::Sample& sample_) {return ApplyReceivedSample(sample_); }, sample_filter, Registration::BuildSHMAttributes(m_context.attributes), m_context.memfile_map);
     } else
 #endif
     if (m_context.attributes.transport_mode == Registration::eTransportMode::udp)
     {
-      m_registration_receiver_udp = std::make_unique<CRegistrationReceiverUDP>([this](const Registration::Sample& sample_) {return m_sample_applier.ApplySample(sample_);}, Registration::BuildUDPReceiverAttributes(m_context.attributes));
+      m_registration_receiver_udp = std::make_unique<CRegistrationReceiverUDP>([this](const Registration::Sample& sample_) {return ApplyReceivedSample(sample_);}, sample_filter, Registration::BuildUDPReceiverAttributes(m_context.attributes));
     }
     else
     {
@@ -131,6 +141,39 @@ namespace eCAL
     m_created = false;
   }
 
+  bool CRegistrationReceiver::IsSampleOfInterest(eCmdType cmd_type_, const std::string& name_)
+  {
+#if ECAL_CORE_MONITORING
+    // the monitoring needs to see all entities
+    if (g_monitoring()) return true;
+#endif
+    // process samples announce the capabilities of the peers (e.g. descriptor hash support)
+    if ((cmd_type_ == bct_reg_process) || (cmd_type_ == bct_unreg_process)) return true;
+    return Registration::CSampleApplierGates::IsSampleOfInterest(cmd_type_, name_);
+  }
+
+  bool CRegistrationReceiver::ApplyReceivedSample(const Registration::Sample& sample_)
+  {
+    const bool topic_registration = (sample_.cmd_type == bct_reg_publisher) || (sample_.cmd_type == bct_reg_subscriber);
+    const uint64_t descriptor_hash = sample_.topic.datatype_descriptor_hash;
+
+    // the descgate learns full descriptors when the sample is applied
+    if (topic_registration && (descriptor_hash != 0) && m_context.descgate && sample_.topic.datatype_information.descriptor.empty())
+    {
+      // the sample references its descriptor by hash only, complete it from the descriptor cache
+      // if the descriptor is unknown so far, it will be sent in full within the next refresh cycles
+      std::string cached_descriptor;
+      if (m_context.descgate->GetDescriptor(descriptor_hash, cached_descriptor))
+      {
+        Registration::Sample resolved_sample(sample_);
+        resolved_sample.topic.datatype_information.descriptor = std::move(cached_descriptor);
+        return m_sample_applier.ApplySample(resolved_sample);
+      }
+    }
+
+    return m_sample_applier.ApplySample(sample_);
+  }
+
   void CRegistrationReceiver::SetCustomApplySampleCallback(const std::string& customer_, const ApplySampleCallbackT& callback_)
   {
     m_sample_applier.SetCustomApplySampleCallback(customer_, callback_);
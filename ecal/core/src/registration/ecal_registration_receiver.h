@@ -49,11 +49,13 @@ namespace eCAL
   class CRegistrationReceiverUDP;
   class CRegistrationReceiverSHM;
   class CMemFileMap;
+  class CDescGate;
 
   struct SRegistrationReceiverContext
   {
     Registration::SAttributes                    attributes;
     std::shared_ptr<eCAL::CMemFileMap>           memfile_map;
+    std::shared_ptr<eCAL::CDescGate>             descgate;
   };
 
   namespace Registration
@@ -61,7 +63,7 @@ namespace eCAL
     template<typename T>
     class CTimeoutProvider;
   }
-  class CCallbackThread;
+  class CCallbackTimer;
 
   class CRegistrationReceiver
   {
@@ -79,12 +81,15 @@ namespace eCAL
     void RemCustomApplySampleCallback(const std::string& customer_);
 
   private:
+    static bool IsSampleOfInterest(eCmdType cmd_type_, const std::string& name_);
+    bool ApplyReceivedSample(const Registration::Sample& sample_);
+
     // why is this a static variable? can someone explain?
     static std::atomic<bool>              m_created;
 
     // this class gets samples and tracks them for timouts
     std::unique_ptr<Registration::CTimeoutProvider<std::chrono::steady_clock>> m_timeout_provider;
-    std::unique_ptr<CCallbackThread>                                           m_timeout_provider_thread;
+    std::unique_ptr<CCallbackTimer>                                            m_timeout_provider_thread;
 
     std::unique_ptr<CRegistrationReceiverUDP> m_registration_receiver_udp;
 #if ECAL_CORE_REGISTRATION_SHM
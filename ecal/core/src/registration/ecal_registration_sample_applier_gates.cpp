@@ -86,5 +86,39 @@ namespace eCAL
         break;
       }
     }
+
+    bool CSampleApplierGates::IsSampleOfInterest(eCmdType cmd_type_, const std::string& name_)
+    {
+      switch (cmd_type_)
+      {
+#if ECAL_CORE_SERVICE
+      case bct_reg_service:
+      case bct_unreg_service:
+      {
+        auto clientgate = g_clientgate();
+        return clientgate && clientgate->HasService(name_);
+      }
+#endif
+#if ECAL_CORE_PUBLISHER
+      case bct_reg_subscriber:
+      case bct_unreg_subscriber:
+      {
+        auto pubgate = g_pubgate();
+        return pubgate && pubgate->HasTopic(name_);
+      }
+#endif
+#if ECAL_CORE_SUBSCRIBER
+      case bct_reg_publisher:
+      case bct_unreg_publisher:
+      {
+        auto subgate = g_subgate();
+        return subgate && subgate->HasSample(name_);
+      }
+#endif
+      default:
+        // process and client samples are not needed by any gate
+        return false;
+      }
+    }
   }
 }
\ No newline at end of file
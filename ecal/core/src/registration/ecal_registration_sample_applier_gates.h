@@ -27,6 +27,8 @@
 
 #include "serialization/ecal_struct_sample_registration.h"
 
+#include <string>
+
 namespace eCAL
 {
   namespace Registration
@@ -35,6 +37,9 @@ namespace eCAL
     {
     public:
       static void ApplySample(const eCAL::Registration::Sample& sample_);
+
+      // checks if a sample (of the given type and topic / service name) is relevant for one of the gates
+      static bool IsSampleOfInterest(eCmdType cmd_type_, const std::string& name_);
     };
   }
 }
@@ -33,7 +33,9 @@
 
 #include "registration/shm/ecal_memfile_broadcast.h"
 #include "registration/shm/ecal_memfile_broadcast_reader.h"
-#include "util/ecal_thread.h"
+#include "util/ecal_callback_timer.h"
+
+#include <utility>
 
 namespace eCAL
 {
@@ -41,8 +43,9 @@ namespace eCAL
   // CMemfileRegistrationReceiver
   //////////////////////////////////////////////////////////////////
 
-  CRegistrationReceiverSHM::CRegistrationReceiverSHM(RegistrationApplySampleCallbackT apply_sample_callback, const Registration::SHM::SAttributes& attr_, std::shared_ptr<eCAL::CMemFileMap> memfile_map_)
+  CRegistrationReceiverSHM::CRegistrationReceiverSHM(RegistrationApplySampleCallbackT apply_sample_callback, Registration::SampleFilterT sample_filter, const Registration::SHM::SAttributes& attr_, std::shared_ptr<eCAL::CMemFileMap> memfile_map_)
    : m_apply_sample_callback(apply_sample_callback)
+   , m_sample_filter(std::move(sample_filter))
   {
     m_memfile_broadcast = std::make_unique<CMemoryFileBroadcast>(memfile_map_);
     m_memfile_broadcast->Create(attr_);
@@ -52,7 +55,7 @@ namespace eCAL
     // This is a bit unclean to take the raw adress of the reader here.
     m_memfile_broadcast_reader->Bind(m_memfile_broadcast.get());
 
-    m_memfile_broadcast_reader_thread = std::make_unique<CCallbackThread>(std::bind(&CRegistrationReceiverSHM::Receive, this));
+    m_memfile_broadcast_reader_thread = std::make_unique<CCallbackTimer>(std::bind(&CRegistrationReceiverSHM::Receive, this));
     m_memfile_broadcast_reader_thread->start(std::chrono::milliseconds(Config::GetRegistrationRefreshMs() / 2));
   }
 
@@ -71,7 +74,7 @@ namespace eCAL
 
   void CRegistrationReceiverSHM::Receive()
   {
-    // At the moment this function is called synchronously by a dedicated thread.
+    // At the moment this function is called synchronously by a single timer task.
     // If this changes, we need to protect the sample list member variable
     MemfileBroadcastMessageListT message_list;
     if (m_memfile_broadcast_reader->Read(message_list, 0))
@@ -79,7 +82,11 @@ namespace eCAL
       m_sample_list.clear();
       for (const auto& message : message_list)
       {
-        if (DeserializeFromBuffer(static_cast<const char*>(message.data), message.size, m_sample_list))
+        // samples rejected by the filter are not deserialized at all
+        const bool deserialized = m_sample_filter ?
+          DeserializeFromBuffer(static_cast<const char*>(message.data), message.size, m_sample_list, m_sample_filter) :
+          DeserializeFromBuffer(static_cast<const char*>(message.data), message.size, m_sample_list);
+        if (deserialized)
         {
           for (const auto& sample : m_sample_list)
           {
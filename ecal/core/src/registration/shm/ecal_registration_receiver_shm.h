@@ -34,7 +34,7 @@
 
 namespace eCAL
 {
-  class CCallbackThread;
+  class CCallbackTimer;
   class CMemoryFileBroadcast;
   class CMemoryFileBroadcastReader;
   class CMemFileMap;
@@ -42,7 +42,7 @@ namespace eCAL
   class CRegistrationReceiverSHM
   {
   public:
-    CRegistrationReceiverSHM(RegistrationApplySampleCallbackT apply_sample_callback, const Registration::SHM::SAttributes& attr_, std::shared_ptr<eCAL::CMemFileMap> memfile_map_);
+    CRegistrationReceiverSHM(RegistrationApplySampleCallbackT apply_sample_callback, Registration::SampleFilterT sample_filter, const Registration::SHM::SAttributes& attr_, std::shared_ptr<eCAL::CMemFileMap> memfile_map_);
     ~CRegistrationReceiverSHM();
 
     // default copy constructor
@@ -59,10 +59,11 @@ namespace eCAL
 
     std::unique_ptr<CMemoryFileBroadcast>       m_memfile_broadcast;
     std::unique_ptr<CMemoryFileBroadcastReader> m_memfile_broadcast_reader;
-    std::unique_ptr<CCallbackThread>            m_memfile_broadcast_reader_thread;
+    std::unique_ptr<CCallbackTimer>             m_memfile_broadcast_reader_thread;
 
     eCAL::Registration::SampleList              m_sample_list;
 
     RegistrationApplySampleCallbackT            m_apply_sample_callback;
+    Registration::SampleFilterT                 m_sample_filter;
   };
 }
@@ -28,13 +28,21 @@
 
 using namespace eCAL;
 
-eCAL::CRegistrationReceiverUDP::CRegistrationReceiverUDP(RegistrationApplySampleCallbackT apply_sample_callback, const Registration::UDP::SReceiverAttributes& attr_)
+eCAL::CRegistrationReceiverUDP::CRegistrationReceiverUDP(RegistrationApplySampleCallbackT apply_sample_callback, Registration::SampleFilterT sample_filter, const Registration::UDP::SReceiverAttributes& attr_)
   : m_registration_receiver(std::make_unique<UDP::CSampleReceiver>(
     Registration::UDP::ConvertToIOUDPReceiverAttributes(attr_),
     [](const std::string& /*sample_name_*/) {return true; },
-    [apply_sample_callback](const char* serialized_sample_data_, size_t serialized_sample_size_) {
+    [apply_sample_callback, sample_filter](const char* serialized_sample_data_, size_t serialized_sample_size_) {
       Registration::Sample sample;
-      if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, sample)) return false;
+      if (sample_filter)
+      {
+        // samples rejected by the filter are not deserialized at all
+        if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, sample, sample_filter)) return false;
+      }
+      else
+      {
+        if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, sample)) return false;
+      }
       return apply_sample_callback(sample);
     }
     ))
@@ -38,7 +38,7 @@ namespace eCAL
   class CRegistrationReceiverUDP
   {
   public:
-    CRegistrationReceiverUDP(RegistrationApplySampleCallbackT apply_sample_callback, const Registration::UDP::SReceiverAttributes& attr_);
+    CRegistrationReceiverUDP(RegistrationApplySampleCallbackT apply_sample_callback, Registration::SampleFilterT sample_filter, const Registration::UDP::SReceiverAttributes& attr_);
     ~CRegistrationReceiverUDP();
 
     // Special member functionss
@@ -30,6 +30,7 @@
 #include "ecal_struct_service.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -43,14 +44,16 @@ namespace eCAL
   inline namespace protozero
   {
     template <typename Writer>
-    void SerializeDataTypeInformation(Writer& writer, const eCAL::SDataTypeInformation& data_type_info)
+    void SerializeDataTypeInformation(Writer& writer, const eCAL::SDataTypeInformation& data_type_info, uint64_t descriptor_hash = 0)
     {
       writer.add_string(+eCAL::pb::DataTypeInformation::optional_string_name, data_type_info.name);
       writer.add_string(+eCAL::pb::DataTypeInformation::optional_string_encoding, data_type_info.encoding);
       writer.add_bytes(+eCAL::pb::DataTypeInformation::optional_bytes_descriptor_information, data_type_info.descriptor);
+      if (descriptor_hash != 0)
+        writer.add_fixed64(+eCAL::pb::DataTypeInformation::optional_fixed64_descriptor_hash, descriptor_hash);
     }
 
-    inline bool DeserializeDataTypeInformation(::protozero::pbf_reader& reader, eCAL::SDataTypeInformation& data_type_info)
+    inline bool DeserializeDataTypeInformationAndHash(::protozero::pbf_reader& reader, eCAL::SDataTypeInformation& data_type_info, uint64_t& descriptor_hash)
     {
       while (reader.next())
       {
@@ -65,6 +68,9 @@ namespace eCAL
         case +eCAL::pb::DataTypeInformation::optional_bytes_descriptor_information:
           AssignBytes(reader, data_type_info.descriptor);
           break;
+        case +eCAL::pb::DataTypeInformation::optional_fixed64_descriptor_hash:
+          descriptor_hash = reader.get_fixed64();
+          break;
         default:
           reader.skip();
         }
@@ -72,6 +78,12 @@ namespace eCAL
       return true;
     }
 
+    inline bool DeserializeDataTypeInformation(::protozero::pbf_reader& reader, eCAL::SDataTypeInformation& data_type_info)
+    {
+      uint64_t descriptor_hash(0);
+      return DeserializeDataTypeInformationAndHash(reader, data_type_info, descriptor_hash);
+    }
+
     void LogDeserializationException(const std::exception& exception, const std::string& context);
   }
 }
@@ -52,6 +52,8 @@ namespace
   {
     // Serialize TCP-specific parameters
     writer.add_int32(+eCAL::pb::LayerParTcp::optional_int32_port, layer.port);
+    if (layer.mux_port != 0)
+      writer.add_int32(+eCAL::pb::LayerParTcp::optional_int32_mux_port, layer.mux_port);
   }
 
   void DeserializeParamTCP(::protozero::pbf_reader& reader, eCAL::Registration::LayerParTcp& layer)
@@ -63,6 +65,9 @@ namespace
       case +eCAL::pb::LayerParTcp::optional_int32_port:
         layer.port = reader.get_int32();
         break;
+      case +eCAL::pb::LayerParTcp::optional_int32_mux_port:
+        layer.mux_port = reader.get_int32();
+        break;
       default:
         reader.skip();
         break;
@@ -128,6 +133,7 @@ namespace
       && static_cast<int>(eCAL::eTLayerType::tl_ecal_shm) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_shm)
       && static_cast<int>(eCAL::eTLayerType::tl_ecal_udp) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_udp_mc)
       && static_cast<int>(eCAL::eTLayerType::tl_ecal_tcp) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_tcp)
+      && static_cast<int>(eCAL::eTLayerType::tl_ecal_inproc) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_inproc)
       && static_cast<int>(eCAL::eTLayerType::tl_all) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_all)
       , "Enum values of eCAL::Registration::TLayer and eCAL::pb::TransportLayer do not match!");
 
@@ -149,6 +155,9 @@ namespace
       case eCAL::eTLayerType::tl_ecal_udp:
         // UDP has no Layer parameters, we do not serialize anything here
         break;
+      case eCAL::eTLayerType::tl_ecal_inproc:
+        // INPROC has no Layer parameters, we do not serialize anything here
+        break;
       case eCAL::eTLayerType::tl_ecal_tcp:
       {
         Writer tcp_writer{ parameter_writer, +eCAL::pb::ConnectionPar::optional_message_layer_par_tcp };
@@ -260,7 +269,7 @@ namespace
 
       {
         Writer datatype_writer{ topic_writer, +eCAL::pb::Topic::optional_message_datatype_information };
-        eCAL::protozero::SerializeDataTypeInformation(datatype_writer, sample.topic.datatype_information);
+        eCAL::protozero::SerializeDataTypeInformation(datatype_writer, sample.topic.datatype_information, sample.topic.datatype_descriptor_hash);
       }
       topic_writer.add_string(+eCAL::pb::Topic::optional_string_unit_name, sample.topic.unit_name);
 
@@ -285,6 +294,8 @@ namespace
         Writer latency_writer{ topic_writer, +eCAL::pb::Topic::optional_message_data_latency_us };
         SerializeTopicStatistics(latency_writer, sample.topic.latency_us);
       }
+      if (sample.topic.max_data_frequency != 0)
+        topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_max_data_frequency, sample.topic.max_data_frequency);
     }
   }
 
@@ -322,7 +333,10 @@ namespace
         AssignString(reader, sample.topic.shm_transport_domain);
         break;
       case +eCAL::pb::Topic::optional_message_datatype_information:
-        AssignMessage(reader, sample.topic.datatype_information, ::eCAL::protozero::DeserializeDataTypeInformation);
+        {
+          ::protozero::pbf_reader datatype_reader = reader.get_message();
+          ::eCAL::protozero::DeserializeDataTypeInformationAndHash(datatype_reader, sample.topic.datatype_information, sample.topic.datatype_descriptor_hash);
+        }
         break;
       case +eCAL::pb::Topic::optional_string_unit_name:
         AssignString(reader, sample.topic.unit_name);
@@ -357,6 +371,9 @@ namespace
       case +eCAL::pb::Topic::optional_message_data_latency_us:
         AssignMessage(reader, sample.topic.latency_us, DeserializeTopicStatistics);
         break;
+      case +eCAL::pb::Topic::optional_int32_max_data_frequency:
+        sample.topic.max_data_frequency = reader.get_int32();
+        break;
       default:
         reader.skip();
       }
@@ -388,6 +405,7 @@ namespace
       process_writer.add_string(+eCAL::pb::Process::optional_string_ecal_runtime_version, sample.process.ecal_runtime_version);
       process_writer.add_string(+eCAL::pb::Process::optional_string_config_file_path, sample.process.config_file_path);
       process_writer.add_string(+eCAL::pb::Process::optional_string_time_sync_module_name, sample.process.time_sync_module_name);
+      process_writer.add_bool(+eCAL::pb::Process::optional_bool_descriptor_hash_support, sample.process.descriptor_hash_support);
 
       // dynamic information
       process_writer.add_int32(+eCAL::pb::Process::optional_int32_registration_clock, sample.process.registration_clock);
@@ -443,6 +461,9 @@ namespace
       case +eCAL::pb::Process::optional_string_time_sync_module_name:
         AssignString(reader, sample.process.time_sync_module_name);
         break;
+      case +eCAL::pb::Process::optional_bool_descriptor_hash_support:
+        sample.process.descriptor_hash_support = reader.get_bool();
+        break;
       case +eCAL::pb::Process::optional_int32_registration_clock:
         sample.process.registration_clock = reader.get_int32();
         break;
@@ -756,6 +777,51 @@ namespace
     }
   }
 
+  void PeekName(::protozero::pbf_reader reader, ::protozero::pbf_tag_type name_tag, std::string& name)
+  {
+    if (reader.next(name_tag))
+    {
+      AssignString(reader, name);
+    }
+  }
+
+  // Reads only the command type and the topic / service name of a registration sample
+  void PeekRegistrationSample(::protozero::pbf_reader reader, eCAL::eCmdType& cmd_type, std::string& name)
+  {
+    cmd_type = eCAL::bct_none;
+    name.clear();
+
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::Sample::optional_enum_cmd_type:
+        cmd_type = static_cast<eCAL::eCmdType>(reader.get_enum());
+        break;
+      case +eCAL::pb::Sample::optional_message_topic:
+        PeekName(reader.get_message(), +eCAL::pb::Topic::optional_string_topic_name, name);
+        break;
+      case +eCAL::pb::Sample::optional_message_service:
+        PeekName(reader.get_message(), +eCAL::pb::Service::optional_string_service_name, name);
+        break;
+      case +eCAL::pb::Sample::optional_message_client:
+        PeekName(reader.get_message(), +eCAL::pb::Client::optional_string_service_name, name);
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
+  bool AcceptRegistrationSample(const ::protozero::pbf_reader& reader, const ::eCAL::Registration::SampleFilterT& filter)
+  {
+    static thread_local std::string name;
+    eCAL::eCmdType cmd_type(eCAL::bct_none);
+    PeekRegistrationSample(reader, cmd_type, name);
+    return filter(cmd_type, name);
+  }
+
   template<typename Writer>
   void SerializeRegistrationSampleList(Writer& writer, const ::eCAL::Registration::SampleList& sample_list)
   {
@@ -781,6 +847,28 @@ namespace
       }
     }
   }
+
+  void DeserializeRegistrationSampleList(::protozero::pbf_reader& reader, ::eCAL::Registration::SampleList& sample_list, const ::eCAL::Registration::SampleFilterT& filter)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::SampleList::repeated_message_samples:
+      {
+        ::protozero::pbf_reader sample_reader = reader.get_message();
+        if (AcceptRegistrationSample(sample_reader, filter))
+        {
+          DeserializeRegistrationSample(sample_reader, sample_list.push_back());
+        }
+        break;
+      }
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
 }
 
 
@@ -851,6 +939,39 @@ namespace protozero
       return false;
     }
   }
+
+  bool DeserializeFromBuffer(const char* data_, size_t size_, ::eCAL::Registration::Sample& target_sample_, const ::eCAL::Registration::SampleFilterT& filter_)
+  {
+    try
+    {
+      target_sample_.clear();
+      ::protozero::pbf_reader message{ data_, size_ };
+      if (!AcceptRegistrationSample(message, filter_)) return false;
+      DeserializeRegistrationSample(message, target_sample_);
+      return true;
+    }
+    catch (const std::exception& exception)
+    {
+      LogDeserializationException(exception, "eCAL::Registration::Sample");
+      return false;
+    }
+  }
+
+  bool DeserializeFromBuffer(const char* data_, size_t size_, ::eCAL::Registration::SampleList& target_sample_list_, const ::eCAL::Registration::SampleFilterT& filter_)
+  {
+    try
+    {
+      target_sample_list_.clear();
+      ::protozero::pbf_reader message{ data_, size_ };
+      DeserializeRegistrationSampleList(message, target_sample_list_, filter_);
+      return true;
+    }
+    catch (const std::exception& exception)
+    {
+      LogDeserializationException(exception, "eCAL::Registration::SampleList");
+      return false;
+    }
+  }
 }
 }
 
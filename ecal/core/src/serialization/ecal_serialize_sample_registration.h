@@ -44,5 +44,10 @@ namespace eCAL
     bool SerializeToBuffer     (const Registration::SampleList& registration_sample_, std::vector<char>& target_buffer_);
     bool SerializeToBuffer     (const Registration::SampleList& source_sample_list_, std::string& target_buffer_);
     bool DeserializeFromBuffer (const char* data_, size_t size_, Registration::SampleList& target_sample_);
+
+    // registration sample (list) - deserialize only the samples accepted by the filter
+    // (the filter is applied to the command type and name, before anything else is deserialized)
+    bool DeserializeFromBuffer (const char* data_, size_t size_, Registration::Sample& target_sample_, const Registration::SampleFilterT& filter_);
+    bool DeserializeFromBuffer (const char* data_, size_t size_, Registration::SampleList& target_sample_, const Registration::SampleFilterT& filter_);
   }
 }
@@ -84,15 +84,24 @@ namespace {
   }
 
   template <typename Writer>
-  void SerializeServiceRequest(Writer& writer, const eCAL::Service::Request& service_request)
+  void SerializeServiceRequest(Writer& writer, const eCAL::Service::ServiceHeader& request_header, const char* request_data, size_t request_size)
   {
     {
       Writer header_writer{ writer, +eCAL::pb::Request::optional_message_header };
-      SerializeServiceHeader(header_writer, service_request.header);
+      SerializeServiceHeader(header_writer, request_header);
     }
-    writer.add_bytes(+eCAL::pb::Request::optional_bytes_request, service_request.request);
+    writer.add_bytes(+eCAL::pb::Request::optional_bytes_request, request_data, request_size);
   }
 
+  template <typename Writer>
+  void SerializeServiceRequest(Writer& writer, const eCAL::Service::Request& service_request)
+  {
+    SerializeServiceRequest(writer, service_request.header, service_request.request.data(), service_request.request.size());
+  }
+
+  // header fields are short strings, this avoids reallocations for large payloads
+  constexpr size_t service_header_size_estimate = 512;
+
   void DeserializeServiceRequest(::protozero::pbf_reader& reader, eCAL::Service::Request& service_request)
   {
     while (reader.next())
@@ -160,11 +169,21 @@ namespace eCAL
     bool SerializeToBuffer(const eCAL::Service::Request& source_sample_, std::string& target_buffer_)
     {
       target_buffer_.clear();
+      target_buffer_.reserve(source_sample_.request.size() + service_header_size_estimate);
       ::protozero::pbf_writer request_writer{ target_buffer_ };
       SerializeServiceRequest(request_writer, source_sample_);
       return true;
     }
 
+    bool SerializeToBuffer(const Service::ServiceHeader& request_header_, const char* request_data_, size_t request_size_, std::string& target_buffer_)
+    {
+      target_buffer_.clear();
+      target_buffer_.reserve(request_size_ + service_header_size_estimate);
+      ::protozero::pbf_writer request_writer{ target_buffer_ };
+      SerializeServiceRequest(request_writer, request_header_, request_data_, request_size_);
+      return true;
+    }
+
     bool DeserializeFromBuffer(const char* data_, size_t size_, Service::Request& target_sample_)
     {
       try
@@ -193,6 +212,7 @@ namespace eCAL
     bool SerializeToBuffer(const Service::Response& source_sample_, std::string& target_buffer_)
     {
       target_buffer_.clear();
+      target_buffer_.reserve(source_sample_.response.size() + service_header_size_estimate);
       ::protozero::pbf_writer response_writer{ target_buffer_ };
       SerializeServiceResponse(response_writer, source_sample_);
       return true;
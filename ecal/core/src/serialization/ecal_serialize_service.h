@@ -37,6 +37,8 @@ namespace eCAL
   {
     bool SerializeToBuffer(const Service::Request& source_sample_, std::vector<char>& target_buffer_);
     bool SerializeToBuffer(const Service::Request& source_sample_, std::string& target_buffer_);
+    // serializes a request from its header and a payload that is not part of a Service::Request (saves copying the payload)
+    bool SerializeToBuffer(const Service::ServiceHeader& request_header_, const char* request_data_, size_t request_size_, std::string& target_buffer_);
     bool DeserializeFromBuffer(const char* data_, size_t size_, Service::Request& target_sample_);
 
     // service response - serialize/deserialize
@@ -39,7 +39,8 @@ namespace eCAL
     bct_unreg_subscriber = 13,
     bct_unreg_process    = 14,
     bct_unreg_service    = 15, // TODO: should be named server!
-    bct_unreg_client     = 16
+    bct_unreg_client     = 16,
+    bct_set_sample_batch = 17
   };
 
   enum eTLayerType
@@ -48,6 +49,7 @@ namespace eCAL
     tl_ecal_udp = 1,
     tl_ecal_shm = 4,
     tl_ecal_tcp = 5,
+    tl_ecal_inproc = 42,
     tl_all      = 255,
   };
 }
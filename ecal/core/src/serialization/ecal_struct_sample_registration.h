@@ -32,6 +32,7 @@
 #include "util/expanding_vector.h"
 
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <string>
@@ -119,14 +120,17 @@ namespace eCAL
     struct LayerParTcp
     {
       int32_t                             port = 0;                     // tcp writers port number
+      int32_t                             mux_port = 0;                 // tcp writers multiplexed connection port number
 
       bool operator==(const LayerParTcp& other) const {
-        return port == other.port;
+        return port == other.port &&
+          mux_port == other.mux_port;
       }
 
       void clear()
       {
         port = 0;
+        mux_port = 0;
       }
     };
 
@@ -145,6 +149,18 @@ namespace eCAL
       }
     };
 
+    // Transport layer parameters for ecal inner process
+    // (subscribers are reached via the subgate, nothing to register)
+    struct LayerParInProc
+    {
+      bool operator==(const LayerParInProc& /*other*/) const {
+        return true;
+      }
+
+      void clear()
+      {}
+    };
+
     // Connection parameter for reader/writer
     struct ConnectionPar
     {
@@ -208,6 +224,7 @@ namespace eCAL
       std::string                         component_init_info;          // like comp_init_state as a human-readable string (pub|sub|srv|mon|log|time|proc)
       std::string                         ecal_runtime_version;         // loaded/runtime eCAL version of a component
       std::string                         config_file_path;             // Path from where the eCAL configuration for this process was loadedloaded/runtime eCAL version of a component
+      bool                                descriptor_hash_support = false; // process resolves datatype descriptors referenced by their hash only
 
       bool operator==(const Process& other) const {
         return registration_clock == other.registration_clock &&
@@ -221,7 +238,8 @@ namespace eCAL
           component_init_state == other.component_init_state &&
           component_init_info == other.component_init_info &&
           ecal_runtime_version == other.ecal_runtime_version &&
-          config_file_path == other.config_file_path;
+          config_file_path == other.config_file_path &&
+          descriptor_hash_support == other.descriptor_hash_support;
       }
 
       void clear()
@@ -238,6 +256,7 @@ namespace eCAL
         component_init_info.clear();
         ecal_runtime_version.clear();
         config_file_path.clear();
+        descriptor_hash_support = false;
       }
     };
 
@@ -281,6 +300,7 @@ namespace eCAL
       std::string                         topic_name;                   // topic name
       std::string                         direction;                    // direction (publisher, subscriber)
       SDataTypeInformation                datatype_information;         // topic datatype information (encoding & type & description)
+      uint64_t                            datatype_descriptor_hash = 0; // hash of the datatype descriptor (0 = none, descriptor may be omitted if set)
 
       Util::CExpandingVector<TLayer>      transport_layer;              // active topic transport layers and its specific parameter
       int32_t                             topic_size = 0;               // topic size
@@ -293,6 +313,7 @@ namespace eCAL
       int64_t                             data_clock = 0;               // data clock (send / receive action)
       int32_t                             data_frequency  = 0;                   // data frequency (send / receive registrations per second) [mHz]
       Statistics                          latency_us;                   // latency statistics for receiving data in microseconds
+      int32_t                             max_data_frequency = 0;       // maximum data frequency a subscriber needs (0 = unlimited) [mHz]
 
       bool operator==(const Topic& other) const {
         return registration_clock == other.registration_clock &&
@@ -302,6 +323,7 @@ namespace eCAL
           topic_name == other.topic_name &&
           direction == other.direction &&
           datatype_information == other.datatype_information &&
+          datatype_descriptor_hash == other.datatype_descriptor_hash &&
           transport_layer == other.transport_layer &&
           topic_size == other.topic_size &&
           connections_local == other.connections_local &&
@@ -310,7 +332,8 @@ namespace eCAL
           data_id == other.data_id &&
           data_clock == other.data_clock &&
           data_frequency == other.data_frequency &&
-          latency_us == other.latency_us;
+          latency_us == other.latency_us &&
+          max_data_frequency == other.max_data_frequency;
       }
 
       void clear()
@@ -322,6 +345,7 @@ namespace eCAL
         topic_name.clear();
         direction.clear();
         datatype_information.clear();
+        datatype_descriptor_hash = 0;
 
         transport_layer.clear();
         topic_size = 0;
@@ -335,6 +359,7 @@ namespace eCAL
         data_frequency = 0;
 
         latency_us.clear();
+        max_data_frequency = 0;
       }
     };
 
@@ -394,6 +419,10 @@ namespace eCAL
 
     // Registration sample list
     using SampleList = Util::CExpandingVector<Sample>;
+
+    // Registration sample filter, decides by command type and topic / service name
+    // (empty for process samples) if a sample needs to be deserialized at all
+    using SampleFilterT = std::function<bool(eCmdType cmd_type_, const std::string& name_)>;
   }
 }
 
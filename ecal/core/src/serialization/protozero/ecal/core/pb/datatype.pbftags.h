@@ -10,7 +10,8 @@ namespace eCAL { namespace pb {
 enum class DataTypeInformation : ::protozero::pbf_tag_type {
     optional_string_name = 1,
     optional_string_encoding = 2,
-    optional_bytes_descriptor_information = 3
+    optional_bytes_descriptor_information = 3,
+    optional_fixed64_descriptor_hash = 4
 };
 
 inline constexpr uint32_t operator+(DataTypeInformation e) {
@@ -55,7 +55,8 @@ enum class eCmdType : std::int32_t {
     bct_unreg_subscriber = 13,
     bct_unreg_process = 14,
     bct_unreg_service = 15,
-    bct_unreg_client = 16
+    bct_unreg_client = 16,
+    bct_set_sample_batch = 17
 };
 
 inline constexpr std::int32_t operator+(eCmdType v) {
@@ -23,7 +23,8 @@ inline constexpr uint32_t operator+(LayerParShm e) {
 }
 
 enum class LayerParTcp : ::protozero::pbf_tag_type {
-    optional_int32_port = 1
+    optional_int32_port = 1,
+    optional_int32_mux_port = 2
 };
 
 inline constexpr uint32_t operator+(LayerParTcp e) {
@@ -57,6 +58,7 @@ enum class eTransportLayerType : std::int32_t {
     tl_ecal_udp_mc = 1,
     tl_ecal_shm = 4,
     tl_ecal_tcp = 5,
+    tl_ecal_inproc = 42,
     tl_all = 255
 };
 
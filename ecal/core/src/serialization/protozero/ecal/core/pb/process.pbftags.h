@@ -31,7 +31,8 @@ enum class Process : ::protozero::pbf_tag_type {
     optional_string_time_sync_module_name = 14,
     optional_int32_registration_clock = 1,
     optional_message_state = 12,
-    optional_enum_time_sync_state = 13
+    optional_enum_time_sync_state = 13,
+    optional_bool_descriptor_hash_support = 20
 };
 
 inline constexpr uint32_t operator+(Process e) {
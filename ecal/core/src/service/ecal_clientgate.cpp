@@ -91,6 +91,12 @@ namespace eCAL
     return(ret_state);
   }
 
+  bool CClientGate::HasService(const std::string& service_name_)
+  {
+    const std::shared_lock<std::shared_timed_mutex> lock(m_service_client_map_mutex);
+    return(m_service_client_map.find(service_name_) != m_service_client_map.end());
+  }
+
   void CClientGate::ApplyServiceRegistration(const Registration::Sample& ecal_sample_)
   {
     v5::SServiceAttr service;
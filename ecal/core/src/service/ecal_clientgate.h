@@ -49,6 +49,8 @@ namespace eCAL
     bool Register  (const std::string& service_name_, const std::shared_ptr<CServiceClientImpl>& client_);
     bool Unregister(const std::string& service_name_, const std::shared_ptr<CServiceClientImpl>& client_);
 
+    bool HasService(const std::string& service_name_);
+
     void ApplyServiceRegistration(const Registration::Sample& ecal_sample_);
 
     void GetRegistrations(Registration::SampleList& reg_sample_list_);
@@ -56,11 +56,11 @@ namespace
   // Serializes the request data into a protocol buffer and returns a shared pointer to it
   std::shared_ptr<std::string> SerializeRequest(const std::string& method_name_, const std::string& request_)
   {
-    eCAL::Service::Request request;
-    request.header.method_name = method_name_;
-    request.request = request_;
+    eCAL::Service::ServiceHeader request_header;
+    request_header.method_name = method_name_;
+    // the payload is written directly into the protocol buffer, without copying it into a Service::Request first
     auto request_shared_ptr = std::make_shared<std::string>();
-    eCAL::SerializeToBuffer(request, *request_shared_ptr);
+    eCAL::SerializeToBuffer(request_header, request_.data(), request_.size(), *request_shared_ptr);
     return request_shared_ptr;
   }
 
@@ -324,8 +324,8 @@ namespace eCAL
                   threadpool->Post(task);
                 };
 
-      // use protocol version 1
-      const auto protocol_version = 1;
+      // use protocol version 2 (pipelined calls), older servers will negotiate version 1
+      const auto protocol_version = 2;
       const auto port_to_use = service_.tcp_port_v1;
 
       const std::vector<std::pair<std::string, uint16_t>> endpoint_list
@@ -333,7 +333,8 @@ namespace eCAL
         {service_.hname, port_to_use},
         {service_.hname + ".local", port_to_use},
       };
-      client.client_session = client_manager->create_client(static_cast<uint8_t>(protocol_version), endpoint_list, response_callback_executor_function, event_callback);
+      // the process id lets the client connect to a server on the same host via its local socket
+      client.client_session = client_manager->create_client(static_cast<uint8_t>(protocol_version), endpoint_list, static_cast<std::int32_t>(service_.pid), response_callback_executor_function, event_callback);
 
       if (client.client_session)
       {
@@ -623,7 +624,7 @@ namespace eCAL
         break;
       }
 
-      service_reponse.response = std::string(response.response.data(), response.response.size());
+      service_reponse.response = std::move(response.response);
     }
     else
     {
@@ -28,6 +28,7 @@
 #include <chrono>
 #include <functional>
 #include <string>
+#include <utility>
 
 #include "ecal_global_accessors.h"
 #include "ecal_service_server_impl.h"
@@ -294,7 +295,8 @@ namespace eCAL
               {
                 threadpool->Post(task);
               };
-    m_tcp_server = server_manager->create_server(1, 0, service_callback, service_callback_executor, event_callback);
+    // Offer protocol version 2 (pipelined calls), older clients will negotiate version 1
+    m_tcp_server = server_manager->create_server(2, 0, service_callback, service_callback_executor, event_callback);
 
     if (!m_tcp_server)
     {
@@ -497,7 +499,7 @@ namespace eCAL
     // set method call state 'executed'
     response_header.state = Service::eMethodCallState::executed;
     // set method response and return state
-    response.response = response_s;
+    response.response = std::move(response_s);
     response.ret_state = service_return_state;
 
     // TODO: The next version of the service protocol should omit the double-serialization (i.e. copying the binary data in a protocol buffer and then serializing that again)
@@ -23,6 +23,8 @@
 
 #include <ecal/ecal.h>
 
+#include "ecal_timer_wheel.h"
+
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -34,9 +36,7 @@ namespace eCAL
   class CTimerImpl
   {
   public:
-    CTimerImpl() : m_stop(false), m_running(false), m_last_error(0) {}
-
-    CTimerImpl(const int timeout_, const TimerCallbackT& callback_, const int delay_) : m_stop(false), m_running(false) { Start(timeout_, callback_, delay_); }
+    explicit CTimerImpl(const eTimerBackend backend_ = eTimerBackend::thread) : m_backend(backend_), m_stop(false), m_running(false), m_last_error(0), m_wheel_task(0) {}
 
     virtual ~CTimerImpl() { Stop(); }
     CTimerImpl(const CTimerImpl&) = delete;
@@ -49,8 +49,18 @@ namespace eCAL
       assert(m_running == false);
       if(m_running)    return(false);
       if(timeout_ < 0) return(false);
-      m_stop = false;
-      m_thread = std::thread(&CTimerImpl::Thread, this, callback_, timeout_, delay_);
+      if(m_backend == eTimerBackend::timer_wheel)
+      {
+        if (callback_ == nullptr) return(false);
+        m_wheel      = CTimerWheel::Get(CTimerWheel::ePool::user);
+        m_wheel_task = m_wheel->Schedule(std::chrono::milliseconds(timeout_), callback_, std::chrono::milliseconds(delay_), CTimerWheel::eMode::fixed_rate);
+        if (m_wheel_task == 0) return(false);
+      }
+      else
+      {
+        m_stop = false;
+        m_thread = std::thread(&CTimerImpl::Thread, this, callback_, timeout_, delay_);
+      }
       m_running = true;
       return(true);
     }
@@ -58,8 +68,17 @@ namespace eCAL
     bool Stop()
     {
       if(!m_running) return(false);
-      m_stop = true;
-      m_thread.join();
+      if(m_backend == eTimerBackend::timer_wheel)
+      {
+        m_wheel->Cancel(m_wheel_task);
+        m_wheel_task = 0;
+        m_wheel.reset();
+      }
+      else
+      {
+        m_stop = true;
+        m_thread.join();
+      }
       m_running = false;
       return(true);
     }
@@ -127,10 +146,14 @@ namespace eCAL
       m_stop = false;
     }
 
-    std::atomic<bool>        m_stop;
-    std::atomic<bool>        m_running;
-    std::thread              m_thread;
-    std::chrono::nanoseconds m_last_error;
+    const eTimerBackend          m_backend;
+    std::atomic<bool>            m_stop;
+    std::atomic<bool>            m_running;
+    std::thread                  m_thread;
+    std::chrono::nanoseconds     m_last_error;
+
+    std::shared_ptr<CTimerWheel> m_wheel;
+    CTimerWheel::TaskIdT         m_wheel_task;
   };
 
 
@@ -145,6 +168,17 @@ namespace eCAL
     m_timer->Start(timeout_, callback_, delay_);
   }
 
+  CTimer::CTimer(const eTimerBackend backend_) : m_timer(nullptr)
+  {
+    m_timer = std::make_unique<CTimerImpl>(backend_);
+  }
+
+  CTimer::CTimer(const int timeout_, const TimerCallbackT& callback_, const int delay_, const eTimerBackend backend_) : m_timer(nullptr)
+  {
+    m_timer = std::make_unique<CTimerImpl>(backend_);
+    m_timer->Start(timeout_, callback_, delay_);
+  }
+
   CTimer::~CTimer()
   {
     Stop();
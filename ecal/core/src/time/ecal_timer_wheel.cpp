@@ -0,0 +1,392 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL process wide hashed timer wheel
+**/
+
+#include "ecal_timer_wheel.h"
+#include "ecal_def.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+  // task id currently executed by this (worker) thread, used to detect self cancellation
+  thread_local eCAL::CTimerWheel::TaskIdT g_current_task_id = 0;
+
+  void JoinThread(std::thread& thread_)
+  {
+    if (!thread_.joinable()) return;
+    // the last owner may release the wheel from within a task callback,
+    // the detached worker keeps the shared state alive until it has left its loop
+    if (thread_.get_id() == std::this_thread::get_id()) thread_.detach();
+    else                                                 thread_.join();
+  }
+}
+
+namespace eCAL
+{
+  struct CTimerWheel::SCore
+  {
+    enum class eState
+    {
+      waiting,  // sleeping in a wheel slot
+      queued,   // waiting for a free worker
+      running,  // callback is executing
+    };
+
+    struct STask
+    {
+      TaskIdT                  id         = 0;
+      CallbackT                callback;
+      std::chrono::nanoseconds period{ 0 };
+      eMode                    mode       = eMode::fixed_rate;
+      std::uint64_t            deadline   = 0;      // absolute tick
+      std::uint64_t            generation = 0;      // invalidates stale slot entries
+      eState                   state      = eState::waiting;
+      bool                     triggered  = false;
+      bool                     cancelled  = false;
+    };
+
+    struct SSlotEntry
+    {
+      std::shared_ptr<STask> task;
+      std::uint64_t          generation;
+    };
+
+    SCore(std::size_t slot_count_, std::chrono::microseconds tick_)
+      : slot_count(std::max<std::size_t>(slot_count_, 1))
+      , tick(std::max<std::chrono::nanoseconds>(tick_, std::chrono::microseconds(1)))
+      , epoch(ClockT::now())
+      , slots(slot_count)
+    {
+    }
+
+    std::uint64_t ToTick(ClockT::time_point time_) const;
+    std::uint64_t NowTick() const;
+    std::uint64_t PeriodTicks(const STask& task_) const;
+
+    void Insert(const std::shared_ptr<STask>& task_, std::uint64_t deadline_);
+    void Dispatch(const std::shared_ptr<STask>& task_);
+    void Reschedule(const std::shared_ptr<STask>& task_);
+
+    const std::size_t                                   slot_count;
+    const std::chrono::nanoseconds                      tick;
+    const ClockT::time_point                            epoch;
+
+    mutable std::mutex                                  mutex;
+    std::condition_variable                             tick_cv;
+    std::condition_variable                             worker_cv;
+    std::condition_variable                             idle_cv;
+    bool                                                shutdown         = false;
+
+    std::uint64_t                                       current_tick     = 0;
+    std::uint64_t                                       next_wakeup_tick = 0;
+    std::vector<std::vector<SSlotEntry>>                slots;
+    std::deque<std::shared_ptr<STask>>                  ready_queue;
+    std::unordered_map<TaskIdT, std::shared_ptr<STask>> tasks;
+    TaskIdT                                             next_id          = 1;
+  };
+
+  std::shared_ptr<CTimerWheel> CTimerWheel::Get(ePool pool_)
+  {
+    static std::mutex                 instance_mtx;
+    static std::weak_ptr<CTimerWheel> instances[3];
+
+    const auto pool_idx = static_cast<std::size_t>(pool_);
+    const std::lock_guard<std::mutex> lock(instance_mtx);
+    auto wheel = instances[pool_idx].lock();
+    if (!wheel)
+    {
+      std::size_t worker_count(TIMER_WHEEL_WORKER_COUNT);
+      if (pool_ == ePool::user) worker_count = TIMER_WHEEL_USER_WORKER_COUNT;
+      if (pool_ == ePool::send) worker_count = TIMER_WHEEL_SEND_WORKER_COUNT;
+      wheel = std::make_shared<CTimerWheel>(TIMER_WHEEL_SLOT_COUNT, std::chrono::microseconds(TIMER_WHEEL_TICK_US), worker_count);
+      instances[pool_idx] = wheel;
+    }
+    return wheel;
+  }
+
+  CTimerWheel::CTimerWheel(std::size_t slot_count_, std::chrono::microseconds tick_, std::size_t worker_count_)
+    : m_core(std::make_shared<SCore>(slot_count_, tick_))
+  {
+    m_tick_thread = std::thread(&CTimerWheel::TickThread, m_core);
+    for (std::size_t i = 0; i < std::max<std::size_t>(worker_count_, 1); ++i)
+    {
+      m_worker_threads.emplace_back(&CTimerWheel::WorkerThread, m_core);
+    }
+  }
+
+  CTimerWheel::~CTimerWheel()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_core->mutex);
+      m_core->shutdown = true;
+    }
+    m_core->tick_cv.notify_all();
+    m_core->worker_cv.notify_all();
+
+    JoinThread(m_tick_thread);
+    for (auto& worker : m_worker_threads) JoinThread(worker);
+  }
+
+  CTimerWheel::TaskIdT CTimerWheel::Schedule(std::chrono::nanoseconds period_, const CallbackT& callback_, std::chrono::nanoseconds delay_, eMode mode_)
+  {
+    if (callback_ == nullptr)                  return 0;
+    if (period_ < std::chrono::nanoseconds(0)) return 0;
+
+    auto task = std::make_shared<SCore::STask>();
+    task->callback = callback_;
+    task->period   = period_;
+    task->mode     = mode_;
+
+    const std::lock_guard<std::mutex> lock(m_core->mutex);
+    if (m_core->shutdown) return 0;
+
+    task->id = m_core->next_id++;
+    m_core->tasks[task->id] = task;
+    m_core->Insert(task, m_core->ToTick(ClockT::now() + std::max(delay_, std::chrono::nanoseconds(0))));
+    return task->id;
+  }
+
+  bool CTimerWheel::Trigger(TaskIdT id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_core->mutex);
+    auto iter = m_core->tasks.find(id_);
+    if (iter == m_core->tasks.end()) return false;
+
+    auto& task = iter->second;
+    switch (task->state)
+    {
+    case SCore::eState::waiting:
+      // invalidate the pending slot entry and run now
+      task->generation++;
+      task->deadline = m_core->NowTick();
+      m_core->Dispatch(task);
+      break;
+    case SCore::eState::queued:
+      break;
+    case SCore::eState::running:
+      task->triggered = true;
+      break;
+    }
+    return true;
+  }
+
+  bool CTimerWheel::Cancel(TaskIdT id_)
+  {
+    std::unique_lock<std::mutex> lock(m_core->mutex);
+    auto iter = m_core->tasks.find(id_);
+    if (iter == m_core->tasks.end()) return false;
+
+    auto task = iter->second;
+    m_core->tasks.erase(iter);
+    task->cancelled = true;
+    task->generation++;
+
+    // wait for a running execution, but never for ourselves
+    if (g_current_task_id != id_)
+    {
+      m_core->idle_cv.wait(lock, [&task]() { return task->state != SCore::eState::running; });
+    }
+    return true;
+  }
+
+  std::size_t CTimerWheel::GetTaskCount() const
+  {
+    const std::lock_guard<std::mutex> lock(m_core->mutex);
+    return m_core->tasks.size();
+  }
+
+  std::uint64_t CTimerWheel::SCore::ToTick(ClockT::time_point time_) const
+  {
+    if (time_ <= epoch) return 0;
+    // round up, a task must never fire before its deadline
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time_ - epoch);
+    return static_cast<std::uint64_t>((elapsed.count() + tick.count() - 1) / tick.count());
+  }
+
+  std::uint64_t CTimerWheel::SCore::NowTick() const
+  {
+    // round down, the current tick is the last one that has fully elapsed
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(ClockT::now() - epoch);
+    return static_cast<std::uint64_t>(elapsed.count() / tick.count());
+  }
+
+  std::uint64_t CTimerWheel::SCore::PeriodTicks(const STask& task_) const
+  {
+    const auto ticks = static_cast<std::uint64_t>((task_.period.count() + tick.count() - 1) / tick.count());
+    return std::max<std::uint64_t>(ticks, 1);
+  }
+
+  void CTimerWheel::SCore::Insert(const std::shared_ptr<STask>& task_, std::uint64_t deadline_)
+  {
+    task_->deadline = deadline_;
+
+    // already due -> skip the wheel
+    if (deadline_ <= current_tick)
+    {
+      Dispatch(task_);
+      return;
+    }
+
+    task_->generation++;
+    task_->state = eState::waiting;
+    slots[deadline_ % slot_count].push_back({ task_, task_->generation });
+
+    // wake up the tick thread if it sleeps beyond the new deadline
+    if (deadline_ < next_wakeup_tick)
+    {
+      next_wakeup_tick = deadline_;
+      tick_cv.notify_one();
+    }
+  }
+
+  void CTimerWheel::SCore::Dispatch(const std::shared_ptr<STask>& task_)
+  {
+    task_->state = eState::queued;
+    ready_queue.push_back(task_);
+    worker_cv.notify_one();
+  }
+
+  void CTimerWheel::SCore::Reschedule(const std::shared_ptr<STask>& task_)
+  {
+    const std::uint64_t now_tick = NowTick();
+
+    if (task_->triggered)
+    {
+      task_->triggered = false;
+      task_->deadline  = now_tick;
+      Dispatch(task_);
+      return;
+    }
+
+    std::uint64_t next_tick = 0;
+    switch (task_->mode)
+    {
+    case eMode::fixed_rate:
+      // drift corrected, but do not try to catch up on missed runs
+      next_tick = std::max(task_->deadline + PeriodTicks(*task_), now_tick);
+      break;
+    case eMode::fixed_delay:
+      next_tick = now_tick + PeriodTicks(*task_);
+      break;
+    }
+    Insert(task_, next_tick);
+  }
+
+  void CTimerWheel::TickThread(std::shared_ptr<SCore> core_)
+  {
+    SCore& core = *core_;
+    std::unique_lock<std::mutex> lock(core.mutex);
+    while (!core.shutdown)
+    {
+      const std::uint64_t now_tick = core.NowTick();
+
+      // advance the wheel, every slot needs to be visited at most once
+      if (now_tick > core.current_tick)
+      {
+        std::uint64_t first_tick = core.current_tick + 1;
+        if (now_tick - core.current_tick > core.slot_count) first_tick = now_tick - core.slot_count + 1;
+
+        for (std::uint64_t tick = first_tick; tick <= now_tick; ++tick)
+        {
+          auto& slot = core.slots[tick % core.slot_count];
+          for (auto entry = slot.begin(); entry != slot.end();)
+          {
+            const auto& task = entry->task;
+            if (task->cancelled || (entry->generation != task->generation))
+            {
+              entry = slot.erase(entry);
+            }
+            else if (task->deadline <= now_tick)
+            {
+              core.Dispatch(task);
+              entry = slot.erase(entry);
+            }
+            else
+            {
+              ++entry;
+            }
+          }
+        }
+        core.current_tick = now_tick;
+      }
+
+      // find the next occupied slot within one revolution
+      core.next_wakeup_tick = core.current_tick + core.slot_count;
+      for (std::uint64_t tick = core.current_tick + 1; tick < core.next_wakeup_tick; ++tick)
+      {
+        const auto& slot = core.slots[tick % core.slot_count];
+        const bool due = std::any_of(slot.begin(), slot.end(), [tick](const SCore::SSlotEntry& entry_)
+          {
+            return (entry_.generation == entry_.task->generation) && (entry_.task->deadline == tick);
+          });
+        if (due)
+        {
+          core.next_wakeup_tick = tick;
+          break;
+        }
+      }
+
+      // sleep until the next deadline or until an earlier one gets inserted
+      const std::uint64_t planned_tick = core.next_wakeup_tick;
+      const auto          wakeup_time  = core.epoch + std::chrono::duration_cast<ClockT::duration>(core.tick * planned_tick);
+      core.tick_cv.wait_until(lock, wakeup_time, [&core, planned_tick]() { return core.shutdown || (core.next_wakeup_tick != planned_tick); });
+    }
+  }
+
+  void CTimerWheel::WorkerThread(std::shared_ptr<SCore> core_)
+  {
+    SCore& core = *core_;
+    std::unique_lock<std::mutex> lock(core.mutex);
+    for (;;)
+    {
+      core.worker_cv.wait(lock, [&core]() { return core.shutdown || !core.ready_queue.empty(); });
+      if (core.shutdown) return;
+
+      auto task = std::move(core.ready_queue.front());
+      core.ready_queue.pop_front();
+      if (task->cancelled) continue;
+
+      task->state = SCore::eState::running;
+      lock.unlock();
+
+      // the callback may destroy the wheel, only the shared state must be used afterwards
+      g_current_task_id = task->id;
+      task->callback();
+      g_current_task_id = 0;
+
+      lock.lock();
+      task->state = SCore::eState::waiting;
+      if (task->cancelled)
+      {
+        core.idle_cv.notify_all();
+        continue;
+      }
+      core.Reschedule(task);
+    }
+  }
+}
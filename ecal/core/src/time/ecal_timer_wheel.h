@@ -0,0 +1,131 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL process wide hashed timer wheel
+ *
+ * All periodic tasks of a process share one tick thread and a small worker
+ * pool instead of running a dedicated thread per timer. There is one wheel
+ * per pool (see CTimerWheel::ePool), so a slow user timer callback cannot
+ * delay the eCAL internal tasks like the registration. Each wheel is created
+ * on first use and destroyed when the last task owner releases it.
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CTimerWheel
+  {
+  public:
+    using TaskIdT    = std::uint64_t;
+    using CallbackT  = std::function<void()>;
+    using ClockT     = std::chrono::steady_clock;
+
+    enum class eMode
+    {
+      fixed_rate,   //!< next run is scheduled relative to the last deadline (drift corrected)
+      fixed_delay,  //!< next run is scheduled relative to the end of the last callback execution
+    };
+
+    enum class ePool
+    {
+      internal,     //!< eCAL internal tasks (registration, timeouts, shm receive polling)
+      user,         //!< eCAL::CTimer instances of the user (eTimerBackend::timer_wheel)
+      send,         //!< publisher sends of samples held back for rate limited subscribers (may block on the network)
+    };
+
+    /**
+     * @brief Get (or create) the process wide timer wheel instance of a pool.
+     *
+     * The instance stays alive as long as at least one returned pointer exists.
+     * The tasks of one pool share its workers, a callback blocking all of them
+     * delays every other task of the same pool (but not the tasks of other pools).
+     *
+     * @param pool_  The pool to get the wheel for.
+    **/
+    static std::shared_ptr<CTimerWheel> Get(ePool pool_ = ePool::internal);
+
+    CTimerWheel(std::size_t slot_count_, std::chrono::microseconds tick_, std::size_t worker_count_);
+
+    /**
+     * @brief Stop the wheel.
+     *
+     * May be called from within a task callback (e.g. by releasing the last
+     * reference), the executing worker thread is detached in that case and
+     * exits as soon as the callback returns.
+    **/
+    ~CTimerWheel();
+
+    CTimerWheel(const CTimerWheel&) = delete;
+    CTimerWheel& operator=(const CTimerWheel&) = delete;
+    CTimerWheel(CTimerWheel&&) = delete;
+    CTimerWheel& operator=(CTimerWheel&&) = delete;
+
+    /**
+     * @brief Schedule a periodic task.
+     *
+     * @param period_    Period of the task (values below one tick are rounded up).
+     * @param callback_  Callback to execute, a task never runs concurrently with itself.
+     * @param delay_     Delay until the first execution.
+     * @param mode_      Rescheduling mode.
+     *
+     * @return  Task id (0 on failure).
+    **/
+    TaskIdT Schedule(std::chrono::nanoseconds period_, const CallbackT& callback_, std::chrono::nanoseconds delay_, eMode mode_);
+
+    /**
+     * @brief Execute the task as soon as possible, the period restarts afterwards.
+     *
+     * If the task is currently running it will be executed again right after it finished.
+    **/
+    bool Trigger(TaskIdT id_);
+
+    /**
+     * @brief Remove a task from the wheel.
+     *
+     * Blocks until a currently running execution has finished, unless it is
+     * called from within the task callback itself.
+    **/
+    bool Cancel(TaskIdT id_);
+
+    std::size_t GetTaskCount() const;
+
+  private:
+    // the shared state is owned by the wheel and by its threads, so a worker thread
+    // that releases the last wheel reference from within a task callback can still
+    // finish its loop safely after the wheel object itself has been destroyed
+    struct SCore;
+
+    static void TickThread(std::shared_ptr<SCore> core_);
+    static void WorkerThread(std::shared_ptr<SCore> core_);
+
+    std::shared_ptr<SCore>                              m_core;
+
+    std::thread                                         m_tick_thread;
+    std::vector<std::thread>                            m_worker_threads;
+  };
+}
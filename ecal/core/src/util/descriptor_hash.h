@@ -0,0 +1,56 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Content hash of datatype descriptors
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+     * @brief Computes the 64 bit FNV-1a hash of a datatype descriptor.
+     *
+     * The hash is exchanged between processes via registration, so it must not
+     * depend on the platform or the standard library (like std::hash does).
+     *
+     * @param descriptor_  The descriptor.
+     *
+     * @return  The descriptor hash, 0 for an empty descriptor.
+    **/
+    inline uint64_t DescriptorHash(const std::string& descriptor_)
+    {
+      if (descriptor_.empty()) return 0;
+
+      uint64_t hash = 14695981039346656037ULL;
+      for (const char c : descriptor_)
+      {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+      }
+      return hash;
+    }
+  }
+}
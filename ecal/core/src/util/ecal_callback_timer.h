@@ -0,0 +1,108 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL periodic callback helper class (based on the process wide timer wheel)
+**/
+
+#pragma once
+
+#include "time/ecal_timer_wheel.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace eCAL
+{
+  /**
+   * @brief Runs its callback periodically on the worker pool of a process wide
+   *        timer wheel (the internal one by default) instead of a dedicated thread.
+   */
+  class CCallbackTimer
+  {
+  public:
+    /**
+     * @brief Constructor for the CallbackTimer class.
+     * @param callback A callback function to be executed periodically.
+     * @param pool     The timer wheel pool the callback is executed on.
+     */
+    CCallbackTimer(std::function<void()> callback, CTimerWheel::ePool pool = CTimerWheel::ePool::internal)
+      : callback_(std::move(callback)), pool_(pool) {}
+
+    ~CCallbackTimer()
+    {
+      stop();
+    }
+
+    CCallbackTimer(const CCallbackTimer&) = delete;
+    CCallbackTimer& operator=(const CCallbackTimer&) = delete;
+    CCallbackTimer(CCallbackTimer&& rhs) = delete;
+    CCallbackTimer& operator=(CCallbackTimer&& rhs) = delete;
+
+    /**
+     * @brief Start the periodic execution, the first call happens after one timeout.
+     * @param timeout The time between the end of one execution and the start of the next one.
+     */
+    template <typename DurationType>
+    void start(DurationType timeout)
+    {
+      const std::lock_guard<std::mutex> lock(mtx_);
+      if (taskId_ != 0) return;
+      wheel_  = CTimerWheel::Get(pool_);
+      taskId_ = wheel_->Schedule(timeout, callback_, timeout, CTimerWheel::eMode::fixed_delay);
+    }
+
+    /**
+     * @brief Stop the periodic execution.
+     * Waits for a currently running callback to finish.
+     */
+    void stop()
+    {
+      std::shared_ptr<CTimerWheel> wheel;
+      CTimerWheel::TaskIdT         task_id{ 0 };
+      {
+        const std::lock_guard<std::mutex> lock(mtx_);
+        wheel.swap(wheel_);
+        std::swap(task_id, taskId_);
+      }
+      // cancel outside of the lock, a running callback may still call trigger()
+      if (wheel) wheel->Cancel(task_id);
+    }
+
+    /**
+     * @brief Interrupt the current waiting period, the callback function will be executed immediately.
+     */
+    void trigger()
+    {
+      const std::lock_guard<std::mutex> lock(mtx_);
+      if (taskId_ == 0) return;
+      wheel_->Trigger(taskId_);
+    }
+
+  private:
+    std::function<void()>        callback_;     /**< The callback function to be executed. */
+    CTimerWheel::ePool           pool_;         /**< The timer wheel pool the callback runs on. */
+    std::mutex                   mtx_;          /**< Mutex protecting the task handle. */
+    std::shared_ptr<CTimerWheel> wheel_;        /**< Keeps the process wide timer wheel alive. */
+    CTimerWheel::TaskIdT         taskId_{ 0 };  /**< Handle of the scheduled task (0 = not running). */
+  };
+}
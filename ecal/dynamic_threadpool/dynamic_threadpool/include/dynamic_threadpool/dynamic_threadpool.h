@@ -19,18 +19,34 @@
 
 #pragma once
 
+#include <dynamic_threadpool/small_task.h>
+
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <utility>
 
 /**
  * @brief Class that implements a dynamically growing thread pool that can execute tasks in parallel.
+ *
+ * Every worker owns its own task queue. Idle workers steal tasks from the
+ * queues of busy workers and spin for a short, adaptive amount of time before
+ * going to sleep, so there is no global lock in the task hand-over path.
  */
 class DynamicThreadPool
 {
 public:
   /**
-   * @brief Create a new thread pool with unlimited maximum size.
+   * @brief Maximum number of threads of a pool that is created without a maximum size.
+   *
+   * The workers are kept in a table of fixed size, so they can scan each
+   * other's queues without locking. A pool without an explicit maximum size
+   * therefore stops growing at this number of threads and queues further tasks.
+   */
+  static constexpr unsigned int default_max_size = 1024;
+
+  /**
+   * @brief Create a new thread pool with the default maximum size (see default_max_size).
    */
   DynamicThreadPool();
 
@@ -43,7 +59,7 @@ public:
    * On shutdown, all queued tasks will still be executed before the threadpool
    * is fully shut down.
    * 
-   * @param max_size_ Maximum number of threads in the pool.
+   * @param max_size_ Maximum number of threads in the pool (0 selects default_max_size).
    */
   explicit DynamicThreadPool(unsigned int max_size_);
 
@@ -67,10 +83,23 @@ public:
    *
    * If shutdown has been called on the thread pool, posting a new task will fail.
    *
+   * Small callables (see SmallTask) are stored without heap allocation.
+   *
    * @param task_ The task to be executed by the thread pool.
    * @return True if the task was successfully posted; otherwise, false.
    */
-  bool Post(const std::function<void()>& task_);
+  template <typename Callable>
+  bool Post(Callable&& task_)
+  {
+    return PostTask(SmallTask(std::forward<Callable>(task_)));
+  }
+
+  /**
+   * @brief Posts an already type erased task to the thread pool for execution.
+   *
+   * @see Post()
+   */
+  bool PostTask(SmallTask&& task_);
 
   /**
    * @brief Get the current number of threads in the pool.
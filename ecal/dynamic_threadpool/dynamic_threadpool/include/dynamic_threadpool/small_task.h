@@ -0,0 +1,146 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Move-only, type erased void() callable with small buffer optimization.
+ *
+ * Callables that fit into the inline buffer (e.g. lambdas capturing a few
+ * pointers or shared_ptrs) are stored without any heap allocation. Larger
+ * callables fall back to a single heap allocation.
+ */
+class SmallTask
+{
+public:
+  static constexpr std::size_t inline_size = 6 * sizeof(void*);
+
+  SmallTask() noexcept = default;
+
+  template <typename Callable, typename = std::enable_if_t<!std::is_same<std::decay_t<Callable>, SmallTask>::value>>
+  SmallTask(Callable&& callable_) // NOLINT(google-explicit-constructor, bugprone-forwarding-reference-overload)
+  {
+    using T = std::decay_t<Callable>;
+    if constexpr (fits_inline<T>())
+    {
+      new (&storage) T(std::forward<Callable>(callable_));
+      ops = &inline_ops<T>;
+    }
+    else
+    {
+      new (&storage) T*(new T(std::forward<Callable>(callable_)));
+      ops = &heap_ops<T>;
+    }
+  }
+
+  ~SmallTask()
+  {
+    reset();
+  }
+
+  // delete copy
+  SmallTask(const SmallTask&) = delete;
+  SmallTask& operator=(const SmallTask&) = delete;
+
+  SmallTask(SmallTask&& other_) noexcept
+  {
+    move_from(other_);
+  }
+
+  SmallTask& operator=(SmallTask&& other_) noexcept
+  {
+    if (this != &other_)
+    {
+      reset();
+      move_from(other_);
+    }
+    return *this;
+  }
+
+  void operator()()
+  {
+    ops->invoke(&storage);
+  }
+
+  explicit operator bool() const noexcept
+  {
+    return ops != nullptr;
+  }
+
+  void reset() noexcept
+  {
+    if (ops != nullptr)
+    {
+      ops->destroy(&storage);
+      ops = nullptr;
+    }
+  }
+
+private:
+  using Storage = std::aligned_storage_t<inline_size, alignof(std::max_align_t)>;
+
+  struct Ops
+  {
+    void (*invoke) (void* storage_);
+    void (*move)   (void* dst_, void* src_) noexcept;
+    void (*destroy)(void* storage_) noexcept;
+  };
+
+  template <typename T>
+  static constexpr bool fits_inline()
+  {
+    return (sizeof(T) <= inline_size)
+        && (alignof(T) <= alignof(Storage))
+        && std::is_nothrow_move_constructible<T>::value;
+  }
+
+  template <typename T>
+  static constexpr Ops inline_ops
+  {
+    [](void* storage_) { (*static_cast<T*>(storage_))(); },
+    [](void* dst_, void* src_) noexcept { new (dst_) T(std::move(*static_cast<T*>(src_))); static_cast<T*>(src_)->~T(); },
+    [](void* storage_) noexcept { static_cast<T*>(storage_)->~T(); }
+  };
+
+  template <typename T>
+  static constexpr Ops heap_ops
+  {
+    [](void* storage_) { (**static_cast<T**>(storage_))(); },
+    [](void* dst_, void* src_) noexcept { new (dst_) T*(*static_cast<T**>(src_)); },
+    [](void* storage_) noexcept { delete *static_cast<T**>(storage_); }
+  };
+
+  void move_from(SmallTask& other_) noexcept
+  {
+    if (other_.ops != nullptr)
+    {
+      other_.ops->move(&storage, &other_.storage);
+      ops        = other_.ops;
+      other_.ops = nullptr;
+    }
+  }
+
+  Storage    storage;
+  const Ops* ops = nullptr;
+};
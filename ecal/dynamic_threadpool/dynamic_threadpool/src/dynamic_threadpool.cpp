@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <utility>
 
 
 DynamicThreadPool::DynamicThreadPool()
@@ -35,9 +36,9 @@ DynamicThreadPool::DynamicThreadPool(unsigned int max_size_)
 
 DynamicThreadPool::~DynamicThreadPool() = default;
 
-bool DynamicThreadPool::Post(const std::function<void()>& task_)
+bool DynamicThreadPool::PostTask(SmallTask&& task_)
 {
-  return impl->Post(task_);
+  return impl->Post(std::move(task_));
 }
 
 void DynamicThreadPool::Shutdown()
@@ -19,105 +19,305 @@
 
 #include "dynamic_threadpool_impl.h"
 
+#include <dynamic_threadpool/dynamic_threadpool.h>
+
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
-#include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
-DynamicThreadPoolImpl::DynamicThreadPoolImpl() = default;
+thread_local const DynamicThreadPoolImpl* DynamicThreadPoolImpl::current_pool   = nullptr;
+thread_local DynamicThreadPoolImpl::Worker* DynamicThreadPoolImpl::current_worker = nullptr;
 
-DynamicThreadPoolImpl::DynamicThreadPoolImpl(size_t max_size_)
-  : max_size(max_size_)
+DynamicThreadPoolImpl::DynamicThreadPoolImpl()
+  : DynamicThreadPoolImpl(0)
 {}
 
+DynamicThreadPoolImpl::DynamicThreadPoolImpl(size_t max_size_)
+  : max_size    (max_size_)
+  , capacity    (max_size_ == 0 ? DynamicThreadPool::default_max_size : max_size_)
+  , worker_slots(std::make_unique<std::atomic<Worker*>[]>(capacity))
+{
+  for (size_t i = 0; i < capacity; ++i)
+  {
+    worker_slots[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
 DynamicThreadPoolImpl::~DynamicThreadPoolImpl()
 {
   Shutdown();
   Join();
 }
 
-bool DynamicThreadPoolImpl::Post(const std::function<void()>& task)
+bool DynamicThreadPoolImpl::Post(SmallTask&& task)
+{
+  // Announce the post before checking the shutdown flag, so the workers
+  // cannot finish while this task is on its way into a queue.
+  posting_count.fetch_add(1);
+  if (shutdown.load())
+  {
+    posting_count.fetch_sub(1);
+    NotifyAll();
+    return false;
+  }
+
+  queued_count.fetch_add(1);
+
+  // If no worker is idle and we can create more, spawn a new worker
+  bool posted = false;
+  if ((idle_count.load() <= 0) && (worker_count.load() < capacity))
+  {
+    posted = SpawnWorker(task);
+  }
+
+  if (!posted)
+  {
+    Worker* target = nullptr;
+    if (current_pool == this)
+    {
+      target = current_worker;
+    }
+    else
+    {
+      const size_t count = worker_count.load(std::memory_order_acquire);
+      target = worker_slots[next_queue.fetch_add(1, std::memory_order_relaxed) % count].load(std::memory_order_acquire);
+    }
+
+    const std::lock_guard<std::mutex> lock(target->mutex);
+    target->tasks.push_back(std::move(task));
+  }
+
+  posting_count.fetch_sub(1);
+
+  // Wake up a sleeping worker
+  if (parked_count.load() > 0)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(park_mutex);
+    }
+    park_cv.notify_one();
+  }
+  if (shutdown.load())
+  {
+    NotifyAll();
+  }
+  return true;
+}
+
+bool DynamicThreadPoolImpl::SpawnWorker(SmallTask& task)
+{
+  const std::lock_guard<std::mutex> lock(spawn_mutex);
+
+  const size_t index = worker_count.load();
+  if (index >= capacity)
+  {
+    return false;
+  }
+
+  // The new worker starts with the task in its own queue
+  auto worker   = std::make_unique<Worker>();
+  worker->index = index;
+  worker->tasks.push_back(std::move(task));
+
+  Worker* const worker_ptr = worker.get();
+  workers.push_back(std::move(worker));
+  worker_slots[index].store(worker_ptr, std::memory_order_release);
+  worker_count.store(index + 1, std::memory_order_release);
+
+  worker_ptr->thread = std::thread([this, worker_ptr]() { WorkerLoop(worker_ptr); });
+  return true;
+}
+
+void DynamicThreadPoolImpl::WorkerLoop(Worker* self)
 {
-  std::unique_lock<std::mutex> const lock(mutex);
+  current_pool   = this;
+  current_worker = self;
+
+  // New workers are counted as busy, as they have been spawned for a task
+  bool      idle = false;
+  SmallTask task;
+
+  while (true)
+  {
+    bool got_task = TryGetTask(self, task);
+
+    if (!got_task)
+    {
+      if (!idle)
+      {
+        idle_count.fetch_add(1);
+        idle = true;
+      }
+      got_task = SpinForTask(self, task);
+    }
+
+    if (got_task)
+    {
+      if (idle)
+      {
+        idle_count.fetch_sub(1);
+        idle = false;
+      }
 
-  if (shutdown)
+      // Execute the task outside of any lock
+      task();
+      task.reset();
+      continue;
+    }
+
+    if (IsFinished())
+    {
+      break;
+    }
+
+    // Nothing to do, go to sleep until new tasks arrive
+    std::unique_lock<std::mutex> lock(park_mutex);
+    parked_count.fetch_add(1);
+    park_cv.wait(lock, [this]() { return (queued_count.load() > 0) || IsFinished(); });
+    parked_count.fetch_sub(1);
+  }
+
+  current_pool   = nullptr;
+  current_worker = nullptr;
+}
+
+bool DynamicThreadPoolImpl::TryPop(Worker* worker, SmallTask& task)
+{
   {
+    const std::lock_guard<std::mutex> lock(worker->mutex);
+    if (worker->tasks.empty())
+    {
       return false;
+    }
+    task = std::move(worker->tasks.front());
+    worker->tasks.pop_front();
   }
 
-  // Add the task to the queue
-  tasks.push(task);
-
-  // If there are idle workers, notify one of them
-  if (idle_count > 0)
-  {
-    cv.notify_one();
-  }
-  // If no idle workers and we can create more, spawn a new worker
-  else if (max_size == 0 || (workers.size() < max_size))
-  {
-    workers.emplace_back([this]()
-                          {
-                            while (true)
-                            {
-                              std::function<void()> current_task;
-                              {
-                                std::unique_lock<std::mutex> lock(mutex);
-                                
-                                // Wait for a task or shutdown signal
-                                idle_count++;
-                                cv.wait(lock, [this]() { return !tasks.empty() || shutdown; });
-                                idle_count--;
-                                
-                                if (shutdown && tasks.empty())
-                                {
-                                  return;
-                                }
-
-                                // Get the next task
-                                current_task = tasks.front();
-                                tasks.pop();
-                              }
-
-                              // Execute the task outside the lock
-                              current_task();
-                            }
-                          });
+  // Wake up the remaining workers, when the last task has been taken after shutdown
+  if ((queued_count.fetch_sub(1) == 1) && shutdown.load())
+  {
+    NotifyAll();
   }
   return true;
 }
 
-void DynamicThreadPoolImpl::Shutdown()
+bool DynamicThreadPoolImpl::TryGetTask(Worker* self, SmallTask& task)
+{
+  // Own queue first
+  if (TryPop(self, task))
+  {
+    return true;
+  }
+
+  // Steal from the other workers, starting with the next neighbour
+  const size_t count = worker_count.load(std::memory_order_acquire);
+  for (size_t i = 1; i < count; ++i)
+  {
+    if (queued_count.load(std::memory_order_relaxed) <= 0)
+    {
+      return false;
+    }
+
+    Worker* const victim = worker_slots[(self->index + i) % count].load(std::memory_order_acquire);
+    if ((victim != nullptr) && TryPop(victim, task))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool DynamicThreadPoolImpl::SpinForTask(Worker* self, SmallTask& task)
+{
+  for (unsigned int i = 0; i < self->spin_budget; ++i)
+  {
+    if ((queued_count.load(std::memory_order_relaxed) > 0) && TryGetTask(self, task))
+    {
+      // Spinning paid off, spin longer next time
+      self->spin_budget = std::min(self->spin_budget * 2, spin_budget_max);
+      return true;
+    }
+    if (shutdown.load(std::memory_order_relaxed))
+    {
+      break;
+    }
+    std::this_thread::yield();
+  }
+
+  self->spin_budget = std::max(self->spin_budget / 2, spin_budget_min);
+  return false;
+}
+
+bool DynamicThreadPoolImpl::IsFinished() const
+{
+  return shutdown.load() && (posting_count.load() == 0) && (queued_count.load() <= 0);
+}
+
+void DynamicThreadPoolImpl::NotifyAll()
 {
   {
-    std::unique_lock<std::mutex> const lock(mutex);
-    shutdown = true;
-    cv.notify_all();
+    const std::lock_guard<std::mutex> lock(park_mutex);
   }
+  park_cv.notify_all();
+}
+
+void DynamicThreadPoolImpl::Shutdown()
+{
+  shutdown = true;
+  NotifyAll();
 }
 
 void DynamicThreadPoolImpl::Join()
 {
   assert(shutdown && "Shutdown must be called before Join");
 
-  // Join all worker threads
-  for (std::thread& worker : workers)
+  // Join all worker threads. Posts that were in flight while shutting down
+  // may still spawn workers, so repeat until no new workers show up.
+  size_t joined = 0;
+  while (true)
   {
-    if (worker.joinable())
+    std::vector<std::thread*> threads_to_join;
     {
-      worker.join();
+      const std::lock_guard<std::mutex> lock(spawn_mutex);
+      for (size_t i = joined; i < workers.size(); ++i)
+      {
+        threads_to_join.push_back(&workers[i]->thread);
+      }
     }
+    if (threads_to_join.empty())
+    {
+      break;
+    }
+
+    for (std::thread* worker_thread : threads_to_join)
+    {
+      if (worker_thread->joinable())
+      {
+        worker_thread->join();
+      }
+    }
+    joined += threads_to_join.size();
   }
 
-  // Clear workers vector
+  // Clear workers
+  const std::lock_guard<std::mutex> lock(spawn_mutex);
+  for (size_t i = 0; i < workers.size(); ++i)
+  {
+    worker_slots[i].store(nullptr, std::memory_order_relaxed);
+  }
   workers.clear();
+  worker_count = 0;
+  idle_count   = 0;
 }
 
 size_t DynamicThreadPoolImpl::GetSize() const
 {
-  std::unique_lock<std::mutex> const lock(mutex);
-  return workers.size();
+  return worker_count.load();
 }
 
 size_t DynamicThreadPoolImpl::GetMaxSize() const
@@ -127,6 +327,5 @@ size_t DynamicThreadPoolImpl::GetMaxSize() const
 
 size_t DynamicThreadPoolImpl::GetIdleCount() const
 {
-  std::unique_lock<std::mutex> const lock(mutex);
-  return idle_count;
+  return static_cast<size_t>(std::max<int64_t>(idle_count.load(), 0));
 }
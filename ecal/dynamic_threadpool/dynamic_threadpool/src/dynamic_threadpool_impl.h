@@ -19,11 +19,15 @@
 
 #pragma once
 
+#include <dynamic_threadpool/small_task.h>
+
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -41,7 +45,7 @@ public:
   DynamicThreadPoolImpl(DynamicThreadPoolImpl&&) = delete;
   DynamicThreadPoolImpl& operator=(DynamicThreadPoolImpl&&) = delete;
 
-  bool Post(const std::function<void()>& task_);
+  bool Post(SmallTask&& task_);
 
   size_t GetSize() const;
   size_t GetMaxSize() const;
@@ -51,12 +55,50 @@ public:
   void Join();
 
 private:
-  mutable std::mutex      mutex;
-  std::condition_variable cv;
-
-  std::vector<std::thread>          workers;
-  size_t                            max_size   = 0;
-  size_t                            idle_count = 0;
-  bool                              shutdown   = false;
-  std::queue<std::function<void()>> tasks;
-};
\ No newline at end of file
+  // Spin budget (in iterations) of an idle worker before it goes to sleep.
+  // The budget adapts between min and max depending on whether spinning paid off.
+  static constexpr unsigned int spin_budget_min = 16;
+  static constexpr unsigned int spin_budget_max = 2048;
+
+  struct Worker
+  {
+    size_t                index = 0;
+    std::mutex            mutex;  // only contended by stealing workers
+    std::deque<SmallTask> tasks;
+    std::thread           thread;
+    unsigned int          spin_budget = spin_budget_min;
+  };
+
+  // worker (and its pool) of the calling thread, tasks posted from within a
+  // task are pushed to the own queue
+  static thread_local const DynamicThreadPoolImpl* current_pool;
+  static thread_local Worker*                      current_worker;
+
+  bool SpawnWorker(SmallTask& task_);
+  void WorkerLoop(Worker* self_);
+  bool TryPop(Worker* worker_, SmallTask& task_);
+  bool TryGetTask(Worker* self_, SmallTask& task_);
+  bool SpinForTask(Worker* self_, SmallTask& task_);
+  bool IsFinished() const;
+  void NotifyAll();
+
+  const size_t                                max_size   = 0;
+  const size_t                                capacity;       // max_size or DynamicThreadPool::default_max_size
+
+  // worker table, slots [0, worker_count) are valid
+  std::unique_ptr<std::atomic<Worker*>[]>     worker_slots;
+  std::atomic<size_t>                         worker_count { 0 };
+  std::vector<std::unique_ptr<Worker>>        workers;        // owned workers, guarded by spawn_mutex
+  std::mutex                                  spawn_mutex;
+
+  std::atomic<int64_t>                        queued_count { 0 };   // tasks posted but not yet taken by a worker
+  std::atomic<int64_t>                        idle_count   { 0 };   // workers not executing a task
+  std::atomic<int64_t>                        posting_count{ 0 };   // Post() calls in flight
+  std::atomic<size_t>                         next_queue   { 0 };   // round robin target for external posts
+  std::atomic<bool>                           shutdown     { false };
+
+  // parking of idle workers
+  std::mutex                                  park_mutex;
+  std::condition_variable                     park_cv;
+  std::atomic<int64_t>                        parked_count { 0 };
+};
@@ -22,10 +22,15 @@
 #include <gtest/gtest.h>
 #include "atomic_signalable.h"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
+#include <functional>
+#include <future>
 #include <memory>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <ecal_utils/barrier.h>
 
@@ -188,6 +193,43 @@ TEST(DynamicThreadPool, MaxSize)
 }
 #endif
 
+#if 1
+// A pool without a maximum size grows up to the default maximum size and queues further tasks
+TEST(DynamicThreadPool, DefaultMaxSize)
+{
+  constexpr int number_of_tasks = static_cast<int>(DynamicThreadPool::default_max_size) + 8;
+
+  DynamicThreadPool thread_pool;
+  atomic_signalable<int> started_tasks(0);
+  atomic_signalable<int> finished_tasks(0);
+  std::promise<void> release_promise;
+  const std::shared_future<void> release = release_promise.get_future().share();
+
+  for (int i = 0; i < number_of_tasks; i++)
+  {
+    thread_pool.Post([&started_tasks, &finished_tasks, release]()
+                      {
+                        started_tasks++;
+                        release.wait();
+                        finished_tasks++;
+                      });
+  }
+
+  started_tasks.wait_for([](int val) { return val >= static_cast<int>(DynamicThreadPool::default_max_size); }, std::chrono::seconds(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(started_tasks.get(),   static_cast<int>(DynamicThreadPool::default_max_size));
+  EXPECT_EQ(thread_pool.GetSize(), DynamicThreadPool::default_max_size);
+
+  // The queued tasks are executed as soon as the threads are free again
+  release_promise.set_value();
+  finished_tasks.wait_for([number_of_tasks](int val) { return val >= number_of_tasks; }, std::chrono::seconds(10));
+
+  EXPECT_EQ(finished_tasks.get(),  number_of_tasks);
+  EXPECT_EQ(thread_pool.GetSize(), DynamicThreadPool::default_max_size);
+}
+#endif
+
 #if 1
 // Shutdown while tasks are running
 TEST(DynamicThreadPool, Shutdown)
@@ -269,3 +311,86 @@ TEST(DynamicThreadPool, StressTest)
   EXPECT_EQ(thread_pool.GetSize(), thread_pool.GetIdleCount()); // All workers are idle
 }
 #endif
+
+#if 1
+// Post from multiple threads and from within tasks (tasks go to the own queue and get stolen by idle workers)
+TEST(DynamicThreadPool, MultiProducerStressTest)
+{
+  constexpr int number_of_producers      = 4;
+  constexpr int tasks_per_producer       = 25'000;
+  constexpr int number_of_tasks          = number_of_producers * tasks_per_producer * 2;
+  constexpr unsigned int max_pool_size   = 4;
+
+  DynamicThreadPool thread_pool(max_pool_size);
+  atomic_signalable<int> finished_tasks(0);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < number_of_producers; p++)
+  {
+    producers.emplace_back([&thread_pool, &finished_tasks]()
+                            {
+                              for (int i = 0; i < tasks_per_producer; i++)
+                              {
+                                thread_pool.Post([&thread_pool, &finished_tasks]()
+                                                  {
+                                                    // Nested post from a worker thread
+                                                    thread_pool.Post([&finished_tasks]() { finished_tasks++; });
+                                                    finished_tasks++;
+                                                  });
+                              }
+                            });
+  }
+  for (auto& producer : producers)
+  {
+    producer.join();
+  }
+
+  finished_tasks.wait_for([number_of_tasks](int val) { return val >= number_of_tasks; }, std::chrono::seconds(10));
+  EXPECT_EQ(finished_tasks.get(), number_of_tasks);
+  EXPECT_LE(thread_pool.GetSize(), max_pool_size);
+}
+#endif
+
+#if 1
+// Tasks with large captures and move-only captures
+TEST(DynamicThreadPool, SmallTask)
+{
+  // Small callables are stored inline, large ones on the heap
+  {
+    int counter = 0;
+    SmallTask small_task([&counter]() { counter++; });
+    EXPECT_TRUE(static_cast<bool>(small_task));
+
+    std::array<char, 1024> big_payload{};
+    big_payload[1023] = 1;
+    SmallTask big_task([&counter, big_payload]() { counter += big_payload[1023]; });
+
+    SmallTask moved_task(std::move(big_task));
+    EXPECT_FALSE(static_cast<bool>(big_task)); // NOLINT(bugprone-use-after-move, clang-analyzer-cplusplus.Move)
+
+    small_task();
+    moved_task();
+    EXPECT_EQ(counter, 2);
+
+    small_task.reset();
+    EXPECT_FALSE(static_cast<bool>(small_task));
+  }
+
+  // Move-only captures can be posted directly
+  {
+    DynamicThreadPool thread_pool;
+    atomic_signalable<int> result(0);
+
+    auto value = std::make_unique<int>(42);
+    EXPECT_TRUE(thread_pool.Post([&result, value = std::move(value)]() { result = *value; }));
+
+    // std::function still works as before
+    const std::function<void()> function_task = [&result]() { result++; };
+    result.wait_for([](int val) { return val == 42; }, std::chrono::milliseconds(1000));
+    EXPECT_TRUE(thread_pool.Post(function_task));
+
+    result.wait_for([](int val) { return val == 43; }, std::chrono::milliseconds(1000));
+    EXPECT_EQ(result.get(), 43);
+  }
+}
+#endif
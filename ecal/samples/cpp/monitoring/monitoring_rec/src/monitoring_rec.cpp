@@ -189,6 +189,9 @@ int main()
           case eCAL::pb::eTransportLayerType::tl_ecal_tcp:
             layer_type = "tlayer_tcp";
             break;
+          case eCAL::pb::eTransportLayerType::tl_ecal_inproc:
+            layer_type = "tlayer_inproc";
+            break;
           case eCAL::pb::eTransportLayerType::tl_all:
             layer_type = "tlayer_all";
             break;
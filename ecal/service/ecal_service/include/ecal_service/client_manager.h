@@ -144,7 +144,7 @@ namespace ecal_service
      * The new Client Session will be managed by the ClientManager and can be
      * stopped from this central place.
      * 
-     * @param protocol_version  The protocol version to use for the client session. If 0, the legacy buggy protocol will be used.
+     * @param protocol_version  The highest protocol version to offer to the server. Since version 2 multiple service calls can be in flight at the same time.
      * @param server_list       A list of endpoints to connect to. Must not be empty. The endpoints will be tried in the given order until a working endpoint is found.
      * @param response_callback_executor_function The callback executor function used for responses. Can be used e.g. to execute the response callback in a different thread.
      * @param event_callback    The callback, that will be called, when the client has connected to the server or disconnected from it. The callback will be executed in the io_context thread.
@@ -156,6 +156,23 @@ namespace ecal_service
                                                 , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                                                 , const ClientSession::EventCallbackT&                      event_callback);
 
+    /**
+     * @brief Creates a new managed ClientSession for a server with a known process id
+     *
+     * If the server runs on the same host, the client connects to its local
+     * stream socket, whose name contains the server's process id, and falls
+     * back to TCP if that fails. With a process id of 0, only TCP is used.
+     *
+     * @param server_process_id The process id of the server or 0, if it is not known.
+     *
+     * See the other overload for all other parameters.
+     */
+    std::shared_ptr<ClientSession> create_client(std::uint8_t                                               protocol_version
+                                                , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                , std::int32_t                                              server_process_id
+                                                , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
+                                                , const ClientSession::EventCallbackT&                      event_callback);
+
     /**
      * @brief Returns the number of managed client sessions
      * 
@@ -133,7 +133,7 @@ namespace ecal_service
      * =========================================================================
      * 
      * @param io_context        The io_context to use for the session and all callbacks.
-     * @param protocol_version  The protocol version to use for the session. When this is 0, the legacy buggy protocol is used.
+     * @param protocol_version  The highest protocol version to offer to the server. The server may choose a lower one. Since version 2 multiple service calls can be in flight at the same time.
      * @param server_list       A list of endpoints to connect to. Must not be empty. The endpoints will be tried in the given order until a working endpoint is found.
      * @param event_callback    The callback to be called when the session's state changes, i.e. when the session successfully connected to a server or disconnected from it.
      * @param logger            The logger to use for logging.
@@ -163,10 +163,41 @@ namespace ecal_service
                                                 , const EventCallbackT&                                     event_callback
                                                 , const DeleteCallbackT&                                    delete_callback);
 
+    /**
+     * @brief Creates a new ClientSession instance for a server with a known process id.
+     *
+     * On non-Windows systems, servers additionally listen on a local stream
+     * socket, whose name contains the process id of the server. If the
+     * process id is known (e.g. from the eCAL registration) and a server is
+     * on the same host, the client connects to that socket and falls back to
+     * TCP if that fails. With a process id of 0, only TCP is used.
+     *
+     * @param server_process_id The process id of the server or 0, if it is not known.
+     *
+     * See the other overloads for all other parameters.
+     */
+    static std::shared_ptr<ClientSession> create(const std::shared_ptr<asio::io_context>&                   io_context
+                                                , std::uint8_t                                              protocol_version
+                                                , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                , std::int32_t                                              server_process_id
+                                                , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
+                                                , const EventCallbackT&                                     event_callback
+                                                , const LoggerT&                                            logger
+                                                , const DeleteCallbackT&                                    delete_callback);
+
+    static std::shared_ptr<ClientSession> create(const std::shared_ptr<asio::io_context>&                   io_context
+                                                , std::uint8_t                                              protocol_version
+                                                , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                , std::int32_t                                              server_process_id
+                                                , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
+                                                , const EventCallbackT&                                     event_callback
+                                                , const LoggerT&                                            logger = default_logger("Service Client"));
+
   protected:
     ClientSession(const std::shared_ptr<asio::io_context>&                    io_context
                   , std::uint8_t                                              protocol_version
                   , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                  , std::int32_t                                              server_process_id
                   , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                   , const EventCallbackT&                                     event_callback
                   , const LoggerT&                                            logger);
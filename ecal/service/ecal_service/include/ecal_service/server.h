@@ -105,7 +105,7 @@ namespace ecal_service
      * =========================================================================
      * 
      * @param io_context                         The io_context to use for the server and event callbacks
-     * @param protocol_version                   The protocol version to use. When this is 0, the buggy protocol version 0 will be used.
+     * @param protocol_version                   The highest protocol version to offer to clients. Clients may choose a lower one. Since version 2 service calls of a single client are executed in parallel.
      * @param port                               The port to listen on. When this is 0, the OS will chose a free port.
      * @param service_callback                   The callback to use for service calls. Will be executed using the post_to_service_callback_executor function.
      * @param post_to_service_callback_executor  A function that can be used to post the service callback to a different thread or threadpool.
@@ -132,7 +132,7 @@ namespace ecal_service
      * server (and all other servers, that have been created by this manager)
      * can be stopped via the stop() method.
      * 
-     * @param protocol_version                   The protocol version, that will be used by this server
+     * @param protocol_version                   The highest protocol version offered by this server
      * @param port                               The port, that the server will listen on. If 0, the OS will choose a free port.
      * @param service_callback                   The callback, that will be called for each incoming service call. The callback will be executed by using the post_to_service_callback_executor.
      * @param post_to_service_callback_executor  A function, that is used to execute the service_callback. Can be used to e.g. post the service callback to a different thread or threadpool.
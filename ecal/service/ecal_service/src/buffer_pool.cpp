@@ -0,0 +1,122 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "buffer_pool.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace ecal_service
+{
+  std::shared_ptr<BufferPool> BufferPool::create(std::size_t max_pooled_buffers, std::size_t max_pooled_bytes)
+  {
+    return std::shared_ptr<BufferPool>(new BufferPool(max_pooled_buffers, max_pooled_bytes));
+  }
+
+  BufferPool::BufferPool(std::size_t max_pooled_buffers, std::size_t max_pooled_bytes)
+    : max_pooled_buffers_(max_pooled_buffers)
+    , max_pooled_bytes_  (max_pooled_bytes)
+    , pooled_bytes_      (0)
+  {}
+
+  std::shared_ptr<std::string> BufferPool::get_buffer(std::size_t size)
+  {
+    std::unique_ptr<std::string> buffer;
+
+    {
+      const std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+      if (!pooled_buffers_.empty())
+      {
+        // Prefer the smallest buffer that is large enough. If there is none,
+        // take the largest one, as it needs the smallest re-allocation.
+        // The final size of an empty buffer is unknown, so it gets the
+        // largest one as well.
+        auto best_it = pooled_buffers_.begin();
+        for (auto it = pooled_buffers_.begin(); it != pooled_buffers_.end(); ++it)
+        {
+          const std::size_t capacity      = (*it)->capacity();
+          const std::size_t best_capacity = (*best_it)->capacity();
+
+          if ((size > 0) && (best_capacity >= size))
+          {
+            if ((capacity >= size) && (capacity < best_capacity))
+              best_it = it;
+          }
+          else if (capacity > best_capacity)
+          {
+            best_it = it;
+          }
+        }
+
+        buffer = std::move(*best_it);
+        pooled_bytes_ -= buffer->capacity();
+        *best_it = std::move(pooled_buffers_.back());
+        pooled_buffers_.pop_back();
+      }
+    }
+
+    if (!buffer)
+    {
+      buffer = std::make_unique<std::string>();
+    }
+
+    // Only the bytes beyond the previous size get initialized. Neither
+    // resizing nor clearing releases the capacity of the string.
+    buffer->resize(size);
+
+    const std::weak_ptr<BufferPool> weak_pool = shared_from_this();
+    return std::shared_ptr<std::string>(buffer.release()
+                                      , [weak_pool](std::string* buffer_to_return)
+                                        {
+                                          std::unique_ptr<std::string> owned_buffer(buffer_to_return);
+                                          const std::shared_ptr<BufferPool> pool = weak_pool.lock();
+                                          if (pool)
+                                            pool->return_buffer(std::move(owned_buffer));
+                                        });
+  }
+
+  std::size_t BufferPool::get_pooled_buffer_count() const
+  {
+    const std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+    return pooled_buffers_.size();
+  }
+
+  std::size_t BufferPool::get_pooled_bytes() const
+  {
+    const std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+    return pooled_bytes_;
+  }
+
+  void BufferPool::return_buffer(std::unique_ptr<std::string> buffer)
+  {
+    const std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+
+    // Buffers that don't fit into the pool anymore are just deleted
+    if ((pooled_buffers_.size() < max_pooled_buffers_)
+      && (pooled_bytes_ + buffer->capacity() <= max_pooled_bytes_))
+    {
+      pooled_bytes_ += buffer->capacity();
+      pooled_buffers_.push_back(std::move(buffer));
+    }
+  }
+} // namespace ecal_service
@@ -0,0 +1,96 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ecal_service
+{
+  /**
+   * @brief Pool of reusable payload buffers
+   *
+   * Buffers are handed out as shared_ptr and automatically return to the pool
+   * when the last reference is released (even if that happens in another
+   * thread). A returned buffer keeps its memory, so receiving a payload of a
+   * similar size as before does not allocate new memory.
+   *
+   * Buffers that outlive the pool are just deleted.
+   */
+  class BufferPool : public std::enable_shared_from_this<BufferPool>
+  {
+  public:
+    // Every session owns a pool. The number of buffers is kept low, but each of
+    // them may hold a large payload (e.g. a map of several MB), as those are
+    // the calls that benefit the most from re-using memory. A pool only grows
+    // that large if the session has actually transferred such payloads.
+    static constexpr std::size_t default_max_pooled_buffers = 4;                                                //!< Default maximum number of idle buffers kept in a pool
+    static constexpr std::size_t default_max_pooled_bytes   = default_max_pooled_buffers * 16 * 1024 * 1024;  //!< Default maximum sum of the capacity of all idle buffers kept in a pool (4 buffers of 16 MiB)
+
+    /**
+     * @brief Create a new buffer pool
+     *
+     * @param max_pooled_buffers   Maximum number of idle buffers kept in the pool
+     * @param max_pooled_bytes     Maximum sum of the capacity of all idle buffers kept in the pool
+     */
+    static std::shared_ptr<BufferPool> create(std::size_t max_pooled_buffers = default_max_pooled_buffers, std::size_t max_pooled_bytes = default_max_pooled_bytes);
+
+  protected:
+    BufferPool(std::size_t max_pooled_buffers, std::size_t max_pooled_bytes);
+
+  public:
+    // Delete copy / move constructor and assignment operator
+    BufferPool(const BufferPool&)            = delete;
+    BufferPool(BufferPool&&)                 = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    BufferPool& operator=(BufferPool&&)      = delete;
+
+    ~BufferPool() = default;
+
+    /**
+     * @brief Get a buffer of exactly the given size
+     *
+     * The content of the buffer is unspecified, it may contain data of
+     * previous usages.
+     *
+     * A buffer of size 0 is meant to be filled by the caller, e.g. with a
+     * service response of unknown size. It is the largest pooled buffer,
+     * cleared but with its capacity kept.
+     */
+    std::shared_ptr<std::string> get_buffer(std::size_t size);
+
+    std::size_t get_pooled_buffer_count() const;
+    std::size_t get_pooled_bytes() const;
+
+  private:
+    void return_buffer(std::unique_ptr<std::string> buffer);
+
+    const std::size_t                         max_pooled_buffers_;
+    const std::size_t                         max_pooled_bytes_;
+
+    mutable std::mutex                        pool_mutex_;
+    std::vector<std::unique_ptr<std::string>> pooled_buffers_;  //!< Idle buffers. Protected by pool_mutex_.
+    std::size_t                               pooled_bytes_;    //!< Sum of the capacity of all idle buffers. Protected by pool_mutex_.
+  };
+} // namespace ecal_service
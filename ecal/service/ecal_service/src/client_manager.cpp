@@ -63,6 +63,15 @@ namespace ecal_service
                                                              , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
                                                              , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                                                              , const ClientSession::EventCallbackT&                      event_callback)
+  {
+    return create_client(protocol_version, server_list, 0, response_callback_executor_function, event_callback);
+  }
+
+  std::shared_ptr<ClientSession> ClientManager::create_client(std::uint8_t                                               protocol_version
+                                                             , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                             , std::int32_t                                              server_process_id
+                                                             , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
+                                                             , const ClientSession::EventCallbackT&                      event_callback)
   {
     const std::lock_guard<std::mutex> lock(client_manager_mutex_);
     if (stopped_)
@@ -81,7 +90,7 @@ namespace ecal_service
       }
     };
 
-    auto client = ClientSession::create(io_context_, protocol_version, server_list, response_callback_executor_function, event_callback, logger_, deleter);
+    auto client = ClientSession::create(io_context_, protocol_version, server_list, server_process_id, response_callback_executor_function, event_callback, logger_, deleter);
     sessions_.emplace(client.get(), client);
     return client;
   }
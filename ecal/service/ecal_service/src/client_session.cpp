@@ -53,7 +53,7 @@ namespace ecal_service
       delete session; // NOLINT(cppcoreguidelines-owning-memory)
     };
 
-    return std::shared_ptr<ClientSession>(new ClientSession(io_context, protocol_version, server_list,response_callback_executor_function, event_callback, logger), deleter);
+    return ClientSession::create(io_context, protocol_version, server_list, 0, response_callback_executor_function, event_callback, logger, delete_callback);
   }
 
   std::shared_ptr<ClientSession> ClientSession::create(const std::shared_ptr<asio::io_context>&                   io_context
@@ -63,7 +63,7 @@ namespace ecal_service
                                                       , const EventCallbackT&                                     event_callback
                                                       , const LoggerT&                                            logger)
   {
-    return std::shared_ptr<ClientSession>(new ClientSession(io_context, protocol_version, server_list,response_callback_executor_function, event_callback, logger));
+    return ClientSession::create(io_context, protocol_version, server_list, 0, response_callback_executor_function, event_callback, logger);
   }
 
   std::shared_ptr<ClientSession> ClientSession::create(const std::shared_ptr<asio::io_context>&                  io_context
@@ -76,15 +76,46 @@ namespace ecal_service
     return ClientSession::create(io_context, protocol_version, server_list, response_callback_executor_function, event_callback, default_logger("Service Client"), delete_callback);
   }
 
+  std::shared_ptr<ClientSession> ClientSession::create(const std::shared_ptr<asio::io_context>&                   io_context
+                                                      , std::uint8_t                                              protocol_version
+                                                      , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                      , std::int32_t                                              server_process_id
+                                                      , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
+                                                      , const EventCallbackT&                                     event_callback
+                                                      , const LoggerT&                                            logger
+                                                      , const DeleteCallbackT&                                    delete_callback)
+  {
+    auto deleter = [delete_callback](ClientSession* session)
+    {
+      delete_callback(session);
+      delete session; // NOLINT(cppcoreguidelines-owning-memory)
+    };
+
+    return std::shared_ptr<ClientSession>(new ClientSession(io_context, protocol_version, server_list, server_process_id, response_callback_executor_function, event_callback, logger), deleter);
+  }
+
+  std::shared_ptr<ClientSession> ClientSession::create(const std::shared_ptr<asio::io_context>&                   io_context
+                                                      , std::uint8_t                                              protocol_version
+                                                      , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                      , std::int32_t                                              server_process_id
+                                                      , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
+                                                      , const EventCallbackT&                                     event_callback
+                                                      , const LoggerT&                                            logger)
+  {
+    return std::shared_ptr<ClientSession>(new ClientSession(io_context, protocol_version, server_list, server_process_id, response_callback_executor_function, event_callback, logger));
+  }
+
   ClientSession::ClientSession(const std::shared_ptr<asio::io_context>&                   io_context
-                              , std::uint8_t                                              /*protocol_version*/
+                              , std::uint8_t                                              protocol_version
                               , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                              , std::int32_t                                              server_process_id
                               , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                               , const EventCallbackT&                                     event_callback
                               , const LoggerT&                                            logger)
   {
-    // we support v1 protocol only
-    impl_ = ClientSessionV1::create(io_context, server_list, response_callback_executor_function, event_callback, logger);
+    // The V1 session implementation handles all protocol versions >= 1. The
+    // protocol version is the highest one that is offered to the server.
+    impl_ = ClientSessionV1::create(io_context, protocol_version, server_list, server_process_id, response_callback_executor_function, event_callback, logger);
   }
 
   ClientSession::~ClientSession()
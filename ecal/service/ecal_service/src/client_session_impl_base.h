@@ -36,6 +36,8 @@
 
 #include <ecal_service/state.h>
 
+#include "endpoint_helpers.h"
+
 namespace ecal_service
 {
   class ClientSessionBase
@@ -86,7 +88,7 @@ namespace ecal_service
   /////////////////////////////////////
   protected:
     const std::shared_ptr<asio::io_context>  io_context_;
-    asio::ip::tcp::socket                    socket_;
+    SocketT                                  socket_;
     mutable std::mutex                       socket_mutex_;
     const EventCallbackT                     event_callback_;
 
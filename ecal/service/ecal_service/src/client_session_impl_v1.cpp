@@ -26,12 +26,14 @@
 #include "log_helpers.h"
 #include "log_defs.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -57,12 +59,14 @@ namespace ecal_service
   // Constructor, Destructor, Create
   /////////////////////////////////////
   std::shared_ptr<ClientSessionV1> ClientSessionV1::create(const std::shared_ptr<asio::io_context>&                   io_context
+                                                          , std::uint8_t                                              max_protocol_version
                                                           , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                          , std::int32_t                                              server_process_id
                                                           , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                                                           , const EventCallbackT&                                     event_callback
                                                           , const LoggerT&                                            logger)
   {
-    std::shared_ptr<ClientSessionV1> instance(new ClientSessionV1(io_context, server_list, response_callback_executor_function, event_callback, logger));
+    std::shared_ptr<ClientSessionV1> instance(new ClientSessionV1(io_context, max_protocol_version, server_list, server_process_id, response_callback_executor_function, event_callback, logger));
 
     // Throw exception, if the server list is empty
     if (server_list.empty())
@@ -70,26 +74,32 @@ namespace ecal_service
       throw std::invalid_argument("Server list must not be empty");
     }
 
-    instance->resolve_endpoint(0);
+    instance->connect_to_server(0);
 
     return instance;
   }
 
   ClientSessionV1::ClientSessionV1(const std::shared_ptr<asio::io_context>&                   io_context
+                                  , std::uint8_t                                              max_protocol_version
                                   , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                  , std::int32_t                                              server_process_id
                                   , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                                   , const EventCallbackT&                                     event_callback
                                   , const LoggerT&                                            logger)
     : ClientSessionBase(io_context, event_callback)
+    , max_protocol_version_               (std::min(std::max(max_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION), MAX_SUPPORTED_PROTOCOL_VERSION))
     , server_list_                        (server_list)
+    , server_process_id_                  (server_process_id)
     , response_callback_executor_function_(response_callback_executor_function)
     , service_call_queue_strand_          (*io_context)
     , resolver_                           (*io_context)
     , logger_                             (logger)
+    , buffer_pool_                        (BufferPool::create())
     , accepted_protocol_version_          (0)
     , state_                              (State::NOT_CONNECTED)
     , stopped_by_user_                    (false)
     , service_call_in_progress_           (false)
+    , next_request_id_                    (1)
   {
     ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Created");
   }
@@ -103,6 +113,59 @@ namespace ecal_service
   //////////////////////////////////////
   // Connection establishement
   //////////////////////////////////////
+  void ClientSessionV1::connect_to_server(size_t server_list_index)
+  {
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    // Servers on the same host can be reached via a local stream socket,
+    // which is faster than going through the loopback TCP stack. Its name
+    // contains the process id of the server, so it is only used, if known.
+    if ((server_process_id_ != 0) && is_local_host(server_list_[server_list_index].first))
+    {
+      connect_to_local_endpoint(server_list_index);
+      return;
+    }
+#endif
+    resolve_endpoint(server_list_index);
+  }
+
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+  void ClientSessionV1::connect_to_local_endpoint(size_t server_list_index)
+  {
+    const auto endpoint = get_local_endpoint(server_process_id_, server_list_[server_list_index].second);
+
+    ECAL_SERVICE_LOG_DEBUG(logger_, "Connecting to local endpoint [" + endpoint_to_string(asio::generic::stream_protocol::endpoint(endpoint)) + "]...");
+
+    const std::lock_guard<std::mutex> socket_lock(socket_mutex_);
+    socket_.async_connect(endpoint
+                        , service_call_queue_strand_.wrap([me = shared_from_this(), server_list_index](asio::error_code ec)
+                          {
+                            if (ec)
+                            {
+                              // The server may be an older version or the local socket may
+                              // not be reachable (e.g. a different network namespace).
+                              // Fall back to TCP.
+                              ECAL_SERVICE_LOG_DEBUG(me->logger_, "Failed to connect to local endpoint, falling back to TCP: " + ec.message());
+                              {
+                                const std::lock_guard<std::mutex> socket_lock(me->socket_mutex_);
+                                asio::error_code close_ec;
+                                me->socket_.close(close_ec); // NOLINT(bugprone-unused-return-value) -> we already get the return value from the ec parameter
+                              }
+                              me->resolve_endpoint(server_list_index);
+                              return;
+                            }
+
+                            ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully connected to local endpoint");
+
+                            {
+                              const std::lock_guard<std::mutex> chosen_endpoint_lock(me->chosen_endpoint_mutex_);
+                              me->chosen_endpoint_ = me->server_list_[server_list_index];
+                            }
+
+                            me->send_protocol_handshake_request();
+                          }));
+  }
+#endif
+
   void ClientSessionV1::resolve_endpoint(size_t server_list_index)
   {
     ECAL_SERVICE_LOG_DEBUG(logger_, "Resolving endpoint [" + server_list_[server_list_index].first + ":" + std::to_string(server_list_[server_list_index].second) + "]...");
@@ -124,7 +187,7 @@ namespace ecal_service
                                 if (server_list_index_copy + 1 < me->server_list_.size())
                                 {
                                   // Try next possible endpoint
-                                  me->resolve_endpoint(server_list_index_copy + 1);
+                                  me->connect_to_server(server_list_index_copy + 1);
                                 }
                                 else
                                 {
@@ -150,7 +213,7 @@ namespace ecal_service
                                   std::string endpoints_str = "Resolved endpoints for " + me->server_list_[server_list_index_copy].first + ": ";
                                   for (const auto& endpoint : resolved_endpoints)
                                   {
-                                    endpoints_str += endpoint_to_string(endpoint) + ", ";
+                                    endpoints_str += endpoint_to_string(endpoint.endpoint()) + ", ";
                                   }
                                   ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, endpoints_str);
                                 }
@@ -164,16 +227,16 @@ namespace ecal_service
   {
     // Convert the resolved_endpoints iterator to an endpoint sequence
     // (i.e. a vector of endpoints)
-    auto endpoint_sequence = std::make_shared<std::vector<asio::ip::tcp::endpoint>>();
+    auto endpoint_sequence = std::make_shared<std::vector<asio::generic::stream_protocol::endpoint>>();
     for (const auto& endpoint : resolved_endpoints)
     {
-      endpoint_sequence->push_back(endpoint);
+      endpoint_sequence->push_back(endpoint.endpoint());
     }
 
     const std::lock_guard<std::mutex> socket_lock(socket_mutex_);
     asio::async_connect(socket_
                       , *endpoint_sequence
-                      , service_call_queue_strand_.wrap([me = shared_from_this(), endpoint_sequence, server_list_index](asio::error_code ec, const asio::ip::tcp::endpoint& endpoint)
+                      , service_call_queue_strand_.wrap([me = shared_from_this(), endpoint_sequence, server_list_index](asio::error_code ec, const asio::generic::stream_protocol::endpoint& endpoint)
                         {
                           (void)endpoint;
                           if (ec)
@@ -187,7 +250,7 @@ namespace ecal_service
                             // If there are more servers available, try the next one
                             if (server_list_index + 1 < me->server_list_.size())
                             {
-                              me->resolve_endpoint(server_list_index + 1);
+                              me->connect_to_server(server_list_index + 1);
                             }
                             else
                             {
@@ -207,7 +270,7 @@ namespace ecal_service
                           }
                           else
                           {
-                            ECAL_SERVICE_LOG_DEBUG(me->logger_, "Successfully connected to endpoint [" + endpoint.address().to_string() + ":" + std::to_string(endpoint.port()) + "]");
+                            ECAL_SERVICE_LOG_DEBUG(me->logger_, "Successfully connected to endpoint [" + endpoint_to_string(endpoint) + "]");
 
                             // Disable Nagle's algorithm. Nagles Algorithm will otherwise cause the
                             // Socket to wait for more data, if it encounters a frame that can still
@@ -254,7 +317,7 @@ namespace ecal_service
     payload_buffer->resize(sizeof(ProtocolHandshakeRequestMessage), '\0');
     ProtocolHandshakeRequestMessage* handshake_request_message = reinterpret_cast<ProtocolHandshakeRequestMessage*>(const_cast<char*>(payload_buffer->data()));
     handshake_request_message->min_supported_protocol_version = MIN_SUPPORTED_PROTOCOL_VERSION;
-    handshake_request_message->max_supported_protocol_version = MAX_SUPPORTED_PROTOCOL_VERSION;
+    handshake_request_message->max_supported_protocol_version = max_protocol_version_;
 
     // Fill TCP Header
     header_buffer->package_size_n = htonl(sizeof(ProtocolHandshakeRequestMessage));
@@ -314,7 +377,7 @@ namespace ecal_service
                                 const ProtocolHandshakeResponseMessage* handshake_response = reinterpret_cast<const ProtocolHandshakeResponseMessage*>(payload_buffer->data());
 
                                 if ((handshake_response->accepted_protocol_version >= MIN_SUPPORTED_PROTOCOL_VERSION)
-                                  && (handshake_response->accepted_protocol_version <= MAX_SUPPORTED_PROTOCOL_VERSION))
+                                  && (handshake_response->accepted_protocol_version <= me->max_protocol_version_))
                                 {
                                   {
                                     const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
@@ -328,6 +391,22 @@ namespace ecal_service
                                   // Call event callback
                                   if(me->event_callback_) me->event_callback_(ecal_service::ClientEventType::Connected, message);
 
+                                  if (me->accepted_protocol_version_ >= 2)
+                                  {
+                                    // Protocol V2: We permanently wait for responses. This also
+                                    // notifies us about a connection loss, so there is no need
+                                    // for peeking for errors.
+                                    me->receive_pipelined_service_responses();
+
+                                    const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+                                    if (!me->service_call_queue_.empty())
+                                    {
+                                      me->service_call_in_progress_ = true;
+                                      me->send_next_pipelined_service_request();
+                                    }
+                                    return;
+                                  }
+
                                   // Start sending service requests, if there are any
                                   {
                                     const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
@@ -393,7 +472,18 @@ namespace ecal_service
                                   // If we are  not in failed state, let's check
                                   // whether we directly invoke the call of if we add it to the queue
 
-                                  if (!me->service_call_in_progress_ && (me->state_ == State::CONNECTED))
+                                  if ((me->state_ == State::CONNECTED) && (me->accepted_protocol_version_ >= 2))
+                                  {
+                                    // Protocol V2: Always enqueue the call. If no request is
+                                    // being sent right now, we directly start sending it.
+                                    me->service_call_queue_.push_back(ServiceCall{request, response_callback});
+                                    if (!me->service_call_in_progress_)
+                                    {
+                                      me->service_call_in_progress_ = true;
+                                      me->send_next_pipelined_service_request();
+                                    }
+                                  }
+                                  else if (!me->service_call_in_progress_ && (me->state_ == State::CONNECTED))
                                   {
                                     // Directly call the the service, iff
                                     // 
@@ -484,7 +574,7 @@ namespace ecal_service
   {
     ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Waiting for service response...");
 
-    ecal_service::ProtocolV1::async_receive_payload(socket_, socket_mutex_
+    ecal_service::ProtocolV1::async_receive_payload(socket_, socket_mutex_, buffer_pool_
                           , service_call_queue_strand_.wrap([me = shared_from_this(), response_cb](asio::error_code ec)
                             {
                               const std::string message = "Failed receiving service response: " + ec.message();
@@ -568,6 +658,113 @@ namespace ecal_service
 
   }
 
+  void ClientSessionV1::send_next_pipelined_service_request()
+  {
+    // Must be called with the service_state_mutex_ locked and a non-empty queue
+    const ServiceCall   service_call = std::move(service_call_queue_.front());
+    const std::uint64_t request_id   = next_request_id_++;
+    service_call_queue_.pop_front();
+
+    // Remember the callback before sending, as the response may arrive before
+    // we get notified about the successfull send operation.
+    pending_calls_.emplace(request_id, service_call.response_cb);
+
+    ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Sending service request " + std::to_string(request_id) + "...");
+
+    // Create header_buffer
+    const std::shared_ptr<TcpHeaderV1>  header_buffer  = std::make_shared<TcpHeaderV1>();
+    header_buffer->package_size_n = htonl(static_cast<std::uint32_t>(service_call.request->size()));
+    header_buffer->version        = accepted_protocol_version_;
+    header_buffer->message_type   = MessageType::ServiceRequest;
+    header_buffer->header_size_n  = htons(sizeof(TcpHeaderV1));
+    header_buffer->request_id_n   = ecal_service::ProtocolV1::hton_request_id(request_id);
+
+    ecal_service::ProtocolV1::async_send_payload(socket_, socket_mutex_, header_buffer, service_call.request
+                            , service_call_queue_strand_.wrap([me = shared_from_this()](asio::error_code ec)
+                              {
+                                const std::string message = "Failed sending service request: " + ec.message();
+                                me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                                // The callback of the failed request is already in the pending
+                                // calls, so it will be called with an error just like all others.
+                                me->handle_connection_loss_error(message);
+                              })
+                            , service_call_queue_strand_.wrap([me = shared_from_this()]()
+                              {
+                                ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully sent service request.");
+
+                                const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+                                if (!me->service_call_queue_.empty() && (me->state_ == State::CONNECTED))
+                                {
+                                  me->send_next_pipelined_service_request();
+                                }
+                                else
+                                {
+                                  me->service_call_in_progress_ = false;
+                                }
+                              }));
+  }
+
+  void ClientSessionV1::receive_pipelined_service_responses()
+  {
+    ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Waiting for service response...");
+
+    ecal_service::ProtocolV1::async_receive_payload(socket_, socket_mutex_, buffer_pool_
+                          , service_call_queue_strand_.wrap([me = shared_from_this()](asio::error_code ec)
+                            {
+                              const std::string message = "Connection loss while waiting for service responses: " + ec.message();
+                              me->logger_(ecal_service::LogLevel::Info, "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                              // Calls all pending callbacks with an error
+                              me->handle_connection_loss_error(message);
+                            })
+                          , service_call_queue_strand_.wrap([me = shared_from_this()](const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)
+                            {
+                              TcpHeaderV1* header = reinterpret_cast<TcpHeaderV1*>(header_buffer->data());
+                              if (header->message_type != ecal_service::MessageType::ServiceResponse)
+                              {
+                                const std::string message = "Received invalid service response from server. Expected message type " 
+                                                            + std::to_string(static_cast<std::uint8_t>(ecal_service::MessageType::ServiceResponse)) 
+                                                            + ", but received " + std::to_string(static_cast<std::uint8_t>(header->message_type));
+                                me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                me->handle_connection_loss_error(message);
+                                return;
+                              }
+
+                              // Find the callback that belongs to the response
+                              const std::uint64_t request_id = ecal_service::ProtocolV1::ntoh_request_id(header->request_id_n);
+                              ResponseCallbackT   response_cb;
+                              {
+                                const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+                                auto pending_call_it = me->pending_calls_.find(request_id);
+                                if (pending_call_it != me->pending_calls_.end())
+                                {
+                                  response_cb = std::move(pending_call_it->second);
+                                  me->pending_calls_.erase(pending_call_it);
+                                }
+                              }
+
+                              if (!response_cb)
+                              {
+                                const std::string message = "Received service response for unknown request id " + std::to_string(request_id);
+                                me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                me->handle_connection_loss_error(message);
+                                return;
+                              }
+
+                              ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully received service response " + std::to_string(request_id) + " of " + std::to_string(payload_buffer->size()) + " bytes");
+
+                              // Call the user's callback using the response callback executor
+                              me->response_callback_executor_function_([payload_buffer, response_cb]()
+                                                                      {
+                                                                        response_cb(Error::OK, payload_buffer);
+                                                                      });
+
+                              // Wait for the next response
+                              me->receive_pipelined_service_responses();
+                            }));
+  }
+
   //////////////////////////////////////
   // Status API
   //////////////////////////////////////
@@ -590,10 +787,12 @@ namespace ecal_service
     {
       asio::error_code ec;
       auto endpoint = socket_.remote_endpoint(ec);
-      if (!ec)
-        return endpoint;
-      else
+      if (ec)
         return asio::ip::tcp::endpoint();
+      else if (is_tcp_endpoint(endpoint))
+        return to_tcp_endpoint(endpoint);
+      else
+        return asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), get_port()); // Local stream socket to a server on the same host
     }
   }
   
@@ -678,6 +877,20 @@ namespace ecal_service
 
   void ClientSessionV1::call_all_callbacks_with_error()
   {
+    // Protocol V2: Requests that have already been sent are answered first
+    std::unordered_map<std::uint64_t, ResponseCallbackT> pending_calls;
+    {
+      const std::lock_guard<std::mutex> lock(service_state_mutex_);
+      pending_calls.swap(pending_calls_);
+    }
+    for (const auto& pending_call : pending_calls)
+    {
+      response_callback_executor_function_([response_cb = pending_call.second]()
+                                            {
+                                              response_cb(ecal_service::Error::ErrorCode::CONNECTION_CLOSED, nullptr);
+                                            });
+    }
+
     while(true)
     {
       ServiceCall current_service_call;
@@ -727,7 +940,7 @@ namespace ecal_service
     {
       {
         asio::error_code ec;
-        socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec); // NOLINT(bugprone-unused-return-value) -> we already get the return value from the ec parameter
+        socket_.shutdown(asio::socket_base::shutdown_both, ec); // NOLINT(bugprone-unused-return-value) -> we already get the return value from the ec parameter
       }
 
       {
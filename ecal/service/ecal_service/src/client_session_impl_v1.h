@@ -21,6 +21,7 @@
 #pragma once
 
 #include "client_session_impl_base.h"
+#include "buffer_pool.h"
 
 #include <atomic>
 #include <cstddef>
@@ -29,6 +30,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -59,14 +61,18 @@ namespace ecal_service
   /////////////////////////////////////
   public:
     static std::shared_ptr<ClientSessionV1> create(const std::shared_ptr<asio::io_context>&                   io_context
+                                                  , std::uint8_t                                              max_protocol_version
                                                   , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                                                  , std::int32_t                                              server_process_id
                                                   , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                                                   , const EventCallbackT&                                     event_callback
                                                   , const LoggerT&                                            logger_ = default_logger("Service Client V1"));
 
   protected:
     ClientSessionV1(const std::shared_ptr<asio::io_context>&                  io_context
+                  , std::uint8_t                                              max_protocol_version
                   , const std::vector<std::pair<std::string, std::uint16_t>>& server_list
+                  , std::int32_t                                              server_process_id
                   , const PostToClientResponseCallbackExecutorFunctionT&      response_callback_executor_function
                   , const EventCallbackT&                                     event_callback
                   , const LoggerT&                                            logger);
@@ -85,6 +91,10 @@ namespace ecal_service
   // Connection establishement
   //////////////////////////////////////
   private:
+    void connect_to_server(size_t server_list_index);
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    void connect_to_local_endpoint(size_t server_list_index);
+#endif
     void resolve_endpoint(size_t server_list_index);
     void connect_to_endpoint(const asio::ip::tcp::resolver::results_type& resolved_endpoints, size_t server_list_index);
 
@@ -100,6 +110,11 @@ namespace ecal_service
   private:
     void send_next_service_request(const std::shared_ptr<const std::string>& request, const ResponseCallbackT& response_cb);
     void receive_service_response(const ResponseCallbackT& response_cb);
+
+    // Protocol V2: Requests are sent back to back without waiting for the
+    // responses. Responses are matched to their callbacks by the request id.
+    void send_next_pipelined_service_request();
+    void receive_pipelined_service_responses();
   
   //////////////////////////////////////
   // Status API
@@ -151,9 +166,11 @@ namespace ecal_service
   //////////////////////////////////////
   private:
     static constexpr std::uint8_t MIN_SUPPORTED_PROTOCOL_VERSION = 1;
-    static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 1;
+    static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 2;
 
+    const std::uint8_t                                       max_protocol_version_;  //!< The highest protocol version this client offers to the server.
     const std::vector<std::pair<std::string, std::uint16_t>> server_list_;    //!< The list of servers that this client was created with. They will be tried in order.
+    const std::int32_t                                       server_process_id_; //!< The process id of the server, if known (0 otherwise). It is part of the name of the server's local endpoint.
     
     const PostToClientResponseCallbackExecutorFunctionT response_callback_executor_function_; //!< A function that will be used to execute response callbacks. Can be user-set i.e. for executing the response callback in a different thread.
 
@@ -163,6 +180,7 @@ namespace ecal_service
     asio::io_context::strand  service_call_queue_strand_;
     asio::ip::tcp::resolver   resolver_;
     const LoggerT             logger_;
+    const std::shared_ptr<BufferPool> buffer_pool_;       //!< Buffers for received responses
 
     std::atomic<std::uint8_t> accepted_protocol_version_;
 
@@ -171,6 +189,9 @@ namespace ecal_service
     bool                      stopped_by_user_;           //!< Telling whether we actively stopped the client. Protected by service_state_mutex_. When set, the client will not accept any more async service calls.
 
     std::deque<ServiceCall>   service_call_queue_;
-    bool                      service_call_in_progress_;
+    bool                      service_call_in_progress_;  //!< V1: Waiting for a response. V2: Sending a request. Protected by service_state_mutex_.
+
+    std::uint64_t                                        next_request_id_;  //!< Protocol V2: The id of the next request. Protected by service_state_mutex_.
+    std::unordered_map<std::uint64_t, ResponseCallbackT> pending_calls_;    //!< Protocol V2: Requests that have been sent, but not answered, yet. Protected by service_state_mutex_.
   };
 }
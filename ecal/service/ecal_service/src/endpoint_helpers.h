@@ -0,0 +1,140 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4834)
+#endif
+#include <asio.hpp>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Servers additionally listen on a local stream socket (Unix domain socket)
+// and clients connecting to a server on the same host prefer it over TCP.
+// On Windows the TCP connection is always used.
+#if defined(ASIO_HAS_LOCAL_SOCKETS) && !defined(_WIN32)
+  #define ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED 1
+#else
+  #define ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED 0
+#endif
+
+namespace ecal_service
+{
+  using SocketT = asio::generic::stream_protocol::socket; //!< Socket type of all sessions. May either hold a TCP or a local stream socket.
+
+  inline bool is_tcp_endpoint(const asio::generic::stream_protocol::endpoint& endpoint)
+  {
+    const int family = endpoint.protocol().family();
+    return (family == asio::ip::tcp::v4().family()) || (family == asio::ip::tcp::v6().family());
+  }
+
+  /**
+   * @brief Converts a generic endpoint to a TCP endpoint
+   *
+   * @return The TCP endpoint or a default constructed endpoint, if the given endpoint is not a TCP endpoint
+   */
+  inline asio::ip::tcp::endpoint to_tcp_endpoint(const asio::generic::stream_protocol::endpoint& endpoint)
+  {
+    asio::ip::tcp::endpoint tcp_endpoint;
+    if (is_tcp_endpoint(endpoint) && (endpoint.size() <= tcp_endpoint.capacity()))
+    {
+      std::memcpy(tcp_endpoint.data(), endpoint.data(), endpoint.size());
+      tcp_endpoint.resize(endpoint.size());
+    }
+    return tcp_endpoint;
+  }
+
+  /**
+   * @brief Checks whether the given host name refers to the own host
+   *
+   * Only "localhost" and the own host name are considered local. Literal IP
+   * addresses are treated as an explicit request for a TCP connection.
+   */
+  inline bool is_local_host(const std::string& host)
+  {
+    const auto iequals = [](const std::string& a, const std::string& b)
+                        {
+                          return (a.size() == b.size())
+                              && std::equal(a.begin(), a.end(), b.begin(), [](char ca, char cb) { return std::tolower(static_cast<unsigned char>(ca)) == std::tolower(static_cast<unsigned char>(cb)); });
+                        };
+
+    if (iequals(host, "localhost"))
+      return true;
+
+    asio::error_code ec;
+    const std::string own_host_name = asio::ip::host_name(ec);
+    return !ec && iequals(host, own_host_name);
+  }
+
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+  /**
+   * @brief Returns the process id of the own process, which is part of the local endpoint name of a server
+   */
+  inline std::int32_t get_own_process_id()
+  {
+    return static_cast<std::int32_t>(::getpid());
+  }
+
+  /**
+   * @brief Returns the local stream socket endpoint of a server process listening on the given TCP port
+   *
+   * The name contains both the process id of the server and its TCP port.
+   * The port alone is not sufficient, as a different process (e.g. an
+   * unrelated server in another network namespace sharing the socket
+   * namespace, or a process squatting the name) may own a socket with that
+   * name. Clients know the process id of the server from its registration.
+   * On Linux the abstract socket namespace is used, so no file is created.
+   * Other systems use a socket file in /tmp.
+   */
+  inline asio::local::stream_protocol::endpoint get_local_endpoint(std::int32_t process_id, std::uint16_t port)
+  {
+    const std::string name = "ecal_service_" + std::to_string(process_id) + "_" + std::to_string(port);
+#ifdef __linux__
+    return asio::local::stream_protocol::endpoint(std::string(1, '\0') + name);
+#else
+    return asio::local::stream_protocol::endpoint("/tmp/" + name + ".sock");
+#endif
+  }
+
+  /**
+   * @brief Removes the socket file of a local endpoint (no-op for abstract sockets)
+   */
+  inline void remove_local_endpoint_file(const asio::local::stream_protocol::endpoint& endpoint)
+  {
+    const std::string path = endpoint.path();
+    if (!path.empty() && (path[0] != '\0'))
+      std::remove(path.c_str());
+  }
+#endif // ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+} // namespace ecal_service
@@ -20,15 +20,19 @@
 #pragma once
 
 #include <asio.hpp>
+#include <cstring>
 #include <string>
 
+#include "endpoint_helpers.h"
+
 namespace ecal_service
 {
   // Forward declarations
-  inline std::string get_connection_info_string(const asio::ip::tcp::socket& socket);
+  inline std::string get_connection_info_string(const SocketT& socket);
   inline std::string endpoint_to_string(const asio::ip::tcp::endpoint& endpoint);
+  inline std::string endpoint_to_string(const asio::generic::stream_protocol::endpoint& endpoint);
 
-  inline std::string get_connection_info_string(const asio::ip::tcp::socket& socket)
+  inline std::string get_connection_info_string(const SocketT& socket)
   {
     std::string local_endpoint_string  = "???";
     std::string remote_endpoint_string = "???";
@@ -64,4 +68,27 @@ namespace ecal_service
 
     return address_string + ":" + std::to_string(endpoint.port());
   }
+
+  inline std::string endpoint_to_string(const asio::generic::stream_protocol::endpoint& endpoint)
+  {
+    if (is_tcp_endpoint(endpoint))
+      return endpoint_to_string(to_tcp_endpoint(endpoint));
+
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    // Local stream socket. Abstract socket names start with '\0', which is displayed as '@'.
+    asio::local::stream_protocol::endpoint local_endpoint;
+    if (endpoint.size() <= local_endpoint.capacity())
+    {
+      std::memcpy(local_endpoint.data(), endpoint.data(), endpoint.size());
+      local_endpoint.resize(endpoint.size());
+
+      std::string name = local_endpoint.path();
+      if (!name.empty() && (name[0] == '\0'))
+        name[0] = '@';
+      if (!name.empty())
+        return "local:" + name;
+    }
+#endif
+    return "local";
+  }
 }// namespace ecal_service
@@ -44,13 +44,16 @@ namespace ecal_service
   // TCP Header
   //   - Used for service request since protocol version 1
   //   - Used for response since protocol version 0
+  //   - Carries a request id since protocol version 2. The server copies the
+  //     id of a request into the matching response, so responses may be sent
+  //     in a different order than the requests were received.
   struct TcpHeaderV1
   {
     std::uint32_t package_size_n = 0;                        // package size in network byte order
     std::uint8_t  version        = 0;                        // protocol version                    (since protocol V1 / eCAL 5.12)
     MessageType   message_type   = MessageType::Undefined;   // message type                        (since protocol V1 / eCAL 5.12)
     std::uint16_t header_size_n  = 0;                        // header size in network byte order   (since protocol V1 / eCAL 5.12)
-    std::uint64_t reserved       = 0;                        // reserved
+    std::uint64_t request_id_n   = 0;                        // request id in network byte order    (since protocol V2, reserved before)
   };
 
   // Handshake Request Message, since protocol v1
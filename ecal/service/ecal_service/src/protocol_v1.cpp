@@ -19,6 +19,7 @@
 
 #include "protocol_v1.h"
 
+#include "buffer_pool.h"
 #include "protocol_layout.h"
 #include <cstddef>
 #include <cstdint>
@@ -41,14 +42,14 @@ namespace ecal_service
   {
     namespace
     {
-      void read_header_start(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
-      void read_header_rest(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const std::shared_ptr<std::vector<char>>& header_buffer, size_t bytes_already_read, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
-      void read_payload(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const std::shared_ptr<std::vector<char>>& header_buffer, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
+      void read_header_start(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
+      void read_header_rest(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const std::shared_ptr<std::vector<char>>& header_buffer, size_t bytes_already_read, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
+      void read_payload(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const std::shared_ptr<std::vector<char>>& header_buffer, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
 
       ///////////////////////////////////////////////////
       // Read and write implementation
       ///////////////////////////////////////////////////
-      void read_header_start(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
+      void read_header_start(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
       {
         // Get size of the entire header as it is currently known. What comes from
         // the network may be larger or smaller.
@@ -71,7 +72,7 @@ namespace ecal_service
         asio::async_read(socket
                       , asio::buffer(header_buffer->data(), bytes_to_read_now)
                       , asio::transfer_at_least(bytes_to_read_now)
-                      , [&socket, &socket_mutex, header_buffer, error_cb, success_cb](asio::error_code ec, std::size_t bytes_read)
+                      , [&socket, &socket_mutex, buffer_pool, header_buffer, error_cb, success_cb](asio::error_code ec, std::size_t bytes_read)
                         {
                           if (ec)
                           {
@@ -81,11 +82,11 @@ namespace ecal_service
                           }
 
                           // Read the rest of the header!
-                          read_header_rest(socket, socket_mutex, header_buffer, bytes_read, error_cb, success_cb);
+                          read_header_rest(socket, socket_mutex, buffer_pool, header_buffer, bytes_read, error_cb, success_cb);
                         });
       }
 
-      void read_header_rest(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const std::shared_ptr<std::vector<char>>& header_buffer, size_t bytes_already_read, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
+      void read_header_rest(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const std::shared_ptr<std::vector<char>>& header_buffer, size_t bytes_already_read, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
       {
         // Check how big the remote header claims to be
         const size_t remote_header_size = ntohs(reinterpret_cast<ecal_service::TcpHeaderV1*>(header_buffer->data())->header_size_n);
@@ -106,7 +107,7 @@ namespace ecal_service
         // 8 bytes should come at least 8 reserved bytes.
         if (bytes_still_to_read <= 0)
         {
-          read_payload(socket, socket_mutex, header_buffer, error_cb, success_cb);
+          read_payload(socket, socket_mutex, buffer_pool, header_buffer, error_cb, success_cb);
           return;
         }
 
@@ -115,7 +116,7 @@ namespace ecal_service
         asio::async_read(socket
                       , asio::buffer(&((*header_buffer)[bytes_already_read]), bytes_still_to_read)
                       , asio::transfer_at_least(bytes_still_to_read)
-                      , [&socket, &socket_mutex, header_buffer, error_cb, success_cb](asio::error_code ec, std::size_t /*bytes_read*/)
+                      , [&socket, &socket_mutex, buffer_pool, header_buffer, error_cb, success_cb](asio::error_code ec, std::size_t /*bytes_read*/)
                         {
                           if (ec)
                           {
@@ -130,24 +131,26 @@ namespace ecal_service
                           if (payload_size > 0)
                           {
                             // If there is a payload, read it
-                            read_payload(socket, socket_mutex, header_buffer, error_cb, success_cb);
+                            read_payload(socket, socket_mutex, buffer_pool, header_buffer, error_cb, success_cb);
                           }
                           else
                           {
-                            // If there is no payload, directly execute the callback with an empty string
+                            // If there is no payload, directly execute the callback with an empty string.
+                            // It doesn't need any memory, so no pooled buffer is taken.
                             success_cb(header_buffer, std::make_shared<std::string>());
                           }
                         });
       }
 
-      void read_payload(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const std::shared_ptr<std::vector<char>>& header_buffer, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
+      void read_payload(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const std::shared_ptr<std::vector<char>>& header_buffer, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
       {
         // Read how many bytes we will get as payload
         const uint32_t payload_size = ntohl(reinterpret_cast<ecal_service::TcpHeaderV1*>(header_buffer->data())->package_size_n);
 
         // Reserver enough memory for receiving the entire payload. The payload is
         // represented as an std::string for legacy, reasons. It is not textual data.
-        const std::shared_ptr<std::string> payload_buffer = std::make_shared<std::string>(payload_size, '\0');
+        // A pooled buffer is re-used without allocating and zeroing the memory again.
+        const std::shared_ptr<std::string> payload_buffer = buffer_pool ? buffer_pool->get_buffer(payload_size) : std::make_shared<std::string>(payload_size, '\0');
 
         // Read all the payload data into the payload_buffer
         const std::lock_guard<std::mutex> socket_lock(socket_mutex);
@@ -173,7 +176,7 @@ namespace ecal_service
     ///////////////////////////////////////////////////
     // Public API
     ///////////////////////////////////////////////////
-    void async_send_payload   (asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const std::shared_ptr<const ecal_service::TcpHeaderV1>& header_buffer, const std::shared_ptr<const std::string>& payload_buffer, const ErrorCallbackT& error_cb, const SendSuccessCallback& success_cb)
+    void async_send_payload   (SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<const ecal_service::TcpHeaderV1>& header_buffer, const std::shared_ptr<const std::string>& payload_buffer, const ErrorCallbackT& error_cb, const SendSuccessCallback& success_cb)
     {        
       const std::vector<asio::const_buffer> buffer_list { asio::buffer(reinterpret_cast<const char*>(header_buffer.get()), sizeof(ecal_service::TcpHeaderV1))
                                                         , asio::buffer(*payload_buffer)};
@@ -194,9 +197,37 @@ namespace ecal_service
 
     }
 
-    void async_receive_payload(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
+    void async_receive_payload(SocketT& socket, std::mutex& socket_mutex, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
     {
-      read_header_start(socket, socket_mutex, error_cb, success_cb);
+      read_header_start(socket, socket_mutex, nullptr, error_cb, success_cb);
+    }
+
+    void async_receive_payload(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb)
+    {
+      read_header_start(socket, socket_mutex, buffer_pool, error_cb, success_cb);
+    }
+
+    std::uint64_t hton_request_id(std::uint64_t request_id)
+    {
+      // Write the id byte by byte, most significant byte first
+      std::uint64_t request_id_n = 0;
+      auto* bytes = reinterpret_cast<unsigned char*>(&request_id_n);
+      for (size_t i = 0; i < sizeof(request_id_n); ++i)
+      {
+        bytes[i] = static_cast<unsigned char>(request_id >> (8 * (sizeof(request_id_n) - 1 - i)));
+      }
+      return request_id_n;
+    }
+
+    std::uint64_t ntoh_request_id(std::uint64_t request_id_n)
+    {
+      std::uint64_t request_id = 0;
+      const auto* bytes = reinterpret_cast<const unsigned char*>(&request_id_n);
+      for (size_t i = 0; i < sizeof(request_id_n); ++i)
+      {
+        request_id = (request_id << 8) | bytes[i];
+      }
+      return request_id;
     }
   } // namespace ProtocolV1
 } // namespace ecal_service
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,6 +28,8 @@
 
 #include <asio.hpp>
 
+#include "buffer_pool.h"
+#include "endpoint_helpers.h"
 #include "protocol_layout.h"
 
 namespace ecal_service
@@ -37,7 +40,14 @@ namespace ecal_service
     using SendSuccessCallback    = std::function<void()>;
     using ReceiveSuccessCallback = std::function<void(const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)>;
 
-    void async_send_payload   (asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const std::shared_ptr<const ecal_service::TcpHeaderV1>& header_buffer, const std::shared_ptr<const std::string>& payload_buffer, const ErrorCallbackT& error_cb, const SendSuccessCallback& success_cb);
-    void async_receive_payload(asio::ip::tcp::socket& socket, std::mutex& socket_mutex, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
+    void async_send_payload   (SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<const ecal_service::TcpHeaderV1>& header_buffer, const std::shared_ptr<const std::string>& payload_buffer, const ErrorCallbackT& error_cb, const SendSuccessCallback& success_cb);
+    void async_receive_payload(SocketT& socket, std::mutex& socket_mutex, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
+
+    // Receives the payload into a buffer from the given pool
+    void async_receive_payload(SocketT& socket, std::mutex& socket_mutex, const std::shared_ptr<BufferPool>& buffer_pool, const ErrorCallbackT& error_cb, const ReceiveSuccessCallback& success_cb);
+
+    // Conversion of the 64 bit request id (since protocol V2) from / to network byte order
+    std::uint64_t hton_request_id(std::uint64_t request_id);
+    std::uint64_t ntoh_request_id(std::uint64_t request_id_n);
   }
 }
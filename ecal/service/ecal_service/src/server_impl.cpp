@@ -35,6 +35,7 @@
 #include <ecal_service/state.h>
 
 #include "log_defs.h"
+#include "log_helpers.h"
 
 namespace ecal_service
 {
@@ -68,6 +69,9 @@ namespace ecal_service
                         , const LoggerT&                                logger)
     : io_context_                       (io_context)
     , acceptor_                         (*io_context)
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    , local_acceptor_                   (*io_context)
+#endif
     , service_callback_                 (service_callback)
     , post_to_service_callback_executor_(post_to_service_callback_executor)
     , event_callback_                   (event_callback)
@@ -211,10 +215,50 @@ namespace ecal_service
       }
     }
 
-    wait_for_next_client(protocol_version);
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    // Clients on the same host will prefer the local socket. It is optional,
+    // as clients will fall back to TCP, if it is not available.
+    start_local_accept(protocol_version, get_port());
+#endif
+
+    wait_for_next_client(acceptor_, protocol_version);
+  }
+
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+  bool ServerImpl::start_local_accept(std::uint8_t protocol_version, std::uint16_t port)
+  {
+    const auto endpoint = get_local_endpoint(get_own_process_id(), port);
+
+    {
+      const std::lock_guard<std::mutex> acceptor_lock(acceptor_mutex_);
+
+      // Remove the socket file of a server that was not shut down properly.
+      // The name contains our process id and the TCP port that is in use by us,
+      // so there cannot be another running server using it.
+      remove_local_endpoint_file(endpoint);
+
+      asio::error_code ec;
+      local_acceptor_.open(endpoint.protocol(), ec);                                   // NOLINT(bugprone-unused-return-value) -> We already get the return value from the ec parameter
+      if (!ec) local_acceptor_.bind(endpoint, ec);                                     // NOLINT(bugprone-unused-return-value) -> We already get the return value from the ec parameter
+      if (!ec) local_acceptor_.listen(asio::socket_base::max_listen_connections, ec);  // NOLINT(bugprone-unused-return-value) -> We already get the return value from the ec parameter
+
+      if (ec)
+      {
+        logger_(ecal_service::LogLevel::Warning, "Service Server: Failed to start local listener, clients will only be able to connect via TCP: " + ec.message());
+        asio::error_code close_ec;
+        local_acceptor_.close(close_ec); // NOLINT(bugprone-unused-return-value) -> We already get the return value from the ec parameter
+        return false;
+      }
+    }
+
+    ECAL_SERVICE_LOG_DEBUG(logger_, "Service Server: Listening on local endpoint " + endpoint_to_string(asio::generic::stream_protocol::endpoint(endpoint)));
+    wait_for_next_client(local_acceptor_, protocol_version);
+    return true;
   }
+#endif
 
-  void ServerImpl::wait_for_next_client(std::uint8_t protocol_version)
+  template <typename AcceptorT>
+  void ServerImpl::wait_for_next_client(AcceptorT& acceptor, std::uint8_t protocol_version)
   {
     ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Service waiting for next client...");
 
@@ -241,15 +285,16 @@ namespace ecal_service
 
     std::shared_ptr<ecal_service::ServerSessionBase> new_session;
 
-    // we support v1 protocol only
-    new_session = ecal_service::ServerSessionV1::create(io_context_, service_callback_, post_to_service_callback_executor_, event_callback_, shutdown_callback, logger_);
+    // The V1 session implementation handles all protocol versions >= 1. The
+    // protocol version is the highest one that is offered to the client.
+    new_session = ecal_service::ServerSessionV1::create(io_context_, protocol_version, service_callback_, post_to_service_callback_executor_, event_callback_, shutdown_callback, logger_);
 
     // Accept new session.
     // By only storing a weak_ptr to this, we assure that the user can still
     // delete the service from the outside.
     const std::lock_guard<std::mutex> acceptor_lock(acceptor_mutex_);
-    acceptor_.async_accept(new_session->socket()
-            , [weak_me = std::weak_ptr<ServerImpl>(shared_from_this()), new_session, protocol_version, logger_copy = logger_](auto ec)
+    acceptor.async_accept(new_session->socket()
+            , [weak_me = std::weak_ptr<ServerImpl>(shared_from_this()), &acceptor, new_session, protocol_version, logger_copy = logger_](auto ec)
               {
                 if (ec)
                 {
@@ -279,7 +324,8 @@ namespace ecal_service
                 const std::shared_ptr<ServerImpl> me = weak_me.lock();
                 if (me)
                 {
-                  me->wait_for_next_client(protocol_version);
+                  // The acceptor is a member of the server, so it is still valid
+                  me->wait_for_next_client(acceptor, protocol_version);
                 }
                 else
                 {
@@ -301,6 +347,16 @@ namespace ecal_service
         asio::error_code ec;
         acceptor_.close(ec); // NOLINT(bugprone-unused-return-value) -> We already get the return value  rom the ec parameter
       }
+
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+      if (local_acceptor_.is_open())
+      {
+        asio::error_code ec;
+        const auto endpoint = local_acceptor_.local_endpoint(ec);
+        local_acceptor_.close(ec); // NOLINT(bugprone-unused-return-value) -> We already get the return value from the ec parameter
+        remove_local_endpoint_file(endpoint);
+      }
+#endif
     }
     
     // Stop all sessions to clients
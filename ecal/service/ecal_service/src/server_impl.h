@@ -37,6 +37,7 @@
 #include <ecal_service/logger.h>
 #include <ecal_service/server_session_types.h>
 
+#include "endpoint_helpers.h"
 #include "server_session_impl_base.h"
 
 namespace ecal_service
@@ -85,7 +86,13 @@ namespace ecal_service
 
   private:
     void start_accept(std::uint8_t protocol_version, std::uint16_t port);
-    void wait_for_next_client(std::uint8_t protocol_version);
+
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    bool start_local_accept(std::uint8_t protocol_version, std::uint16_t port);
+#endif
+
+    template <typename AcceptorT>
+    void wait_for_next_client(AcceptorT& acceptor, std::uint8_t protocol_version);
 
   ///////////////////////////////////////////
   // Member Variables
@@ -95,6 +102,9 @@ namespace ecal_service
     const std::shared_ptr<asio::io_context>         io_context_;
     asio::ip::tcp::acceptor                         acceptor_;
     mutable std::mutex                              acceptor_mutex_;                                //!< Mutex for stopping the server. The stop() function is both used externally (via API) and from within the server itself. Closing the acceptor is not thread-safe, so we need to protect it.
+#if ECAL_SERVICE_LOCAL_ENDPOINT_ENABLED
+    asio::local::stream_protocol::acceptor          local_acceptor_;                                //!< Additional acceptor for clients on the same host. The socket name is derived from the TCP port. Also protected by the acceptor_mutex_.
+#endif
 
     const ServerServiceCallbackT                    service_callback_;
     const PostToServiceCallbackExecutorFunctionT    post_to_service_callback_executor_;
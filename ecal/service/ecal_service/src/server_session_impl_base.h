@@ -39,6 +39,8 @@
 #include <ecal_service/server_session_types.h>
 #include <ecal_service/state.h>
 
+#include "endpoint_helpers.h"
+
 namespace ecal_service
 {
   class ServerSessionBase
@@ -78,7 +80,7 @@ namespace ecal_service
   // Public API
   /////////////////////////////////////
   public:
-    asio::ip::tcp::socket& socket() { return socket_; }
+    SocketT& socket() { return socket_; }
     virtual void start() = 0;
     virtual void stop() = 0;
 
@@ -89,7 +91,7 @@ namespace ecal_service
   /////////////////////////////////////
   protected:
     const std::shared_ptr<asio::io_context>         io_context_;
-    asio::ip::tcp::socket                           socket_;
+    SocketT                                         socket_;
     mutable std::mutex                              socket_mutex_;
 
     const ServerServiceCallbackT                    service_callback_;
@@ -54,18 +54,22 @@ namespace ecal_service
   constexpr std::uint8_t ServerSessionV1::MIN_SUPPORTED_PROTOCOL_VERSION;
   constexpr std::uint8_t ServerSessionV1::MAX_SUPPORTED_PROTOCOL_VERSION;
 
+  constexpr std::size_t  ServerSessionV1::MAX_REQUESTS_IN_FLIGHT;
+
   std::shared_ptr<ServerSessionV1> ServerSessionV1::create(const std::shared_ptr<asio::io_context>&          io_context
+                                                          , std::uint8_t                                     max_protocol_version
                                                           , const ServerServiceCallbackT&                    service_callback
                                                           , const PostToServiceCallbackExecutorFunctionT&    post_to_service_callback_executor
                                                           , const ServerEventCallbackT&                      event_callback
                                                           , const ShutdownCallbackT&                         shutdown_callback
                                                           , const LoggerT&                                   logger)
   {
-    std::shared_ptr<ServerSessionV1> instance = std::shared_ptr<ServerSessionV1>(new ServerSessionV1(io_context, service_callback, post_to_service_callback_executor, event_callback, shutdown_callback, logger));
+    std::shared_ptr<ServerSessionV1> instance = std::shared_ptr<ServerSessionV1>(new ServerSessionV1(io_context, max_protocol_version, service_callback, post_to_service_callback_executor, event_callback, shutdown_callback, logger));
     return instance;
   }
 
   ServerSessionV1::ServerSessionV1(const std::shared_ptr<asio::io_context>&          io_context
+                                  , std::uint8_t                                     max_protocol_version
                                   , const ServerServiceCallbackT&                    service_callback
                                   , const PostToServiceCallbackExecutorFunctionT&    post_to_service_callback_executor
                                   , const ServerEventCallbackT&                      event_callback
@@ -73,9 +77,14 @@ namespace ecal_service
                                   , const LoggerT&                                   logger)
     : ServerSessionBase(io_context, service_callback, event_callback, shutdown_callback)
     , state_                            (State::NOT_CONNECTED)
+    , max_protocol_version_             (std::min(std::max(max_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION), MAX_SUPPORTED_PROTOCOL_VERSION))
     , accepted_protocol_version_        (0)
     , post_to_service_callback_executor_(post_to_service_callback_executor)
     , logger_                           (logger)
+    , buffer_pool_                      (BufferPool::create())
+    , response_send_in_progress_        (false)
+    , requests_in_flight_               (0)
+    , receive_paused_                   (false)
   {
     ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Server Session Created");
   }
@@ -98,11 +107,15 @@ namespace ecal_service
     // Socket to wait for more data, if it encounters a frame that can still
     // fit more data. Obviously, this is an awfull default behaviour, if we
     // want to transmit our data in a timely fashion.
+    // Local stream sockets don't have that option.
     {
       asio::error_code socket_option_ec;
       {
         const std::lock_guard<std::mutex> socket_lock(socket_mutex_);
-        socket_.set_option(asio::ip::tcp::no_delay(true), socket_option_ec); // NOLINT(bugprone-unused-return-value) -> We already get the value from the ec parameter
+        asio::error_code endpoint_ec;
+        const auto local_endpoint = socket_.local_endpoint(endpoint_ec);
+        if (!endpoint_ec && is_tcp_endpoint(local_endpoint))
+          socket_.set_option(asio::ip::tcp::no_delay(true), socket_option_ec); // NOLINT(bugprone-unused-return-value) -> We already get the value from the ec parameter
       }
       if (socket_option_ec)
       {
@@ -122,7 +135,7 @@ namespace ecal_service
       {
         // Shutdown the socket
         asio::error_code ec;
-        socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec); // NOLINT(bugprone-unused-return-value) -> We already get the value from the ec parameter
+        socket_.shutdown(asio::socket_base::shutdown_both, ec); // NOLINT(bugprone-unused-return-value) -> We already get the value from the ec parameter
       }
       {
         // Close the socket
@@ -179,7 +192,7 @@ namespace ecal_service
                                 const ProtocolHandshakeRequestMessage* handshake_request = reinterpret_cast<const ProtocolHandshakeRequestMessage*>(payload_buffer->data());
 
                                 // Compute the maximum supported protocol version by this server and the remote client
-                                const std::uint8_t both_supported_max_protocol_version = std::min(handshake_request->max_supported_protocol_version, MAX_SUPPORTED_PROTOCOL_VERSION);
+                                const std::uint8_t both_supported_max_protocol_version = std::min(handshake_request->max_supported_protocol_version, me->max_protocol_version_);
                                 const std::uint8_t both_supported_min_protocol_version = std::max(handshake_request->min_supported_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION);
 
                                 if (both_supported_max_protocol_version >= both_supported_min_protocol_version)
@@ -195,7 +208,7 @@ namespace ecal_service
                                 {
                                   const std::string message = std::string("Error while accepting connection from client. No common protocol version is found. ")
                                                             + "Client supports [min: " + std::to_string(handshake_request->min_supported_protocol_version) + ", max: " + std::to_string(handshake_request->max_supported_protocol_version) + "]. "
-                                                            + "Server supports [min: " + std::to_string(MIN_SUPPORTED_PROTOCOL_VERSION) + ", max: " + std::to_string(MAX_SUPPORTED_PROTOCOL_VERSION) + "].";
+                                                            + "Server supports [min: " + std::to_string(MIN_SUPPORTED_PROTOCOL_VERSION) + ", max: " + std::to_string(me->max_protocol_version_) + "].";
                                   me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
                                   //const auto message = get_log_string("ERROR", "Error connecting to server. Server reported an un-supported protocol version: " + std::to_string(handshake_response->accepted_protocol_version));
@@ -260,13 +273,16 @@ namespace ecal_service
   {
     ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Waiting for service request...");
 
-    ecal_service::ProtocolV1::async_receive_payload(socket_, socket_mutex_
+    ecal_service::ProtocolV1::async_receive_payload(socket_, socket_mutex_, buffer_pool_
                           , [me = shared_from_this()](asio::error_code ec)
                             {
                               const std::string message = "Server session disconnected while waiting for request: " + ec.message();
                               me->logger_(LogLevel::Info, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
-                              me->state_ = State::FAILED;
+                              // With protocol V2 reading and writing may fail at the same time.
+                              // Only the first failing operation reports the disconnect.
+                              if (me->state_.exchange(State::FAILED) == State::FAILED)
+                                return;
                               
                               // call event callback
                               me->event_callback_(ecal_service::ServerEventType::Disconnected, message);
@@ -283,7 +299,9 @@ namespace ecal_service
                                 me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
                                 // The request is not a Service request.
-                                me->state_ = State::FAILED;
+                                // Only the first failing operation reports the disconnect
+                                if (me->state_.exchange(State::FAILED) == State::FAILED)
+                                  return;
 
                                 // call event callback
                                 me->event_callback_(ecal_service::ServerEventType::Disconnected, message);
@@ -297,26 +315,52 @@ namespace ecal_service
                                 
                                 ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Received service request of " + std::to_string(payload_buffer->size()) + " bytes");
 
-                                // Prepare a buffer for the response
-                                const std::shared_ptr<std::string> response_buffer = std::make_shared<std::string>();
+                                // Prepare a buffer for the response. The service callback writes
+                                // directly into it, a pooled buffer already has a matching capacity.
+                                const std::shared_ptr<std::string> response_buffer = me->buffer_pool_->get_buffer(0);
+
+                                // Since protocol V2 the response must carry the id of the request.
+                                // In V1 the field is reserved and we just send back what we got.
+                                const std::uint64_t request_id_n = header->request_id_n;
+
+                                // With protocol V2 we don't wait for the response to be sent,
+                                // but directly continue reading the next request. Only if too
+                                // many requests are already being executed, we stop reading
+                                // and let TCP flow control throttle the client.
+                                // The request is counted before the service callback is posted,
+                                // as a fast callback may already have sent its response (and
+                                // decremented the counter) before the post returns.
+                                bool receive_next_request = false;
+                                if (me->accepted_protocol_version_ >= 2)
+                                {
+                                  const std::lock_guard<std::mutex> response_queue_lock(me->response_queue_mutex_);
+                                  ++me->requests_in_flight_;
+                                  if (me->requests_in_flight_ < MAX_REQUESTS_IN_FLIGHT)
+                                    receive_next_request = true;
+                                  else
+                                    me->receive_paused_ = true;
+                                }
 
                                 // Post the service callback to the user-defined executor.
                                 // Note: The capture contains a dummy work guard to keep the io_context alive,
                                 //       even if the user passes the service callback to another thread.
-                                me->post_to_service_callback_executor_([me, payload_buffer, response_buffer, dummy_work = asio::make_work_guard(me->io_context_)]()
+                                me->post_to_service_callback_executor_([me, payload_buffer, response_buffer, request_id_n, dummy_work = asio::make_work_guard(me->io_context_)]()
                                                                       {
                                                                         me->service_callback_(payload_buffer, response_buffer);
 
                                                                         // Send the response to the client
-                                                                        me->send_service_response(response_buffer);
+                                                                        me->send_service_response(response_buffer, request_id_n);
                                                                       }
                                 ); 
+
+                                if (receive_next_request)
+                                  me->receive_service_request();
                               }
                             });
 
   }
 
-  void ServerSessionV1::send_service_response(const std::shared_ptr<std::string>& response_buffer)
+  void ServerSessionV1::send_service_response(const std::shared_ptr<std::string>& response_buffer, std::uint64_t request_id_n)
   {
     // Create header_buffer
     const std::shared_ptr<TcpHeaderV1>  header_buffer  = std::make_shared<TcpHeaderV1>();
@@ -324,6 +368,22 @@ namespace ecal_service
     header_buffer->version        = accepted_protocol_version_;
     header_buffer->message_type   = MessageType::ServiceResponse;
     header_buffer->header_size_n  = htons(sizeof(TcpHeaderV1));
+    header_buffer->request_id_n   = request_id_n;
+
+    if (accepted_protocol_version_ >= 2)
+    {
+      // Service callbacks of the same session may finish concurrently, so we
+      // have to make sure that only one response is written at a time.
+      {
+        const std::lock_guard<std::mutex> response_queue_lock(response_queue_mutex_);
+        response_queue_.push_back(QueuedResponse{header_buffer, response_buffer});
+        if (response_send_in_progress_)
+          return;
+        response_send_in_progress_ = true;
+      }
+      send_next_queued_response();
+      return;
+    }
 
     ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Sending service response...");
 
@@ -333,7 +393,9 @@ namespace ecal_service
                               const std::string message = "Failed sending service response: " + ec.message();
                               me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
-                              me->state_ = State::FAILED;
+                              // Only the first failing operation reports the disconnect
+                              if (me->state_.exchange(State::FAILED) == State::FAILED)
+                                return;
                               
                               // call event callback
                               me->event_callback_(ecal_service::ServerEventType::Disconnected, message);
@@ -348,4 +410,59 @@ namespace ecal_service
                             });
   }
 
+  void ServerSessionV1::send_next_queued_response()
+  {
+    QueuedResponse next_response;
+    {
+      const std::lock_guard<std::mutex> response_queue_lock(response_queue_mutex_);
+      next_response = std::move(response_queue_.front());
+      response_queue_.pop_front();
+    }
+
+    ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Sending service response for request " + std::to_string(ecal_service::ProtocolV1::ntoh_request_id(next_response.header->request_id_n)) + "...");
+
+    ecal_service::ProtocolV1::async_send_payload(socket_, socket_mutex_, next_response.header, next_response.payload
+                          , [me = shared_from_this()](asio::error_code ec)
+                            {
+                              const std::string message = "Failed sending service response: " + ec.message();
+                              me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                              // Only the first failing operation reports the disconnect
+                              if (me->state_.exchange(State::FAILED) == State::FAILED)
+                                return;
+                              
+                              // call event callback
+                              me->event_callback_(ecal_service::ServerEventType::Disconnected, message);
+                              me->shutdown_callback_(me);
+                            }
+                          , [me = shared_from_this()]()
+                            {
+                              ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully sent service response.");
+
+                              bool send_next_response    = false;
+                              bool resume_receiving      = false;
+                              {
+                                const std::lock_guard<std::mutex> response_queue_lock(me->response_queue_mutex_);
+                                --me->requests_in_flight_;
+
+                                if (me->receive_paused_)
+                                {
+                                  me->receive_paused_ = false;
+                                  resume_receiving    = true;
+                                }
+
+                                if (me->response_queue_.empty())
+                                  me->response_send_in_progress_ = false;
+                                else
+                                  send_next_response = true;
+                              }
+
+                              if (resume_receiving)
+                                me->receive_service_request();
+
+                              if (send_next_response)
+                                me->send_next_queued_response();
+                            });
+  }
+
 } // namespace ecal_service
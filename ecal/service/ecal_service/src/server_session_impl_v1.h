@@ -21,10 +21,15 @@
 #pragma once
 
 #include "server_session_impl_base.h"
+#include "buffer_pool.h"
+#include "protocol_layout.h"
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <asio.hpp>
@@ -46,6 +51,7 @@ namespace ecal_service
 
   public:
     static std::shared_ptr<ServerSessionV1> create(const std::shared_ptr<asio::io_context>&          io_context
+                                                  , std::uint8_t                                     max_protocol_version
                                                   , const ServerServiceCallbackT&                    service_callback
                                                   , const PostToServiceCallbackExecutorFunctionT&    post_to_service_callback_executor
                                                   , const ServerEventCallbackT&                      event_callback
@@ -54,6 +60,7 @@ namespace ecal_service
 
   protected:
     ServerSessionV1(const std::shared_ptr<asio::io_context>&         io_context
+                  , std::uint8_t                                     max_protocol_version
                   , const ServerServiceCallbackT&                    service_callback
                   , const PostToServiceCallbackExecutorFunctionT&    post_to_service_callback_executor
                   , const ServerEventCallbackT&                      event_callback
@@ -86,19 +93,38 @@ namespace ecal_service
     void send_handshake_response();
 
     void receive_service_request();
-    void send_service_response(const std::shared_ptr<std::string>& response_buffer);
+    void send_service_response(const std::shared_ptr<std::string>& response_buffer, std::uint64_t request_id_n);
+
+    // Protocol V2: responses are queued and sent one after another in the order the service callbacks finish
+    void send_next_queued_response();
 
   /////////////////////////////////////
   // Member variables
   /////////////////////////////////////
   private:
     static constexpr std::uint8_t MIN_SUPPORTED_PROTOCOL_VERSION = 1;
-    static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 1;
+    static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 2;
+
+    static constexpr std::size_t  MAX_REQUESTS_IN_FLIGHT         = 64;  //!< Protocol V2: Requests executed in parallel for a single session. Further requests are not read from the socket until a response has been sent.
+
+    struct QueuedResponse
+    {
+      std::shared_ptr<const TcpHeaderV1> header;
+      std::shared_ptr<const std::string> payload;
+    };
 
     std::atomic<State>      state_;
+    const std::uint8_t      max_protocol_version_;      //!< The highest protocol version this session offers to clients
     std::uint8_t            accepted_protocol_version_;
 
     const PostToServiceCallbackExecutorFunctionT post_to_service_callback_executor_;
     const LoggerT                                logger_;
+    const std::shared_ptr<BufferPool>            buffer_pool_;   //!< Buffers for received requests and the responses
+
+    std::mutex                  response_queue_mutex_;
+    std::deque<QueuedResponse>  response_queue_;             //!< Protocol V2: Responses waiting to be sent. Protected by response_queue_mutex_.
+    bool                        response_send_in_progress_;  //!< Protocol V2: Whether an async_write is currently running. Protected by response_queue_mutex_.
+    std::size_t                 requests_in_flight_;         //!< Protocol V2: Received requests whose response has not been sent, yet. Protected by response_queue_mutex_.
+    bool                        receive_paused_;             //!< Protocol V2: Whether reading requests is paused due to MAX_REQUESTS_IN_FLIGHT. Protected by response_queue_mutex_.
   };
 }
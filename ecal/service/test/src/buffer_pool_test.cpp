@@ -0,0 +1,132 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "buffer_pool.h"
+
+TEST(BufferPool, ReusesReturnedBuffers)
+{
+  auto buffer_pool = ecal_service::BufferPool::create();
+
+  const char* first_data = nullptr;
+  {
+    auto buffer = buffer_pool->get_buffer(1000);
+    EXPECT_EQ(buffer->size(), 1000);
+    first_data = buffer->data();
+  }
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 1);
+
+  // The returned buffer is handed out again, without re-allocation
+  auto buffer = buffer_pool->get_buffer(500);
+  EXPECT_EQ(buffer->size(), 500);
+  EXPECT_EQ(buffer->data(), first_data);
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 0);
+}
+
+TEST(BufferPool, EmptyBufferKeepsPooledCapacity)
+{
+  auto buffer_pool = ecal_service::BufferPool::create();
+
+  {
+    auto small_buffer = buffer_pool->get_buffer(100);
+    auto large_buffer = buffer_pool->get_buffer(1000);
+  }
+  ASSERT_EQ(buffer_pool->get_pooled_buffer_count(), 2);
+
+  // An empty buffer (e.g. for a response of unknown size) is the largest pooled one
+  auto empty_buffer = buffer_pool->get_buffer(0);
+  EXPECT_TRUE(empty_buffer->empty());
+  EXPECT_GE(empty_buffer->capacity(), 1000);
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 1);
+
+  empty_buffer.reset();
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 2);
+}
+
+TEST(BufferPool, RetentionLimits)
+{
+  auto buffer_pool = ecal_service::BufferPool::create(2, 10000);
+
+  // Only 2 buffers are kept
+  {
+    auto buffer_1 = buffer_pool->get_buffer(100);
+    auto buffer_2 = buffer_pool->get_buffer(100);
+    auto buffer_3 = buffer_pool->get_buffer(100);
+  }
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 2);
+
+  // A buffer exceeding the byte limit is deleted (it has been grown from one of the pooled buffers)
+  buffer_pool->get_buffer(20000).reset();
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 1);
+  EXPECT_LE(buffer_pool->get_pooled_bytes(), 10000);
+}
+
+TEST(BufferPool, LargePayloadsDoNotAllocateTwice)
+{
+  auto buffer_pool = ecal_service::BufferPool::create();
+
+  constexpr std::size_t payload_size = 8 * 1024 * 1024;
+  const std::string     response(payload_size, 'r');
+
+  const char* request_data  = nullptr;
+  const char* response_data = nullptr;
+
+  // First call: The request is received into a new buffer and the service
+  // callback writes the response into another new one.
+  {
+    auto request_buffer  = buffer_pool->get_buffer(payload_size);
+    auto response_buffer = buffer_pool->get_buffer(0);
+    response_buffer->append(response);
+
+    request_data  = request_buffer->data();
+    response_data = response_buffer->data();
+  }
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 2);
+
+  // Second call: Both buffers are re-used, nothing is allocated
+  {
+    auto request_buffer  = buffer_pool->get_buffer(payload_size);
+    auto response_buffer = buffer_pool->get_buffer(0);
+    const std::size_t response_capacity = response_buffer->capacity();
+    response_buffer->append(response);
+
+    // Both pooled buffers are large enough, so they may have swapped roles
+    EXPECT_TRUE(((request_buffer->data() == request_data) && (response_buffer->data() == response_data))
+             || ((request_buffer->data() == response_data) && (response_buffer->data() == request_data)));
+    EXPECT_EQ(response_buffer->capacity(), response_capacity);
+    EXPECT_EQ(*response_buffer, response);
+  }
+  EXPECT_EQ(buffer_pool->get_pooled_buffer_count(), 2);
+}
+
+TEST(BufferPool, BuffersOutliveThePool)
+{
+  auto buffer_pool = ecal_service::BufferPool::create();
+  auto buffer      = buffer_pool->get_buffer(100);
+
+  buffer_pool.reset();
+  EXPECT_EQ(buffer->size(), 100);
+  buffer.reset();
+}
@@ -49,6 +49,10 @@
 #include "ecal_service/server_session_types.h"
 #include "ecal_service/state.h"
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 ecal_service::LoggerT critical_logger(const std::string& node_name)
 {
       return [node_name](const ecal_service::LogLevel log_level, const std::string& message)
@@ -71,7 +75,7 @@ ecal_service::LoggerT critical_logger(const std::string& node_name)
 }
 
 constexpr std::uint8_t min_protocol_version = 1;
-constexpr std::uint8_t max_protocol_version = 1;
+constexpr std::uint8_t max_protocol_version = 2;
 
 // Simple response callback executors that directly executes the callback in the calling thread.
 // This is fine for testing purposes.
@@ -1951,7 +1955,10 @@ TEST(ecal_service, ErrorCallback_ErrorCallbackServerHasDisconnected) // NOLINT
 #if 1
 TEST(ecal_service, ErrorCallback_ErrorCallbackClientDisconnects) // NOLINT
 {
-  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= max_protocol_version; protocol_version++)
+  // Only protocol V1 serializes the service calls, so the second request
+  // will not reach the server before the first one has been answered.
+  // Protocol V2 sends all requests directly (see Pipelining_OutOfOrderResponses).
+  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= 1; protocol_version++)
   {
     const auto io_context = std::make_shared<asio::io_context>();
     const asio::executor_work_guard<asio::io_context::executor_type> dummy_work_guard(io_context->get_executor());
@@ -2818,3 +2825,233 @@ TEST(ecal_service, Asynchronous_Callback_Executors)
   }
 }
 #endif
+
+#if 1
+TEST(ecal_service, Pipelining_OutOfOrderResponses) // NOLINT
+{
+  // Protocol V2 sends all requests without waiting for the responses. The
+  // server executes them in parallel and answers in the order in which the
+  // service callbacks finish.
+  constexpr std::uint8_t protocol_version = 2;
+  constexpr int          num_calls        = 10;
+
+  const auto io_context = std::make_shared<asio::io_context>();
+  const asio::executor_work_guard<asio::io_context::executor_type> dummy_work_guard(io_context->get_executor());
+
+  SimpleThreadpool server_threadpool;
+
+  const ecal_service::Server::ServiceCallbackT server_service_callback
+          = [](const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+            {
+              // The first request takes the longest
+              const int call_index = std::stoi(*request);
+              std::this_thread::sleep_for(std::chrono::milliseconds(20 * (num_calls - call_index)));
+              *response = "Response on " + *request;
+            };
+
+  const ecal_service::Server::EventCallbackT server_event_callback
+          = [](ecal_service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+            {};
+
+  const ecal_service::ClientSession::EventCallbackT client_event_callback
+          = [](ecal_service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+            {};
+
+  auto server = ecal_service::Server::create(io_context, protocol_version, 0, server_service_callback, server_threadpool.get_post_function(), server_event_callback, critical_logger("Server"));
+  auto client = ecal_service::ClientSession::create(io_context, protocol_version, {{ "127.0.0.1", server->get_port() }}, synchronous_client_response_callback_executor_function, client_event_callback, critical_logger("Client"));
+
+  std::thread io_thread([&io_context]()
+                        {
+                          io_context->run();
+                        });
+
+  std::mutex       response_order_mutex;
+  std::vector<int> response_order;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_calls; ++i)
+  {
+    client->async_call_service(std::make_shared<std::string>(std::to_string(i))
+                              , [i, &response_order_mutex, &response_order](const ecal_service::Error& error, const std::shared_ptr<std::string>& response)
+                                {
+                                  EXPECT_FALSE(error);
+                                  ASSERT_NE(response, nullptr);
+                                  EXPECT_EQ(*response, "Response on " + std::to_string(i));
+
+                                  const std::lock_guard<std::mutex> lock(response_order_mutex);
+                                  response_order.push_back(i);
+                                });
+  }
+
+  // Serialized calls would take 20 * (10 + 9 + ... + 1) ms = 1100 ms
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  {
+    const std::lock_guard<std::mutex> lock(response_order_mutex);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+    EXPECT_EQ(client->get_accepted_protocol_version(), protocol_version);
+    ASSERT_EQ(response_order.size(), num_calls);
+
+    // The fastest call (i.e. the last request) is answered first
+    EXPECT_EQ(response_order.front(), num_calls - 1);
+    EXPECT_EQ(response_order.back(),  0);
+  }
+
+  client->stop();
+  server->stop();
+
+  // join the io_thread
+  io_context->stop();
+  io_thread.join();
+}
+#endif
+
+#if 1
+TEST(ecal_service, Pipelining_MixedProtocolVersions) // NOLINT
+{
+  // V2 clients and servers must fall back to V1 when talking to V1 peers
+  const std::vector<std::pair<std::uint8_t, std::uint8_t>> server_client_versions { {1, 2}, {2, 1}, {2, 2} };
+
+  for (const auto& versions : server_client_versions)
+  {
+    const auto io_context = std::make_shared<asio::io_context>();
+    const asio::executor_work_guard<asio::io_context::executor_type> dummy_work_guard(io_context->get_executor());
+
+    std::atomic<int> num_client_response_callback_called(0);
+
+    const ecal_service::Server::ServiceCallbackT server_service_callback
+            = [](const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+              {
+                *response = "Response on " + *request;
+              };
+
+    auto server = ecal_service::Server::create(io_context, versions.first, 0, server_service_callback, synchronous_server_service_callback_executor_function, [](auto, auto) {}, critical_logger("Server"));
+    auto client = ecal_service::ClientSession::create(io_context, versions.second, {{ "127.0.0.1", server->get_port() }}, synchronous_client_response_callback_executor_function, [](auto, auto) {}, critical_logger("Client"));
+
+    std::thread io_thread([&io_context]()
+                          {
+                            io_context->run();
+                          });
+
+    for (int i = 0; i < 5; ++i)
+    {
+      client->async_call_service(std::make_shared<std::string>(std::to_string(i))
+                                , [i, &num_client_response_callback_called](const ecal_service::Error& error, const std::shared_ptr<std::string>& response)
+                                  {
+                                    EXPECT_FALSE(error);
+                                    ASSERT_NE(response, nullptr);
+                                    EXPECT_EQ(*response, "Response on " + std::to_string(i));
+                                    num_client_response_callback_called++;
+                                  });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(num_client_response_callback_called, 5);
+    EXPECT_EQ(client->get_accepted_protocol_version(), std::min(versions.first, versions.second));
+
+    client->stop();
+    server->stop();
+
+    // join the io_thread
+    io_context->stop();
+    io_thread.join();
+  }
+}
+#endif
+
+#if !defined(_WIN32)
+TEST(ecal_service, LocalEndpoint_SameHost) // NOLINT
+{
+  // Clients connecting to "localhost" use the local stream socket of the
+  // server, if they know its process id. Literal IP addresses, an unknown
+  // process id and a wrong process id (-> failing local connect) use TCP.
+  struct LocalEndpointTestCase
+  {
+    std::string  host;
+    std::int32_t server_process_id;
+    bool         expect_local;
+  };
+
+  const std::int32_t own_process_id = static_cast<std::int32_t>(getpid());
+  const std::vector<LocalEndpointTestCase> test_cases
+  {
+    { "localhost", own_process_id,     true  },
+    { "127.0.0.1", own_process_id,     false },
+    { "localhost", 0,                  false },
+    { "localhost", own_process_id + 1, false },
+  };
+
+  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= max_protocol_version; protocol_version++)
+  {
+    for (const auto& test_case : test_cases)
+    {
+      const auto io_context = std::make_shared<asio::io_context>();
+      const asio::executor_work_guard<asio::io_context::executor_type> dummy_work_guard(io_context->get_executor());
+
+      std::atomic<int> num_client_response_callback_called(0);
+
+      std::mutex  connected_message_mutex;
+      std::string connected_message;
+
+      const ecal_service::LoggerT client_logger
+              = [&connected_message_mutex, &connected_message](const ecal_service::LogLevel log_level, const std::string& message)
+                {
+                  if ((log_level == ecal_service::LogLevel::Info) && (message.find("Connected to server") != std::string::npos))
+                  {
+                    const std::lock_guard<std::mutex> lock(connected_message_mutex);
+                    connected_message = message;
+                  }
+                };
+
+      const ecal_service::Server::ServiceCallbackT server_service_callback
+              = [](const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+                {
+                  *response = "Response on " + *request;
+                };
+
+      auto server = ecal_service::Server::create(io_context, protocol_version, 0, server_service_callback, synchronous_server_service_callback_executor_function, [](auto, auto) {}, critical_logger("Server"));
+      auto client = ecal_service::ClientSession::create(io_context, protocol_version, {{ test_case.host, server->get_port() }}, test_case.server_process_id, synchronous_client_response_callback_executor_function, [](auto, auto) {}, client_logger);
+
+      std::thread io_thread([&io_context]()
+                            {
+                              io_context->run();
+                            });
+
+      for (int i = 0; i < 5; ++i)
+      {
+        client->async_call_service(std::make_shared<std::string>(std::to_string(i))
+                                  , [i, &num_client_response_callback_called](const ecal_service::Error& error, const std::shared_ptr<std::string>& response)
+                                    {
+                                      EXPECT_FALSE(error);
+                                      ASSERT_NE(response, nullptr);
+                                      EXPECT_EQ(*response, "Response on " + std::to_string(i));
+                                      num_client_response_callback_called++;
+                                    });
+      }
+
+      // Wait generously, the fallback to TCP takes an additional connection attempt
+      for (int i = 0; (i < 500) && (num_client_response_callback_called < 5); ++i)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+      EXPECT_EQ(num_client_response_callback_called, 5);
+      EXPECT_EQ(client->get_host(), test_case.host);
+      EXPECT_EQ(client->get_remote_endpoint().port(), server->get_port());
+
+      {
+        const std::lock_guard<std::mutex> lock(connected_message_mutex);
+        EXPECT_EQ(connected_message.find("local:") != std::string::npos, test_case.expect_local) << connected_message;
+      }
+
+      client->stop();
+      server->stop();
+
+      // join the io_thread
+      io_context->stop();
+      io_thread.join();
+    }
+  }
+}
+#endif
@@ -116,6 +116,10 @@ publisher:
       acknowledge_timeout_ms: 346
       # Maximum number of used buffers (needs to be greater than 1, default = 1)
       memfile_buffer_count: 1
+      # Request transparent huge pages for memory files (Linux only, needs shmem_enabled=advise)
+      memfile_huge_pages: false
+      # Pre-fault memory file pages on creation to avoid page faults on the first writes (Linux only)
+      memfile_prefault: true
     
     # Base configuration for UDP publisher
     udp:
@@ -42,6 +42,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.communication_mode = eCAL::eCommunicationMode::network;
 
     config.registration.registration_refresh = 500;
+    config.registration.descriptor_refresh = 5;
+    config.registration.interest_filter = true;
     config.registration.registration_timeout = 2000;
     config.registration.loopback = false;
     config.registration.shm_transport_domain = "shm_transport_domain";
@@ -74,15 +76,29 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.publisher.layer.shm.memfile_buffer_count = 13;
     config.publisher.layer.shm.memfile_min_size_bytes = 8192;
     config.publisher.layer.shm.memfile_reserve_percent = 14;
+    config.publisher.layer.shm.memfile_huge_pages = true;
+    config.publisher.layer.shm.memfile_prefault = true;
+    config.publisher.layer.shm.memfile_lock = true;
+    config.publisher.layer.shm.memfile_numa_local = true;
     config.publisher.layer.udp.enable = false;
+    config.publisher.layer.udp.retransmit_window = 32;
+    config.publisher.layer.udp.repair_rate_limit = 12345;
+    config.publisher.layer.udp.coalescing_latency_us = 250;
+    config.publisher.layer.udp.coalescing_max_size = 8192;
     config.publisher.layer.tcp.enable = false;
+    config.publisher.layer.tcp.multiplexed = true;
     config.publisher.layer_priority_local = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::shm, eCAL::TransportLayer::eType::udp_mc};
     config.publisher.layer_priority_remote = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::udp_mc};
+    config.publisher.send_queue.enable = true;
+    config.publisher.send_queue.capacity = 42;
+    config.publisher.send_queue.overflow_policy = eCAL::Publisher::SendQueue::eOverflowPolicy::block;
 
     config.subscriber.layer.shm.enable = false;
     config.subscriber.layer.udp.enable = false;
     config.subscriber.layer.tcp.enable = true;
     config.subscriber.drop_out_of_order_messages = false;
+    config.subscriber.history_depth = 7;
+    config.subscriber.max_frequency = 2.5;
 
     config.timesync.timesync_module_replay = "my_replay";
     config.timesync.timesync_module_rt = "my_rt";
@@ -108,6 +124,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     // Compare all values of the config struct with the values of the config struct created from yaml string
     EXPECT_EQ(config.communication_mode, config_from_yaml.communication_mode);
     EXPECT_EQ(config.registration.registration_refresh, config_from_yaml.registration.registration_refresh);
+    EXPECT_EQ(config.registration.descriptor_refresh, config_from_yaml.registration.descriptor_refresh);
+    EXPECT_EQ(config.registration.interest_filter, config_from_yaml.registration.interest_filter);
     EXPECT_EQ(config.registration.registration_timeout, config_from_yaml.registration.registration_timeout);
     EXPECT_EQ(config.registration.loopback, config_from_yaml.registration.loopback);
     EXPECT_EQ(config.registration.shm_transport_domain, config_from_yaml.registration.shm_transport_domain);
@@ -137,14 +155,28 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.publisher.layer.shm.memfile_buffer_count, config_from_yaml.publisher.layer.shm.memfile_buffer_count);
     EXPECT_EQ(config.publisher.layer.shm.memfile_min_size_bytes, config_from_yaml.publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(config.publisher.layer.shm.memfile_reserve_percent, config_from_yaml.publisher.layer.shm.memfile_reserve_percent);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_huge_pages, config_from_yaml.publisher.layer.shm.memfile_huge_pages);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_prefault, config_from_yaml.publisher.layer.shm.memfile_prefault);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_lock, config_from_yaml.publisher.layer.shm.memfile_lock);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_numa_local, config_from_yaml.publisher.layer.shm.memfile_numa_local);
     EXPECT_EQ(config.publisher.layer.udp.enable, config_from_yaml.publisher.layer.udp.enable);
+    EXPECT_EQ(config.publisher.layer.udp.retransmit_window, config_from_yaml.publisher.layer.udp.retransmit_window);
+    EXPECT_EQ(config.publisher.layer.udp.repair_rate_limit, config_from_yaml.publisher.layer.udp.repair_rate_limit);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_latency_us, config_from_yaml.publisher.layer.udp.coalescing_latency_us);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_size, config_from_yaml.publisher.layer.udp.coalescing_max_size);
     EXPECT_EQ(config.publisher.layer.tcp.enable, config_from_yaml.publisher.layer.tcp.enable);
+    EXPECT_EQ(config.publisher.layer.tcp.multiplexed, config_from_yaml.publisher.layer.tcp.multiplexed);
     EXPECT_EQ(config.publisher.layer_priority_local, config_from_yaml.publisher.layer_priority_local);
     EXPECT_EQ(config.publisher.layer_priority_remote, config_from_yaml.publisher.layer_priority_remote);
+    EXPECT_EQ(config.publisher.send_queue.enable, config_from_yaml.publisher.send_queue.enable);
+    EXPECT_EQ(config.publisher.send_queue.capacity, config_from_yaml.publisher.send_queue.capacity);
+    EXPECT_EQ(config.publisher.send_queue.overflow_policy, config_from_yaml.publisher.send_queue.overflow_policy);
     EXPECT_EQ(config.subscriber.layer.shm.enable, config_from_yaml.subscriber.layer.shm.enable);
     EXPECT_EQ(config.subscriber.layer.udp.enable, config_from_yaml.subscriber.layer.udp.enable);
     EXPECT_EQ(config.subscriber.layer.tcp.enable, config_from_yaml.subscriber.layer.tcp.enable);
     EXPECT_EQ(config.subscriber.drop_out_of_order_messages, config_from_yaml.subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(config.subscriber.history_depth, config_from_yaml.subscriber.history_depth);
+    EXPECT_EQ(config.subscriber.max_frequency, config_from_yaml.subscriber.max_frequency);
     EXPECT_EQ(config.timesync.timesync_module_replay, config_from_yaml.timesync.timesync_module_replay);
     EXPECT_EQ(config.timesync.timesync_module_rt, config_from_yaml.timesync.timesync_module_rt);
     EXPECT_EQ(config.application.startup.terminal_emulator, config_from_yaml.application.startup.terminal_emulator);
@@ -166,6 +198,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     // Compare all values of the config struct with the encoded and decoded config struct
     EXPECT_EQ(config.communication_mode, config_from_yaml_config.communication_mode);
     EXPECT_EQ(config.registration.registration_refresh, config_from_yaml_config.registration.registration_refresh);
+    EXPECT_EQ(config.registration.descriptor_refresh, config_from_yaml_config.registration.descriptor_refresh);
+    EXPECT_EQ(config.registration.interest_filter, config_from_yaml_config.registration.interest_filter);
     EXPECT_EQ(config.registration.registration_timeout, config_from_yaml_config.registration.registration_timeout);
     EXPECT_EQ(config.registration.loopback, config_from_yaml_config.registration.loopback);
     EXPECT_EQ(config.registration.shm_transport_domain, config_from_yaml_config.registration.shm_transport_domain);
@@ -195,14 +229,28 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.publisher.layer.shm.memfile_buffer_count, config_from_yaml_config.publisher.layer.shm.memfile_buffer_count);
     EXPECT_EQ(config.publisher.layer.shm.memfile_min_size_bytes, config_from_yaml_config.publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(config.publisher.layer.shm.memfile_reserve_percent, config_from_yaml_config.publisher.layer.shm.memfile_reserve_percent);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_huge_pages, config_from_yaml_config.publisher.layer.shm.memfile_huge_pages);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_prefault, config_from_yaml_config.publisher.layer.shm.memfile_prefault);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_lock, config_from_yaml_config.publisher.layer.shm.memfile_lock);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_numa_local, config_from_yaml_config.publisher.layer.shm.memfile_numa_local);
     EXPECT_EQ(config.publisher.layer.udp.enable, config_from_yaml_config.publisher.layer.udp.enable);
+    EXPECT_EQ(config.publisher.layer.udp.retransmit_window, config_from_yaml_config.publisher.layer.udp.retransmit_window);
+    EXPECT_EQ(config.publisher.layer.udp.repair_rate_limit, config_from_yaml_config.publisher.layer.udp.repair_rate_limit);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_latency_us, config_from_yaml_config.publisher.layer.udp.coalescing_latency_us);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_size, config_from_yaml_config.publisher.layer.udp.coalescing_max_size);
     EXPECT_EQ(config.publisher.layer.tcp.enable, config_from_yaml_config.publisher.layer.tcp.enable);
+    EXPECT_EQ(config.publisher.layer.tcp.multiplexed, config_from_yaml_config.publisher.layer.tcp.multiplexed);
     EXPECT_EQ(config.publisher.layer_priority_local, config_from_yaml_config.publisher.layer_priority_local);
     EXPECT_EQ(config.publisher.layer_priority_remote, config_from_yaml_config.publisher.layer_priority_remote);
+    EXPECT_EQ(config.publisher.send_queue.enable, config_from_yaml_config.publisher.send_queue.enable);
+    EXPECT_EQ(config.publisher.send_queue.capacity, config_from_yaml_config.publisher.send_queue.capacity);
+    EXPECT_EQ(config.publisher.send_queue.overflow_policy, config_from_yaml_config.publisher.send_queue.overflow_policy);
     EXPECT_EQ(config.subscriber.layer.shm.enable, config_from_yaml_config.subscriber.layer.shm.enable);
     EXPECT_EQ(config.subscriber.layer.udp.enable, config_from_yaml_config.subscriber.layer.udp.enable);
     EXPECT_EQ(config.subscriber.layer.tcp.enable, config_from_yaml_config.subscriber.layer.tcp.enable);
     EXPECT_EQ(config.subscriber.drop_out_of_order_messages, config_from_yaml_config.subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(config.subscriber.history_depth, config_from_yaml_config.subscriber.history_depth);
+    EXPECT_EQ(config.subscriber.max_frequency, config_from_yaml_config.subscriber.max_frequency);
     EXPECT_EQ(config.timesync.timesync_module_replay, config_from_yaml_config.timesync.timesync_module_replay);
     EXPECT_EQ(config.timesync.timesync_module_rt, config_from_yaml_config.timesync.timesync_module_rt);
     EXPECT_EQ(config.application.startup.terminal_emulator, config_from_yaml_config.application.startup.terminal_emulator);
@@ -259,6 +307,7 @@ TEST(core_cpp_config /*unused*/, parse_values_test /*unused*/)
 
   // Check boolean
   EXPECT_EQ(config.transport_layer.udp.npcap_enabled, true);
+  EXPECT_EQ(config.publisher.layer.shm.memfile_prefault, true);
 
   // Check unsigned size_t
   EXPECT_EQ(config.transport_layer.tcp.max_reconnections, 7);
@@ -419,3 +419,85 @@ TEST(core_cpp_descgate, ManyClient)
   // samples should be expired
   EXPECT_EQ(0, desc_gate.GetClientIDs().size());
 }
+
+TEST(core_cpp_descgate, DescriptorCache)
+{
+  eCAL::CDescGate desc_gate;
+
+  const std::uint64_t descriptor_hash(42);
+  std::string descriptor;
+
+  // unknown descriptor
+  EXPECT_FALSE(desc_gate.GetDescriptor(descriptor_hash, descriptor));
+  EXPECT_TRUE(descriptor.empty());
+
+  // a publisher with a full descriptor fills the cache
+  auto pub1 = CreatePublisher("pub1", 1);
+  pub1.topic.datatype_information.descriptor = "descriptor-42";
+  pub1.topic.datatype_descriptor_hash        = descriptor_hash;
+  desc_gate.ApplySample(pub1, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.GetDescriptor(descriptor_hash, descriptor));
+  EXPECT_EQ("descriptor-42", descriptor);
+
+  // descriptors are content addressed, the first one for a hash stays valid
+  auto pub2 = CreatePublisher("pub2", 2);
+  pub2.topic.datatype_information.descriptor = "descriptor-43";
+  pub2.topic.datatype_descriptor_hash        = descriptor_hash;
+  desc_gate.ApplySample(pub2, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.GetDescriptor(descriptor_hash, descriptor));
+  EXPECT_EQ("descriptor-42", descriptor);
+
+  // a hash only sample must not wipe the known descriptor of the entity
+  auto pub1_hash_only = pub1;
+  pub1_hash_only.topic.datatype_information.descriptor.clear();
+  desc_gate.ApplySample(pub1_hash_only, eCAL::tl_none);
+  eCAL::STopicId pub1_id;
+  pub1_id.topic_id.entity_id = 1;
+  pub1_id.topic_name         = "pub1";
+  eCAL::SDataTypeInformation topic_info;
+  EXPECT_TRUE(desc_gate.GetPublisherInfo(pub1_id, topic_info));
+  EXPECT_EQ("descriptor-42", topic_info.descriptor);
+
+  // the descriptor stays cached as long as one entity references it
+  auto pub1_unreg = pub1;
+  pub1_unreg.cmd_type = eCAL::bct_unreg_publisher;
+  desc_gate.ApplySample(pub1_unreg, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.GetDescriptor(descriptor_hash, descriptor));
+
+  // and is evicted with the last one
+  auto pub2_unreg = pub2;
+  pub2_unreg.cmd_type = eCAL::bct_unreg_publisher;
+  desc_gate.ApplySample(pub2_unreg, eCAL::tl_none);
+  EXPECT_FALSE(desc_gate.GetDescriptor(descriptor_hash, descriptor));
+
+  // hash 0 means "no hash" and is never cached
+  auto pub3 = CreatePublisher("pub3", 3);
+  desc_gate.ApplySample(pub3, eCAL::tl_none);
+  EXPECT_FALSE(desc_gate.GetDescriptor(0, descriptor));
+}
+
+TEST(core_cpp_descgate, DescriptorHashSupport)
+{
+  eCAL::CDescGate desc_gate;
+  EXPECT_TRUE(desc_gate.AllProcessesSupportDescriptorHash());
+
+  eCAL::Registration::Sample process_sample;
+  process_sample.cmd_type                       = eCAL::bct_reg_process;
+  process_sample.identifier.process_id          = 1;
+  process_sample.identifier.host_name           = "host";
+  process_sample.process.descriptor_hash_support = true;
+  desc_gate.ApplySample(process_sample, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.AllProcessesSupportDescriptorHash());
+
+  // an older process does not advertise the support
+  auto legacy_sample = process_sample;
+  legacy_sample.identifier.process_id           = 2;
+  legacy_sample.process.descriptor_hash_support = false;
+  desc_gate.ApplySample(legacy_sample, eCAL::tl_none);
+  EXPECT_FALSE(desc_gate.AllProcessesSupportDescriptorHash());
+
+  // until it is gone
+  legacy_sample.cmd_type = eCAL::bct_unreg_process;
+  desc_gate.ApplySample(legacy_sample, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.AllProcessesSupportDescriptorHash());
+}
@@ -32,6 +32,12 @@
 #include <gtest/gtest.h>
 #include <vector>
 
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 namespace eCAL
 {
   std::shared_ptr<CMemFileMap> g_memfile_map()
@@ -300,3 +306,162 @@ TEST(core_cpp_core, MemFile_Concurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+#ifndef _WIN32
+TEST(core_cpp_core, MemFile_SharedReadAccess)
+{
+  const std::string memfile_name = "my_shared_memory_file";
+  const std::string content      = "Hello World";
+
+  eCAL::CMemoryFile writer(eCAL::g_memfile_map());
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(content.size(), writer.WriteBuffer(content.data(), content.size(), 0));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  // reader1 shares the file handle with the writer, reader2 simulates a reader in another process
+  eCAL::CMemoryFile reader1(eCAL::g_memfile_map());
+  eCAL::CMemoryFile reader2(std::make_shared<eCAL::CMemFileMap>());
+  EXPECT_EQ(true, reader1.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader2.Create(memfile_name.c_str(), false));
+
+  // both readers access the memory file at the same time
+  EXPECT_EQ(true, reader1.GetReadAccess(100));
+  EXPECT_EQ(true, reader2.GetReadAccess(100));
+  EXPECT_EQ(true, reader1.HasSharedReadAccess());
+  EXPECT_EQ(true, reader2.HasSharedReadAccess());
+
+  std::string read_s(content.size(), '\0');
+  EXPECT_EQ(content.size(), reader1.Read(&read_s[0], read_s.size(), 0));
+  EXPECT_EQ(content, read_s);
+  EXPECT_EQ(content.size(), reader2.Read(&read_s[0], read_s.size(), 0));
+  EXPECT_EQ(content, read_s);
+
+  // the writer has to wait for all readers
+  EXPECT_EQ(false, writer.GetWriteAccess(10));
+  EXPECT_EQ(true, reader1.ReleaseReadAccess());
+  EXPECT_EQ(false, writer.GetWriteAccess(10));
+  EXPECT_EQ(true, reader2.ReleaseReadAccess());
+  EXPECT_EQ(true, writer.GetWriteAccess(10));
+
+  // new readers have to wait for the writer
+  EXPECT_EQ(false, reader1.GetReadAccess(10));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+  EXPECT_EQ(true, reader1.GetReadAccess(10));
+  EXPECT_EQ(true, reader1.ReleaseReadAccess());
+
+  EXPECT_EQ(true, reader1.Destroy(false));
+  EXPECT_EQ(true, reader2.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFile_SharedReadAccessCrashedReader)
+{
+  const std::string memfile_name = "my_crashed_reader_memory_file";
+
+  eCAL::CMemoryFile writer(eCAL::g_memfile_map());
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+
+  int pipe_fds[2];
+  ASSERT_EQ(0, pipe(pipe_fds));
+
+  // the child process gets shared read access and never releases it
+  const pid_t child = fork();
+  ASSERT_NE(-1, child);
+  if (child == 0)
+  {
+    eCAL::CMemoryFile reader(std::make_shared<eCAL::CMemFileMap>());
+    const char state = (reader.Create(memfile_name.c_str(), false) && reader.GetReadAccess(100) && reader.HasSharedReadAccess()) ? 1 : 0;
+    if (write(pipe_fds[1], &state, 1) != 1) _exit(1);
+    for (;;) pause();
+  }
+
+  char state = 0;
+  EXPECT_EQ(1, read(pipe_fds[0], &state, 1));
+  EXPECT_EQ(1, state);
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+
+  // the writer has to wait for the reader
+  EXPECT_EQ(false, writer.GetWriteAccess(10));
+
+  // the lock of the reader is released with its process
+  kill(child, SIGKILL);
+  waitpid(child, nullptr, 0);
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+#endif
+
+#ifndef _WIN32
+TEST(core_cpp_core, MemFile_Grow)
+{
+  const std::string memfile_name = "my_growing_memory_file";
+  const std::string content(64 * 1024, 'x');
+
+  eCAL::CMemoryFile writer(eCAL::g_memfile_map());
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+
+  // use a separate memory file map to simulate a reader in another process
+  eCAL::CMemoryFile reader(std::make_shared<eCAL::CMemFileMap>());
+  EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+
+  // too large for the current file
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(0, writer.WriteBuffer(content.data(), content.size(), 0));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  // grow in place, the file name does not change
+  EXPECT_EQ(true, writer.Grow(content.size(), 100));
+  EXPECT_EQ(content.size(), writer.MaxDataSize());
+  EXPECT_EQ(memfile_name, writer.Name());
+
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(content.size(), writer.WriteBuffer(content.data(), content.size(), 0));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  // the reader maps the larger file on its next access
+  std::string read_s(content.size(), '\0');
+  EXPECT_EQ(true, reader.GetReadAccess(100));
+  EXPECT_EQ(content.size(), reader.MaxDataSize());
+  EXPECT_EQ(content.size(), reader.Read(&read_s[0], read_s.size(), 0));
+  EXPECT_EQ(true, reader.ReleaseReadAccess());
+  EXPECT_EQ(content, read_s);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+#endif
+
+TEST(core_cpp_core, MemFile_Options)
+{
+  const std::string memfile_name = "my_prefaulted_memory_file";
+  const std::string content(256 * 1024, 'x');
+
+  // the options are hints, the memory file has to work even if the system refuses them
+  eCAL::SMemFileOptions options;
+  options.huge_pages = true;
+  options.prefault   = true;
+  options.lock       = true;
+  options.numa_local = true;
+
+  eCAL::CMemoryFile writer(eCAL::g_memfile_map());
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, content.size(), false, options));
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(content.size(), writer.WriteBuffer(content.data(), content.size(), 0));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  eCAL::CMemoryFile reader(std::make_shared<eCAL::CMemFileMap>());
+  EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+
+  std::string read_s(content.size(), '\0');
+  EXPECT_EQ(true, reader.GetReadAccess(100));
+  EXPECT_EQ(content.size(), reader.Read(&read_s[0], read_s.size(), 0));
+  EXPECT_EQ(true, reader.ReleaseReadAccess());
+  EXPECT_EQ(content, read_s);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
@@ -0,0 +1,153 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "io/tcp/ecal_tcp_mux_client.h"
+#include "io/tcp/ecal_tcp_mux_executor.h"
+#include "io/tcp/ecal_tcp_mux_server.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace
+{
+  // samples received by a multiplexed client, the header of every test sample is the sending topic id
+  class CReceivedSamples
+  {
+  public:
+    void Apply(const char* buffer_, size_t size_)
+    {
+      const std::string sample(buffer_, size_);
+      const auto separator = sample.find(':');
+      if (separator == std::string::npos) return;
+
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_last_sample[std::stoull(sample.substr(0, separator))] = sample.substr(separator + 1);
+    }
+
+    std::string GetLastSample(eCAL::EntityIdT topic_id_)
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      const auto iter = m_last_sample.find(topic_id_);
+      return (iter != m_last_sample.end()) ? iter->second : std::string();
+    }
+
+  private:
+    std::mutex                              m_mutex;
+    std::map<eCAL::EntityIdT, std::string>  m_last_sample;
+  };
+
+  bool Send(eCAL::TCP::CMuxServer& server_, eCAL::EntityIdT topic_id_, const std::string& content_)
+  {
+    const std::string header = std::to_string(topic_id_) + ":";
+    return server_.Send(topic_id_, header.data(), header.size(), content_.data(), content_.size());
+  }
+
+  // the subscription reaches the server asynchronously, so the sample is repeated until it arrives
+  bool SendUntilReceived(eCAL::TCP::CMuxServer& server_, CReceivedSamples& received_, eCAL::EntityIdT topic_id_, const std::string& content_)
+  {
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < timeout)
+    {
+      Send(server_, topic_id_, content_);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      if (received_.GetLastSample(topic_id_) == content_) return true;
+    }
+    return false;
+  }
+
+  std::shared_ptr<eCAL::TCP::CMuxClient> CreateClient(eCAL::TCP::CMuxExecutor& executor_, uint16_t port_, CReceivedSamples& received_)
+  {
+    auto client = std::make_shared<eCAL::TCP::CMuxClient>(executor_.GetIoContext(), eCAL::TCP::CMuxClient::EndpointListT{ { "127.0.0.1", port_ } }, 0,
+      [&received_](const char* buffer_, size_t size_) { received_.Apply(buffer_, size_); });
+    client->Start();
+    return client;
+  }
+}
+
+TEST(core_cpp_io_tcp_mux, OneConnectionForAllTopics)
+{
+  eCAL::TCP::CMuxServer server(1, "127.0.0.1");
+  ASSERT_TRUE(server.IsOpen());
+
+  eCAL::TCP::CMuxExecutor executor(1);
+  CReceivedSamples        received;
+  auto client = CreateClient(executor, server.GetPort(), received);
+
+  // all publishers of the publishing process share the connection
+  client->Subscribe(1, "A");
+  client->Subscribe(2, "B");
+  client->Subscribe(3, "C");
+
+  EXPECT_TRUE(SendUntilReceived(server, received, 1, "a"));
+  EXPECT_TRUE(SendUntilReceived(server, received, 2, "b"));
+  EXPECT_TRUE(SendUntilReceived(server, received, 3, "c"));
+
+  EXPECT_EQ(server.GetSessionCount(), 1u);
+
+  client->Stop();
+  executor.Shutdown();
+}
+
+TEST(core_cpp_io_tcp_mux, PublishersOfTheSameTopic)
+{
+  const int send_count = 1000;
+
+  eCAL::TCP::CMuxServer server(1, "127.0.0.1");
+  ASSERT_TRUE(server.IsOpen());
+
+  eCAL::TCP::CMuxExecutor executor(1);
+  CReceivedSamples        received;
+  auto client = CreateClient(executor, server.GetPort(), received);
+
+  // two publishers with the same topic name
+  client->Subscribe(1, "A");
+  client->Subscribe(2, "A");
+  ASSERT_TRUE(SendUntilReceived(server, received, 1, "start"));
+  ASSERT_TRUE(SendUntilReceived(server, received, 2, "start"));
+
+  // only older samples of the same publisher may be replaced, so the newest sample of both arrives
+  for (int i = 0; i < send_count; ++i)
+  {
+    EXPECT_TRUE(Send(server, 1, std::to_string(i)));
+    EXPECT_TRUE(Send(server, 2, std::to_string(i)));
+  }
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while ((std::chrono::steady_clock::now() < timeout)
+    && ((received.GetLastSample(1) != std::to_string(send_count - 1)) || (received.GetLastSample(2) != std::to_string(send_count - 1))))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(received.GetLastSample(1), std::to_string(send_count - 1));
+  EXPECT_EQ(received.GetLastSample(2), std::to_string(send_count - 1));
+
+  // unsubscribing the topic leaves all of its publishers
+  client->Unsubscribe("A");
+  EXPECT_EQ(client->GetTopicCount(), 0u);
+
+  client->Stop();
+  executor.Shutdown();
+}
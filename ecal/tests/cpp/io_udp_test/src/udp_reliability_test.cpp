@@ -0,0 +1,206 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "io/udp/ecal_udp_sample_receiver.h"
+#include "io/udp/ecal_udp_sample_reliability.h"
+#include "io/udp/ecal_udp_sample_sender.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  std::vector<char> Frame(const std::string& content_)
+  {
+    return std::vector<char>(content_.begin(), content_.end());
+  }
+
+  struct SStreamRecorder
+  {
+    std::vector<std::string>           delivered;
+    std::vector<std::vector<uint64_t>> nacks;
+
+    eCAL::UDP::CReliableReceiveStream::DeliverFunctionT Deliver()
+    {
+      return [this](const char* frame_, size_t frame_size_) { delivered.emplace_back(frame_, frame_size_); };
+    }
+
+    eCAL::UDP::CReliableReceiveStream::NackFunctionT Nack()
+    {
+      return [this](const std::vector<uint64_t>& sequences_) { nacks.push_back(sequences_); };
+    }
+  };
+
+  void Apply(eCAL::UDP::CReliableReceiveStream& stream_, SStreamRecorder& recorder_, uint64_t sequence_, std::chrono::steady_clock::time_point now_)
+  {
+    const std::string frame = std::to_string(sequence_);
+    stream_.Apply(sequence_, frame.data(), frame.size(), now_, recorder_.Deliver(), recorder_.Nack());
+  }
+}
+
+TEST(core_cpp_io_udp, ReliabilityHeader)
+{
+  char header[eCAL::UDP::g_reliability_header_size];
+  eCAL::UDP::WriteReliabilityHeader(header, 0x0102030405060708ULL);
+
+  uint64_t sequence(0);
+  EXPECT_TRUE(eCAL::UDP::ReadReliabilityHeader(header, sizeof(header), sequence));
+  EXPECT_EQ(0x0102030405060708ULL, sequence);
+
+  // too short or unknown version
+  EXPECT_FALSE(eCAL::UDP::ReadReliabilityHeader(header, sizeof(header) - 1, sequence));
+  header[0] = 42;
+  EXPECT_FALSE(eCAL::UDP::ReadReliabilityHeader(header, sizeof(header), sequence));
+
+  // nack round trip
+  std::vector<char>     nack_buffer;
+  std::vector<uint64_t> sequences;
+  eCAL::UDP::SerializeNack({ 1, 5, 0xFFFFFFFFFFULL }, nack_buffer);
+  EXPECT_TRUE(eCAL::UDP::DeserializeNack(nack_buffer.data(), nack_buffer.size(), sequences));
+  EXPECT_EQ(std::vector<uint64_t>({ 1, 5, 0xFFFFFFFFFFULL }), sequences);
+  EXPECT_FALSE(eCAL::UDP::DeserializeNack(nack_buffer.data(), nack_buffer.size() - 1, sequences));
+}
+
+TEST(core_cpp_io_udp, ReliableStreamRepairsGap)
+{
+  eCAL::UDP::CReliableReceiveStream stream;
+  SStreamRecorder recorder;
+  const auto now = std::chrono::steady_clock::now();
+
+  // 1 and 2 are lost
+  Apply(stream, recorder, 0, now);
+  Apply(stream, recorder, 3, now);
+  Apply(stream, recorder, 4, now);
+  EXPECT_EQ(std::vector<std::string>({ "0" }), recorder.delivered);
+  ASSERT_EQ(1, recorder.nacks.size());
+  EXPECT_EQ(std::vector<uint64_t>({ 1, 2 }), recorder.nacks[0]);
+
+  // repairs arrive, everything is delivered in order
+  Apply(stream, recorder, 2, now);
+  Apply(stream, recorder, 1, now);
+  EXPECT_EQ(std::vector<std::string>({ "0", "1", "2", "3", "4" }), recorder.delivered);
+
+  // late duplicate
+  Apply(stream, recorder, 2, now);
+  EXPECT_EQ(5, recorder.delivered.size());
+  EXPECT_EQ(1, recorder.nacks.size());
+}
+
+TEST(core_cpp_io_udp, ReliableStreamSkipsUnrepairedGap)
+{
+  eCAL::UDP::CReliableReceiveStream stream;
+  SStreamRecorder recorder;
+  auto now = std::chrono::steady_clock::now();
+
+  Apply(stream, recorder, 10, now);
+  Apply(stream, recorder, 12, now);
+  EXPECT_EQ(1, recorder.nacks.size());
+
+  // the nack is repeated, then the gap is given up
+  for (unsigned int i = 0; i <= eCAL::UDP::CReliableReceiveStream::nack_attempts; ++i)
+  {
+    EXPECT_EQ(std::vector<std::string>({ "10" }), recorder.delivered);
+    now += eCAL::UDP::CReliableReceiveStream::nack_interval;
+    stream.Poll(now, recorder.Deliver(), recorder.Nack());
+  }
+  EXPECT_EQ(std::vector<std::string>({ "10", "12" }), recorder.delivered);
+  EXPECT_EQ(1 + eCAL::UDP::CReliableReceiveStream::nack_attempts, recorder.nacks.size());
+
+  // a repair arriving after that is dropped
+  Apply(stream, recorder, 11, now);
+  Apply(stream, recorder, 13, now);
+  EXPECT_EQ(std::vector<std::string>({ "10", "12", "13" }), recorder.delivered);
+}
+
+TEST(core_cpp_io_udp, RetransmitWindowLimitsRepairs)
+{
+  // 4 samples, 100 bytes per second
+  eCAL::UDP::CRetransmitWindow window(4, 100);
+  for (uint64_t sequence = 0; sequence < 5; ++sequence)
+  {
+    window.Store(sequence) = Frame(std::string(60, 'a'));
+  }
+  auto now = std::chrono::steady_clock::now();
+
+  // 0 has been overwritten by 4
+  EXPECT_EQ(nullptr, window.Repair(0, now));
+  EXPECT_NE(nullptr, window.Repair(4, now));
+
+  // multiple requests for the same sample are answered once
+  EXPECT_EQ(nullptr, window.Repair(4, now));
+
+  // the repair rate is exhausted after 120 bytes
+  EXPECT_NE(nullptr, window.Repair(3, now));
+  EXPECT_EQ(nullptr, window.Repair(2, now));
+
+  // and refilled after a while
+  now += std::chrono::seconds(1);
+  EXPECT_NE(nullptr, window.Repair(2, now));
+}
+
+TEST(core_cpp_io_udp, ReliableLoopbackWithInjectedLoss)
+{
+  std::mutex               received_mutex;
+  std::vector<std::string> received;
+
+  eCAL::UDP::SReceiverAttr receiver_attr;
+  receiver_attr.address  = "239.0.0.42";
+  receiver_attr.port     = 14042;
+  receiver_attr.loopback = true;
+  eCAL::UDP::CSampleReceiver receiver(receiver_attr,
+    [](const std::string& sample_name_) { return sample_name_ == "reliable"; },
+    [&received_mutex, &received](const char* data_, size_t size_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received.emplace_back(data_, size_);
+    });
+
+  // every 4th sample is lost on its first transmission
+  eCAL::UDP::SSenderAttr sender_attr;
+  sender_attr.address            = receiver_attr.address;
+  sender_attr.port               = receiver_attr.port;
+  sender_attr.ttl                = 0;
+  sender_attr.loopback           = true;
+  sender_attr.retransmit_window  = 16;
+  sender_attr.test_drop_interval = 4;
+  eCAL::UDP::CSampleSender sender(sender_attr);
+
+  // let the receiver join
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // the last sample (20) is not dropped, so every gap is detected
+  std::vector<std::string> sent;
+  for (int i = 0; i <= 20; ++i)
+  {
+    sent.push_back(std::to_string(i));
+    sender.Send("reliable", Frame(sent.back()));
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  const std::lock_guard<std::mutex> lock(received_mutex);
+  EXPECT_EQ(sent, received);
+}
@@ -57,6 +57,7 @@ TEST(core_cpp_pubsub, TimeoutAcknowledgment)
   // create publisher config
   eCAL::Publisher::Configuration pub_config;
   pub_config.layer.shm.acknowledge_timeout_ms = 500;
+  pub_config.layer.inproc.enable = false;
 
   // create publisher
   eCAL::CPublisher pub("topic", {}, pub_config);
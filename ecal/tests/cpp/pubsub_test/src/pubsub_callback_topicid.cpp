@@ -38,6 +38,8 @@ namespace eCAL
       *os << "TCP ";
     if (config.publisher.layer.udp.enable)
       *os << "UDP ";
+    if (config.publisher.layer.inproc.enable)
+      *os << "INPROC ";
   }
 }
 
@@ -55,10 +57,12 @@ eCAL::Configuration GetTestingConfig()
   config.publisher.layer.shm.enable = false;
   config.publisher.layer.udp.enable = false;
   config.publisher.layer.tcp.enable = false;
+  config.publisher.layer.inproc.enable = false;
 
   config.subscriber.layer.shm.enable = false;
   config.subscriber.layer.udp.enable = false;
   config.subscriber.layer.tcp.enable = false;
+  config.subscriber.layer.inproc.enable = false;
 
   return config;
 }
@@ -88,6 +92,14 @@ eCAL::Configuration EnableSHM(const eCAL::Configuration& config_)
   return config;
 }
 
+eCAL::Configuration EnableINPROC(const eCAL::Configuration& config_)
+{
+  eCAL::Configuration config(config_);
+  config.publisher.layer.inproc.enable = true;
+  config.subscriber.layer.inproc.enable = true;
+  return config;
+}
+
 
 // test fixture class
 class TestFixture : public ::testing::TestWithParam<eCAL::Configuration>
@@ -195,6 +207,7 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     EnableSHM(GetTestingConfig()),
     EnableUDP(GetTestingConfig()),
-    EnableTCP(GetTestingConfig())
+    EnableTCP(GetTestingConfig()),
+    EnableINPROC(GetTestingConfig())
   )
 );
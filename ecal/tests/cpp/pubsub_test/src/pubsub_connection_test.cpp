@@ -42,6 +42,7 @@ TEST(core_cpp_pubsub, TestSubscriberIsPublishedTiming)
   auto publisher_function = [&do_start_publication, &publication_finished, &subscriber_seen_at_publication_start]() {
     eCAL::Publisher::Configuration pub_config;
     pub_config.layer.shm.acknowledge_timeout_ms = 500;
+    pub_config.layer.inproc.enable = false;
     eCAL::CPublisher pub("blob", eCAL::SDataTypeInformation(), pub_config);
 
     int pub_count(0);
@@ -141,6 +142,7 @@ TEST(core_cpp_pubsub, TestPublisherIsSubscribedTiming)
   auto publisher_function = [&do_start_publication, &publication_finished]() {
     eCAL::Publisher::Configuration pub_config;
     pub_config.layer.shm.acknowledge_timeout_ms = 500;
+    pub_config.layer.inproc.enable = false;
     eCAL::CPublisher pub("blob", eCAL::SDataTypeInformation(), pub_config);
 
     int cnt(0);
@@ -85,6 +85,7 @@ std::vector<char> multibuffer_pub_sub_test(int buffer_count, bool zero_copy, int
   pub_config.layer.shm.enable = true;
   pub_config.layer.udp.enable = false;
   pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
   // set zero copy mode
   pub_config.layer.shm.zero_copy_mode = zero_copy;
   // set number of memory buffer
@@ -0,0 +1,282 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <cstddef>
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+enum {
+  CMN_REGISTRATION_REFRESH_MS = 1000,
+  DATA_FLOW_TIME_MS = 50,
+};
+
+namespace
+{
+  eCAL::Publisher::Configuration GetInProcPublisherConfig()
+  {
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable    = false;
+    pub_config.layer.udp.enable    = false;
+    pub_config.layer.tcp.enable    = false;
+    pub_config.layer.inproc.enable = true;
+    pub_config.layer_priority_local = { eCAL::TransportLayer::eType::inproc };
+    return pub_config;
+  }
+
+  eCAL::Subscriber::Configuration GetInProcSubscriberConfig()
+  {
+    eCAL::Subscriber::Configuration sub_config;
+    sub_config.layer.inproc.enable = true;
+    return sub_config;
+  }
+}
+
+TEST(core_cpp_pubsub, ZeroPayloadMessageINPROC)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), GetInProcSubscriberConfig());
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), GetInProcPublisherConfig());
+
+  // add callback
+  std::atomic<size_t> received_bytes(0);
+  std::atomic<size_t> received_count(0);
+  sub.SetReceiveCallback([&received_bytes, &received_count](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      received_bytes += data_.buffer_size;
+      received_count++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  EXPECT_TRUE(pub.Send(std::string()));
+  EXPECT_TRUE(pub.Send(nullptr, 0));
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // check callback receive
+  EXPECT_EQ(0, received_bytes);
+  EXPECT_EQ(2, received_count);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, MultipleSendsINPROC)
+{
+  // default send string
+  const std::vector<std::string> send_vector{ "this", "is", "a", "", "testtest" };
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), GetInProcSubscriberConfig());
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), GetInProcPublisherConfig());
+
+  // add callback
+  std::mutex               received_mutex;
+  std::vector<std::string> received_msgs;
+  std::vector<long long>   received_timestamps;
+  std::thread::id          callback_thread_id;
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received_msgs.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      received_timestamps.push_back(data_.send_timestamp);
+      callback_thread_id = std::this_thread::get_id();
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  long long timestamp = 1;
+  for (const auto& elem : send_vector)
+  {
+    EXPECT_TRUE(pub.Send(elem, timestamp));
+    timestamp++;
+  }
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // all samples are received in order, on the receive thread of the subscriber
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    EXPECT_EQ(send_vector, received_msgs);
+    EXPECT_EQ(std::vector<long long>({ 1, 2, 3, 4, 5 }), received_timestamps);
+    EXPECT_NE(std::this_thread::get_id(), callback_thread_id);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, SlowSubscriberINPROC)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), GetInProcSubscriberConfig());
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), GetInProcPublisherConfig());
+
+  // add a callback that stalls until it is released
+  std::atomic<bool>   callback_entered(false);
+  std::atomic<bool>   callback_released(false);
+  std::atomic<size_t> received_count(0);
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      callback_entered = true;
+      while (!callback_released) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      received_count++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // the stalled callback does not block the publisher
+  EXPECT_TRUE(pub.Send("first"));
+  while (!callback_entered) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  const auto send_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 100; ++i)
+  {
+    EXPECT_TRUE(pub.Send(std::to_string(i)));
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - send_start, std::chrono::seconds(1));
+
+  // the subscriber only keeps the newest samples while it is stalled
+  callback_released = true;
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  EXPECT_GT(received_count, 1);
+  EXPECT_LT(received_count, 101);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, DisabledSubscriberINPROC)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A" that does not accept inner process samples
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.layer.inproc.enable = false;
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), sub_config);
+
+  // create publisher for topic "A" that can only use the inner process layer
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), GetInProcPublisherConfig());
+
+  // add callback
+  std::atomic<size_t> received_count(0);
+  sub.SetReceiveCallback([&received_count](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      received_count++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // no common layer, nothing should be received
+  pub.Send("hello");
+  eCAL::Process::SleepMS(50);
+  EXPECT_EQ(0, received_count);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, SubscriberHistoryINPROC)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A" that keeps the last 3 samples
+  eCAL::Subscriber::Configuration sub_config = GetInProcSubscriberConfig();
+  sub_config.history_depth = 3;
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), sub_config);
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), GetInProcPublisherConfig());
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // nothing received yet
+  eCAL::SHistorySample sample;
+  EXPECT_FALSE(sub.Take(sample));
+  EXPECT_FALSE(sub.Peek(sample));
+
+  // send 5 samples, only the last 3 are kept
+  for (long long i = 1; i <= 5; ++i)
+  {
+    EXPECT_TRUE(pub.Send(std::to_string(i), i));
+  }
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // peek returns the oldest sample without removing it
+  EXPECT_TRUE(sub.Peek(sample));
+  EXPECT_EQ("3", sample.buffer);
+  EXPECT_EQ(3, sample.send_timestamp);
+  EXPECT_EQ(pub.GetTopicId(), sample.publisher_id);
+
+  // take returns the same sample
+  EXPECT_TRUE(sub.Take(sample));
+  EXPECT_EQ("3", sample.buffer);
+
+  // read batch returns the remaining samples, oldest first
+  std::vector<eCAL::SHistorySample> samples(3);
+  EXPECT_EQ(2, sub.ReadBatch(samples));
+  ASSERT_EQ(3, samples.size()); // the vector is not shrunk
+  EXPECT_EQ("4", samples[0].buffer);
+  EXPECT_EQ("5", samples[1].buffer);
+
+  // history is empty now
+  EXPECT_FALSE(sub.Take(sample));
+  EXPECT_EQ(0, sub.ReadBatch(samples));
+  EXPECT_EQ(3, samples.size());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -78,6 +78,7 @@ TEST(core_cpp_pubsub_multilayer, MultiLayerNoDuplicateMessages)
   pub_config.layer.shm.enable = true;
   pub_config.layer.udp.enable = true;
   pub_config.layer.tcp.enable = true;
+  pub_config.layer.inproc.enable = false;
 
   eCAL::Subscriber::Configuration sub_shm_config;
   sub_shm_config.layer.shm.enable = true;
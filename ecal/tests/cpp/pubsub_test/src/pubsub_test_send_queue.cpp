@@ -0,0 +1,105 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+enum {
+  CMN_REGISTRATION_REFRESH_MS = 1000,
+};
+
+namespace
+{
+  eCAL::Publisher::Configuration GetSendQueuePublisherConfig(unsigned int capacity_, eCAL::Publisher::SendQueue::eOverflowPolicy overflow_policy_)
+  {
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable    = false;
+    pub_config.layer.udp.enable    = false;
+    pub_config.layer.tcp.enable    = false;
+    pub_config.layer.inproc.enable = true;
+    pub_config.layer_priority_local = { eCAL::TransportLayer::eType::inproc };
+
+    pub_config.send_queue.enable          = true;
+    pub_config.send_queue.capacity        = capacity_;
+    pub_config.send_queue.overflow_policy = overflow_policy_;
+    return pub_config;
+  }
+
+  eCAL::Subscriber::Configuration GetInProcSubscriberConfig()
+  {
+    eCAL::Subscriber::Configuration sub_config;
+    sub_config.layer.inproc.enable = true;
+    return sub_config;
+  }
+}
+
+TEST(core_cpp_pubsub, SendQueueINPROC)
+{
+  // default send string
+  const std::vector<std::string> send_vector{ "this", "is", "a", "send", "queue", "test" };
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), GetInProcSubscriberConfig());
+
+  // create publisher for topic "A" with an asynchronous send queue
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), GetSendQueuePublisherConfig(16, eCAL::Publisher::SendQueue::eOverflowPolicy::block));
+
+  // add callback
+  std::mutex               received_mutex;
+  std::vector<std::string> received_msgs;
+  std::thread::id          callback_thread_id;
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received_msgs.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      callback_thread_id = std::this_thread::get_id();
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  for (const auto& elem : send_vector)
+  {
+    EXPECT_TRUE(pub.Send(elem));
+  }
+
+  // let the writer thread drain the queue
+  eCAL::Process::SleepMS(100);
+
+  // all samples are received in order, not on the thread of the caller
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    EXPECT_EQ(send_vector, received_msgs);
+    EXPECT_NE(std::this_thread::get_id(), callback_thread_id);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -23,6 +23,7 @@
 #include <ecal/pubsub/subscriber.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -66,6 +67,7 @@ TEST(core_cpp_pubsub, ZeroPayloadMessageSHM)
   pub_config.layer.shm.enable = true;
   pub_config.layer.udp.enable = false;
   pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
 
   // create publisher for topic "A" (no zero copy)
   eCAL::CPublisher pub1("A", eCAL::SDataTypeInformation(), pub_config);
@@ -125,6 +127,7 @@ TEST(core_cpp_pubsub, MultipleSendsSHM)
   pub_config.layer.shm.enable = true;
   pub_config.layer.udp.enable = false;
   pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
 
   // create publisher for topic "A"
   eCAL::CPublisher pub("A", {}, pub_config);
@@ -189,9 +192,11 @@ TEST(core_cpp_pubsub, SubscriberFastReconnectionSHM) {
   config.publisher.layer.shm.enable = true;
   config.publisher.layer.tcp.enable = false;
   config.publisher.layer.udp.enable = false;
+  config.publisher.layer.inproc.enable = false;
   config.subscriber.layer.shm.enable = true;
   config.subscriber.layer.tcp.enable = false;
   config.subscriber.layer.udp.enable = false;
+  config.subscriber.layer.inproc.enable = false;
   config.registration.registration_refresh = REGISTRATION_REFRESH_MS;
   config.registration.registration_timeout = REGISTRATION_TIMEOUT_MS;
 
@@ -263,3 +268,57 @@ TEST(core_cpp_pubsub, SubscriberFastReconnectionSHM) {
 
   eCAL::Finalize();
 }
+
+TEST(core_cpp_pubsub, SendQueueDropNewestSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.layer.inproc.enable = false;
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), sub_config);
+
+  // create publisher for topic "A" with a send queue that can hold a single sample,
+  // the acknowledge timeout makes the writer thread wait for the subscriber callback
+  eCAL::Publisher::Configuration pub_config;
+  pub_config.layer.shm.enable                 = true;
+  pub_config.layer.shm.acknowledge_timeout_ms = 5000;
+  pub_config.layer.udp.enable                 = false;
+  pub_config.layer.tcp.enable                 = false;
+  pub_config.layer.inproc.enable              = false;
+  pub_config.send_queue.enable                = true;
+  pub_config.send_queue.capacity              = 1;
+  pub_config.send_queue.overflow_policy       = eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest;
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), pub_config);
+
+  // add a callback that stalls the writer thread until it is released
+  std::atomic<bool>   callback_entered(false);
+  std::atomic<bool>   callback_released(false);
+  std::atomic<size_t> received_count(0);
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      callback_entered = true;
+      while (!callback_released) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      received_count++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // first sample is taken by the writer thread, which waits for the acknowledge of the stalled callback
+  EXPECT_TRUE(pub.Send("first"));
+  while (!callback_entered) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  // second sample fills the queue, the third one is dropped without blocking the caller
+  EXPECT_TRUE(pub.Send("second"));
+  EXPECT_FALSE(pub.Send("third"));
+
+  // release the writer thread
+  callback_released = true;
+  eCAL::Process::SleepMS(100);
+  EXPECT_EQ(2, received_count);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
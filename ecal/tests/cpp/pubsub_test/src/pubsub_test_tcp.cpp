@@ -0,0 +1,108 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <cstddef>
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+#include <gtest/gtest.h>
+
+enum {
+  CMN_REGISTRATION_REFRESH_MS = 1000,
+  DATA_FLOW_TIME_MS = 50,
+};
+
+TEST(core_cpp_pubsub, MultiplexedTopicsTCP)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config, all publishers share one multiplexed connection
+  eCAL::Publisher::Configuration pub_config;
+  pub_config.layer.shm.enable      = false;
+  pub_config.layer.udp.enable      = false;
+  pub_config.layer.tcp.enable      = true;
+  pub_config.layer.tcp.multiplexed = true;
+  pub_config.layer.inproc.enable   = false;
+
+  // create subscriber config
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.layer.shm.enable    = false;
+  sub_config.layer.udp.enable    = false;
+  sub_config.layer.tcp.enable    = true;
+  sub_config.layer.inproc.enable = false;
+
+  // create publishers and subscribers for topic "A" and "B"
+  eCAL::CPublisher  pub_a("A", eCAL::SDataTypeInformation(), pub_config);
+  eCAL::CPublisher  pub_b("B", eCAL::SDataTypeInformation(), pub_config);
+  eCAL::CSubscriber sub_a("A", eCAL::SDataTypeInformation(), sub_config);
+  eCAL::CSubscriber sub_b("B", eCAL::SDataTypeInformation(), sub_config);
+
+  // add callbacks
+  std::atomic<size_t> received_count_a(0);
+  std::atomic<size_t> received_count_b(0);
+  std::mutex          last_received_mutex;
+  std::string         last_received_a;
+  std::string         last_received_b;
+  sub_a.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(last_received_mutex);
+        last_received_a = std::string(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      }
+      received_count_a++;
+    });
+  sub_b.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(last_received_mutex);
+        last_received_b = std::string(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      }
+      received_count_b++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send alternating on both topics
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_TRUE(pub_a.Send("A" + std::to_string(i)));
+    EXPECT_TRUE(pub_b.Send("B" + std::to_string(i)));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  // every subscriber receives the samples of its own topic only
+  EXPECT_EQ(10, received_count_a);
+  EXPECT_EQ(10, received_count_b);
+  {
+    const std::lock_guard<std::mutex> lock(last_received_mutex);
+    EXPECT_EQ("A9", last_received_a);
+    EXPECT_EQ("B9", last_received_b);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
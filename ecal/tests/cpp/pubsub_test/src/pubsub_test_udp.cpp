@@ -23,7 +23,9 @@
 #include <ecal/pubsub/subscriber.h>
 
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <mutex>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -63,6 +65,7 @@ TEST(core_cpp_pubsub, ZeroPayloadMessageUDP)
   pub_config.layer.shm.enable = false;
   pub_config.layer.udp.enable = true;
   pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
 
   // create publisher for topic "A"
   eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), pub_config);
@@ -109,6 +112,7 @@ TEST(core_cpp_pubsub, MultipleSendsUDP)
   pub_config.layer.shm.enable = false;
   pub_config.layer.udp.enable = true;
   pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
 
   // create publisher for topic "A"
   eCAL::CPublisher pub("A", {}, pub_config);
@@ -136,3 +140,128 @@ TEST(core_cpp_pubsub, MultipleSendsUDP)
   // finalize eCAL API
   eCAL::Finalize();
 }
+
+TEST(core_cpp_pubsub, RateLimitedSubscriberUDP)
+{
+  const int send_count        = 100;
+  const int send_interval_ms  = 200;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A" that only needs 5 samples per second
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.max_frequency = 1000.0 / send_interval_ms;
+  eCAL::CSubscriber sub("A", eCAL::SDataTypeInformation(), sub_config);
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), pub_config);
+
+  // add callback
+  std::mutex  received_mutex;
+  std::string last_received_msg;
+  size_t      received_count(0);
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      last_received_msg = std::string(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      received_count++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send a burst of samples, skipped samples are no send failures
+  const auto burst_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < send_count; ++i)
+  {
+    EXPECT_TRUE(pub.Send(std::to_string(i)));
+  }
+  const auto burst_duration = std::chrono::steady_clock::now() - burst_start;
+
+  // the last sample of the burst is held back until the next send slot
+  eCAL::Process::SleepMS(2 * send_interval_ms + DATA_FLOW_TIME_MS);
+
+  // every send slot during the burst sends at most one sample, the held back sample follows after the burst
+  const auto send_slots = std::chrono::duration_cast<std::chrono::milliseconds>(burst_duration).count() / send_interval_ms + 1;
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    EXPECT_GE(received_count, 2u);
+    EXPECT_LE(received_count, static_cast<size_t>(send_slots + 1));
+    EXPECT_LT(received_count, static_cast<size_t>(send_count));
+
+    // the newest sample is never dropped
+    EXPECT_EQ(last_received_msg, std::to_string(send_count - 1));
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, CoalescedSamplesUDP)
+{
+  const int send_count = 200;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscribers for topic "A" and "B"
+  eCAL::CSubscriber sub_a("A");
+  eCAL::CSubscriber sub_b("B");
+
+  // create publisher config, small samples are held back for 10 ms
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  pub_config.layer.inproc.enable = false;
+  pub_config.layer.udp.coalescing_latency_us = 10000;
+
+  // create publishers for topic "A" and "B"
+  eCAL::CPublisher pub_a("A", eCAL::SDataTypeInformation(), pub_config);
+  eCAL::CPublisher pub_b("B", eCAL::SDataTypeInformation(), pub_config);
+
+  // add callbacks, collecting the received messages
+  std::vector<std::string> received_a;
+  std::vector<std::string> received_b;
+  sub_a.SetReceiveCallback([&received_a](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      received_a.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+    });
+  sub_b.SetReceiveCallback([&received_b](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      received_b.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send small samples on both topics, mixed with a sample too large to be coalesced
+  std::vector<std::string> sent_a;
+  std::vector<std::string> sent_b;
+  for (int i = 0; i < send_count; ++i)
+  {
+    sent_a.push_back("A" + std::to_string(i));
+    sent_b.push_back((i == send_count / 2) ? std::string(4000, 'B') : "B" + std::to_string(i));
+    EXPECT_TRUE(pub_a.Send(sent_a.back()));
+    EXPECT_TRUE(pub_b.Send(sent_b.back()));
+    if (i % 20 == 0) eCAL::Process::SleepMS(1);
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS + 10);
+
+  // all samples arrived in order
+  EXPECT_EQ(sent_a, received_a);
+  EXPECT_EQ(sent_b, received_b);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
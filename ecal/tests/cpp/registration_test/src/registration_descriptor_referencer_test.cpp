@@ -0,0 +1,151 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "ecal_descgate.h"
+#include "registration/ecal_registration_descriptor_referencer.h"
+#include "serialization/ecal_struct_sample_registration.h"
+
+#include <cstdint>
+#include <string>
+
+namespace
+{
+  const std::uint64_t descriptor_hash = 42;
+
+  eCAL::Registration::Sample CreatePublisher(const std::string& topic_name_, std::uint64_t entity_id_)
+  {
+    eCAL::Registration::Sample reg_sample;
+    reg_sample.cmd_type                              = eCAL::bct_reg_publisher;
+    reg_sample.identifier.entity_id                  = entity_id_;
+    reg_sample.topic.topic_name                      = topic_name_;
+    reg_sample.topic.datatype_information.name       = "datatype";
+    reg_sample.topic.datatype_information.encoding   = "encoding";
+    reg_sample.topic.datatype_information.descriptor = "descriptor";
+    reg_sample.topic.datatype_descriptor_hash        = descriptor_hash;
+    return reg_sample;
+  }
+
+  eCAL::Registration::SampleList CreateSampleList()
+  {
+    // two topics of the same datatype, sharing one descriptor
+    eCAL::Registration::SampleList sample_list;
+    sample_list.push_back(CreatePublisher("foo", 1));
+    sample_list.push_back(CreatePublisher("bar", 2));
+    return sample_list;
+  }
+
+  // applies the samples of one topic only, like the registration interest filter of a process that subscribes to that topic
+  void ApplyTopicSamples(eCAL::CDescGate& desc_gate_, const eCAL::Registration::SampleList& sample_list_, const std::string& topic_name_)
+  {
+    for (const auto& sample : sample_list_)
+    {
+      if (sample.topic.topic_name == topic_name_) desc_gate_.ApplySample(sample, eCAL::tl_none);
+    }
+  }
+}
+
+TEST(core_cpp_registration_descriptor_referencer, FirstSampleOfEachTopicCarriesDescriptor)
+{
+  eCAL::Registration::CDescriptorReferencer referencer(10);
+
+  auto sample_list = CreateSampleList();
+  referencer.ReferenceSentDescriptors(sample_list);
+
+  for (const auto& sample : sample_list)
+  {
+    EXPECT_EQ("descriptor", sample.topic.datatype_information.descriptor) << sample.topic.topic_name;
+  }
+
+  // following cycles only reference the descriptors
+  sample_list = CreateSampleList();
+  referencer.ReferenceSentDescriptors(sample_list);
+
+  for (const auto& sample : sample_list)
+  {
+    EXPECT_TRUE(sample.topic.datatype_information.descriptor.empty()) << sample.topic.topic_name;
+    EXPECT_EQ(descriptor_hash, sample.topic.datatype_descriptor_hash);
+  }
+}
+
+TEST(core_cpp_registration_descriptor_referencer, FilteredTopicReceivesDescriptor)
+{
+  eCAL::Registration::CDescriptorReferencer referencer(10);
+
+  // the receiving process only subscribes to the second topic
+  eCAL::CDescGate desc_gate;
+  auto sample_list = CreateSampleList();
+  referencer.ReferenceSentDescriptors(sample_list);
+  ApplyTopicSamples(desc_gate, sample_list, "bar");
+
+  std::string descriptor;
+  EXPECT_TRUE(desc_gate.GetDescriptor(descriptor_hash, descriptor));
+  EXPECT_EQ("descriptor", descriptor);
+
+  eCAL::STopicId bar_id;
+  bar_id.topic_id.entity_id = 2;
+  bar_id.topic_name         = "bar";
+  eCAL::SDataTypeInformation topic_info;
+  EXPECT_TRUE(desc_gate.GetPublisherInfo(bar_id, topic_info));
+  EXPECT_EQ("descriptor", topic_info.descriptor);
+}
+
+TEST(core_cpp_registration_descriptor_referencer, Refresh)
+{
+  const std::uint64_t refresh_cycles = 3;
+  eCAL::Registration::CDescriptorReferencer referencer(refresh_cycles);
+
+  for (std::uint64_t cycle = 0; cycle < 2 * refresh_cycles; ++cycle)
+  {
+    auto sample_list = CreateSampleList();
+    referencer.ReferenceSentDescriptors(sample_list);
+
+    const bool full_descriptor_expected = (cycle % refresh_cycles) == 0;
+    for (const auto& sample : sample_list)
+    {
+      EXPECT_EQ(full_descriptor_expected, !sample.topic.datatype_information.descriptor.empty()) << "cycle " << cycle;
+    }
+  }
+
+  // after a reset all descriptors are sent in full again
+  referencer.Reset();
+  auto sample_list = CreateSampleList();
+  referencer.ReferenceSentDescriptors(sample_list);
+  for (const auto& sample : sample_list)
+  {
+    EXPECT_FALSE(sample.topic.datatype_information.descriptor.empty());
+  }
+}
+
+TEST(core_cpp_registration_descriptor_referencer, Disabled)
+{
+  eCAL::Registration::CDescriptorReferencer referencer(0);
+
+  for (int cycle = 0; cycle < 3; ++cycle)
+  {
+    auto sample_list = CreateSampleList();
+    referencer.ReferenceSentDescriptors(sample_list);
+    for (const auto& sample : sample_list)
+    {
+      EXPECT_EQ("descriptor", sample.topic.datatype_information.descriptor);
+    }
+  }
+}
@@ -105,6 +105,7 @@ namespace eCAL
         break;
       case eTLayerType::tl_ecal_tcp:
         layer.par_layer.layer_par_tcp.port = rand();
+        layer.par_layer.layer_par_tcp.mux_port = rand();
         break;
       default:
         break;
@@ -123,9 +124,11 @@ namespace eCAL
       topic.topic_name           = GenerateString(8);
       topic.direction            = GenerateString(5);
       topic.datatype_information = GenerateDataTypeInformation();
+      topic.datatype_descriptor_hash = static_cast<uint64_t>(rand()) << 32 | static_cast<uint64_t>(rand());
       topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_shm));
       topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_udp));
       topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_tcp));
+      topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_inproc));
       topic.topic_size           = rand() % 1000;
       topic.connections_local    = rand() % 50;
       topic.connections_external = rand() % 50;
@@ -139,6 +142,7 @@ namespace eCAL
       topic.latency_us.max = static_cast<double>(rand() % 1000) / 10.0 + topic.latency_us.min;
       topic.latency_us.mean = (topic.latency_us.min + topic.latency_us.max) / 2.0;
       topic.latency_us.variance = static_cast<double>(rand() % 100) / 10.0;
+      topic.max_data_frequency   = rand() % 10000;
       return topic;
     }
 
@@ -159,6 +163,7 @@ namespace eCAL
       process.component_init_info   = GenerateString(8);
       process.ecal_runtime_version  = GenerateString(5);
       process.config_file_path      = GenerateString(20);
+      process.descriptor_hash_support = (rand() % 2) == 1;
       return process;
     }
 
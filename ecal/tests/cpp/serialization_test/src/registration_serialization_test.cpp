@@ -107,5 +107,75 @@ namespace eCAL
       EXPECT_TRUE(sample_list_in.size() == sample_list_out.size());
       EXPECT_EQ(sample_list_in, sample_list_out);
     }
+
+    TEST_F(core_cpp_registration_serialization, RegistrationFiltered)
+    {
+      for (const auto& sample_in : samples)
+      {
+        std::string sample_buffer;
+        EXPECT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+        // the filter gets command type and topic / service name of the sample
+        std::string expected_name;
+        switch (sample_in.cmd_type)
+        {
+        case bct_reg_publisher:
+        case bct_reg_subscriber:
+          expected_name = sample_in.topic.topic_name;
+          break;
+        case bct_reg_service:
+          expected_name = sample_in.service.service_name;
+          break;
+        case bct_reg_client:
+          expected_name = sample_in.client.service_name;
+          break;
+        default:
+          break;
+        }
+
+        eCmdType filter_cmd_type(bct_none);
+        std::string filter_name;
+        auto accept_filter = [&filter_cmd_type, &filter_name](eCmdType cmd_type_, const std::string& name_)
+          {
+            filter_cmd_type = cmd_type_;
+            filter_name     = name_;
+            return true;
+          };
+
+        Sample sample_out;
+        EXPECT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out, accept_filter));
+        EXPECT_EQ(sample_in.cmd_type, filter_cmd_type);
+        EXPECT_EQ(expected_name, filter_name);
+        EXPECT_EQ(sample_in, sample_out);
+
+        // rejected samples are not deserialized
+        auto reject_filter = [](eCmdType /*cmd_type_*/, const std::string& /*name_*/) { return false; };
+        EXPECT_FALSE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out, reject_filter));
+      }
+    }
+
+    TEST_F(core_cpp_registration_serialization, RegistrationListFiltered)
+    {
+      SampleList sample_list_in;
+      for (const auto& sample_in : samples)
+      {
+        sample_list_in.push_back(sample_in);
+      }
+
+      std::string sample_buffer;
+      EXPECT_TRUE(SerializeToBuffer(sample_list_in, sample_buffer));
+
+      // accept topic samples only
+      auto topic_filter = [](eCmdType cmd_type_, const std::string& /*name_*/)
+        {
+          return (cmd_type_ == bct_reg_publisher) || (cmd_type_ == bct_reg_subscriber);
+        };
+
+      SampleList sample_list_out;
+      EXPECT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_list_out, topic_filter));
+
+      ASSERT_TRUE(sample_list_out.size() == 1);
+      EXPECT_EQ(samples[1], sample_list_out[0]);
+    }
   }
 }
@@ -54,6 +54,20 @@ namespace eCAL
       ASSERT_TRUE(CompareRequests(sample_in, sample_out));
     }
 
+    TEST(core_cpp_serialization, RequestHeaderAndPayload2String)
+    {
+      Request sample_in = GenerateRequest();
+
+      // serializing header and payload separately must produce the same request
+      std::string sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_in.header, sample_in.request.data(), sample_in.request.size(), sample_buffer));
+
+      Request sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      ASSERT_TRUE(CompareRequests(sample_in, sample_out));
+    }
+
     TEST(core_cpp_serialization, Response2String)
     {
       Response sample_in = GenerateResponse();
@@ -0,0 +1,232 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "time/ecal_timer_wheel.h"
+#include "util/ecal_callback_timer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace eCAL;
+
+namespace
+{
+  // waits until the condition is met, the timeout is generous to tolerate loaded test machines
+  bool WaitFor(const std::function<bool()>& condition_, std::chrono::milliseconds timeout_ = std::chrono::milliseconds(5000))
+  {
+    const auto deadline = std::chrono::steady_clock::now() + timeout_;
+    while (!condition_())
+    {
+      if (std::chrono::steady_clock::now() > deadline) return false;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+  }
+}
+
+TEST(TimerWheel, PeriodicExecution)
+{
+  CTimerWheel wheel(64, std::chrono::microseconds(1000), 2);
+
+  std::atomic<int> counter{ 0 };
+  const auto id = wheel.Schedule(std::chrono::milliseconds(10), [&counter]() { counter++; }, std::chrono::milliseconds(0), CTimerWheel::eMode::fixed_rate);
+  EXPECT_NE(id, 0U);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(505));
+  EXPECT_TRUE(wheel.Cancel(id));
+
+  // 51 executions expected (first one immediately), missed runs are never caught up,
+  // so only the upper bound is strict
+  EXPECT_GE(counter, 10);
+  EXPECT_LE(counter, 52);
+
+  // no more executions after cancellation
+  const int final_count = counter;
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(counter, final_count);
+  EXPECT_FALSE(wheel.Cancel(id));
+}
+
+TEST(TimerWheel, LongPeriodsWrapAroundWheel)
+{
+  // 8 slots with 1 ms resolution -> a 30 ms period needs several revolutions
+  CTimerWheel wheel(8, std::chrono::microseconds(1000), 1);
+
+  std::atomic<int> counter{ 0 };
+  const auto start = std::chrono::steady_clock::now();
+  std::atomic<long long> first_call_ms{ 0 };
+  const auto id = wheel.Schedule(std::chrono::milliseconds(30), [&]()
+    {
+      if (counter++ == 0) first_call_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    }, std::chrono::milliseconds(30), CTimerWheel::eMode::fixed_rate);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  wheel.Cancel(id);
+
+  EXPECT_GE(first_call_ms, 30);
+  EXPECT_GE(counter, 1);
+  EXPECT_LE(counter, 7);
+}
+
+TEST(TimerWheel, TriggerRunsImmediately)
+{
+  CTimerWheel wheel(64, std::chrono::microseconds(1000), 2);
+
+  std::atomic<int> counter{ 0 };
+  const auto id = wheel.Schedule(std::chrono::seconds(10), [&counter]() { counter++; }, std::chrono::seconds(10), CTimerWheel::eMode::fixed_delay);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(counter, 0);
+
+  EXPECT_TRUE(wheel.Trigger(id));
+  EXPECT_TRUE(WaitFor([&counter]() { return counter == 1; }));
+
+  EXPECT_TRUE(wheel.Cancel(id));
+  EXPECT_FALSE(wheel.Trigger(id));
+}
+
+TEST(TimerWheel, CancelWaitsForRunningCallback)
+{
+  CTimerWheel wheel(64, std::chrono::microseconds(1000), 2);
+
+  std::atomic<bool> started{ false };
+  std::atomic<bool> finished{ false };
+  const auto id = wheel.Schedule(std::chrono::milliseconds(100), [&]()
+    {
+      started = true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      finished = true;
+    }, std::chrono::milliseconds(0), CTimerWheel::eMode::fixed_rate);
+
+  while (!started) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_TRUE(wheel.Cancel(id));
+  EXPECT_TRUE(finished);
+}
+
+TEST(TimerWheel, CancelFromWithinCallback)
+{
+  CTimerWheel wheel(64, std::chrono::microseconds(1000), 1);
+
+  std::atomic<int>                  counter{ 0 };
+  std::atomic<CTimerWheel::TaskIdT> id{ 0 };
+  id = wheel.Schedule(std::chrono::milliseconds(5), [&]()
+    {
+      while (id == 0) std::this_thread::yield();
+      if (++counter == 3) wheel.Cancel(id);
+    }, std::chrono::milliseconds(0), CTimerWheel::eMode::fixed_rate);
+
+  EXPECT_TRUE(WaitFor([&wheel]() { return wheel.GetTaskCount() == 0; }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(counter, 3);
+}
+
+TEST(TimerWheel, DestroyFromWithinCallback)
+{
+  auto wheel = std::make_shared<CTimerWheel>(64, std::chrono::microseconds(1000), 1);
+
+  // the callback releases the last reference, so the wheel is destroyed on its own worker thread
+  std::atomic<bool> released{ false };
+  std::shared_ptr<CTimerWheel> owner = wheel;
+  owner->Schedule(std::chrono::milliseconds(5), [&owner, &released]()
+    {
+      if (released) return;
+      owner.reset();
+      released = true;
+    }, std::chrono::milliseconds(20), CTimerWheel::eMode::fixed_rate);
+  wheel.reset();
+
+  EXPECT_TRUE(WaitFor([&released]() { return released.load(); }));
+  // give the detached worker the chance to leave its loop
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+}
+
+TEST(TimerWheel, ManyTasksShareWorkers)
+{
+  CTimerWheel wheel(512, std::chrono::microseconds(1000), 2);
+
+  const int task_num = 500;
+  std::vector<std::atomic<int>> counters(task_num);
+  std::vector<CTimerWheel::TaskIdT> ids;
+  for (int i = 0; i < task_num; ++i)
+  {
+    counters[i] = 0;
+    ids.push_back(wheel.Schedule(std::chrono::milliseconds(20 + i % 7), [&counters, i]() { counters[i]++; }, std::chrono::milliseconds(i % 13), CTimerWheel::eMode::fixed_delay));
+  }
+  EXPECT_EQ(wheel.GetTaskCount(), static_cast<size_t>(task_num));
+
+  // every task has to run several times
+  EXPECT_TRUE(WaitFor([&counters]()
+    {
+      for (const auto& counter : counters) if (counter < 3) return false;
+      return true;
+    }));
+  for (auto id : ids) EXPECT_TRUE(wheel.Cancel(id));
+}
+
+TEST(TimerWheel, CallbackTimer)
+{
+  std::atomic<int> counter{ 0 };
+  {
+    CCallbackTimer timer([&counter]() { counter++; });
+    timer.start(std::chrono::milliseconds(20));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(110));
+    EXPECT_GE(counter, 1);
+    EXPECT_LE(counter, 6);
+
+    const int count_before_trigger = counter;
+    timer.trigger();
+    EXPECT_TRUE(WaitFor([&counter, count_before_trigger]() { return counter > count_before_trigger; }));
+
+    timer.stop();
+  }
+  const int final_count = counter;
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(counter, final_count);
+}
+
+TEST(TimerWheel, BlockedUserPoolDoesNotDelayInternalPool)
+{
+  const auto internal_wheel = CTimerWheel::Get(CTimerWheel::ePool::internal);
+  const auto user_wheel     = CTimerWheel::Get(CTimerWheel::ePool::user);
+  EXPECT_NE(internal_wheel, user_wheel);
+  EXPECT_EQ(internal_wheel, CTimerWheel::Get());
+
+  // block every worker of the user wheel
+  std::atomic<bool> release{ false };
+  std::vector<CTimerWheel::TaskIdT> user_ids;
+  for (int i = 0; i < 8; ++i)
+  {
+    user_ids.push_back(user_wheel->Schedule(std::chrono::milliseconds(10), [&release]() { while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1)); }, std::chrono::milliseconds(0), CTimerWheel::eMode::fixed_rate));
+  }
+
+  std::atomic<int> counter{ 0 };
+  const auto internal_id = internal_wheel->Schedule(std::chrono::milliseconds(10), [&counter]() { counter++; }, std::chrono::milliseconds(0), CTimerWheel::eMode::fixed_rate);
+  EXPECT_TRUE(WaitFor([&counter]() { return counter >= 5; }));
+  EXPECT_TRUE(internal_wheel->Cancel(internal_id));
+
+  release = true;
+  for (auto id : user_ids) EXPECT_TRUE(user_wheel->Cancel(id));
+}
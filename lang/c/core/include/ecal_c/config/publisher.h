@@ -103,14 +103,31 @@ struct eCAL_Publisher_Layer_SHM_Configuration
   unsigned int memfile_buffer_count; /*!< Maximum number of used buffers (needs to be greater than 1, default = 1) */
   unsigned int memfile_min_size_bytes; //!< Default memory file size for new publisher (Default: 4096)
   unsigned int memfile_reserve_percent; //!< Dynamic file size reserve before recreating memory file if topic size changes (Default: 50)
+  int memfile_huge_pages; //!< Request transparent huge pages for memory files (Linux only, Default: false)
+  int memfile_prefault; //!< Pre-fault memory file pages on creation to avoid page faults on the first writes (Linux only, Default: false)
+  int memfile_lock; //!< Lock memory file pages in RAM (mlock, Linux only, Default: false)
+  int memfile_numa_local; //!< Bind memory file pages to the NUMA node of the publishing thread (Linux only, Default: false)
 };
 
 struct eCAL_Publisher_Layer_UDP_Configuration
 {
-  int enable; //!< enable layer
+  int enable;                     //!< enable layer
+
+  unsigned int retransmit_window; //!< Number of sent samples kept to repair losses reported by subscribers (0 == no repair, Default: 0)
+  unsigned int repair_rate_limit; //!< Maximum rate of repaired samples in bytes per second (0 == unlimited, Default: 10 MB/s)
+
+  unsigned int coalescing_latency_us; //!< Maximum time in microseconds small samples are held back to be sent together in one datagram (0 == no coalescing, Default: 0)
+  unsigned int coalescing_max_size;   //!< Maximum size of a coalesced datagram, larger samples are sent directly (Default: 1400)
 };
 
 struct eCAL_Publisher_Layer_TCP_Configuration
+{
+  int enable;      //!< enable layer
+
+  int multiplexed; //!< Send over one connection per subscribing process that is shared by all multiplexed TCP publishers of this process (Default: false)
+};
+
+struct eCAL_Publisher_Layer_INPROC_Configuration
 {
   int enable; //!< enable layer
 };
@@ -120,6 +137,21 @@ struct eCAL_Publisher_Layer_Configuration
   struct eCAL_Publisher_Layer_SHM_Configuration shm;
   struct eCAL_Publisher_Layer_UDP_Configuration udp;
   struct eCAL_Publisher_Layer_TCP_Configuration tcp;
+  struct eCAL_Publisher_Layer_INPROC_Configuration inproc;
+};
+
+enum eCAL_Publisher_SendQueue_eOverflowPolicy
+{
+  eCAL_Publisher_SendQueue_eOverflowPolicy_drop_oldest, //!< drop the oldest queued sample to make room for the new one
+  eCAL_Publisher_SendQueue_eOverflowPolicy_drop_newest, //!< drop the new sample, the send call returns an error
+  eCAL_Publisher_SendQueue_eOverflowPolicy_block        //!< block the send call until the queue has room again
+};
+
+struct eCAL_Publisher_SendQueue_Configuration
+{
+  int enable; //!< Send enqueues the payload, a writer thread hands it to the transport layers (Default: false)
+  unsigned int capacity; //!< Maximum number of queued samples (Default: 16)
+  enum eCAL_Publisher_SendQueue_eOverflowPolicy overflow_policy; //!< Behavior of the send call if the queue is full (Default: drop_oldest)
 };
 
 struct eCAL_Publisher_Configuration
@@ -130,6 +162,8 @@ struct eCAL_Publisher_Configuration
   size_t layer_priority_local_length;
   enum eCAL_TransportLayer_eType layer_priority_remote[8];
   size_t layer_priority_remote_length;
+
+  struct eCAL_Publisher_SendQueue_Configuration send_queue; //!< Asynchronous send queue configuration
 };
 
 #endif /* ecal_c_config_publisher_h_included */
@@ -71,6 +71,8 @@ struct eCAL_Registration_Configuration
 {
   unsigned int registration_timeout; //!< Timeout for topic registration in ms (internal) (Default: 10000)
   unsigned int registration_refresh; //!< Topic registration refresh cycle (has to be smaller than registration timeout!) (Default: 1000)
+  unsigned int descriptor_refresh; //!< Send full datatype descriptors only every n-th refresh cycle, in between they are referenced by their hash (0 = always send full descriptors) (Default: 10)
+  int interest_filter; //!< Only deserialize and apply registration samples of entities matching local publishers, subscribers and clients (ignored if monitoring is initialized) (Default: false)
   int loopback; //!< Enable to receive UDP messages on the same local machine (Default: true)
   const char* shm_transport_domain; //!< Common shm transport domain that enables interprocess mechanisms across (virtual) host borders (e.g., Docker); by default equivalent to local host name (Default: "")
   struct eCAL_Registration_Local_Configuration local;
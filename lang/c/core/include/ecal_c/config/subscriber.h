@@ -40,11 +40,17 @@ struct eCAL_Subscriber_Layer_TCP_Configuration
   int enable;  //!< enable layer (Default: false)
 };
 
+struct eCAL_Subscriber_Layer_INPROC_Configuration
+{
+  int enable;  //!< enable layer (Default: true)
+};
+
 struct eCAL_Subscriber_Layer_Configuration
 {
   struct eCAL_Subscriber_Layer_SHM_Configuration shm;
   struct eCAL_Subscriber_Layer_UDP_Configuration udp;
   struct eCAL_Subscriber_Layer_TCP_Configuration tcp;
+  struct eCAL_Subscriber_Layer_INPROC_Configuration inproc;
 };
 
 struct eCAL_Subscriber_Configuration
@@ -52,6 +58,8 @@ struct eCAL_Subscriber_Configuration
   struct eCAL_Subscriber_Layer_Configuration layer;
 
   int drop_out_of_order_messages;  //!< Enable dropping of payload messages that arrive out of order (Default: true)
+  unsigned int history_depth;      //!< Number of received samples kept for polling (0 == no history, Default: 0)
+  double max_frequency;            //!< Maximum data frequency [Hz] needed, publishers skip network sends above it (0 == unlimited, Default: 0)
 };
 
 #endif /* ecal_c_config_subscriber_h_included */
\ No newline at end of file
@@ -35,6 +35,7 @@ enum eCAL_TransportLayer_eType
   eCAL_TransportLayer_eType_udp_mc,
   eCAL_TransportLayer_eType_shm,
   eCAL_TransportLayer_eType_tcp,
+  eCAL_TransportLayer_eType_inproc,
 };
 
 struct eCAL_TransportLayer_UDP_MulticastConfiguration
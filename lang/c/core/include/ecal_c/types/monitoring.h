@@ -57,7 +57,8 @@ enum eCAL_Monitoring_eTransportLayerType
   eCAL_Monitoring_eTransportLayerType_none = 0,
   eCAL_Monitoring_eTransportLayerType_udp_mc = 1,
   eCAL_Monitoring_eTransportLayerType_shm = 4,
-  eCAL_Monitoring_eTransportLayerType_tcp = 5
+  eCAL_Monitoring_eTransportLayerType_tcp = 5,
+  eCAL_Monitoring_eTransportLayerType_inproc = 42
 };
 
 struct eCAL_Monitoring_STransportLayer
@@ -47,7 +47,8 @@ enum eCAL_TransportLayer_eType Convert_TransportLayer_eType(eCAL::TransportLayer
     {eCAL::TransportLayer::eType::none, eCAL_TransportLayer_eType_none},
     {eCAL::TransportLayer::eType::shm, eCAL_TransportLayer_eType_shm},
     {eCAL::TransportLayer::eType::udp_mc, eCAL_TransportLayer_eType_udp_mc},
-    {eCAL::TransportLayer::eType::tcp, eCAL_TransportLayer_eType_tcp}
+    {eCAL::TransportLayer::eType::tcp, eCAL_TransportLayer_eType_tcp},
+    {eCAL::TransportLayer::eType::inproc, eCAL_TransportLayer_eType_inproc}
   };
   return transport_layer_type_map.at(type_);
 }
@@ -71,6 +72,17 @@ enum eCAL_Registration_Network_eTransportType Convert_Registration_Network_eTran
   return transport_type_map.at(transport_type_);
 }
 
+enum eCAL_Publisher_SendQueue_eOverflowPolicy Convert_Publisher_SendQueue_eOverflowPolicy(eCAL::Publisher::SendQueue::eOverflowPolicy overflow_policy_)
+{
+  static const std::map<eCAL::Publisher::SendQueue::eOverflowPolicy, enum eCAL_Publisher_SendQueue_eOverflowPolicy> overflow_policy_map
+  {
+    {eCAL::Publisher::SendQueue::eOverflowPolicy::drop_oldest, eCAL_Publisher_SendQueue_eOverflowPolicy_drop_oldest},
+    {eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest, eCAL_Publisher_SendQueue_eOverflowPolicy_drop_newest},
+    {eCAL::Publisher::SendQueue::eOverflowPolicy::block, eCAL_Publisher_SendQueue_eOverflowPolicy_block}
+  };
+  return overflow_policy_map.at(overflow_policy_);
+}
+
 enum eCAL_Types_UdpConfigVersion Convert_Types_UdpConfigVersion(eCAL::Types::UdpConfigVersion udp_config_version_)
 {
   static const std::map<eCAL::Types::UdpConfigVersion, enum eCAL_Types_UdpConfigVersion> udp_config_version_map
@@ -152,9 +164,19 @@ void Assign_Publisher_Configuration(struct eCAL_Publisher_Configuration* configu
   configuration_c_->layer.shm.memfile_buffer_count = configuration_.layer.shm.memfile_buffer_count;
   configuration_c_->layer.shm.memfile_min_size_bytes = configuration_.layer.shm.memfile_min_size_bytes;
   configuration_c_->layer.shm.memfile_reserve_percent = configuration_.layer.shm.memfile_reserve_percent;
+  configuration_c_->layer.shm.memfile_huge_pages = configuration_.layer.shm.memfile_huge_pages;
+  configuration_c_->layer.shm.memfile_prefault = configuration_.layer.shm.memfile_prefault;
+  configuration_c_->layer.shm.memfile_lock = configuration_.layer.shm.memfile_lock;
+  configuration_c_->layer.shm.memfile_numa_local = configuration_.layer.shm.memfile_numa_local;
 
   configuration_c_->layer.udp.enable = configuration_.layer.udp.enable;
+  configuration_c_->layer.udp.retransmit_window = configuration_.layer.udp.retransmit_window;
+  configuration_c_->layer.udp.repair_rate_limit = configuration_.layer.udp.repair_rate_limit;
+  configuration_c_->layer.udp.coalescing_latency_us = configuration_.layer.udp.coalescing_latency_us;
+  configuration_c_->layer.udp.coalescing_max_size = configuration_.layer.udp.coalescing_max_size;
   configuration_c_->layer.tcp.enable = configuration_.layer.tcp.enable;
+  configuration_c_->layer.tcp.multiplexed = configuration_.layer.tcp.multiplexed;
+  configuration_c_->layer.inproc.enable = configuration_.layer.inproc.enable;
 
   // Assign layer_priority_local
   configuration_c_->layer_priority_local_length = configuration_.layer_priority_local.size();
@@ -169,6 +191,11 @@ void Assign_Publisher_Configuration(struct eCAL_Publisher_Configuration* configu
   {
     configuration_c_->layer_priority_remote[i] = Convert_TransportLayer_eType(configuration_.layer_priority_remote[i]);
   }
+
+  // Assign SendQueue::Configuration
+  configuration_c_->send_queue.enable = configuration_.send_queue.enable;
+  configuration_c_->send_queue.capacity = configuration_.send_queue.capacity;
+  configuration_c_->send_queue.overflow_policy = Convert_Publisher_SendQueue_eOverflowPolicy(configuration_.send_queue.overflow_policy);
 }
 
 void Assign_Registration_Configuration(struct eCAL_Registration_Configuration* configuration_c_, const eCAL::Registration::Configuration& configuration_)
@@ -176,6 +203,8 @@ void Assign_Registration_Configuration(struct eCAL_Registration_Configuration* c
   // Assign general configuration
   configuration_c_->registration_timeout = configuration_.registration_timeout;
   configuration_c_->registration_refresh = configuration_.registration_refresh;
+  configuration_c_->descriptor_refresh = configuration_.descriptor_refresh;
+  configuration_c_->interest_filter = static_cast<int>(configuration_.interest_filter);
   configuration_c_->loopback = configuration_.loopback;
   configuration_c_->shm_transport_domain = configuration_.shm_transport_domain.c_str();
 
@@ -199,9 +228,12 @@ void Assign_Subscriber_Configuration(struct eCAL_Subscriber_Configuration* confi
   configuration_c_->layer.shm.enable = configuration_.layer.shm.enable;
   configuration_c_->layer.udp.enable = configuration_.layer.udp.enable;
   configuration_c_->layer.tcp.enable = configuration_.layer.tcp.enable;
+  configuration_c_->layer.inproc.enable = configuration_.layer.inproc.enable;
 
   // Assign Subscriber configuration
   configuration_c_->drop_out_of_order_messages = configuration_.drop_out_of_order_messages;
+  configuration_c_->history_depth = configuration_.history_depth;
+  configuration_c_->max_frequency = configuration_.max_frequency;
 }
 
 void Assign_Time_Configuration(struct eCAL_Time_Configuration* configuration_c_, const eCAL::Time::Configuration& configuration_)
@@ -274,7 +306,8 @@ eCAL::TransportLayer::eType Convert_TransportLayer_eType(enum eCAL_TransportLaye
     {eCAL_TransportLayer_eType_none, eCAL::TransportLayer::eType::none},
     {eCAL_TransportLayer_eType_shm, eCAL::TransportLayer::eType::shm},
     {eCAL_TransportLayer_eType_udp_mc, eCAL::TransportLayer::eType::udp_mc},
-    {eCAL_TransportLayer_eType_tcp, eCAL::TransportLayer::eType::tcp}
+    {eCAL_TransportLayer_eType_tcp, eCAL::TransportLayer::eType::tcp},
+    {eCAL_TransportLayer_eType_inproc, eCAL::TransportLayer::eType::inproc}
   };
   return transport_layer_type_map.at(type_);
 }
@@ -298,6 +331,17 @@ eCAL::Registration::Network::eTransportType Convert_Registration_Network_eTransp
   return transport_type_map.at(transport_type_);
 }
 
+eCAL::Publisher::SendQueue::eOverflowPolicy Convert_Publisher_SendQueue_eOverflowPolicy(enum eCAL_Publisher_SendQueue_eOverflowPolicy overflow_policy_)
+{
+  static const std::map<enum eCAL_Publisher_SendQueue_eOverflowPolicy, eCAL::Publisher::SendQueue::eOverflowPolicy> overflow_policy_map
+  {
+    {eCAL_Publisher_SendQueue_eOverflowPolicy_drop_oldest, eCAL::Publisher::SendQueue::eOverflowPolicy::drop_oldest},
+    {eCAL_Publisher_SendQueue_eOverflowPolicy_drop_newest, eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest},
+    {eCAL_Publisher_SendQueue_eOverflowPolicy_block, eCAL::Publisher::SendQueue::eOverflowPolicy::block}
+  };
+  return overflow_policy_map.at(overflow_policy_);
+}
+
 eCAL::Types::UdpConfigVersion Convert_Types_UdpConfigVersion(enum eCAL_Types_UdpConfigVersion udp_config_version_)
 {
   static const std::map<enum eCAL_Types_UdpConfigVersion, eCAL::Types::UdpConfigVersion> udp_config_version_map
@@ -378,9 +422,19 @@ void Assign_Publisher_Configuration(eCAL::Publisher::Configuration& configuratio
   configuration_.layer.shm.memfile_buffer_count = configuration_c_->layer.shm.memfile_buffer_count;
   configuration_.layer.shm.memfile_min_size_bytes = configuration_c_->layer.shm.memfile_min_size_bytes;
   configuration_.layer.shm.memfile_reserve_percent = configuration_c_->layer.shm.memfile_reserve_percent;
+  configuration_.layer.shm.memfile_huge_pages = static_cast<bool>(configuration_c_->layer.shm.memfile_huge_pages);
+  configuration_.layer.shm.memfile_prefault = static_cast<bool>(configuration_c_->layer.shm.memfile_prefault);
+  configuration_.layer.shm.memfile_lock = static_cast<bool>(configuration_c_->layer.shm.memfile_lock);
+  configuration_.layer.shm.memfile_numa_local = static_cast<bool>(configuration_c_->layer.shm.memfile_numa_local);
 
   configuration_.layer.udp.enable = static_cast<bool>(configuration_c_->layer.udp.enable);
+  configuration_.layer.udp.retransmit_window = configuration_c_->layer.udp.retransmit_window;
+  configuration_.layer.udp.repair_rate_limit = configuration_c_->layer.udp.repair_rate_limit;
+  configuration_.layer.udp.coalescing_latency_us = configuration_c_->layer.udp.coalescing_latency_us;
+  configuration_.layer.udp.coalescing_max_size = configuration_c_->layer.udp.coalescing_max_size;
   configuration_.layer.tcp.enable = static_cast<bool>(configuration_c_->layer.tcp.enable);
+  configuration_.layer.tcp.multiplexed = static_cast<bool>(configuration_c_->layer.tcp.multiplexed);
+  configuration_.layer.inproc.enable = static_cast<bool>(configuration_c_->layer.inproc.enable);
 
   // Assign layer_priority_local
   configuration_.layer_priority_local.resize(configuration_c_->layer_priority_local_length);
@@ -395,6 +449,11 @@ void Assign_Publisher_Configuration(eCAL::Publisher::Configuration& configuratio
   {
     configuration_.layer_priority_remote[i] = Convert_TransportLayer_eType(configuration_c_->layer_priority_remote[i]);
   }
+
+  // Assign SendQueue::Configuration
+  configuration_.send_queue.enable = static_cast<bool>(configuration_c_->send_queue.enable);
+  configuration_.send_queue.capacity = configuration_c_->send_queue.capacity;
+  configuration_.send_queue.overflow_policy = Convert_Publisher_SendQueue_eOverflowPolicy(configuration_c_->send_queue.overflow_policy);
 }
 
 void Assign_Registration_Configuration(eCAL::Registration::Configuration& configuration_, const struct eCAL_Registration_Configuration* configuration_c_)
@@ -402,6 +461,8 @@ void Assign_Registration_Configuration(eCAL::Registration::Configuration& config
   // Assign general configuration
   configuration_.registration_timeout = configuration_c_->registration_timeout;
   configuration_.registration_refresh = configuration_c_->registration_refresh;
+  configuration_.descriptor_refresh = configuration_c_->descriptor_refresh;
+  configuration_.interest_filter = static_cast<bool>(configuration_c_->interest_filter);
   configuration_.loopback = static_cast<bool>(configuration_c_->loopback);
   configuration_.shm_transport_domain = configuration_c_->shm_transport_domain != NULL ? configuration_c_->shm_transport_domain : "";
 
@@ -422,9 +483,12 @@ void Assign_Subscriber_Configuration(eCAL::Subscriber::Configuration& configurat
   configuration_.layer.shm.enable = static_cast<bool>(configuration_c_->layer.shm.enable);
   configuration_.layer.udp.enable = static_cast<bool>(configuration_c_->layer.udp.enable);
   configuration_.layer.tcp.enable = static_cast<bool>(configuration_c_->layer.tcp.enable);
+  configuration_.layer.inproc.enable = static_cast<bool>(configuration_c_->layer.inproc.enable);
 
   // Assign Subscriber configuration
   configuration_.drop_out_of_order_messages = static_cast<bool>(configuration_c_->drop_out_of_order_messages);
+  configuration_.history_depth = configuration_c_->history_depth;
+  configuration_.max_frequency = configuration_c_->max_frequency;
 }
 
 void Assign_Time_Configuration(eCAL::Time::Configuration& configuration_, const struct eCAL_Time_Configuration* configuration_c_)
@@ -34,6 +34,7 @@
 enum eCAL_TransportLayer_eType Convert_TransportLayer_eType(eCAL::TransportLayer::eType type_);
 enum eCAL_Registration_Local_eTransportType Convert_Registration_Local_eTransportType(eCAL::Registration::Local::eTransportType transport_type_);
 enum eCAL_Registration_Network_eTransportType Convert_Registration_Network_eTransportType(eCAL::Registration::Network::eTransportType transport_type_);
+enum eCAL_Publisher_SendQueue_eOverflowPolicy Convert_Publisher_SendQueue_eOverflowPolicy(eCAL::Publisher::SendQueue::eOverflowPolicy overflow_policy_);
 enum eCAL_Types_UdpConfigVersion Convert_Types_UdpConfigVersion(eCAL::Types::UdpConfigVersion udp_config_version_);
 enum eCAL_eCommunicationMode Convert_eCommunicationMode(eCAL::eCommunicationMode communication_mode_);
 eCAL_Logging_Filter Convert_Logging_Filter(eCAL::Logging::Filter filter_);
@@ -56,6 +57,7 @@ void Assign_Configuration(eCAL_Configuration* configuration_c_, const eCAL::Conf
 eCAL::TransportLayer::eType Convert_TransportLayer_eType(enum eCAL_TransportLayer_eType type_);
 eCAL::Registration::Local::eTransportType Convert_Registration_Local_eTransportType(enum eCAL_Registration_Local_eTransportType transport_type_);
 eCAL::Registration::Network::eTransportType Convert_Registration_Network_eTransportType(enum eCAL_Registration_Network_eTransportType transport_type_);
+eCAL::Publisher::SendQueue::eOverflowPolicy Convert_Publisher_SendQueue_eOverflowPolicy(enum eCAL_Publisher_SendQueue_eOverflowPolicy overflow_policy_);
 eCAL::Types::UdpConfigVersion Convert_Types_UdpConfigVersion(enum eCAL_Types_UdpConfigVersion udp_config_version_);
 eCAL::eCommunicationMode Convert_eCommunicationMode(enum eCAL_eCommunicationMode communication_mode_);
 eCAL::Logging::Filter Convert_Logging_FilterC(eCAL_Logging_Filter filter_c_);
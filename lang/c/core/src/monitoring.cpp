@@ -203,7 +203,8 @@ namespace
       {eCAL::Monitoring::eTransportLayerType::none, eCAL_Monitoring_eTransportLayerType_none},
       {eCAL::Monitoring::eTransportLayerType::udp_mc, eCAL_Monitoring_eTransportLayerType_udp_mc},
       {eCAL::Monitoring::eTransportLayerType::shm, eCAL_Monitoring_eTransportLayerType_shm},
-      {eCAL::Monitoring::eTransportLayerType::tcp, eCAL_Monitoring_eTransportLayerType_tcp}
+      {eCAL::Monitoring::eTransportLayerType::tcp, eCAL_Monitoring_eTransportLayerType_tcp},
+      {eCAL::Monitoring::eTransportLayerType::inproc, eCAL_Monitoring_eTransportLayerType_inproc}
     };
 
     transport_layer_c_->active = transport_layer_.active;
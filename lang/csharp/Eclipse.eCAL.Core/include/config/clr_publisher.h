@@ -43,6 +43,10 @@ namespace Eclipse {
           property unsigned int MemfileBufferCount;
           property unsigned int MemfileMinSizeBytes;
           property unsigned int MemfileReservePercent;
+          property bool MemfileHugePages;
+          property bool MemfilePrefault;
+          property bool MemfileLock;
+          property bool MemfileNumaLocal;
 
           PublisherLayerSHMConfiguration() {
             ::eCAL::Publisher::Layer::SHM::Configuration native_config;
@@ -52,6 +56,10 @@ namespace Eclipse {
             MemfileBufferCount = native_config.memfile_buffer_count;
             MemfileMinSizeBytes = native_config.memfile_min_size_bytes;
             MemfileReservePercent = native_config.memfile_reserve_percent;
+            MemfileHugePages = native_config.memfile_huge_pages;
+            MemfilePrefault = native_config.memfile_prefault;
+            MemfileLock = native_config.memfile_lock;
+            MemfileNumaLocal = native_config.memfile_numa_local;
           }
 
           // Native struct constructor
@@ -62,6 +70,10 @@ namespace Eclipse {
             MemfileBufferCount = native_config.memfile_buffer_count;
             MemfileMinSizeBytes = native_config.memfile_min_size_bytes;
             MemfileReservePercent = native_config.memfile_reserve_percent;
+            MemfileHugePages = native_config.memfile_huge_pages;
+            MemfilePrefault = native_config.memfile_prefault;
+            MemfileLock = native_config.memfile_lock;
+            MemfileNumaLocal = native_config.memfile_numa_local;
           }
 
           ::eCAL::Publisher::Layer::SHM::Configuration ToNative() {
@@ -72,6 +84,10 @@ namespace Eclipse {
             native_config.memfile_buffer_count = MemfileBufferCount;
             native_config.memfile_min_size_bytes = MemfileMinSizeBytes;
             native_config.memfile_reserve_percent = MemfileReservePercent;
+            native_config.memfile_huge_pages = MemfileHugePages;
+            native_config.memfile_prefault = MemfilePrefault;
+            native_config.memfile_lock = MemfileLock;
+            native_config.memfile_numa_local = MemfileNumaLocal;
             return native_config;
           }
         };
@@ -82,20 +98,36 @@ namespace Eclipse {
         public ref class PublisherLayerUDPConfiguration {
         public:
           property bool Enable;
+          property unsigned int RetransmitWindow;
+          property unsigned int RepairRateLimit;
+          property unsigned int CoalescingLatencyUs;
+          property unsigned int CoalescingMaxSize;
 
           PublisherLayerUDPConfiguration() {
             ::eCAL::Publisher::Layer::UDP::Configuration native_config;
             Enable = native_config.enable;
+            RetransmitWindow = native_config.retransmit_window;
+            RepairRateLimit = native_config.repair_rate_limit;
+            CoalescingLatencyUs = native_config.coalescing_latency_us;
+            CoalescingMaxSize = native_config.coalescing_max_size;
           }
 
           // Native struct constructor
           PublisherLayerUDPConfiguration(const ::eCAL::Publisher::Layer::UDP::Configuration& native_config) {
             Enable = native_config.enable;
+            RetransmitWindow = native_config.retransmit_window;
+            RepairRateLimit = native_config.repair_rate_limit;
+            CoalescingLatencyUs = native_config.coalescing_latency_us;
+            CoalescingMaxSize = native_config.coalescing_max_size;
           }
 
           ::eCAL::Publisher::Layer::UDP::Configuration ToNative() {
             ::eCAL::Publisher::Layer::UDP::Configuration native_config;
             native_config.enable = Enable;
+            native_config.retransmit_window = RetransmitWindow;
+            native_config.repair_rate_limit = RepairRateLimit;
+            native_config.coalescing_latency_us = CoalescingLatencyUs;
+            native_config.coalescing_max_size = CoalescingMaxSize;
             return native_config;
           }
         };
@@ -106,20 +138,48 @@ namespace Eclipse {
         public ref class PublisherLayerTCPConfiguration {
         public:
           property bool Enable;
+          property bool Multiplexed;
 
           PublisherLayerTCPConfiguration() {
             ::eCAL::Publisher::Layer::TCP::Configuration native_config;
             Enable = native_config.enable;
+            Multiplexed = native_config.multiplexed;
           }
 
           // Native struct constructor
           PublisherLayerTCPConfiguration(const ::eCAL::Publisher::Layer::TCP::Configuration& native_config) {
             Enable = native_config.enable;
+            Multiplexed = native_config.multiplexed;
           }
 
           ::eCAL::Publisher::Layer::TCP::Configuration ToNative() {
             ::eCAL::Publisher::Layer::TCP::Configuration native_config;
             native_config.enable = Enable;
+            native_config.multiplexed = Multiplexed;
+            return native_config;
+          }
+        };
+
+        /**
+         * @brief Managed wrapper for the native ::eCAL::Publisher::Layer::INPROC::Configuration structure.
+         */
+        public ref class PublisherLayerINPROCConfiguration {
+        public:
+          property bool Enable;
+
+          PublisherLayerINPROCConfiguration() {
+            ::eCAL::Publisher::Layer::INPROC::Configuration native_config;
+            Enable = native_config.enable;
+          }
+
+          // Native struct constructor
+          PublisherLayerINPROCConfiguration(const ::eCAL::Publisher::Layer::INPROC::Configuration& native_config) {
+            Enable = native_config.enable;
+          }
+
+          ::eCAL::Publisher::Layer::INPROC::Configuration ToNative() {
+            ::eCAL::Publisher::Layer::INPROC::Configuration native_config;
+            native_config.enable = Enable;
             return native_config;
           }
         };
@@ -132,12 +192,14 @@ namespace Eclipse {
           property PublisherLayerSHMConfiguration^ SHM;
           property PublisherLayerUDPConfiguration^ UDP;
           property PublisherLayerTCPConfiguration^ TCP;
+          property PublisherLayerINPROCConfiguration^ INPROC;
 
           PublisherLayerConfiguration() {
             ::eCAL::Publisher::Layer::Configuration native_config;
             SHM = gcnew PublisherLayerSHMConfiguration(native_config.shm);
             UDP = gcnew PublisherLayerUDPConfiguration(native_config.udp);
             TCP = gcnew PublisherLayerTCPConfiguration(native_config.tcp);
+            INPROC = gcnew PublisherLayerINPROCConfiguration(native_config.inproc);
           }
 
           // Native struct constructor
@@ -145,6 +207,7 @@ namespace Eclipse {
             SHM = gcnew PublisherLayerSHMConfiguration(native_config.shm);
             UDP = gcnew PublisherLayerUDPConfiguration(native_config.udp);
             TCP = gcnew PublisherLayerTCPConfiguration(native_config.tcp);
+            INPROC = gcnew PublisherLayerINPROCConfiguration(native_config.inproc);
           }
 
           ::eCAL::Publisher::Layer::Configuration ToNative() {
@@ -152,6 +215,49 @@ namespace Eclipse {
             native_config.shm = SHM->ToNative();
             native_config.udp = UDP->ToNative();
             native_config.tcp = TCP->ToNative();
+            native_config.inproc = INPROC->ToNative();
+            return native_config;
+          }
+        };
+
+        /**
+         * @brief Specifies the behavior of the publisher send call if the send queue is full.
+         */
+        public enum class ePublisherSendQueueOverflowPolicy
+        {
+          DropOldest = ::eCAL::Publisher::SendQueue::eOverflowPolicy::drop_oldest,
+          DropNewest = ::eCAL::Publisher::SendQueue::eOverflowPolicy::drop_newest,
+          Block      = ::eCAL::Publisher::SendQueue::eOverflowPolicy::block
+        };
+
+        /**
+         * @brief Managed wrapper for the native ::eCAL::Publisher::SendQueue::Configuration structure.
+         */
+        public ref class PublisherSendQueueConfiguration {
+        public:
+          property bool Enable;
+          property unsigned int Capacity;
+          property ePublisherSendQueueOverflowPolicy OverflowPolicy;
+
+          PublisherSendQueueConfiguration() {
+            ::eCAL::Publisher::SendQueue::Configuration native_config;
+            Enable = native_config.enable;
+            Capacity = native_config.capacity;
+            OverflowPolicy = static_cast<ePublisherSendQueueOverflowPolicy>(native_config.overflow_policy);
+          }
+
+          // Native struct constructor
+          PublisherSendQueueConfiguration(const ::eCAL::Publisher::SendQueue::Configuration& native_config) {
+            Enable = native_config.enable;
+            Capacity = native_config.capacity;
+            OverflowPolicy = static_cast<ePublisherSendQueueOverflowPolicy>(native_config.overflow_policy);
+          }
+
+          ::eCAL::Publisher::SendQueue::Configuration ToNative() {
+            ::eCAL::Publisher::SendQueue::Configuration native_config;
+            native_config.enable = Enable;
+            native_config.capacity = Capacity;
+            native_config.overflow_policy = static_cast<::eCAL::Publisher::SendQueue::eOverflowPolicy>(OverflowPolicy);
             return native_config;
           }
         };
@@ -164,6 +270,7 @@ namespace Eclipse {
           property PublisherLayerConfiguration^ Layer;
           property List<eTransportLayerType>^ LayerPriorityLocal;
           property List<eTransportLayerType>^ LayerPriorityRemote;
+          property PublisherSendQueueConfiguration^ SendQueue;
 
           PublisherConfiguration() {
             ::eCAL::Publisher::Configuration native_config;
@@ -178,6 +285,8 @@ namespace Eclipse {
             for (auto layer : native_config.layer_priority_remote) {
               LayerPriorityRemote->Add(TransportLayerTypeHelper::FromNative(layer));
             }
+
+            SendQueue = gcnew PublisherSendQueueConfiguration(native_config.send_queue);
           }
 
           // Native struct constructor
@@ -193,6 +302,8 @@ namespace Eclipse {
             for (auto layer : native_config.layer_priority_remote) {
               LayerPriorityRemote->Add(TransportLayerTypeHelper::FromNative(layer));
             }
+
+            SendQueue = gcnew PublisherSendQueueConfiguration(native_config.send_queue);
           }
 
           ::eCAL::Publisher::Configuration ToNative() {
@@ -209,6 +320,8 @@ namespace Eclipse {
               native_config.layer_priority_remote.push_back(TransportLayerTypeHelper::ToNative(layer));
             }
 
+            native_config.send_queue = SendQueue->ToNative();
+
             return native_config;
           }
         };
@@ -223,6 +223,8 @@ namespace Eclipse {
         public:
           property unsigned int RegistrationTimeout;
           property unsigned int RegistrationRefresh;
+          property unsigned int DescriptorRefresh;
+          property bool InterestFilter;
           property bool Loopback;
           property System::String^ ShmTransportDomain;
           property RegistrationLocalConfiguration^ Local;
@@ -232,6 +234,8 @@ namespace Eclipse {
             ::eCAL::Registration::Configuration native_config;
             RegistrationTimeout = native_config.registration_timeout;
             RegistrationRefresh = native_config.registration_refresh;
+            DescriptorRefresh = native_config.descriptor_refresh;
+            InterestFilter = native_config.interest_filter;
             Loopback = native_config.loopback;
             ShmTransportDomain = Internal::StlStringToString(native_config.shm_transport_domain);
             Local = gcnew RegistrationLocalConfiguration(native_config.local);
@@ -242,6 +246,8 @@ namespace Eclipse {
           RegistrationConfiguration(const ::eCAL::Registration::Configuration& native_config) {
             RegistrationTimeout = native_config.registration_timeout;
             RegistrationRefresh = native_config.registration_refresh;
+            DescriptorRefresh = native_config.descriptor_refresh;
+            InterestFilter = native_config.interest_filter;
             Loopback = native_config.loopback;
             ShmTransportDomain = Internal::StlStringToString(native_config.shm_transport_domain);
             Local = gcnew RegistrationLocalConfiguration(native_config.local);
@@ -252,6 +258,8 @@ namespace Eclipse {
             ::eCAL::Registration::Configuration native_config;
             native_config.registration_timeout = RegistrationTimeout;
             native_config.registration_refresh = RegistrationRefresh;
+            native_config.descriptor_refresh = DescriptorRefresh;
+            native_config.interest_filter = InterestFilter;
             native_config.loopback = Loopback;
             native_config.shm_transport_domain = Internal::StringToStlString(ShmTransportDomain);
             native_config.local = Local->ToNative();
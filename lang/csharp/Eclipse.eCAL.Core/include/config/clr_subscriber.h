@@ -101,6 +101,30 @@ namespace Eclipse {
           }
         };
 
+        /**
+         * @brief Managed wrapper for the native ::eCAL::Subscriber::Layer::INPROC::Configuration structure.
+         */
+        public ref class SubscriberLayerINPROCConfiguration {
+        public:
+          property bool Enable;
+
+          SubscriberLayerINPROCConfiguration() {
+            ::eCAL::Subscriber::Layer::INPROC::Configuration native_config;
+            Enable = native_config.enable;
+          }
+
+          // Native struct constructor
+          SubscriberLayerINPROCConfiguration(const ::eCAL::Subscriber::Layer::INPROC::Configuration& native_config) {
+            Enable = native_config.enable;
+          }
+
+          ::eCAL::Subscriber::Layer::INPROC::Configuration ToNative() {
+            ::eCAL::Subscriber::Layer::INPROC::Configuration native_config;
+            native_config.enable = Enable;
+            return native_config;
+          }
+        };
+
         /**
          * @brief Managed wrapper for the native ::eCAL::Subscriber::Layer::Configuration structure.
          */
@@ -109,12 +133,14 @@ namespace Eclipse {
           property SubscriberLayerSHMConfiguration^ SHM;
           property SubscriberLayerUDPConfiguration^ UDP;
           property SubscriberLayerTCPConfiguration^ TCP;
+          property SubscriberLayerINPROCConfiguration^ INPROC;
 
           SubscriberLayerConfiguration() {
             ::eCAL::Subscriber::Layer::Configuration native_config;
             SHM = gcnew SubscriberLayerSHMConfiguration(native_config.shm);
             UDP = gcnew SubscriberLayerUDPConfiguration(native_config.udp);
             TCP = gcnew SubscriberLayerTCPConfiguration(native_config.tcp);
+            INPROC = gcnew SubscriberLayerINPROCConfiguration(native_config.inproc);
           }
 
           // Native struct constructor
@@ -122,6 +148,7 @@ namespace Eclipse {
             SHM = gcnew SubscriberLayerSHMConfiguration(native_config.shm);
             UDP = gcnew SubscriberLayerUDPConfiguration(native_config.udp);
             TCP = gcnew SubscriberLayerTCPConfiguration(native_config.tcp);
+            INPROC = gcnew SubscriberLayerINPROCConfiguration(native_config.inproc);
           }
 
           ::eCAL::Subscriber::Layer::Configuration ToNative() {
@@ -129,6 +156,7 @@ namespace Eclipse {
             native_config.shm = SHM->ToNative();
             native_config.udp = UDP->ToNative();
             native_config.tcp = TCP->ToNative();
+            native_config.inproc = INPROC->ToNative();
             return native_config;
           }
         };
@@ -140,23 +168,31 @@ namespace Eclipse {
         public:
           property SubscriberLayerConfiguration^ Layer;
           property bool DropOutOfOrderMessages;
+          property unsigned int HistoryDepth;
+          property double MaxFrequency;
 
           SubscriberConfiguration() {
             ::eCAL::Subscriber::Configuration native_config;
             Layer = gcnew SubscriberLayerConfiguration(native_config.layer);
             DropOutOfOrderMessages = native_config.drop_out_of_order_messages;
+            HistoryDepth = native_config.history_depth;
+            MaxFrequency = native_config.max_frequency;
           }
 
           // Native struct constructor
           SubscriberConfiguration(const ::eCAL::Subscriber::Configuration& native_config) {
             Layer = gcnew SubscriberLayerConfiguration(native_config.layer);
             DropOutOfOrderMessages = native_config.drop_out_of_order_messages;
+            HistoryDepth = native_config.history_depth;
+            MaxFrequency = native_config.max_frequency;
           }
 
           ::eCAL::Subscriber::Configuration ToNative() {
             ::eCAL::Subscriber::Configuration native_config;
             native_config.layer = Layer->ToNative();
             native_config.drop_out_of_order_messages = DropOutOfOrderMessages;
+            native_config.history_depth = HistoryDepth;
+            native_config.max_frequency = MaxFrequency;
             return native_config;
           }
         };
@@ -38,7 +38,8 @@ namespace Eclipse {
           None = ::eCAL::TransportLayer::eType::none,
           UdpMc = ::eCAL::TransportLayer::eType::udp_mc,
           Shm = ::eCAL::TransportLayer::eType::shm,
-          Tcp = ::eCAL::TransportLayer::eType::tcp
+          Tcp = ::eCAL::TransportLayer::eType::tcp,
+          InProc = ::eCAL::TransportLayer::eType::inproc
         };
 
         /**
@@ -52,7 +52,8 @@ namespace Eclipse {
         None   = ::eCAL::Monitoring::eTransportLayerType::none,   ///< No transport layer
         UdpMc  = ::eCAL::Monitoring::eTransportLayerType::udp_mc, ///< UDP multicast transport layer
         Shm    = ::eCAL::Monitoring::eTransportLayerType::shm,    ///< Shared memory transport layer
-        Tcp    = ::eCAL::Monitoring::eTransportLayerType::tcp     ///< TCP transport layer
+        Tcp    = ::eCAL::Monitoring::eTransportLayerType::tcp,    ///< TCP transport layer
+        InProc = ::eCAL::Monitoring::eTransportLayerType::inproc  ///< Inner process transport layer
       };
 
       /**
@@ -38,24 +38,63 @@ void AddConfigPublisher(nanobind::module_& module)
     .def_rw("memfile_min_size_bytes", &Layer::SHM::Configuration::memfile_min_size_bytes,
       "Default memory file size for new publishers")
     .def_rw("memfile_reserve_percent", &Layer::SHM::Configuration::memfile_reserve_percent,
-      "Dynamic memory file size reserve before recreation");
+      "Dynamic memory file size reserve before recreation")
+    .def_rw("memfile_huge_pages", &Layer::SHM::Configuration::memfile_huge_pages,
+      "Request transparent huge pages for memory files (Linux only)")
+    .def_rw("memfile_prefault", &Layer::SHM::Configuration::memfile_prefault,
+      "Pre-fault memory file pages on creation (Linux only)")
+    .def_rw("memfile_lock", &Layer::SHM::Configuration::memfile_lock,
+      "Lock memory file pages in RAM (Linux only)")
+    .def_rw("memfile_numa_local", &Layer::SHM::Configuration::memfile_numa_local,
+      "Bind memory file pages to the NUMA node of the publishing thread (Linux only)");
 
   // Bind Publisher::Layer::UDP::Configuration struct
   nb::class_<Layer::UDP::Configuration>(module, "PublisherLayerUDPConfiguration")
     .def(nb::init<>()) // Default constructor
-    .def_rw("enable", &Layer::UDP::Configuration::enable, "Enable UDP layer");
+    .def_rw("enable", &Layer::UDP::Configuration::enable, "Enable UDP layer")
+    .def_rw("retransmit_window", &Layer::UDP::Configuration::retransmit_window,
+      "Number of sent samples kept to repair losses reported by subscribers (0 = no repair, Default: 0)")
+    .def_rw("repair_rate_limit", &Layer::UDP::Configuration::repair_rate_limit,
+      "Maximum rate of repaired samples in bytes per second (0 = unlimited, Default: 10 MB/s)")
+    .def_rw("coalescing_latency_us", &Layer::UDP::Configuration::coalescing_latency_us,
+      "Maximum time in microseconds small samples are held back to be sent together in one datagram (0 = no coalescing, Default: 0)")
+    .def_rw("coalescing_max_size", &Layer::UDP::Configuration::coalescing_max_size,
+      "Maximum size of a coalesced datagram, larger samples are sent directly (Default: 1400)");
 
   // Bind Publisher::Layer::TCP::Configuration struct
   nb::class_<Layer::TCP::Configuration>(module, "PublisherLayerTCPConfiguration")
     .def(nb::init<>()) // Default constructor
-    .def_rw("enable", &Layer::TCP::Configuration::enable, "Enable TCP layer");
+    .def_rw("enable", &Layer::TCP::Configuration::enable, "Enable TCP layer")
+    .def_rw("multiplexed", &Layer::TCP::Configuration::multiplexed,
+      "Share one connection per subscribing process with all multiplexed TCP publishers of this process (Default: False)");
+
+  // Bind Publisher::Layer::INPROC::Configuration struct
+  nb::class_<Layer::INPROC::Configuration>(module, "PublisherLayerINPROCConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("enable", &Layer::INPROC::Configuration::enable, "Enable inner process layer");
 
   // Bind Publisher::Layer::Configuration struct
   nb::class_<Layer::Configuration>(module, "PublisherLayerConfiguration")
     .def(nb::init<>()) // Default constructor
     .def_rw("shm", &Layer::Configuration::shm, "Shared Memory (SHM) layer configuration")
     .def_rw("udp", &Layer::Configuration::udp, "UDP layer configuration")
-    .def_rw("tcp", &Layer::Configuration::tcp, "TCP layer configuration");
+    .def_rw("tcp", &Layer::Configuration::tcp, "TCP layer configuration")
+    .def_rw("inproc", &Layer::Configuration::inproc, "Inner process layer configuration");
+
+  // Bind Publisher::SendQueue::eOverflowPolicy enum
+  nb::enum_<SendQueue::eOverflowPolicy>(module, "PublisherSendQueueOverflowPolicy")
+    .value("DROP_OLDEST", SendQueue::eOverflowPolicy::drop_oldest)
+    .value("DROP_NEWEST", SendQueue::eOverflowPolicy::drop_newest)
+    .value("BLOCK", SendQueue::eOverflowPolicy::block);
+
+  // Bind Publisher::SendQueue::Configuration struct
+  nb::class_<SendQueue::Configuration>(module, "PublisherSendQueueConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("enable", &SendQueue::Configuration::enable,
+      "Send enqueues the payload, a writer thread hands it to the transport layers")
+    .def_rw("capacity", &SendQueue::Configuration::capacity, "Maximum number of queued samples")
+    .def_rw("overflow_policy", &SendQueue::Configuration::overflow_policy,
+      "Behavior of the send call if the queue is full");
 
   // Bind Publisher::Configuration struct
   nb::class_<Configuration>(module, "PublisherConfiguration")
@@ -64,5 +103,6 @@ void AddConfigPublisher(nanobind::module_& module)
     .def_rw("layer_priority_local", &Configuration::layer_priority_local,
       "Transport layer priority for local communication")
     .def_rw("layer_priority_remote", &Configuration::layer_priority_remote,
-      "Transport layer priority for remote communication");
+      "Transport layer priority for remote communication")
+    .def_rw("send_queue", &Configuration::send_queue, "Asynchronous send queue configuration");
 }
@@ -40,17 +40,27 @@ void AddConfigSubscriber(nanobind::module_& module)
     .def(nb::init<>()) // Default constructor
     .def_rw("enable", &Layer::TCP::Configuration::enable, "Enable TCP layer (Default: false)");
 
+  // Bind Subscriber::Layer::INPROC::Configuration struct
+  nb::class_<Layer::INPROC::Configuration>(module, "SubscriberLayerINPROCConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("enable", &Layer::INPROC::Configuration::enable, "Enable inner process layer (Default: true)");
+
   // Bind Subscriber::Layer::Configuration struct
   nb::class_<Layer::Configuration>(module, "SubscriberLayerConfiguration")
     .def(nb::init<>()) // Default constructor
     .def_rw("shm", &Layer::Configuration::shm, "Shared Memory (SHM) layer configuration")
     .def_rw("udp", &Layer::Configuration::udp, "UDP layer configuration")
-    .def_rw("tcp", &Layer::Configuration::tcp, "TCP layer configuration");
+    .def_rw("tcp", &Layer::Configuration::tcp, "TCP layer configuration")
+    .def_rw("inproc", &Layer::Configuration::inproc, "Inner process layer configuration");
 
   // Bind Subscriber::Configuration struct
   nb::class_<Configuration>(module, "SubscriberConfiguration")
     .def(nb::init<>()) // Default constructor
     .def_rw("layer", &Configuration::layer, "Layer configuration for subscriber")
     .def_rw("drop_out_of_order_messages", &Configuration::drop_out_of_order_messages,
-      "Enable dropping of out-of-order messages (Default: true)");
+      "Enable dropping of out-of-order messages (Default: true)")
+    .def_rw("history_depth", &Configuration::history_depth,
+      "Number of received samples kept for take/peek/read_batch (0 = no history, Default: 0)")
+    .def_rw("max_frequency", &Configuration::max_frequency,
+      "Maximum data frequency in Hz needed by this subscriber, publishers skip network sends above it (0 = unlimited, Default: 0)");
 }
@@ -51,6 +51,7 @@ void AddTypesMonitoring(nanobind::module_& m)
     .value("UDP_MC", eTransportLayerType::udp_mc)
     .value("SHM", eTransportLayerType::shm)
     .value("TCP", eTransportLayerType::tcp)
+    .value("INPROC", eTransportLayerType::inproc)
     .export_values();
 
   // Transport Layer
@@ -65,6 +65,7 @@ namespace EcalUtils
       Type GetType() const;
 
       int64_t FileSize() const;
+      int64_t ModificationTimeNs() const; // nanoseconds since epoch, with second resolution on some platforms
 
       bool PermissionRootRead()     const;
       bool PermissionRootWrite()    const;
@@ -0,0 +1,60 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace EcalUtils
+{
+  /**
+   * @brief Read-only memory mapping of an entire file
+   *
+   * The mapping stays valid as long as the object exists, even if the file is
+   * renamed or deleted in the meantime. If the file cannot be mapped (e.g.
+   * because it does not exist or is empty), Data() returns nullptr.
+   */
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    // Copy
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Move
+    MappedFile(MappedFile&&)                 = delete;
+    MappedFile& operator=(MappedFile&&)      = delete;
+
+    const char* Data() const { return data_; }
+    size_t      Size() const { return size_; }
+
+  private:
+#ifdef _WIN32
+    void*       file_handle_;       // HANDLE
+    void*       mapping_handle_;    // HANDLE
+#endif // _WIN32
+    const char* data_;
+    size_t      size_;
+  };
+}
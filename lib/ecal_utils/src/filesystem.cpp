@@ -113,6 +113,20 @@ namespace EcalUtils
       return file_status_.st_size;
     }
 
+    int64_t FileStatus::ModificationTimeNs() const
+    {
+      if (!is_ok_)
+        return 0;
+
+#if defined(__linux__) || defined(__FreeBSD__)
+      return static_cast<int64_t>(file_status_.st_mtim.tv_sec) * 1000000000LL + file_status_.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+      return static_cast<int64_t>(file_status_.st_mtimespec.tv_sec) * 1000000000LL + file_status_.st_mtimespec.tv_nsec;
+#else
+      return static_cast<int64_t>(file_status_.st_mtime) * 1000000000LL;
+#endif
+    }
+
 #ifdef _WIN32
     bool FileStatus::PermissionRootRead()     const { return 0 != (file_status_.st_mode & S_IREAD); }
     bool FileStatus::PermissionRootWrite()    const { return 0 != (file_status_.st_mode & S_IWRITE); }
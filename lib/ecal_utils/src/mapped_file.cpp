@@ -0,0 +1,93 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <ecal_utils/mapped_file.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif // NOMINMAX
+#include <windows.h>
+#include <ecal_utils/str_convert.h>
+#else // _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace EcalUtils
+{
+  MappedFile::MappedFile(const std::string& path)
+#ifdef _WIN32
+    : file_handle_   (INVALID_HANDLE_VALUE)
+    , mapping_handle_(nullptr)
+    , data_          (nullptr)
+#else // _WIN32
+    : data_          (nullptr)
+#endif // _WIN32
+    , size_          (0)
+  {
+#ifdef _WIN32
+    const std::wstring w_path = StrConvert::Utf8ToWide(path);
+    file_handle_ = ::CreateFileW(w_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle_ == INVALID_HANDLE_VALUE) return;
+
+    LARGE_INTEGER file_size;
+    if ((::GetFileSizeEx(file_handle_, &file_size) == 0) || (file_size.QuadPart <= 0)) return;
+
+    mapping_handle_ = ::CreateFileMappingW(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle_ == nullptr) return;
+
+    data_ = static_cast<const char*>(::MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+    if (data_ != nullptr) size_ = static_cast<size_t>(file_size.QuadPart);
+#else // _WIN32
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+
+    struct stat file_status;
+    if ((::fstat(fd, &file_status) == 0) && (file_status.st_size > 0))
+    {
+      void* address = ::mmap(nullptr, static_cast<size_t>(file_status.st_size), PROT_READ, MAP_SHARED, fd, 0);
+      if (address != MAP_FAILED)
+      {
+        data_ = static_cast<const char*>(address);
+        size_ = static_cast<size_t>(file_status.st_size);
+      }
+    }
+    // The mapping stays valid after closing the file descriptor
+    ::close(fd);
+#endif // _WIN32
+  }
+
+  MappedFile::~MappedFile()
+  {
+#ifdef _WIN32
+    if (data_ != nullptr)                     ::UnmapViewOfFile(data_);
+    if (mapping_handle_ != nullptr)           ::CloseHandle(mapping_handle_);
+    if (file_handle_ != INVALID_HANDLE_VALUE) ::CloseHandle(file_handle_);
+#else // _WIN32
+    if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+#endif // _WIN32
+  }
+}
@@ -0,0 +1,87 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2026 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include <gtest/gtest.h>
+
+#include <ecal_utils/mapped_file.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace
+{
+  const std::string kTestFilePath = "ecal_utils_mapped_file_test.bin";
+
+  void WriteTestFile(const std::string& content)
+  {
+    std::ofstream file(kTestFilePath, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+}
+
+using namespace EcalUtils;
+
+TEST(MappedFile, MapsFileContent)
+{
+  const std::string content("mapped\0content", 14);
+  WriteTestFile(content);
+
+  {
+    const MappedFile mapped_file(kTestFilePath);
+    ASSERT_NE(mapped_file.Data(), nullptr);
+    ASSERT_EQ(mapped_file.Size(), content.size());
+    EXPECT_EQ(std::string(mapped_file.Data(), mapped_file.Size()), content);
+  }
+
+  std::remove(kTestFilePath.c_str());
+}
+
+TEST(MappedFile, StaysValidAfterRemovingTheFile)
+{
+  const std::string content("content of a removed file");
+  WriteTestFile(content);
+
+  const MappedFile mapped_file(kTestFilePath);
+  ASSERT_NE(mapped_file.Data(), nullptr);
+
+  EXPECT_EQ(std::remove(kTestFilePath.c_str()), 0);
+  EXPECT_EQ(std::string(mapped_file.Data(), mapped_file.Size()), content);
+}
+
+TEST(MappedFile, EmptyFile)
+{
+  WriteTestFile("");
+
+  {
+    const MappedFile mapped_file(kTestFilePath);
+    EXPECT_EQ(mapped_file.Data(), nullptr);
+    EXPECT_EQ(mapped_file.Size(), 0u);
+  }
+
+  std::remove(kTestFilePath.c_str());
+}
+
+TEST(MappedFile, MissingFile)
+{
+  const MappedFile mapped_file("ecal_utils_mapped_file_test_missing.bin");
+  EXPECT_EQ(mapped_file.Data(), nullptr);
+  EXPECT_EQ(mapped_file.Size(), 0u);
+}
@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <limits>
+#include <random>
 #include <set>
 #include <thread>
 #include <sstream>
@@ -392,6 +394,130 @@ TEST(contrib, HDF5_WriteReadIntegrity)
   }
 }
 
+TEST(contrib, HDF5_WriteReadCompressed)
+{
+  // LZ4 falls back to DEFLATE, so DEFLATE is all that is needed
+  if (!eCAL::eh5::IsCompressionAvailable(eCAL::eh5::eCompression::DEFLATE))
+  {
+    GTEST_SKIP() << "HDF5 has been built without the DEFLATE (zlib) filter";
+  }
+
+  const std::string base_name_compressed   = "compressed_meas";
+  const std::string base_name_uncompressed = "uncompressed_meas";
+
+  // Highly compressible entries, one entry that is too small to be compressed
+  // and one that does not shrink and is stored as it is
+  TestingMeasEntry deflate_entry{ { "deflate_topic", 1 }, "", 1001LL, 2001LL, 0, 11LL };
+  TestingMeasEntry lz4_entry    { { "lz4_topic",     2 }, "", 1002LL, 2002LL, 0, 12LL };
+  TestingMeasEntry small_entry  { { "deflate_topic", 1 }, "tiny", 1003LL, 2003LL, 0, 13LL };
+  TestingMeasEntry random_entry { { "deflate_topic", 1 }, "", 1004LL, 2004LL, 0, 14LL };
+  for (int i = 0; i < 2000; ++i)
+  {
+    deflate_entry.data += "{\"value\": " + std::to_string(i % 10) + "}\n";
+    lz4_entry.data     += "occupancy grid cell free;";
+  }
+  std::mt19937 random_generator(42);
+  for (int i = 0; i < 4096; ++i)
+  {
+    random_entry.data += static_cast<char>(random_generator() & 0xFF);
+  }
+  const std::vector<TestingMeasEntry> meas_entries{ deflate_entry, lz4_entry, small_entry, random_entry };
+
+  // Write the same entries compressed and uncompressed
+  for (bool compressed : { true, false })
+  {
+    const std::string base_name = (compressed ? base_name_compressed : base_name_uncompressed);
+
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, output_dir + "/" + base_name, base_name);
+
+    if (compressed)
+    {
+      hdf5_writer.SetChannelCompression(deflate_entry.channel, eCAL::eh5::eCompression::DEFLATE);
+      // Falls back to deflate, if the LZ4 filter plugin is not available
+      hdf5_writer.SetChannelCompression(lz4_entry.channel, eCAL::eh5::eCompression::LZ4);
+    }
+
+    for (const auto& entry : meas_entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // Decompression is transparent for the reader
+  {
+    MeasAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(output_dir + "/" + base_name_compressed));
+
+    for (const auto& entry : meas_entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+
+  // The compressed file must be considerably smaller
+  auto file_size = [](const std::string& path) -> long long
+  {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return static_cast<long long>(file.tellg());
+  };
+  const long long compressed_size   = file_size(output_dir + "/" + base_name_compressed   + "/" + base_name_compressed   + ".hdf5");
+  const long long uncompressed_size = file_size(output_dir + "/" + base_name_uncompressed + "/" + base_name_uncompressed + ".hdf5");
+  EXPECT_GT(compressed_size, 0);
+  EXPECT_LT(compressed_size + static_cast<long long>(deflate_entry.data.size()), uncompressed_size);
+}
+
+TEST(contrib, HDF5_ReadDataView)
+{
+  const std::string base_name = "data_view_meas";
+
+  TestingMeasEntry plain_entry     { { "plain_topic",      1 }, "plain data",   1001LL, 2001LL, 0, 11LL };
+  TestingMeasEntry empty_entry     { { "plain_topic",      1 }, "",             1002LL, 2002LL, 0, 12LL };
+  TestingMeasEntry compressed_entry{ { "compressed_topic", 2 }, "",             1003LL, 2003LL, 0, 13LL };
+  for (int i = 0; i < 1000; ++i)
+    compressed_entry.data += "compressible;";
+  const std::vector<TestingMeasEntry> meas_entries{ plain_entry, empty_entry, compressed_entry };
+
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, output_dir + "/" + base_name, base_name);
+    hdf5_writer.SetChannelCompression(compressed_entry.channel, eCAL::eh5::eCompression::DEFLATE);
+
+    for (const auto& entry : meas_entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  std::vector<eCAL::eh5::EntryDataView> views;
+  {
+    MeasAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(output_dir + "/" + base_name));
+
+    for (const auto& entry : meas_entries)
+    {
+      eCAL::eh5::EntryInfoSet entries;
+      EXPECT_TRUE(hdf5_reader.GetEntriesInfo(entry.channel, entries));
+      const auto entry_info = FindInSet(entries, entry);
+
+      eCAL::eh5::EntryDataView view;
+      EXPECT_TRUE(hdf5_reader.GetEntryDataView(entry_info.ID, view));
+      EXPECT_EQ(std::string(view.begin(), view.end()), entry.data);
+      views.push_back(view);
+    }
+
+    EXPECT_TRUE(hdf5_reader.Close());
+  }
+
+  // The views keep the data alive after the measurement has been closed
+  for (size_t i = 0; i < meas_entries.size(); ++i)
+  {
+    EXPECT_EQ(std::string(views[i].begin(), views[i].end()), meas_entries[i].data);
+  }
+}
+
 TEST(contrib, HDF5_ReadWrite)
 {
   std::string file_name = "meas_readwrite";
@@ -1108,6 +1234,133 @@ TEST(HDF5, TestReaderWriterV5)
 
 
 
+TEST(HDF5, TimeIndexRange)
+{
+  eCAL::eh5::SChannel channel{ "topic", 0xAAAA };
+
+  // 5 seconds of data, one entry every 10 ms. Two entries are added out of order.
+  std::vector<TestingMeasEntry> meas_entries;
+  for (long long i = 0; i < 500; ++i)
+  {
+    const long long rcv_timestamp = i * 10000;
+    meas_entries.push_back(TestingMeasEntry{ channel, std::to_string(rcv_timestamp), rcv_timestamp, rcv_timestamp, 0, i });
+  }
+  std::swap(meas_entries[200], meas_entries[201]);
+
+  std::string base_name = "time_index_range";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // Write HDF5 file
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, meas_root_dir, base_name);
+
+    for (const auto& entry : meas_entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // Read a time range with HDF5 dir API
+  {
+    MeasAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+    EXPECT_TRUE(hdf5_reader.HasTimeIndex(channel));
+
+    EXPECT_EQ(hdf5_reader.GetMinTimestamp(channel), 0);
+    EXPECT_EQ(hdf5_reader.GetMaxTimestamp(channel), 4990000);
+
+    eCAL::eh5::EntryInfoSet entries;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange(channel, 1234567, 3450000, entries));
+    ASSERT_EQ(entries.size(), 222);
+    EXPECT_EQ(entries.begin()->RcvTimestamp, 1240000);
+    EXPECT_EQ(entries.rbegin()->RcvTimestamp, 3450000);
+
+    for (const auto& entry : entries)
+    {
+      std::string data;
+      EXPECT_TRUE(hdf5_reader.GetEntryDataAsString(entry.ID, data));
+      EXPECT_EQ(data, std::to_string(entry.RcvTimestamp));
+    }
+
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfo(channel, entries));
+    EXPECT_EQ(entries.size(), meas_entries.size());
+  }
+
+  // The V5 writer of the legacy API (used by eCAL Rec) writes a time index as well
+  {
+    std::string legacy_dir = meas_root_dir + "_v5";
+    {
+      LegacyAPI hdf5_writer;
+      CreateMeasurement<LegacyAPI, LegacyAPIAccess>(hdf5_writer, legacy_dir, base_name);
+      for (const auto& entry : meas_entries)
+      {
+        EXPECT_TRUE(WriteToHDF(hdf5_writer, TestingMeasEntry{ { channel.name, 0 }, entry.data, entry.snd_timestamp, entry.rcv_timestamp, entry.snd_id, entry.clock }));
+      }
+      EXPECT_TRUE(hdf5_writer.Close());
+    }
+
+    LegacyAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(legacy_dir));
+    EXPECT_EQ(hdf5_reader.GetFileVersion(), "5.0");
+    EXPECT_TRUE(hdf5_reader.HasTimeIndex(channel.name));
+
+    EXPECT_EQ(hdf5_reader.GetMinTimestamp(channel.name), 0);
+    EXPECT_EQ(hdf5_reader.GetMaxTimestamp(channel.name), 4990000);
+
+    eCAL::eh5::EntryInfoSet entries;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange(channel.name, 1234567, 3450000, entries));
+    ASSERT_EQ(entries.size(), 222);
+    EXPECT_EQ(entries.begin()->RcvTimestamp, 1240000);
+    EXPECT_EQ(entries.rbegin()->RcvTimestamp, 3450000);
+
+    for (const auto& entry : entries)
+    {
+      std::string data;
+      EXPECT_TRUE(hdf5_reader.GetEntryDataAsString(entry.ID, data));
+      EXPECT_EQ(data, std::to_string(entry.RcvTimestamp));
+    }
+  }
+}
+
+TEST(HDF5, TimeIndexEmptyChannel)
+{
+  eCAL::eh5::SChannel channel_a{ "topic_a", 0xAAAA };
+  eCAL::eh5::SChannel channel_b{ "topic_b", 0xBBBB };
+
+  std::string base_name = "time_index_empty_channel";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // The entry of channel b does not fit into the first file anymore. The
+  // second file then also holds channel a, but without any entries.
+  const std::string data(600 * 1024, 'x');
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, meas_root_dir, base_name);
+    hdf5_writer.SetMaxSizePerFile(1);
+
+    EXPECT_TRUE(WriteToHDF(hdf5_writer, TestingMeasEntry{ channel_a, data, 5000, 5000, 0, 0 }));
+    EXPECT_TRUE(WriteToHDF(hdf5_writer, TestingMeasEntry{ channel_b, data, 6000, 6000, 0, 0 }));
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  MeasAPI hdf5_reader;
+  EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+  ASSERT_TRUE(hdf5_reader.HasTimeIndex(channel_a));
+
+  // The empty channel of the second file must not count as timestamp 0
+  EXPECT_EQ(hdf5_reader.GetMinTimestamp(channel_a), 5000);
+  EXPECT_EQ(hdf5_reader.GetMaxTimestamp(channel_a), 5000);
+  EXPECT_EQ(hdf5_reader.GetMinTimestamp(channel_b), 6000);
+  EXPECT_EQ(hdf5_reader.GetMaxTimestamp(channel_b), 6000);
+
+  eCAL::eh5::EntryInfoSet entries;
+  EXPECT_TRUE(hdf5_reader.GetEntriesInfo(channel_a, entries));
+  EXPECT_EQ(entries.size(), 1);
+}
+
 TEST(HDF5, ParsePrintHex)
 {
   std::vector<std::string> hex_values =
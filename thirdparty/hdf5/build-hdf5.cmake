@@ -23,7 +23,7 @@ include_guard(GLOBAL)
   set(ONLY_SHARED_LIBS          ON CACHE BOOL  "Only Build Shared Libraries" FORCE)
   set(HDF5_ENABLE_THREADSAFE    ON  CACHE BOOL "Enable thread-safety" FORCE)
   set(HDF5_ENABLE_SZIP_SUPPORT  OFF  CACHE BOOL "Disable szip support" FORCE) 
-  set(HDF5_ENABLE_Z_LIB_SUPPORT OFF  CACHE BOOL "Disable zlib support" FORCE)   
+  set(HDF5_ENABLE_Z_LIB_SUPPORT ON   CACHE BOOL "Enable zlib support (DEFLATE compression of measurement entries)" FORCE)
   set(BUILD_TESTING             OFF CACHE BOOL "Do not build HDF5 Unit Testing" FORCE)
   set(HDF5_BUILD_UTILS          OFF CACHE BOOL "Do not build HDF5 Utils" FORCE)
   set(HDF5_BUILD_TOOLS          OFF CACHE BOOL "Do not build HDF5 Tools" FORCE)